@@ -43,6 +43,167 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 	return 0;
 }
 
+static void *spsc_block_ptr(struct data_fifo *data_fifo, atomic_val_t cnt)
+{
+	return data_fifo->slab_buffer +
+	       ((uint32_t)cnt % data_fifo->elements_max) * data_fifo->block_size_max;
+}
+
+static struct data_fifo_msgq *spsc_block_info(struct data_fifo *data_fifo, atomic_val_t cnt)
+{
+	return (struct data_fifo_msgq *)data_fifo->msgq_buffer +
+	       ((uint32_t)cnt % data_fifo->elements_max);
+}
+
+static bool spsc_vacant_available(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	return (uint32_t)(atomic_get(&ring->claimed) - atomic_get(&ring->freed)) <
+	       data_fifo->elements_max;
+}
+
+static bool spsc_filled_available(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	return atomic_get(&ring->fetched) != atomic_get(&ring->locked);
+}
+
+/* Wake up the other side if it waits for the block that was just handed over. */
+static void spsc_notify(atomic_t *waiting, struct k_sem *sem)
+{
+	if (atomic_get(waiting)) {
+		k_sem_give(sem);
+	}
+}
+
+/* The waiting flag is set before the condition is checked again, so a block handed over
+ * by the other side in the meantime is either seen here or results in a semaphore give.
+ */
+static int spsc_wait(struct data_fifo *data_fifo, bool (*available)(struct data_fifo *),
+		     atomic_t *waiting, struct k_sem *sem, k_timeout_t timeout)
+{
+	uint64_t end = sys_clock_timeout_end_calc(timeout);
+	int ret = 0;
+
+	while (!available(data_fifo)) {
+		k_timeout_t remaining = K_FOREVER;
+
+		if (!K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+			int64_t ticks_left = end - sys_clock_tick_get();
+
+			if (ticks_left <= 0) {
+				ret = -EAGAIN;
+				break;
+			}
+
+			remaining = K_TICKS(ticks_left);
+		}
+
+		atomic_set(waiting, true);
+		if (!available(data_fifo)) {
+			(void)k_sem_take(sem, remaining);
+		}
+		atomic_set(waiting, false);
+	}
+
+	return ret;
+}
+
+static int spsc_vacant_get(struct data_fifo *data_fifo, void **data, k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	if (!spsc_vacant_available(data_fifo)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMEM;
+		}
+
+		int ret = spsc_wait(data_fifo, spsc_vacant_available, &ring->producer_waiting,
+				    &ring->producer_sem, timeout);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	*data = spsc_block_ptr(data_fifo, atomic_get(&ring->claimed));
+	atomic_inc(&ring->claimed);
+
+	return 0;
+}
+
+static void spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	atomic_val_t locked = atomic_get(&ring->locked);
+
+	__ASSERT(*data == spsc_block_ptr(data_fifo, locked), "Blocks must be locked in order");
+	__ASSERT_NO_MSG(locked != atomic_get(&ring->claimed));
+
+	spsc_block_info(data_fifo, locked)->size = size;
+	atomic_inc(&ring->locked);
+
+	spsc_notify(&ring->consumer_waiting, &ring->consumer_sem);
+}
+
+static int spsc_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+			   k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	if (!spsc_filled_available(data_fifo)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		int ret = spsc_wait(data_fifo, spsc_filled_available, &ring->consumer_waiting,
+				    &ring->consumer_sem, timeout);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	atomic_val_t fetched = atomic_get(&ring->fetched);
+
+	*data = spsc_block_ptr(data_fifo, fetched);
+	*size = spsc_block_info(data_fifo, fetched)->size;
+	atomic_inc(&ring->fetched);
+
+	return 0;
+}
+
+static void spsc_block_free(struct data_fifo *data_fifo, void **data)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	atomic_val_t freed = atomic_get(&ring->freed);
+
+	__ASSERT(*data == spsc_block_ptr(data_fifo, freed), "Blocks must be freed in order");
+	__ASSERT_NO_MSG(freed != atomic_get(&ring->fetched));
+
+	atomic_inc(&ring->freed);
+
+	spsc_notify(&ring->producer_waiting, &ring->producer_sem);
+}
+
+static void spsc_init(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	/* The counters run freely, so the slot index stays continuous on wrap-around */
+	__ASSERT(IS_POWER_OF_TWO(data_fifo->elements_max),
+		 "SPSC data_fifo requires a power of two number of elements");
+
+	atomic_set(&ring->claimed, 0);
+	atomic_set(&ring->locked, 0);
+	atomic_set(&ring->fetched, 0);
+	atomic_set(&ring->freed, 0);
+	atomic_set(&ring->producer_waiting, false);
+	atomic_set(&ring->consumer_waiting, false);
+	k_sem_init(&ring->producer_sem, 0, 1);
+	k_sem_init(&ring->consumer_sem, 0, 1);
+}
+
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout)
 {
@@ -50,6 +211,10 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+	if (data_fifo->spsc) {
+		return spsc_vacant_get(data_fifo, data, timeout);
+	}
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
@@ -68,6 +233,11 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+	if (data_fifo->spsc) {
+		spsc_block_lock(data_fifo, data, size);
+		return 0;
+	}
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -93,6 +263,10 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+	if (data_fifo->spsc) {
+		return spsc_filled_get(data_fifo, data, size, timeout);
+	}
+
 	struct data_fifo_msgq msgq_tmp;
 
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
@@ -110,6 +284,11 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void **data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+	if (data_fifo->spsc) {
+		spsc_block_free(data_fifo, data);
+		return;
+	}
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -122,6 +301,23 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+	if (data_fifo->spsc) {
+		struct data_fifo_spsc *ring = &data_fifo->ring;
+
+		/* Read each counter before the one it is compared against is written
+		 * by the other side, so the difference never underflows.
+		 */
+		atomic_val_t freed = atomic_get(&ring->freed);
+		atomic_val_t fetched = atomic_get(&ring->fetched);
+		atomic_val_t locked = atomic_get(&ring->locked);
+		atomic_val_t claimed = atomic_get(&ring->claimed);
+
+		*locked_num = (uint32_t)(locked - fetched);
+		*alloced_num = (uint32_t)(claimed - freed);
+
+		return 0;
+	}
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -158,6 +354,12 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 		data_fifo_block_free(data_fifo, &old_data);
 	}
 
+	if (data_fifo->spsc) {
+		/* Reset the counters to drop blocks claimed but not locked */
+		spsc_init(data_fifo);
+		return 0;
+	}
+
 	/* Re-init k_mem_slab to reset the number of alloced slabs */
 	ret = k_mem_slab_init(&data_fifo->mem_slab, data_fifo->slab_buffer,
 			      data_fifo->block_size_max, data_fifo->elements_max);
@@ -178,6 +380,12 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+	if (data_fifo->spsc) {
+		spsc_init(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
@@ -19,6 +19,25 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+/* Free-running block counters of the lock-free single-producer single-consumer ring.
+ * Block with counter value n is stored at index n % elements_max.
+ */
+struct data_fifo_spsc {
+	/* Number of blocks handed out to the producer. Written by the producer only. */
+	atomic_t claimed;
+	/* Number of blocks locked by the producer. Written by the producer only. */
+	atomic_t locked;
+	/* Number of blocks handed out to the consumer. Written by the consumer only. */
+	atomic_t fetched;
+	/* Number of blocks freed by the consumer. Written by the consumer only. */
+	atomic_t freed;
+	/* Set while the producer or the consumer waits for the other side. */
+	atomic_t producer_waiting;
+	atomic_t consumer_waiting;
+	struct k_sem producer_sem;
+	struct k_sem consumer_sem;
+};
+
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
@@ -27,9 +46,12 @@ struct data_fifo {
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+	/* Use the lock-free ring instead of the slab and the message queue. */
+	bool spsc;
+	struct data_fifo_spsc ring;
 };
 
-#define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
+#define _DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in, spsc_in)                      \
 	char __aligned(WB_UP(1))                                                                   \
 		_msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = { 0 };    \
 	char __aligned(WB_UP(1))                                                                   \
@@ -38,7 +60,28 @@ struct data_fifo {
 				  .slab_buffer = _slab_buffer_##name,                              \
 				  .block_size_max = block_size_max_in,                             \
 				  .elements_max = elements_max_in,                                 \
-				  .initialized = false }
+				  .initialized = false,                                            \
+				  .spsc = spsc_in }
+
+#define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
+	_DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in, false)
+
+/**
+ * @brief Define a data_fifo using a lock-free single-producer single-consumer ring.
+ *
+ * The FIFO has the same API as the one defined with DATA_FIFO_DEFINE, but no kernel
+ * objects are used unless a call has to wait. The following restrictions apply:
+ * - elements_max_in must be a power of two.
+ * - data_fifo_pointer_first_vacant_get and data_fifo_block_lock must be called from
+ *   a single context (the producer). Blocks must be locked in the order they were
+ *   given out.
+ * - data_fifo_pointer_last_filled_get and data_fifo_block_free must be called from
+ *   a single context (the consumer). Blocks must be freed in the order they were
+ *   given out.
+ * - data_fifo_empty must not be called while the producer or consumer is active.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	_DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in, true)
 
 /**
  * @brief Get pointer to first vacant block in slab.
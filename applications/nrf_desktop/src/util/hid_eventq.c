@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include "hid_eventq.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(hid_eventq, CONFIG_DESKTOP_HID_STATE_LOG_LEVEL);
+
+
+static struct hid_eventq_event *eventq_at(struct hid_eventq *eventq, size_t pos)
+{
+	__ASSERT_NO_MSG(pos < eventq->len);
+
+	return &eventq->events[(eventq->head + pos) % ARRAY_SIZE(eventq->events)];
+}
+
+const struct hid_eventq_event *hid_eventq_peek(const struct hid_eventq *eventq, size_t pos)
+{
+	return eventq_at((struct hid_eventq *)eventq, pos);
+}
+
+void hid_eventq_reset(struct hid_eventq *eventq)
+{
+	eventq->stats.dropped += eventq->len;
+	eventq->head = 0;
+	eventq->len = 0;
+}
+
+bool hid_eventq_get(struct hid_eventq *eventq, struct hid_eventq_event *event,
+		    uint32_t timestamp)
+{
+	if (hid_eventq_is_empty(eventq)) {
+		return false;
+	}
+
+	*event = *eventq_at(eventq, 0);
+
+	eventq->head = (eventq->head + 1) % ARRAY_SIZE(eventq->events);
+	eventq->len--;
+
+	uint32_t time = timestamp - event->timestamp;
+
+	eventq->stats.dequeued++;
+	eventq->stats.time_sum += time;
+	eventq->stats.time_max = MAX(eventq->stats.time_max, time);
+
+	return true;
+}
+
+void hid_eventq_append(struct hid_eventq *eventq, uint16_t usage_id, int16_t value,
+		       uint32_t timestamp)
+{
+	if (hid_eventq_is_full(eventq)) {
+		LOG_ERR("No space for HID event");
+		/* Should never happen. */
+		__ASSERT_NO_MSG(false);
+		return;
+	}
+
+	eventq->len++;
+
+	struct hid_eventq_event *hid_event = eventq_at(eventq, eventq->len - 1);
+
+	hid_event->usage_id = usage_id;
+	hid_event->value = value;
+	hid_event->timestamp = timestamp;
+
+	eventq->stats.len_max = MAX(eventq->stats.len_max, eventq->len);
+}
+
+static void eventq_purge(struct hid_eventq *eventq, size_t cnt)
+{
+	__ASSERT_NO_MSG(cnt <= eventq->len);
+
+	eventq->head = (eventq->head + cnt) % ARRAY_SIZE(eventq->events);
+	eventq->len -= cnt;
+	eventq->stats.dropped += cnt;
+
+	LOG_WRN("%u stale events removed from the queue!", cnt);
+}
+
+static size_t eventq_first_valid(struct hid_eventq *eventq, uint32_t timestamp)
+{
+	/* Events are ordered by timestamps, so the timed out events form
+	 * the head of the queue.
+	 */
+	size_t lo = 0;
+	size_t hi = eventq->len;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		uint32_t diff = timestamp - eventq_at(eventq, mid)->timestamp;
+
+		if (diff < CONFIG_DESKTOP_HID_REPORT_EXPIRATION) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+
+	return lo;
+}
+
+void hid_eventq_cleanup(struct hid_eventq *eventq, uint32_t timestamp)
+{
+	/* Find timed out events. */
+
+	size_t first_valid = eventq_first_valid(eventq, timestamp);
+
+	/* Remove events but only if key up was generated for each removed
+	 * key down. Positions are counted from the head of the queue before
+	 * the cleanup.
+	 */
+
+	size_t maxfound = 0;
+	size_t purged = 0;
+
+	for (size_t cur = 0; cur < first_valid; cur++) {
+		const struct hid_eventq_event cur_event = *eventq_at(eventq, cur - purged);
+
+		if (cur_event.value > 0) {
+			/* Every key down must be paired with key up.
+			 * Set hit count to value as we just detected
+			 * first key down for this usage.
+			 */
+
+			unsigned int hit_count = cur_event.value;
+			size_t j;
+
+			for (j = cur + 1; j < first_valid; j++) {
+				const struct hid_eventq_event *event = eventq_at(eventq, j - purged);
+
+				if (cur_event.usage_id == event->usage_id) {
+					hit_count += event->value;
+
+					if (hit_count == 0) {
+						/* All events with this usage
+						 * are paired.
+						 */
+						break;
+					}
+				}
+			}
+
+			if (j == first_valid) {
+				/* Pair not found. */
+				break;
+			}
+
+			maxfound = MAX(maxfound, j);
+		}
+
+		if (cur == maxfound) {
+			/* All events up to this point have pairs and can
+			 * be deleted.
+			 */
+			eventq_purge(eventq, maxfound + 1 - purged);
+			purged = maxfound + 1;
+		}
+	}
+}
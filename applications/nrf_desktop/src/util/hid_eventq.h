@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _HID_EVENTQ_H_
+#define _HID_EVENTQ_H_
+
+/**
+ * @file
+ * @defgroup hid_eventq HID event queue
+ * @{
+ * @brief Queue of HID events used by the HID state module.
+ *
+ * Events are kept in a statically allocated ring buffer in the order of their
+ * timestamps.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Enqueued HID event. */
+struct hid_eventq_event {
+	uint16_t usage_id; /**< HID usage ID. */
+	int16_t value; /**< HID value. */
+	uint32_t timestamp; /**< HID event timestamp [ms]. */
+};
+
+/** @brief Event queue statistics. */
+struct hid_eventq_stats {
+	uint32_t len_max; /**< Maximal number of enqueued events. */
+	uint32_t dropped; /**< Number of events removed without being reported. */
+	uint32_t dequeued; /**< Number of events taken from the queue. */
+	uint32_t time_max; /**< Maximal time an event spent in the queue [ms]. */
+	uint32_t time_sum; /**< Total time dequeued events spent in the queue [ms]. */
+};
+
+/** @brief Event queue. */
+struct hid_eventq {
+	struct hid_eventq_event events[CONFIG_DESKTOP_HID_EVENT_QUEUE_SIZE];
+	uint8_t head; /**< Index of the oldest event. */
+	uint8_t len; /**< Number of enqueued events. */
+	struct hid_eventq_stats stats; /**< Queue statistics. */
+};
+
+/**
+ * @brief Drop all the events from the queue.
+ *
+ * @param eventq Event queue.
+ */
+void hid_eventq_reset(struct hid_eventq *eventq);
+
+/**
+ * @brief Check if the queue is full.
+ *
+ * @param eventq Event queue.
+ *
+ * @return True if no event can be appended, false otherwise.
+ */
+static inline bool hid_eventq_is_full(const struct hid_eventq *eventq)
+{
+	return (eventq->len >= CONFIG_DESKTOP_HID_EVENT_QUEUE_SIZE);
+}
+
+/**
+ * @brief Check if the queue is empty.
+ *
+ * @param eventq Event queue.
+ *
+ * @return True if there are no enqueued events, false otherwise.
+ */
+static inline bool hid_eventq_is_empty(const struct hid_eventq *eventq)
+{
+	return (eventq->len == 0);
+}
+
+/**
+ * @brief Get an enqueued event.
+ *
+ * @param eventq Event queue.
+ * @param pos    Position of the event, counted from the oldest one.
+ *
+ * @return Pointer to the event.
+ */
+const struct hid_eventq_event *hid_eventq_peek(const struct hid_eventq *eventq, size_t pos);
+
+/**
+ * @brief Take the oldest event from the queue.
+ *
+ * @param eventq    Event queue.
+ * @param event     Pointer to the structure the event is copied to.
+ * @param timestamp Current time [ms], used for the statistics.
+ *
+ * @return True if an event was taken, false if the queue is empty.
+ */
+bool hid_eventq_get(struct hid_eventq *eventq, struct hid_eventq_event *event,
+		    uint32_t timestamp);
+
+/**
+ * @brief Append an event to the queue.
+ *
+ * The queue must not be full. Timestamps of the appended events must not
+ * decrease.
+ *
+ * @param eventq    Event queue.
+ * @param usage_id  HID usage ID.
+ * @param value     HID value.
+ * @param timestamp Event timestamp [ms].
+ */
+void hid_eventq_append(struct hid_eventq *eventq, uint16_t usage_id, int16_t value,
+		       uint32_t timestamp);
+
+/**
+ * @brief Remove the expired events from the queue.
+ *
+ * The events that are older than @kconfig{CONFIG_DESKTOP_HID_REPORT_EXPIRATION}
+ * are removed, starting from the oldest one, but only if a key up follows
+ * every removed key down.
+ *
+ * @param eventq    Event queue.
+ * @param timestamp Current time [ms].
+ */
+void hid_eventq_cleanup(struct hid_eventq *eventq, uint32_t timestamp);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _HID_EVENTQ_H_ */
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#include "hid_eventq.h"
+
+#define QUEUE_SIZE	CONFIG_DESKTOP_HID_EVENT_QUEUE_SIZE
+#define EXPIRATION	CONFIG_DESKTOP_HID_REPORT_EXPIRATION
+
+#define USAGE_A		0x04
+#define USAGE_B		0x05
+#define USAGE_C		0x06
+
+#define KEY_DOWN	1
+#define KEY_UP		-1
+
+/* Start close to the timestamp overflow, so that the tests also cover it. */
+#define TIME_START	(UINT32_MAX - 2 * EXPIRATION)
+
+static struct hid_eventq eventq;
+static uint32_t now;
+
+/* Reference model: the queue as a plain list, cleaned up by walking the list
+ * like the linked list based queue used before.
+ */
+struct ref_queue {
+	struct hid_eventq_event events[QUEUE_SIZE];
+	size_t len;
+};
+
+static struct ref_queue ref;
+
+static void ref_append(struct ref_queue *q, uint16_t usage_id, int16_t value,
+		       uint32_t timestamp)
+{
+	TEST_ASSERT_TRUE(q->len < ARRAY_SIZE(q->events));
+
+	q->events[q->len].usage_id = usage_id;
+	q->events[q->len].value = value;
+	q->events[q->len].timestamp = timestamp;
+	q->len++;
+}
+
+static void ref_purge(struct ref_queue *q, size_t cnt)
+{
+	memmove(&q->events[0], &q->events[cnt], (q->len - cnt) * sizeof(q->events[0]));
+	q->len -= cnt;
+}
+
+static void ref_cleanup(struct ref_queue *q, uint32_t timestamp)
+{
+	size_t first_valid;
+
+	for (first_valid = 0; first_valid < q->len; first_valid++) {
+		if ((timestamp - q->events[first_valid].timestamp) < EXPIRATION) {
+			break;
+		}
+	}
+
+	/* Positions are counted from the list head before the cleanup. */
+	size_t maxfound = 0;
+	size_t purged = 0;
+
+	for (size_t cur = 0; cur < first_valid; cur++) {
+		const struct hid_eventq_event *cur_event = &q->events[cur - purged];
+
+		if (cur_event->value > 0) {
+			unsigned int hit_count = cur_event->value;
+			size_t j;
+
+			for (j = cur + 1; j < first_valid; j++) {
+				const struct hid_eventq_event *event = &q->events[j - purged];
+
+				if (event->usage_id == cur_event->usage_id) {
+					hit_count += event->value;
+					if (hit_count == 0) {
+						break;
+					}
+				}
+			}
+
+			if (j == first_valid) {
+				break;
+			}
+
+			if (j > maxfound) {
+				maxfound = j;
+			}
+		}
+
+		if (cur == maxfound) {
+			ref_purge(q, maxfound + 1 - purged);
+			purged = maxfound + 1;
+		}
+	}
+}
+
+static void assert_same_as_ref(void)
+{
+	TEST_ASSERT_EQUAL(ref.len, eventq.len);
+
+	for (size_t i = 0; i < ref.len; i++) {
+		const struct hid_eventq_event *event = hid_eventq_peek(&eventq, i);
+
+		TEST_ASSERT_EQUAL(ref.events[i].usage_id, event->usage_id);
+		TEST_ASSERT_EQUAL(ref.events[i].value, event->value);
+		TEST_ASSERT_EQUAL(ref.events[i].timestamp, event->timestamp);
+	}
+}
+
+static void append(uint16_t usage_id, int16_t value)
+{
+	hid_eventq_append(&eventq, usage_id, value, now);
+}
+
+static void assert_get(uint16_t usage_id, int16_t value, uint32_t timestamp)
+{
+	struct hid_eventq_event event;
+
+	TEST_ASSERT_TRUE(hid_eventq_get(&eventq, &event, now));
+	TEST_ASSERT_EQUAL(usage_id, event.usage_id);
+	TEST_ASSERT_EQUAL(value, event.value);
+	TEST_ASSERT_EQUAL(timestamp, event.timestamp);
+}
+
+/* Deterministic pseudo random sequence. */
+static uint32_t rand_state;
+
+static uint32_t rand_get(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+
+	return rand_state >> 16;
+}
+
+void setUp(void)
+{
+	memset(&eventq, 0, sizeof(eventq));
+	memset(&ref, 0, sizeof(ref));
+	now = TIME_START;
+	rand_state = 1;
+}
+
+void test_empty(void)
+{
+	struct hid_eventq_event event;
+
+	TEST_ASSERT_TRUE(hid_eventq_is_empty(&eventq));
+	TEST_ASSERT_FALSE(hid_eventq_is_full(&eventq));
+	TEST_ASSERT_FALSE(hid_eventq_get(&eventq, &event, now));
+}
+
+void test_fifo_order_wraparound(void)
+{
+	/* Keep the queue partially filled while the head moves around the
+	 * ring buffer a few times.
+	 */
+	uint16_t next_in = 0;
+	uint16_t next_out = 0;
+
+	for (size_t i = 0; i < QUEUE_SIZE - 1; i++) {
+		append(next_in, next_in);
+		next_in++;
+	}
+
+	for (size_t i = 0; i < 3 * QUEUE_SIZE; i++) {
+		now++;
+		append(next_in, next_in);
+		next_in++;
+
+		TEST_ASSERT_TRUE(hid_eventq_is_full(&eventq));
+
+		assert_get(next_out, next_out, TIME_START + MAX((int)next_out - QUEUE_SIZE + 2, 0));
+		next_out++;
+
+		TEST_ASSERT_EQUAL(QUEUE_SIZE - 1, eventq.len);
+	}
+
+	while (!hid_eventq_is_empty(&eventq)) {
+		assert_get(next_out, next_out, hid_eventq_peek(&eventq, 0)->timestamp);
+		next_out++;
+	}
+
+	TEST_ASSERT_EQUAL(next_in, next_out);
+	TEST_ASSERT_EQUAL(QUEUE_SIZE, eventq.stats.len_max);
+	TEST_ASSERT_EQUAL(next_out, eventq.stats.dequeued);
+	TEST_ASSERT_EQUAL(0, eventq.stats.dropped);
+}
+
+void test_full_drop(void)
+{
+	for (size_t i = 0; i < QUEUE_SIZE; i++) {
+		append(USAGE_A, i);
+	}
+
+	TEST_ASSERT_TRUE(hid_eventq_is_full(&eventq));
+
+	/* Event appended to a full queue is dropped, the queue is unchanged. */
+	append(USAGE_B, KEY_DOWN);
+
+	TEST_ASSERT_EQUAL(QUEUE_SIZE, eventq.len);
+	for (size_t i = 0; i < QUEUE_SIZE; i++) {
+		TEST_ASSERT_EQUAL(USAGE_A, hid_eventq_peek(&eventq, i)->usage_id);
+		TEST_ASSERT_EQUAL(i, hid_eventq_peek(&eventq, i)->value);
+	}
+
+	hid_eventq_reset(&eventq);
+
+	TEST_ASSERT_TRUE(hid_eventq_is_empty(&eventq));
+	TEST_ASSERT_EQUAL(QUEUE_SIZE, eventq.stats.dropped);
+}
+
+void test_time_in_queue(void)
+{
+	append(USAGE_A, KEY_DOWN);
+	now += 10;
+	append(USAGE_A, KEY_UP);
+	now += 30;
+
+	assert_get(USAGE_A, KEY_DOWN, TIME_START);
+	assert_get(USAGE_A, KEY_UP, TIME_START + 10);
+
+	TEST_ASSERT_EQUAL(40, eventq.stats.time_max);
+	TEST_ASSERT_EQUAL(70, eventq.stats.time_sum);
+	TEST_ASSERT_EQUAL(2, eventq.stats.dequeued);
+}
+
+void test_cleanup_not_expired(void)
+{
+	append(USAGE_A, KEY_DOWN);
+	append(USAGE_A, KEY_UP);
+
+	hid_eventq_cleanup(&eventq, now + EXPIRATION - 1);
+
+	TEST_ASSERT_EQUAL(2, eventq.len);
+}
+
+void test_cleanup_paired(void)
+{
+	append(USAGE_A, KEY_DOWN);
+	append(USAGE_B, KEY_DOWN);
+	append(USAGE_A, KEY_UP);
+	append(USAGE_B, KEY_UP);
+	now += EXPIRATION;
+	append(USAGE_C, KEY_DOWN);
+
+	hid_eventq_cleanup(&eventq, now);
+
+	TEST_ASSERT_EQUAL(1, eventq.len);
+	TEST_ASSERT_EQUAL(USAGE_C, hid_eventq_peek(&eventq, 0)->usage_id);
+	TEST_ASSERT_EQUAL(4, eventq.stats.dropped);
+}
+
+void test_cleanup_unpaired_key_down(void)
+{
+	/* The key up of USAGE_B is not expired yet, so the events starting
+	 * from the key down of USAGE_B must stay in the queue.
+	 */
+	append(USAGE_A, KEY_DOWN);
+	append(USAGE_A, KEY_UP);
+	append(USAGE_B, KEY_DOWN);
+	append(USAGE_C, KEY_DOWN);
+	append(USAGE_C, KEY_UP);
+	now += EXPIRATION;
+	append(USAGE_B, KEY_UP);
+
+	hid_eventq_cleanup(&eventq, now);
+
+	TEST_ASSERT_EQUAL(4, eventq.len);
+	TEST_ASSERT_EQUAL(USAGE_B, hid_eventq_peek(&eventq, 0)->usage_id);
+	TEST_ASSERT_EQUAL(KEY_DOWN, hid_eventq_peek(&eventq, 0)->value);
+	TEST_ASSERT_EQUAL(2, eventq.stats.dropped);
+}
+
+void test_cleanup_wraparound(void)
+{
+	/* Move the head to the end of the ring buffer first. */
+	for (size_t i = 0; i < QUEUE_SIZE - 1; i++) {
+		append(USAGE_C, KEY_DOWN);
+		assert_get(USAGE_C, KEY_DOWN, now);
+	}
+
+	for (size_t i = 0; i < QUEUE_SIZE / 2; i++) {
+		append(USAGE_A, KEY_DOWN);
+		append(USAGE_A, KEY_UP);
+	}
+
+	TEST_ASSERT_TRUE(hid_eventq_is_full(&eventq));
+
+	hid_eventq_cleanup(&eventq, now + EXPIRATION);
+
+	TEST_ASSERT_TRUE(hid_eventq_is_empty(&eventq));
+	TEST_ASSERT_EQUAL(2 * (QUEUE_SIZE / 2), eventq.stats.dropped);
+}
+
+/* Replay a random storm of key presses and releases and compare the queue with
+ * the reference model after every operation.
+ */
+void test_cleanup_matches_list(void)
+{
+	static const uint16_t usages[] = {USAGE_A, USAGE_B, USAGE_C};
+	int16_t pressed[ARRAY_SIZE(usages)] = {0};
+
+	for (size_t i = 0; i < 2000; i++) {
+		size_t key = rand_get() % ARRAY_SIZE(usages);
+
+		now += rand_get() % (EXPIRATION / 2);
+
+		hid_eventq_cleanup(&eventq, now);
+		ref_cleanup(&ref, now);
+		assert_same_as_ref();
+
+		switch (rand_get() % 4) {
+		case 0:
+		{
+			struct hid_eventq_event event;
+
+			if (hid_eventq_get(&eventq, &event, now)) {
+				TEST_ASSERT_EQUAL(ref.events[0].usage_id, event.usage_id);
+				TEST_ASSERT_EQUAL(ref.events[0].value, event.value);
+				ref_purge(&ref, 1);
+			}
+			break;
+		}
+
+		default:
+			if (hid_eventq_is_full(&eventq)) {
+				hid_eventq_reset(&eventq);
+				ref.len = 0;
+				break;
+			}
+
+			int16_t value = (pressed[key] > 0) ? KEY_UP : KEY_DOWN;
+
+			pressed[key] += value;
+			append(usages[key], value);
+			ref_append(&ref, usages[key], value, now);
+			break;
+		}
+
+		assert_same_as_ref();
+	}
+}
+
+/* It is required to be added to each test. That is because unity is using
+ * different main signature (returns int) and zephyr expects main which does
+ * not return value.
+ */
+extern int unity_main(void);
+
+void main(void)
+{
+	(void)unity_main();
+}
@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2022 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""Host side of the Serial LTE Modem multiplexing mode.
+
+Implements the framing protocol used by AT#XMUX, and measures the aggregate
+uplink throughput of several sockets in multiplexing mode against sending the
+same data in data mode, one socket at a time, on a connected SLM. The sockets
+given by --handles must already be opened and connected.
+"""
+
+import argparse
+import struct
+import sys
+import threading
+import time
+
+import serial
+
+SOF = 0xF9
+HDR_LEN = 6
+AT_CHANNEL = 0
+FRAME_DATA = 0
+FRAME_CREDIT = 1
+FRAME_CLOSE = 2
+
+DATAMODE_TERMINATOR = b'+++'
+
+
+def frame_encode(channel, frame_type, payload=b''):
+    length = struct.pack('<H', len(payload))
+    check = 0xFF ^ channel ^ frame_type ^ length[0] ^ length[1]
+    return bytes([SOF, channel, frame_type]) + length + bytes([check]) + payload
+
+
+class FrameParser:
+    """Incremental frame parser, calls handler(channel, type, payload) per frame."""
+
+    def __init__(self, handler, max_len=4096):
+        self.handler = handler
+        self.max_len = max_len
+        self.buf = bytearray()
+
+    def feed(self, data):
+        self.buf += data
+        while True:
+            start = self.buf.find(bytes([SOF]))
+            if start < 0:
+                self.buf.clear()
+                return
+            del self.buf[:start]
+            if len(self.buf) < HDR_LEN:
+                return
+            channel, frame_type, length, check = struct.unpack('<BBHB', self.buf[1:HDR_LEN])
+            if (0xFF ^ channel ^ frame_type ^ self.buf[3] ^ self.buf[4]) != check or \
+               length > self.max_len:
+                del self.buf[:1]
+                continue
+            if len(self.buf) < HDR_LEN + length:
+                return
+            payload = bytes(self.buf[HDR_LEN:HDR_LEN + length])
+            del self.buf[:HDR_LEN + length]
+            self.handler(channel, frame_type, payload)
+
+
+class Link:
+    """Byte stream over a pyserial port."""
+
+    def __init__(self, port):
+        self.port = port
+
+    def read(self):
+        return self.port.read(max(1, self.port.in_waiting))
+
+    def write(self, data):
+        self.port.write(data)
+
+
+class Host:
+    """MCU side of the SLM AT command, data and multiplexing modes."""
+
+    def __init__(self, link, timeout=10):
+        self.link = link
+        self.timeout = timeout
+        self.lock = threading.Condition()
+        self.muxed = False
+        self.text = bytearray()
+        self.credit = {}
+        self.closed = set()
+        self.parser = FrameParser(self._frame)
+        threading.Thread(target=self._reader, daemon=True).start()
+
+    def _reader(self):
+        while True:
+            try:
+                data = self.link.read()
+            except OSError:
+                return
+            if not data:
+                continue
+            with self.lock:
+                if self.muxed:
+                    self.parser.feed(data)
+                else:
+                    self.text += data
+                self.lock.notify_all()
+
+    def _frame(self, channel, frame_type, payload):
+        # Called with the lock held.
+        if channel == AT_CHANNEL and frame_type == FRAME_DATA:
+            self.text += payload
+        elif frame_type == FRAME_CREDIT:
+            self.credit[channel] = self.credit.get(channel, 0) + \
+                struct.unpack('<H', payload)[0]
+        elif frame_type == FRAME_CLOSE:
+            self.closed.add(channel)
+
+    def _wait_text(self, patterns):
+        deadline = time.monotonic() + self.timeout
+        with self.lock:
+            while True:
+                for pattern in patterns:
+                    pos = self.text.find(pattern)
+                    if pos >= 0:
+                        rsp = bytes(self.text[:pos + len(pattern)])
+                        del self.text[:pos + len(pattern)]
+                        return rsp
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    raise TimeoutError(f'No response, got {bytes(self.text)!r}')
+                self.lock.wait(remaining)
+
+    def at(self, cmd):
+        data = cmd.encode() + b'\r\n'
+        if self.muxed:
+            # The SLM gives credit for the AT channel too.
+            self.mux_send(AT_CHANNEL, data, len(data))
+        else:
+            self.link.write(data)
+        rsp = self._wait_text([b'OK\r\n', b'ERROR\r\n'])
+        if rsp.endswith(b'ERROR\r\n'):
+            raise RuntimeError(f'{cmd} failed: {rsp!r}')
+        return rsp
+
+    def mux_start(self):
+        with self.lock:
+            self.credit[AT_CHANNEL] = 0
+        self.at('AT#XMUX=1')
+        with self.lock:
+            self.muxed = True
+            # Frames may have been read together with the final result.
+            rest = bytes(self.text)
+            self.text.clear()
+            self.parser.feed(rest)
+
+    def mux_stop(self):
+        self.at('AT#XMUX=0')
+        with self.lock:
+            self.muxed = False
+
+    def bind(self, channel, handle):
+        with self.lock:
+            self.credit[channel] = 0
+            self.closed.discard(channel)
+        self.at(f'AT#XMUXBIND={channel},{handle}')
+
+    def mux_send(self, channel, data, frame_size):
+        """Send data on a channel within the credit given by the SLM."""
+        while data:
+            with self.lock:
+                if not self.lock.wait_for(lambda: self.credit[channel] > 0 or
+                                          channel in self.closed, self.timeout):
+                    raise TimeoutError(f'No credit on channel {channel}')
+                if channel in self.closed:
+                    raise RuntimeError(f'Channel {channel} closed')
+                size = min(len(data), frame_size, self.credit[channel])
+                self.credit[channel] -= size
+            self.link.write(frame_encode(channel, FRAME_DATA, data[:size]))
+            data = data[size:]
+
+    def mux_wait_credit(self, channel, credit):
+        """Wait until the SLM has sent all data of the channel to the socket."""
+        with self.lock:
+            if not self.lock.wait_for(lambda: self.credit[channel] >= credit,
+                                      self.timeout):
+                raise TimeoutError(f'Data not sent on channel {channel}')
+
+    def datamode_send(self, handle, data):
+        self.at(f'AT#XSOCKETSELECT={handle}')
+        self.at('AT#XSEND')
+        self.link.write(data + DATAMODE_TERMINATOR)
+        self._wait_text([b'#XDATAMODE: 0\r\n'])
+
+
+def payload(size):
+    # Avoid the data mode terminator in the payload.
+    return bytes(0x30 + (i % 10) for i in range(size))
+
+
+def bench_datamode(host, handles, size, chunk):
+    data = payload(chunk)
+    start = time.monotonic()
+    for _ in range(0, size, chunk):
+        for handle in handles:
+            host.datamode_send(handle, data)
+    return time.monotonic() - start
+
+
+def bench_mux(host, handles, size, chunk, frame_size):
+    host.mux_start()
+    credit = {}
+    for channel, handle in enumerate(handles, 1):
+        host.bind(channel, handle)
+        with host.lock:
+            credit[channel] = host.lock.wait_for(lambda: host.credit[channel] > 0,
+                                                 host.timeout) and host.credit[channel]
+
+    def sender(channel):
+        data = payload(chunk)
+        for _ in range(0, size, chunk):
+            host.mux_send(channel, data, frame_size)
+        host.mux_wait_credit(channel, credit[channel])
+
+    threads = [threading.Thread(target=sender, args=(channel,))
+               for channel in range(1, len(handles) + 1)]
+    start = time.monotonic()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = time.monotonic() - start
+    host.mux_stop()
+    return elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--port', required=True, help='serial port of the SLM')
+    parser.add_argument('--baudrate', type=int, default=115200)
+    parser.add_argument('--handles', default='0,1,2,3',
+                        help='comma-separated handles of connected sockets')
+    parser.add_argument('--size', type=int, default=16384, help='bytes to send per socket')
+    parser.add_argument('--chunk', type=int, default=1024,
+                        help='bytes sent per socket at a time')
+    parser.add_argument('--frame-size', type=int, default=1024,
+                        help='CONFIG_SLM_MUX_FRAME_SIZE')
+    args = parser.parse_args()
+
+    handles = [int(h) for h in args.handles.split(',')]
+
+    link = Link(serial.Serial(args.port, args.baudrate, rtscts=True, timeout=1))
+    host = Host(link)
+    total = args.size * len(handles)
+
+    results = [
+        ('data mode', bench_datamode(host, handles, args.size, args.chunk)),
+        ('multiplexing mode', bench_mux(host, handles, args.size, args.chunk,
+                                        args.frame_size)),
+    ]
+
+    print(f'{len(handles)} sockets, {args.size} bytes each, {args.baudrate} baud')
+    for name, elapsed in results:
+        print(f'{name:>18}: {elapsed:7.2f} s, {total / elapsed:9.0f} bytes/s')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
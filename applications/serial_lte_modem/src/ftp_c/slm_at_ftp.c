@@ -485,7 +485,7 @@ static int do_ftp_put(void)
 
 	if (at_params_valid_count_get(&at_param_list) == 3) {
 		/* enter data mode */
-		ret = enter_datamode(ftp_datamode_callback);
+		ret = enter_datamode(ftp_datamode_callback, DATAMODE_STREAM);
 		if (ret) {
 			return ret;
 		}
@@ -528,7 +528,7 @@ static int do_ftp_uput(void)
 
 	if (at_params_valid_count_get(&at_param_list) == 2) {
 		/* enter data mode */
-		ret = enter_datamode(ftp_datamode_callback);
+		ret = enter_datamode(ftp_datamode_callback, DATAMODE_STREAM);
 		if (ret) {
 			return ret;
 		}
@@ -574,7 +574,7 @@ static int do_ftp_mput(void)
 
 	if (at_params_valid_count_get(&at_param_list) == 3) {
 		/* enter data mode */
-		ret = enter_datamode(ftp_datamode_callback);
+		ret = enter_datamode(ftp_datamode_callback, DATAMODE_STREAM);
 		if (ret) {
 			return ret;
 		}
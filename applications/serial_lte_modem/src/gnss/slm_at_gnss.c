@@ -1084,7 +1084,7 @@ int handle_at_nrf_cloud(enum at_cmd_type cmd_type)
 			}
 		} else if (op == nRF_CLOUD_SEND && nrf_cloud_ready) {
 			/* enter data mode */
-			err = enter_datamode(nrf_cloud_datamode_callback);
+			err = enter_datamode(nrf_cloud_datamode_callback, DATAMODE_MESSAGE);
 		} else if (op == nRF_CLOUD_DISCONNECT && nrf_cloud_ready) {
 			err = nrf_cloud_disconnect();
 			if (err) {
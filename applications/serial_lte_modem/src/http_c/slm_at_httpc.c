@@ -195,7 +195,7 @@ static int payload_cb(int sock, struct http_request *req, void *user_data)
 	ARG_UNUSED(user_data);
 
 	if (httpc.content_length > 0 || httpc.chunked_transfer) {
-		enter_datamode(httpc_datamode_callback);
+		enter_datamode(httpc_datamode_callback, DATAMODE_STREAM);
 		sprintf(rsp_buf, "\r\n#XHTTPCREQ: 1\r\n");
 		rsp_send(rsp_buf, strlen(rsp_buf));
 		/* Wait until all payload is sent */
@@ -608,7 +608,7 @@ int handle_at_mqtt_publish(enum at_cmd_type cmd_type)
 		}
 		if (strlen(pub_msg) == 0) {
 			/* Publish payload in data mode */
-			err = enter_datamode(mqtt_datamode_callback);
+			err = enter_datamode(mqtt_datamode_callback, DATAMODE_MESSAGE);
 		} else {
 			err = do_mqtt_publish(pub_msg, msg_sz);
 		}
@@ -49,6 +49,9 @@
 #if defined(CONFIG_SLM_NRF52_DFU)
 #include "slm_at_dfu.h"
 #endif
+#if defined(CONFIG_SLM_MUX)
+#include "slm_mux.h"
+#endif
 
 LOG_MODULE_REGISTER(slm_at, CONFIG_SLM_LOG_LEVEL);
 
@@ -378,6 +381,48 @@ static int handle_at_datactrl(enum at_cmd_type cmd_type)
 	return ret;
 }
 
+/**@brief handle AT#XDATASTAT commands
+ *  AT#XDATASTAT=0
+ *  AT#XDATASTAT?
+ *  AT#XDATASTAT=?
+ */
+static int handle_at_datastat(enum at_cmd_type cmd_type)
+{
+	int ret = 0;
+	uint16_t op;
+	struct slm_datamode_stats stats;
+
+	switch (cmd_type) {
+	case AT_CMD_TYPE_SET_COMMAND:
+		ret = at_params_unsigned_short_get(&at_param_list, 1, &op);
+		if (ret) {
+			return ret;
+		}
+		if (op != 0) {
+			return -EINVAL;
+		}
+		datamode_stats_reset();
+		break;
+
+	case AT_CMD_TYPE_READ_COMMAND:
+		datamode_stats_get(&stats);
+		sprintf(rsp_buf, "\r\n#XDATASTAT: %u,%u,%u,%u,%u\r\n", stats.rx_bytes,
+			stats.tx_bytes, stats.dropped, stats.stalls, stats.time);
+		rsp_send(rsp_buf, strlen(rsp_buf));
+		break;
+
+	case AT_CMD_TYPE_TEST_COMMAND:
+		sprintf(rsp_buf, "\r\n#XDATASTAT: (0)\r\n");
+		rsp_send(rsp_buf, strlen(rsp_buf));
+		break;
+
+	default:
+		break;
+	}
+
+	return ret;
+}
+
 /**@brief handle AT#XCLAC commands
  *  AT#XCLAC
  *  AT#XCLAC? not supported
@@ -474,6 +519,11 @@ int handle_at_dfu_size(enum at_cmd_type cmd_type);
 int handle_at_dfu_run(enum at_cmd_type cmd_type);
 #endif
 
+#if defined(CONFIG_SLM_MUX)
+int handle_at_mux(enum at_cmd_type cmd_type);
+int handle_at_muxbind(enum at_cmd_type cmd_type);
+#endif
+
 static struct slm_at_cmd {
 	char *string;
 	slm_at_handler_t handler;
@@ -487,6 +537,7 @@ static struct slm_at_cmd {
 	{"AT#XCLAC", handle_at_clac},
 	{"AT#XSLMUART", handle_at_slmuart},
 	{"AT#XDATACTRL", handle_at_datactrl},
+	{"AT#XDATASTAT", handle_at_datastat},
 
 	/* TCP proxy commands */
 	{"AT#XTCPSVR", handle_at_tcp_server},
@@ -584,6 +635,11 @@ static struct slm_at_cmd {
 	{"AT#XDFUSIZE", handle_at_dfu_size},
 	{"AT#XDFURUN", handle_at_dfu_run},
 #endif
+
+#if defined(CONFIG_SLM_MUX)
+	{"AT#XMUX", handle_at_mux},
+	{"AT#XMUXBIND", handle_at_muxbind},
+#endif
 };
 
 int handle_at_clac(enum at_cmd_type cmd_type)
@@ -721,6 +777,13 @@ int slm_at_init(void)
 		return -EFAULT;
 	}
 #endif
+#if defined(CONFIG_SLM_MUX)
+	err = slm_mux_init();
+	if (err) {
+		LOG_ERR("MUX could not be initialized: %d", err);
+		return -EFAULT;
+	}
+#endif
 
 	return err;
 }
@@ -803,4 +866,10 @@ void slm_at_uninit(void)
 		LOG_ERR("DFU could not be uninitialized: %d", err);
 	}
 #endif
+#if defined(CONFIG_SLM_MUX)
+	err = slm_mux_uninit();
+	if (err) {
+		LOG_ERR("MUX could not be uninitialized: %d", err);
+	}
+#endif
 }
@@ -18,7 +18,11 @@
 #include <zephyr/init.h>
 #include "slm_util.h"
 #include "slm_at_host.h"
+#include "slm_term.h"
 #include "slm_at_fota.h"
+#if defined(CONFIG_SLM_MUX)
+#include "slm_mux.h"
+#endif
 #if defined(CONFIG_SLM_NRF52_DFU_LEGACY)
 #include "slip.h"
 #endif
@@ -49,24 +53,35 @@ LOG_MODULE_REGISTER(slm_at_host, CONFIG_SLM_LOG_LEVEL);
 #define UART_RX_MARGIN_MS       10
 #define UART_TX_DATA_SIZE	1024
 
+/* Data mode receive buffers share the AT command buffer */
+#define DATAMODE_BUF_NUM        CONFIG_SLM_DATAMODE_BUF_COUNT
+#define DATAMODE_BUF_LEN        (AT_MAX_CMD_LEN / DATAMODE_BUF_NUM)
+
+#define TERMINATOR_STR          CONFIG_SLM_DATAMODE_TERMINATOR
+
 #define HEXDUMP_DATAMODE_MAX    16
 
 static enum slm_operation_modes {
 	SLM_AT_COMMAND_MODE,  /* AT command host or bridge */
 	SLM_DATA_MODE,        /* Raw data sending */
-	SLM_DFU_MODE          /* nRF52 DFU controller */
+	SLM_DFU_MODE,         /* nRF52 DFU controller */
+	SLM_MUX_MODE          /* Multiplexed AT commands and data */
 } slm_operation_mode;
 
 static const struct device *const uart_dev = DEVICE_DT_GET(UART_NODE);
 static uint8_t at_buf[AT_MAX_CMD_LEN];
 static uint16_t at_buf_len;
 static bool at_buf_overflow;
-static struct ring_buf data_rb;
 static bool datamode_rx_disabled;
 static slm_datamode_handler_t datamode_handler;
+static enum slm_datamode_type datamode_type;
 static struct k_work raw_send_work;
 static struct k_work cmd_send_work;
 static struct k_work datamode_quit_work;
+static bool cmd_pending;
+#if defined(CONFIG_SLM_MUX)
+static bool muxmode_switch_pending;
+#endif
 
 RING_BUF_DECLARE(delayed_rb, UART_TX_DATA_SIZE);
 static struct k_work delayed_send_work;
@@ -79,6 +94,26 @@ static struct k_work_delayable uart_recovery_work;
 
 static K_SEM_DEFINE(tx_done, 0, 1);
 
+/* Received data mode buffer, passed to the sending work without copying */
+struct datamode_chunk {
+	uint8_t *data;          /* NULL when the time limit is reached */
+	uint16_t len;
+};
+
+static ATOMIC_DEFINE(datamode_buf_used, DATAMODE_BUF_NUM);
+static uint16_t datamode_buf_len[DATAMODE_BUF_NUM];
+K_MSGQ_DEFINE(datamode_msgq, sizeof(struct datamode_chunk), DATAMODE_BUF_NUM + 2, 4);
+static bool datamode_buf_starved;
+static bool datamode_flush_pending;
+static struct slm_term datamode_term;
+/* Length of the message gathered from the start of the data mode buffers */
+static size_t datamode_msg_len;
+static struct slm_datamode_stats datamode_stats;
+static int64_t datamode_start_time;
+
+static void inactivity_timer_handler(struct k_timer *timer);
+K_TIMER_DEFINE(inactivity_timer, inactivity_timer_handler, NULL);
+
 /* global functions defined in different files */
 int slm_at_parse(const char *at_cmd);
 int slm_at_init(void);
@@ -133,6 +168,12 @@ void rsp_send(const char *str, size_t len)
 	}
 
 	LOG_HEXDUMP_DBG(str, len, "TX");
+#if defined(CONFIG_SLM_MUX)
+	if (slm_operation_mode == SLM_MUX_MODE) {
+		(void)slm_mux_send(SLM_MUX_AT_CHANNEL, str, len);
+		return;
+	}
+#endif
 	if (uart_send(str, len) < 0) {
 		ring_buf_put(&delayed_rb, str, len);
 	}
@@ -144,16 +185,76 @@ void data_send(const uint8_t *data, size_t len)
 		return;
 	}
 	LOG_HEXDUMP_DBG(data, MIN(len, HEXDUMP_DATAMODE_MAX), "TX-DATA");
+#if defined(CONFIG_SLM_MUX)
+	if (slm_operation_mode == SLM_MUX_MODE) {
+		(void)slm_mux_send(SLM_MUX_AT_CHANNEL, data, len);
+		return;
+	}
+#endif
 	if (uart_send(data, len) < 0) {
 		ring_buf_put(&delayed_rb, data, len);
 	}
 }
 
+int raw_uart_send(const uint8_t *data, size_t len)
+{
+	return uart_send(data, len);
+}
+
+static int datamode_buf_index(const uint8_t *buf)
+{
+	if (buf < at_buf || buf >= at_buf + DATAMODE_BUF_NUM * DATAMODE_BUF_LEN) {
+		return -1;
+	}
+
+	return (buf - at_buf) / DATAMODE_BUF_LEN;
+}
+
+static uint8_t *datamode_buf_alloc(void)
+{
+	for (int i = 0; i < DATAMODE_BUF_NUM; i++) {
+		if (!atomic_test_and_set_bit(datamode_buf_used, i)) {
+			datamode_buf_len[i] = 0;
+			return &at_buf[i * DATAMODE_BUF_LEN];
+		}
+	}
+
+	return NULL;
+}
+
+static void datamode_buf_free(const uint8_t *buf)
+{
+	atomic_clear_bit(datamode_buf_used, datamode_buf_index(buf));
+}
+
+static void datamode_buf_reset(void)
+{
+	k_msgq_purge(&datamode_msgq);
+	for (int i = 0; i < DATAMODE_BUF_NUM; i++) {
+		atomic_clear_bit(datamode_buf_used, i);
+	}
+}
+
 static int uart_receive(void)
 {
 	int ret;
+	uint8_t *buf = uart_rx_buf[0];
+	size_t len = sizeof(uart_rx_buf[0]);
 
-	ret = uart_rx_enable(uart_dev, uart_rx_buf[0], sizeof(uart_rx_buf[0]), UART_RX_TIMEOUT_US);
+	if (slm_operation_mode == SLM_DATA_MODE) {
+		buf = datamode_buf_alloc();
+		if (buf == NULL) {
+			/* Resumed when sending has freed a buffer */
+			datamode_rx_disabled = true;
+			return 0;
+		}
+		len = DATAMODE_BUF_LEN;
+	}
+
+	ret = uart_rx_enable(uart_dev, buf, len, UART_RX_TIMEOUT_US);
+	if (ret && datamode_buf_index(buf) >= 0) {
+		datamode_buf_free(buf);
+	}
 	if (ret && ret != -EBUSY) {
 		LOG_ERR("UART RX failed: %d", ret);
 		rsp_send(FATAL_STR, sizeof(FATAL_STR) - 1);
@@ -175,15 +276,21 @@ static void uart_recovery(struct k_work *work)
 	LOG_DBG("UART recovered");
 }
 
-int enter_datamode(slm_datamode_handler_t handler)
+int enter_datamode(slm_datamode_handler_t handler, enum slm_datamode_type type)
 {
-	if (handler == NULL || datamode_handler != NULL) {
+	if (handler == NULL || datamode_handler != NULL ||
+	    slm_operation_mode != SLM_AT_COMMAND_MODE) {
 		LOG_INF("Invalid, not enter datamode");
 		return -EINVAL;
 	}
 
-	ring_buf_init(&data_rb, sizeof(at_buf), at_buf);
+	/* UART RX is restarted with the data mode buffers after the final result */
+	datamode_buf_reset();
+	slm_term_reset(&datamode_term);
+	datamode_msg_len = 0;
+	datamode_start_time = k_uptime_get();
 	datamode_handler = handler;
+	datamode_type = type;
 	slm_operation_mode = SLM_DATA_MODE;
 	if (datamode_time_limit == 0) {
 		if (slm_uart.baudrate > 0) {
@@ -207,16 +314,20 @@ bool in_datamode(void)
 bool exit_datamode(int result)
 {
 	if (slm_operation_mode == SLM_DATA_MODE) {
-		ring_buf_reset(&data_rb);
+		k_timer_stop(&inactivity_timer);
 		/* reset UART to restore command mode */
 		uart_rx_disable(uart_dev);
 		k_sleep(K_MSEC(10));
+		/* drop data not sent yet */
+		datamode_buf_reset();
+		datamode_rx_disabled = false;
+		datamode_stats.time += k_uptime_get() - datamode_start_time;
+		slm_operation_mode = SLM_AT_COMMAND_MODE;
 		(void)uart_receive();
 
 		sprintf(rsp_buf, "\r\n#XDATAMODE: %d\r\n", result);
 		rsp_send(rsp_buf, strlen(rsp_buf));
 
-		slm_operation_mode = SLM_AT_COMMAND_MODE;
 		datamode_handler = NULL;
 		LOG_INF("Exit datamode");
 		return true;
@@ -225,6 +336,53 @@ bool exit_datamode(int result)
 	return false;
 }
 
+void datamode_stats_get(struct slm_datamode_stats *stats)
+{
+	*stats = datamode_stats;
+	if (slm_operation_mode == SLM_DATA_MODE) {
+		stats->time += k_uptime_get() - datamode_start_time;
+	}
+}
+
+void datamode_stats_reset(void)
+{
+	memset(&datamode_stats, 0, sizeof(datamode_stats));
+	datamode_start_time = k_uptime_get();
+}
+
+#if defined(CONFIG_SLM_MUX)
+int enter_muxmode(void)
+{
+	if (slm_operation_mode != SLM_AT_COMMAND_MODE) {
+		LOG_INF("Invalid, not enter muxmode");
+		return -EINVAL;
+	}
+
+	/* Switch after the final result has been sent */
+	muxmode_switch_pending = true;
+	LOG_INF("Enter muxmode");
+
+	return 0;
+}
+
+bool in_muxmode(void)
+{
+	return (slm_operation_mode == SLM_MUX_MODE);
+}
+
+bool exit_muxmode(void)
+{
+	if (slm_operation_mode == SLM_MUX_MODE) {
+		/* Switch after the final result has been sent */
+		muxmode_switch_pending = true;
+		LOG_INF("Exit muxmode");
+		return true;
+	}
+
+	return false;
+}
+#endif /* CONFIG_SLM_MUX */
+
 int poweroff_uart(void)
 {
 	int err;
@@ -354,7 +512,7 @@ AT_MONITOR(at_notify, ANY, notification_handler);
 
 static void notification_handler(const char *response)
 {
-	if (slm_operation_mode == SLM_AT_COMMAND_MODE) {
+	if (slm_operation_mode == SLM_AT_COMMAND_MODE || slm_operation_mode == SLM_MUX_MODE) {
 		/* Forward the data over UART */
 		rsp_send("\r\n", 2);
 		rsp_send(response, strlen(response));
@@ -481,97 +639,160 @@ int dfu_drv_tx(const uint8_t *data, uint16_t length)
 #endif /* CONFIG_SLM_NRF52_DFU_LEGACY */
 #endif /* CONFIG_SLM_NRF52_DFU */
 
-static void raw_send(struct k_work *work)
+/* Returns true if data mode is to be exited */
+static bool datamode_data_send(const uint8_t *data, size_t len)
 {
-	uint8_t *data = NULL;
-	int size_send, size_sent;
-	const char *quit_str = CONFIG_SLM_DATAMODE_TERMINATOR;
-	int quit_str_len = strlen(quit_str);
-	bool datamode_off_pending = false;
-
-	ARG_UNUSED(work);
+	int ret;
+	size_t sent = 0;
 
-	/* NOTE ring_buf_get_claim() might not return full size */
-	do {
-		size_send = ring_buf_get_claim(&data_rb, &data, sizeof(at_buf));
-		if (data != NULL && size_send > 0) {
-			/* Exit datamode if apply */
-			if (size_send >= quit_str_len) {
-				char *quit = data + (size_send - quit_str_len);
-
-				if (strncmp(quit, quit_str, quit_str_len) == 0) {
-					memset(quit, 0x00, quit_str_len);
-					size_send -= quit_str_len;
-					datamode_off_pending = true;
-				}
-				if (size_send == 0) {
-					k_work_submit(&datamode_quit_work);
-					LOG_INF("datamode off pending");
-					return;
-				}
-			}
-			/* Raw data sending */
-			int size_finish = datamode_off_pending ? quit_str_len : 0;
-
-			LOG_INF("Raw send %d", size_send);
-			LOG_HEXDUMP_DBG(data, MIN(size_send, HEXDUMP_DATAMODE_MAX), "RX-DATAMODE");
-			if (datamode_handler && size_send > 0) {
-				size_sent = datamode_handler(DATAMODE_SEND, data, size_send);
-				if (size_sent > 0) {
-					size_finish += size_sent;
-				} else if (size_sent == 0) {
-					size_finish += size_send;
-				} else {
-					LOG_WRN("Raw send failed, %d dropped", size_send);
-					size_finish += size_send;
-					datamode_off_pending = true;
-				}
-				(void)ring_buf_get_finish(&data_rb, size_finish);
-			} else {
-				LOG_WRN("no handler, %d dropped", size_send);
-				(void)ring_buf_get_finish(&data_rb, size_send + size_finish);
-			}
+	LOG_DBG("Raw send %d", len);
+	LOG_HEXDUMP_DBG(data, MIN(len, HEXDUMP_DATAMODE_MAX), "RX-DATAMODE");
+	if (datamode_handler == NULL) {
+		LOG_WRN("no handler, %d dropped", len);
+		datamode_stats.dropped += len;
+		return false;
+	}
 
-			if (datamode_off_pending) {
+	while (sent < len) {
+		ret = datamode_handler(DATAMODE_SEND, data + sent, len - sent);
+		if (ret < 0) {
+			LOG_WRN("Raw send failed, %d dropped", len - sent);
+			datamode_stats.dropped += len - sent;
 #if defined(CONFIG_SLM_DATAMODE_URC)
-				sprintf(rsp_buf, "\r\n#XDATAMODE: %d\r\n",
-					size_finish - quit_str_len);
-				rsp_send(rsp_buf, strlen(rsp_buf));
+			sprintf(rsp_buf, "\r\n#XDATAMODE: %d\r\n", ret);
+			rsp_send(rsp_buf, strlen(rsp_buf));
 #endif
-				k_work_submit(&datamode_quit_work);
-				LOG_INF("datamode off pending");
-				return;
-			}
+			return true;
+		}
+		sent += (ret == 0) ? (len - sent) : ret;
+	}
+	datamode_stats.tx_bytes += sent;
 #if defined(CONFIG_SLM_DATAMODE_URC)
-			sprintf(rsp_buf, "\r\n#XDATAMODE: %d\r\n", size_finish);
-			rsp_send(rsp_buf, strlen(rsp_buf));
+	sprintf(rsp_buf, "\r\n#XDATAMODE: %d\r\n", sent);
+	rsp_send(rsp_buf, strlen(rsp_buf));
 #endif
+
+	return false;
+}
+
+static bool datamode_chunk_send(const uint8_t *data, size_t len)
+{
+	return slm_term_chunk_send(&datamode_term, data, len, datamode_data_send);
+}
+
+static bool datamode_flush(void)
+{
+	if (slm_term_flush(&datamode_term, datamode_data_send)) {
+		LOG_INF("datamode off pending");
+		return true;
+	}
+
+	return false;
+}
+
+/* Adds a received buffer to the message. The buffers are allocated in order, so they are
+ * contiguous unless a buffer was released before it was full.
+ */
+static void datamode_msg_add(const uint8_t *data, size_t len)
+{
+	if (data != at_buf + datamode_msg_len) {
+		memmove(at_buf + datamode_msg_len, data, len);
+	}
+	datamode_msg_len += len;
+}
+
+/* Returns true if data mode is to be exited */
+static bool datamode_msg_send(void)
+{
+	size_t len = datamode_msg_len;
+	bool quit = false;
+
+	datamode_msg_len = 0;
+	if (slm_term_match_update(&datamode_term, 0, at_buf, len) == datamode_term.len) {
+		LOG_INF("datamode off pending");
+		len -= datamode_term.len;
+		quit = true;
+	}
+	if (len > 0 && datamode_data_send(at_buf, len)) {
+		quit = true;
+	}
+	for (int i = 0; i < DATAMODE_BUF_NUM; i++) {
+		atomic_clear_bit(datamode_buf_used, i);
+	}
+
+	return quit;
+}
+
+static void raw_send(struct k_work *work)
+{
+	struct datamode_chunk chunk;
+	bool quit = false;
+
+	ARG_UNUSED(work);
+
+	while (!quit && k_msgq_get(&datamode_msgq, &chunk, K_NO_WAIT) == 0) {
+		if (datamode_type == DATAMODE_MESSAGE) {
+			/* Sent as one message when the time limit is reached or all buffers are full */
+			if (chunk.data != NULL) {
+				datamode_msg_add(chunk.data, chunk.len);
+			}
+			if (chunk.data == NULL ||
+			    datamode_msg_len == DATAMODE_BUF_NUM * DATAMODE_BUF_LEN) {
+				quit = datamode_msg_send();
+			}
+		} else if (chunk.data == NULL) {
+			quit = datamode_flush();
 		} else {
-			break;
+			quit = datamode_chunk_send(chunk.data, chunk.len);
+			datamode_buf_free(chunk.data);
 		}
-	} while (true);
+	}
 
-	/* resume UART RX in case of stopped by buffer full */
+	if (quit) {
+		k_work_submit(&datamode_quit_work);
+		return;
+	}
+
+	/* resume UART RX in case of stopped by buffer full or time limit */
 	if (datamode_rx_disabled) {
-		(void)uart_receive();
 		datamode_rx_disabled = false;
+		(void)uart_receive();
 	}
 }
 
+static void datamode_chunk_put(uint8_t *data, uint16_t len)
+{
+	struct datamode_chunk chunk = {
+		.data = data,
+		.len = len
+	};
+
+	if (k_msgq_put(&datamode_msgq, &chunk, K_NO_WAIT)) {
+		LOG_ERR("enqueue data error (%d)", len);
+		datamode_stats.dropped += len;
+		if (data != NULL) {
+			datamode_buf_free(data);
+		}
+		return;
+	}
+
+	k_work_submit(&raw_send_work);
+}
+
 static void inactivity_timer_handler(struct k_timer *timer)
 {
 	ARG_UNUSED(timer);
 
-	LOG_INF("time limit reached");
-	if (!ring_buf_is_empty(&data_rb)) {
-		k_work_submit(&raw_send_work);
-	} else {
-		LOG_WRN("data buffer empty");
+	LOG_DBG("time limit reached");
+	datamode_flush_pending = true;
+	/* Release the partially filled buffer for sending, RX is resumed after that */
+	if (uart_rx_disable(uart_dev)) {
+		/* Already stopped, all received data is queued */
+		datamode_flush_pending = false;
+		datamode_chunk_put(NULL, 0);
 	}
 }
 
-K_TIMER_DEFINE(inactivity_timer, inactivity_timer_handler, NULL);
-
 static void datamode_quit(struct k_work *work)
 {
 	ARG_UNUSED(work);
@@ -585,30 +806,22 @@ static void datamode_quit(struct k_work *work)
 	(void)exit_datamode(0);
 }
 
-static int raw_rx_handler(const uint8_t *data, int datalen)
+static void raw_rx_handler(const uint8_t *buf, size_t offset, size_t len)
 {
-	int ret;
+	int index = datamode_buf_index(buf);
 
 	k_timer_stop(&inactivity_timer);
 
-	/* save data to buffer */
-	ret = ring_buf_put(&data_rb, data, datalen);
-	if (ret != datalen) {
-		LOG_ERR("enqueue data error (%d, %d)", datalen, ret);
-		uart_rx_disable(uart_dev);
-		return -1;
-	}
-	ret = ring_buf_space_get(&data_rb);
-	if (ret < UART_RX_LEN) {
-		LOG_WRN("data buffer full (%d)", ret);
-		uart_rx_disable(uart_dev);
-		return -1;
+	if (index < 0) {
+		LOG_WRN("Not data mode buffer, %d dropped", len);
+		datamode_stats.dropped += len;
+		return;
 	}
+	datamode_buf_len[index] = offset + len;
+	datamode_stats.rx_bytes += len;
 
 	/* start/restart inactivity timer */
 	k_timer_start(&inactivity_timer, K_MSEC(datamode_time_limit), K_NO_WAIT);
-
-	return 0;
 }
 
 /*
@@ -769,6 +982,8 @@ final_result:
 static void cmd_send(struct k_work *work)
 {
 	int err;
+	/* UART RX is kept enabled for the other channels in multiplexing mode */
+	bool rx_disabled = (slm_operation_mode != SLM_MUX_MODE);
 
 	ARG_UNUSED(work);
 
@@ -814,7 +1029,27 @@ static void cmd_send(struct k_work *work)
 	}
 
 done:
-	(void)uart_receive();
+#if defined(CONFIG_SLM_MUX)
+	if (muxmode_switch_pending) {
+		if (slm_operation_mode == SLM_MUX_MODE) {
+			/* Send the queued frames before going back to raw AT commands */
+			slm_mux_tx_drain();
+		}
+		slm_operation_mode = (slm_operation_mode == SLM_MUX_MODE) ?
+				     SLM_AT_COMMAND_MODE : SLM_MUX_MODE;
+		muxmode_switch_pending = false;
+	}
+#endif
+	cmd_pending = false;
+#if defined(CONFIG_SLM_MUX)
+	if (slm_operation_mode == SLM_MUX_MODE) {
+		/* Continue with the AT channel input held while the command was pending */
+		slm_mux_cmd_done();
+	}
+#endif
+	if (rx_disabled) {
+		(void)uart_receive();
+	}
 }
 
 static int cmd_rx_handler(uint8_t character)
@@ -875,7 +1110,10 @@ static int cmd_rx_handler(uint8_t character)
 	return 0;
 
 send:
-	uart_rx_disable(uart_dev);
+	if (slm_operation_mode != SLM_MUX_MODE) {
+		uart_rx_disable(uart_dev);
+	}
+	cmd_pending = true;
 
 	at_buf[at_cmd_len] = '\0';
 	at_buf_len = at_cmd_len;
@@ -889,9 +1127,23 @@ send:
 	return 0;
 }
 
+#if defined(CONFIG_SLM_MUX)
+size_t muxmode_cmd_rx(const uint8_t *data, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len && !cmd_pending; i++) {
+		(void)cmd_rx_handler(data[i]);
+	}
+
+	return i;
+}
+#endif
+
 static void uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	int err;
+	uint8_t *buf;
 	static uint16_t pos;
 	static bool enable_rx_retry;
 
@@ -917,11 +1169,11 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 				}
 			}
 		} else if (slm_operation_mode == SLM_DATA_MODE) {
-			LOG_DBG("RX_RDY %d", evt->data.rx.len);
-			err = raw_rx_handler(&(evt->data.rx.buf[pos]), evt->data.rx.len);
-			if (err) {
-				return;
-			}
+			raw_rx_handler(evt->data.rx.buf, evt->data.rx.offset, evt->data.rx.len);
+#if defined(CONFIG_SLM_MUX)
+		} else if (slm_operation_mode == SLM_MUX_MODE) {
+			slm_mux_rx(&(evt->data.rx.buf[pos]), evt->data.rx.len);
+#endif
 #if defined(CONFIG_SLM_NRF52_DFU_LEGACY)
 		} else if (slm_operation_mode == SLM_DFU_MODE) {
 			(void)dfu_rx_handler(&(evt->data.rx.buf[pos]), evt->data.rx.len);
@@ -933,13 +1185,33 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 		break;
 	case UART_RX_BUF_REQUEST:
 		pos = 0;
-		err = uart_rx_buf_rsp(uart_dev, next_buf, sizeof(uart_rx_buf[0]));
+		if (slm_operation_mode == SLM_DATA_MODE) {
+			buf = datamode_buf_alloc();
+			if (buf == NULL) {
+				/* RX stops when the current buffer is full */
+				datamode_buf_starved = true;
+				break;
+			}
+			err = uart_rx_buf_rsp(uart_dev, buf, DATAMODE_BUF_LEN);
+			if (err) {
+				datamode_buf_free(buf);
+			}
+		} else {
+			err = uart_rx_buf_rsp(uart_dev, next_buf, sizeof(uart_rx_buf[0]));
+		}
 		if (err) {
 			LOG_WRN("UART RX buf rsp: %d", err);
 		}
 		break;
 	case UART_RX_BUF_RELEASED:
-		next_buf = evt->data.rx_buf.buf;
+		buf = evt->data.rx_buf.buf;
+		if (datamode_buf_index(buf) < 0) {
+			next_buf = buf;
+		} else if (datamode_buf_len[datamode_buf_index(buf)] > 0) {
+			datamode_chunk_put(buf, datamode_buf_len[datamode_buf_index(buf)]);
+		} else {
+			datamode_buf_free(buf);
+		}
 		break;
 	case UART_RX_STOPPED:
 		LOG_WRN("RX_STOPPED (%d)", evt->data.rx_stop.reason);
@@ -951,8 +1223,15 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 	case UART_RX_DISABLED:
 		LOG_DBG("RX_DISABLED");
 		if (slm_operation_mode == SLM_DATA_MODE) {
+			if (datamode_flush_pending) {
+				datamode_flush_pending = false;
+				datamode_chunk_put(NULL, 0);
+			} else if (datamode_buf_starved) {
+				datamode_stats.stalls++;
+			}
+			datamode_buf_starved = false;
 			datamode_rx_disabled = true;
-			/* flush data in ring-buffer, if any */
+			/* send received data, RX is resumed after that */
 			k_work_submit(&raw_send_work);
 		}
 		if (enable_rx_retry && !uart_recovery_pending) {
@@ -1039,6 +1318,11 @@ int slm_at_host_init(void)
 		return -EFAULT;
 	}
 
+	err = slm_term_init(&datamode_term, TERMINATOR_STR);
+	if (err) {
+		LOG_ERR("Invalid data mode terminator: %d", err);
+		return err;
+	}
 	k_work_init(&raw_send_work, raw_send);
 	k_work_init(&cmd_send_work, cmd_send);
 	k_work_init(&datamode_quit_work, datamode_quit);
@@ -26,6 +26,12 @@ enum slm_datamode_operation {
 	DATAMODE_EXIT   /* Exit data mode */
 };
 
+/**@brief Data mode sending types. */
+enum slm_datamode_type {
+	DATAMODE_STREAM,  /* Data is passed to the handler as it is received */
+	DATAMODE_MESSAGE  /* Data received until the time limit is passed as one message */
+};
+
 /**@brief Data mode sending handler type.
  *
  * @retval 0 means all data is sent successfully.
@@ -34,6 +40,15 @@ enum slm_datamode_operation {
  */
 typedef int (*slm_datamode_handler_t)(uint8_t op, const uint8_t *data, int len);
 
+/**@brief Data mode statistics. */
+struct slm_datamode_stats {
+	uint32_t rx_bytes;  /* Bytes received from UART */
+	uint32_t tx_bytes;  /* Bytes sent by the data mode handler */
+	uint32_t dropped;   /* Bytes dropped, because of no handler or sending failure */
+	uint32_t stalls;    /* Times UART RX was stopped for lack of receive buffers */
+	uint32_t time;      /* Time spent in data mode, in milliseconds */
+};
+
 /**
  * @brief Initialize AT host for serial LTE modem
  *
@@ -71,12 +86,18 @@ void data_send(const uint8_t *data, size_t len);
  *
  * No AT unsolicited message or command response allowed in data mode.
  *
+ * With DATAMODE_STREAM, the data is passed to the handler in the receive buffers, as soon as
+ * each buffer is filled. With DATAMODE_MESSAGE, the data received until the time limit is
+ * passed to the handler in one call, so that one burst of data is sent as one message.
+ * A message is limited to the size of the whole data mode receive space.
+ *
  * @param handler Data mode handler provided by requesting module
+ * @param type Whether the handler sends a stream or messages
  *
  * @retval 0 If the operation was successful.
  *         Otherwise, a (negative) error code is returned.
  */
-int enter_datamode(slm_datamode_handler_t handler);
+int enter_datamode(slm_datamode_handler_t handler, enum slm_datamode_type type);
 
 /**
  * @brief Check whether SLM AT host is in data mode
@@ -94,6 +115,71 @@ bool in_datamode(void);
  *         false If not in data mode.
  */
 bool exit_datamode(int result);
+
+/**
+ * @brief Get data mode statistics
+ *
+ * @param stats Statistics accumulated since boot or last reset.
+ */
+void datamode_stats_get(struct slm_datamode_stats *stats);
+
+/**
+ * @brief Reset data mode statistics
+ */
+void datamode_stats_reset(void);
+
+/**
+ * @brief Send data over UART as is
+ *
+ * Unlike @ref data_send, the data is not framed in multiplexing mode.
+ *
+ * @param data Data to send
+ * @param len Length of data
+ *
+ * @retval 0 If the operation was successful.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int raw_uart_send(const uint8_t *data, size_t len);
+
+/**
+ * @brief Request SLM AT host to enter multiplexing mode
+ *
+ * The mode is switched after the final result of the current AT command is sent.
+ *
+ * @retval 0 If the operation was successful.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int enter_muxmode(void);
+
+/**
+ * @brief Check whether SLM AT host is in multiplexing mode
+ *
+ * @retval true if yes, false if no.
+ */
+bool in_muxmode(void);
+
+/**
+ * @brief Request SLM AT host to exit multiplexing mode
+ *
+ * The mode is switched after the final result of the current AT command is sent.
+ *
+ * @retval true If normal exit from multiplexing mode.
+ *         false If not in multiplexing mode.
+ */
+bool exit_muxmode(void);
+
+/**
+ * @brief Handle AT command characters received on the AT channel in multiplexing mode
+ *
+ * Stops after the character that completes an AT command, the rest is handled
+ * once the command is done.
+ *
+ * @param data Received characters
+ * @param len Number of received characters
+ *
+ * @return Number of characters handled.
+ */
+size_t muxmode_cmd_rx(const uint8_t *data, size_t len);
 /** @} */
 
 #endif /* SLM_AT_HOST_ */
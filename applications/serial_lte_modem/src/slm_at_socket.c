@@ -1477,7 +1477,9 @@ int handle_at_send(enum at_cmd_type cmd_type)
 			}
 			err = do_send(data, size);
 		} else {
-			err = enter_datamode(socket_datamode_callback);
+			err = enter_datamode(socket_datamode_callback,
+					     sock.type == SOCK_STREAM ? DATAMODE_STREAM :
+					     DATAMODE_MESSAGE);
 		}
 		break;
 
@@ -1552,7 +1554,9 @@ int handle_at_sendto(enum at_cmd_type cmd_type)
 			}
 			err = do_sendto(udp_url, udp_port, data, size);
 		} else {
-			err = enter_datamode(socket_datamode_callback);
+			err = enter_datamode(socket_datamode_callback,
+					     sock.type == SOCK_STREAM ? DATAMODE_STREAM :
+					     DATAMODE_MESSAGE);
 		}
 		break;
 
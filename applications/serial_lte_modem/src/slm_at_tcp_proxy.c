@@ -817,7 +817,7 @@ int handle_at_tcp_send(enum at_cmd_type cmd_type)
 			}
 			err = do_tcp_send(data, size);
 		} else {
-			err = enter_datamode(tcp_datamode_callback);
+			err = enter_datamode(tcp_datamode_callback, DATAMODE_STREAM);
 		}
 		break;
 
@@ -579,7 +579,7 @@ int handle_at_udp_send(enum at_cmd_type cmd_type)
 			}
 			err = do_udp_send(data, size);
 		} else {
-			err = enter_datamode(udp_datamode_callback);
+			err = enter_datamode(udp_datamode_callback, DATAMODE_MESSAGE);
 		}
 		break;
 
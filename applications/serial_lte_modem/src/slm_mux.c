@@ -0,0 +1,833 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/sys/byteorder.h>
+#include "slm_util.h"
+#include "slm_at_host.h"
+#include "slm_mux.h"
+
+LOG_MODULE_REGISTER(slm_mux, CONFIG_SLM_LOG_LEVEL);
+
+#define THREAD_STACK_SIZE	KB(2)
+#define THREAD_PRIORITY		K_LOWEST_APPLICATION_THREAD_PRIO
+#define TX_WQ_STACK_SIZE	KB(1)
+#define TX_WQ_PRIORITY		K_LOWEST_APPLICATION_THREAD_PRIO
+
+/*
+ * Frame format, all multi-byte fields in little endian:
+ *
+ * | SOF (0xF9) | channel | type | length (2) | header check | payload (length) |
+ *
+ * The header check is 0xFF XOR channel, type and both length bytes.
+ */
+#define MUX_SOF			0xF9
+#define MUX_HDR_LEN		6
+#define MUX_CREDIT_LEN		2
+
+/* Credit is returned to the host when this much buffer space has been freed,
+ * or when the buffer becomes empty.
+ */
+#define MUX_CREDIT_THRESHOLD	(CONFIG_SLM_MUX_CHANNEL_BUF_SIZE / 4)
+
+/* Retry period of frames that could not be sent, for example while the UART is off */
+#define MUX_TX_RETRY_TIME	K_MSEC(100)
+/* Maximum time to wait for room in the TX buffer for AT responses and notifications */
+#define MUX_AT_TX_TIMEOUT	K_SECONDS(1)
+/* Maximum time for the mux thread to pick up an unbind request */
+#define MUX_UNBIND_TIMEOUT	K_MSEC(CONFIG_SLM_MUX_POLL_TIME * 10)
+
+BUILD_ASSERT(CONFIG_SLM_MUX_TX_BUF_SIZE >= MUX_HDR_LEN + CONFIG_SLM_MUX_FRAME_SIZE,
+	     "TX buffer cannot hold a frame");
+
+/**@brief Multiplexing operations. */
+enum slm_mux_operation {
+	MUX_OP_STOP,
+	MUX_OP_START
+};
+
+/**@brief Frame types. */
+enum mux_frame_type {
+	MUX_FRAME_DATA,   /* Channel data */
+	MUX_FRAME_CREDIT, /* Number of bytes the receiver can accept in addition */
+	MUX_FRAME_CLOSE   /* Channel closed */
+};
+
+enum mux_rx_state {
+	MUX_RX_SOF,
+	MUX_RX_HEADER,
+	MUX_RX_PAYLOAD
+};
+
+static struct mux_channel {
+	int fd;               /* Bound socket, or INVALID_SOCKET. */
+	struct ring_buf rb;   /* Data from the host to be sent to the socket. */
+	uint8_t buf[CONFIG_SLM_MUX_CHANNEL_BUF_SIZE];
+	atomic_t credit;      /* Bytes the host can still receive. */
+	atomic_t close;       /* Close requested by the host. */
+	atomic_t unbind;      /* Unbind requested with AT#XMUXBIND. */
+	uint32_t freed;       /* Bytes sent to the socket, not yet credited to the host. */
+	uint32_t tx_bytes;    /* Bytes sent from the host to the socket. */
+	uint32_t rx_bytes;    /* Bytes sent from the socket to the host. */
+	uint32_t overruns;    /* Bytes dropped because the host exceeded its credit. */
+} channels[CONFIG_SLM_MUX_CHANNELS];
+
+/* AT channel input, held while an AT command is pending. */
+static struct mux_at {
+	struct ring_buf rb;
+	uint8_t buf[CONFIG_SLM_MUX_AT_BUF_SIZE];
+	atomic_t freed;       /* Bytes consumed, not yet credited to the host. */
+	uint32_t overruns;    /* Bytes dropped because the host exceeded its credit. */
+} mux_at;
+
+static struct mux_rx {
+	enum mux_rx_state state;
+	uint8_t hdr[MUX_HDR_LEN - 1];
+	uint8_t hdr_len;
+	uint8_t channel;
+	uint8_t type;
+	uint16_t len;
+	uint16_t pos;
+	uint8_t ctrl[MUX_CREDIT_LEN];
+} mux_rx;
+
+static struct k_thread mux_thread;
+static K_THREAD_STACK_DEFINE(mux_thread_stack, THREAD_STACK_SIZE);
+static K_SEM_DEFINE(mux_sem, 0, 1);
+static K_SEM_DEFINE(mux_unbind_done, 0, 1);
+static uint8_t mux_rx_data[CONFIG_SLM_MUX_FRAME_SIZE];
+static bool mux_running;
+
+/* Protects the binding of the channels, which is checked from the UART callback,
+ * and the AT channel input.
+ */
+static struct k_spinlock mux_ch_lock;
+static struct k_spinlock mux_at_lock;
+
+/* Frames are queued and sent from their own work queue, so that a frame that
+ * cannot be sent right away is retried instead of lost.
+ */
+RING_BUF_DECLARE(mux_tx_rb, CONFIG_SLM_MUX_TX_BUF_SIZE);
+static K_MUTEX_DEFINE(mux_tx_lock);
+static K_CONDVAR_DEFINE(mux_tx_space);
+static struct k_work_q mux_tx_wq;
+static K_THREAD_STACK_DEFINE(mux_tx_wq_stack, TX_WQ_STACK_SIZE);
+static struct k_work_delayable mux_tx_work;
+
+/* global variable defined in different files */
+extern struct at_param_list at_param_list;
+extern char rsp_buf[SLM_AT_CMD_RESPONSE_MAX_LEN];
+
+static struct mux_channel *channel_get(uint8_t channel)
+{
+	if (channel == SLM_MUX_AT_CHANNEL || channel > CONFIG_SLM_MUX_CHANNELS) {
+		return NULL;
+	}
+
+	return &channels[channel - 1];
+}
+
+static uint8_t channel_number(const struct mux_channel *ch)
+{
+	return (ch - channels) + 1;
+}
+
+static void mux_tx(struct k_work *work)
+{
+	uint8_t *data;
+	uint32_t size;
+	int ret;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		k_mutex_lock(&mux_tx_lock, K_FOREVER);
+		size = ring_buf_get_claim(&mux_tx_rb, &data, MUX_HDR_LEN + CONFIG_SLM_MUX_FRAME_SIZE);
+		k_mutex_unlock(&mux_tx_lock);
+		if (size == 0) {
+			break;
+		}
+
+		/* This work is the only consumer, the claimed data stays in place. */
+		ret = raw_uart_send(data, size);
+
+		k_mutex_lock(&mux_tx_lock, K_FOREVER);
+		(void)ring_buf_get_finish(&mux_tx_rb, ret ? 0 : size);
+		if (ret == 0) {
+			/* Wake up the senders waiting for room */
+			k_condvar_broadcast(&mux_tx_space);
+		}
+		k_mutex_unlock(&mux_tx_lock);
+
+		if (ret) {
+			LOG_DBG("Frame send failed: %d, retry", ret);
+			k_work_schedule_for_queue(&mux_tx_wq, &mux_tx_work, MUX_TX_RETRY_TIME);
+			return;
+		}
+
+		/* The mux thread may be waiting for room to forward socket data */
+		k_sem_give(&mux_sem);
+	}
+}
+
+static size_t tx_space_get(void)
+{
+	size_t space;
+
+	k_mutex_lock(&mux_tx_lock, K_FOREVER);
+	space = ring_buf_space_get(&mux_tx_rb);
+	k_mutex_unlock(&mux_tx_lock);
+
+	return (space > MUX_HDR_LEN) ? (space - MUX_HDR_LEN) : 0;
+}
+
+/* Queue a frame to the host, waiting up to timeout for room in the TX buffer. */
+static int frame_send(uint8_t channel, uint8_t type, const uint8_t *data, uint16_t len,
+		      k_timeout_t timeout)
+{
+	uint8_t hdr[MUX_HDR_LEN];
+
+	hdr[0] = MUX_SOF;
+	hdr[1] = channel;
+	hdr[2] = type;
+	sys_put_le16(len, &hdr[3]);
+	hdr[5] = 0xFF ^ hdr[1] ^ hdr[2] ^ hdr[3] ^ hdr[4];
+
+	k_mutex_lock(&mux_tx_lock, K_FOREVER);
+	while (ring_buf_space_get(&mux_tx_rb) < MUX_HDR_LEN + len) {
+		if (k_condvar_wait(&mux_tx_space, &mux_tx_lock, timeout) != 0) {
+			k_mutex_unlock(&mux_tx_lock);
+			LOG_WRN("TX buffer full, frame dropped on channel %d", channel);
+			return -ENOBUFS;
+		}
+	}
+	(void)ring_buf_put(&mux_tx_rb, hdr, sizeof(hdr));
+	(void)ring_buf_put(&mux_tx_rb, data, len);
+	k_mutex_unlock(&mux_tx_lock);
+
+	/* Does nothing if a retry is already scheduled */
+	k_work_schedule_for_queue(&mux_tx_wq, &mux_tx_work, K_NO_WAIT);
+
+	return 0;
+}
+
+static int credit_send(uint8_t channel, uint16_t credit)
+{
+	uint8_t payload[MUX_CREDIT_LEN];
+
+	sys_put_le16(credit, payload);
+	return frame_send(channel, MUX_FRAME_CREDIT, payload, sizeof(payload), K_NO_WAIT);
+}
+
+int slm_mux_send(uint8_t channel, const uint8_t *data, size_t len)
+{
+	int ret = 0;
+
+	while (len > 0 && ret == 0) {
+		uint16_t size = MIN(len, CONFIG_SLM_MUX_FRAME_SIZE);
+
+		ret = frame_send(channel, MUX_FRAME_DATA, data, size, MUX_AT_TX_TIMEOUT);
+		data += size;
+		len -= size;
+	}
+
+	return ret;
+}
+
+void slm_mux_tx_drain(void)
+{
+	k_mutex_lock(&mux_tx_lock, K_FOREVER);
+	while (!ring_buf_is_empty(&mux_tx_rb)) {
+		if (k_condvar_wait(&mux_tx_space, &mux_tx_lock, MUX_AT_TX_TIMEOUT) != 0) {
+			LOG_WRN("TX buffer not drained");
+			break;
+		}
+	}
+	k_mutex_unlock(&mux_tx_lock);
+}
+
+static void channel_fd_set(struct mux_channel *ch, int fd)
+{
+	k_spinlock_key_t key = k_spin_lock(&mux_ch_lock);
+
+	ch->fd = fd;
+
+	k_spin_unlock(&mux_ch_lock, key);
+}
+
+static void channel_bind(struct mux_channel *ch, int fd)
+{
+	ring_buf_init(&ch->rb, sizeof(ch->buf), ch->buf);
+	atomic_set(&ch->credit, 0);
+	atomic_set(&ch->close, 0);
+	atomic_set(&ch->unbind, 0);
+	ch->freed = 0;
+	ch->tx_bytes = 0;
+	ch->rx_bytes = 0;
+	ch->overruns = 0;
+	channel_fd_set(ch, fd);
+}
+
+/* Only called from the mux thread, which is the only user of a bound socket. */
+static void channel_close(struct mux_channel *ch)
+{
+	LOG_INF("Channel %d closed, socket %d", channel_number(ch), ch->fd);
+
+	channel_fd_set(ch, INVALID_SOCKET);
+	(void)frame_send(channel_number(ch), MUX_FRAME_CLOSE, NULL, 0, K_FOREVER);
+}
+
+/* Feed the buffered AT channel input to the AT command parser, until a command
+ * is pending. Called from the UART callback and when a command is done.
+ */
+static void at_rx_process(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&mux_at_lock);
+	uint8_t *data;
+	uint32_t size;
+	size_t used;
+	size_t freed = 0;
+
+	while (true) {
+		size = ring_buf_get_claim(&mux_at.rb, &data, sizeof(mux_at.buf));
+		if (size == 0) {
+			break;
+		}
+		used = muxmode_cmd_rx(data, size);
+		(void)ring_buf_get_finish(&mux_at.rb, used);
+		freed += used;
+		if (used < size) {
+			/* AT command pending */
+			break;
+		}
+	}
+
+	k_spin_unlock(&mux_at_lock, key);
+
+	if (freed > 0) {
+		/* The credit is returned by the mux thread */
+		atomic_add(&mux_at.freed, freed);
+		k_sem_give(&mux_sem);
+	}
+}
+
+void slm_mux_cmd_done(void)
+{
+	at_rx_process();
+	/* The initial credit of the AT channel is sent once in multiplexing mode */
+	k_sem_give(&mux_sem);
+}
+
+static void at_credit_send(void)
+{
+	atomic_val_t freed = atomic_get(&mux_at.freed);
+
+	/* The initial credit waits until the multiplexing mode is entered */
+	if (freed == 0 || !in_muxmode()) {
+		return;
+	}
+	if (freed < MIN(MUX_CREDIT_THRESHOLD, sizeof(mux_at.buf) / 4) &&
+	    !ring_buf_is_empty(&mux_at.rb)) {
+		return;
+	}
+	if (credit_send(SLM_MUX_AT_CHANNEL, freed) == 0) {
+		atomic_sub(&mux_at.freed, freed);
+	}
+}
+
+static void rx_frame_done(void)
+{
+	struct mux_channel *ch = channel_get(mux_rx.channel);
+
+	if (ch == NULL || ch->fd == INVALID_SOCKET) {
+		return;
+	}
+
+	switch (mux_rx.type) {
+	case MUX_FRAME_CREDIT:
+		if (mux_rx.len == MUX_CREDIT_LEN) {
+			atomic_add(&ch->credit, sys_get_le16(mux_rx.ctrl));
+			k_sem_give(&mux_sem);
+		}
+		break;
+	case MUX_FRAME_CLOSE:
+		atomic_set(&ch->close, 1);
+		k_sem_give(&mux_sem);
+		break;
+	default:
+		break;
+	}
+}
+
+static void rx_payload(const uint8_t *data, size_t len)
+{
+	struct mux_channel *ch;
+	uint32_t put;
+
+	if (mux_rx.type != MUX_FRAME_DATA) {
+		for (size_t i = 0; i < len; i++) {
+			if (mux_rx.pos + i < sizeof(mux_rx.ctrl)) {
+				mux_rx.ctrl[mux_rx.pos + i] = data[i];
+			}
+		}
+		return;
+	}
+
+	if (mux_rx.channel == SLM_MUX_AT_CHANNEL) {
+		k_spinlock_key_t key = k_spin_lock(&mux_at_lock);
+
+		put = ring_buf_put(&mux_at.rb, data, len);
+		k_spin_unlock(&mux_at_lock, key);
+		if (put < len) {
+			mux_at.overruns += len - put;
+			LOG_WRN("AT channel overrun, %d dropped", len - put);
+		}
+		at_rx_process();
+		return;
+	}
+
+	ch = channel_get(mux_rx.channel);
+	if (ch == NULL) {
+		LOG_WRN("Channel %d not bound, %d dropped", mux_rx.channel, len);
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&mux_ch_lock);
+
+	if (ch->fd == INVALID_SOCKET) {
+		k_spin_unlock(&mux_ch_lock, key);
+		LOG_WRN("Channel %d not bound, %d dropped", mux_rx.channel, len);
+		return;
+	}
+	put = ring_buf_put(&ch->rb, data, len);
+	if (put < len) {
+		ch->overruns += len - put;
+	}
+
+	k_spin_unlock(&mux_ch_lock, key);
+
+	k_sem_give(&mux_sem);
+}
+
+void slm_mux_rx(const uint8_t *data, size_t len)
+{
+	size_t i = 0;
+
+	while (i < len) {
+		switch (mux_rx.state) {
+		case MUX_RX_SOF:
+			if (data[i++] == MUX_SOF) {
+				mux_rx.hdr_len = 0;
+				mux_rx.state = MUX_RX_HEADER;
+			}
+			break;
+
+		case MUX_RX_HEADER:
+			mux_rx.hdr[mux_rx.hdr_len++] = data[i++];
+			if (mux_rx.hdr_len < sizeof(mux_rx.hdr)) {
+				break;
+			}
+			if ((0xFF ^ mux_rx.hdr[0] ^ mux_rx.hdr[1] ^ mux_rx.hdr[2] ^
+			     mux_rx.hdr[3]) != mux_rx.hdr[4]) {
+				LOG_WRN("Invalid frame header");
+				mux_rx.state = MUX_RX_SOF;
+				break;
+			}
+			mux_rx.channel = mux_rx.hdr[0];
+			mux_rx.type = mux_rx.hdr[1];
+			mux_rx.len = sys_get_le16(&mux_rx.hdr[2]);
+			mux_rx.pos = 0;
+			if (mux_rx.len > CONFIG_SLM_MUX_FRAME_SIZE) {
+				LOG_WRN("Frame too long: %d", mux_rx.len);
+				mux_rx.state = MUX_RX_SOF;
+				break;
+			}
+			if (mux_rx.len == 0) {
+				rx_frame_done();
+				mux_rx.state = MUX_RX_SOF;
+				break;
+			}
+			mux_rx.state = MUX_RX_PAYLOAD;
+			break;
+
+		case MUX_RX_PAYLOAD: {
+			size_t size = MIN(len - i, mux_rx.len - mux_rx.pos);
+
+			rx_payload(&data[i], size);
+			mux_rx.pos += size;
+			i += size;
+			if (mux_rx.pos == mux_rx.len) {
+				rx_frame_done();
+				mux_rx.state = MUX_RX_SOF;
+			}
+			break;
+		}
+		}
+	}
+}
+
+/* Send the data received from the host to the socket. Returns true if the socket
+ * must be polled for POLLOUT before sending more.
+ */
+static bool channel_tx(struct mux_channel *ch)
+{
+	uint8_t *data;
+	uint32_t size;
+	int ret;
+
+	while (true) {
+		size = ring_buf_get_claim(&ch->rb, &data, sizeof(ch->buf));
+		if (size == 0) {
+			break;
+		}
+		ret = send(ch->fd, data, size, MSG_DONTWAIT);
+		if (ret < 0) {
+			(void)ring_buf_get_finish(&ch->rb, 0);
+			if (errno == EAGAIN) {
+				return true;
+			}
+			LOG_ERR("send() failed on channel %d: %d", channel_number(ch), -errno);
+			channel_close(ch);
+			return false;
+		}
+		(void)ring_buf_get_finish(&ch->rb, ret);
+		ch->tx_bytes += ret;
+		ch->freed += ret;
+		if (ch->freed >= MUX_CREDIT_THRESHOLD &&
+		    credit_send(channel_number(ch), ch->freed) == 0) {
+			ch->freed = 0;
+		}
+	}
+
+	/* Credit that could not be queued is retried on the next round */
+	if (ch->freed > 0 && credit_send(channel_number(ch), ch->freed) == 0) {
+		ch->freed = 0;
+	}
+
+	return false;
+}
+
+/* Forward the data received from the socket to the host, within the credit
+ * given by the host and the room in the TX buffer, so that the received data
+ * is never dropped.
+ */
+static void channel_rx(struct mux_channel *ch)
+{
+	size_t size = MIN(MIN(atomic_get(&ch->credit), sizeof(mux_rx_data)), tx_space_get());
+	int ret;
+
+	if (size == 0) {
+		return;
+	}
+
+	ret = recv(ch->fd, mux_rx_data, size, MSG_DONTWAIT);
+	if (ret < 0) {
+		if (errno != EAGAIN) {
+			LOG_ERR("recv() failed on channel %d: %d", channel_number(ch), -errno);
+			channel_close(ch);
+		}
+		return;
+	}
+	if (ret == 0) {
+		/* Orderly shutdown by the remote */
+		channel_close(ch);
+		return;
+	}
+
+	atomic_sub(&ch->credit, ret);
+	ch->rx_bytes += ret;
+	/* Room was checked above, only AT responses may have taken it meanwhile */
+	(void)frame_send(channel_number(ch), MUX_FRAME_DATA, mux_rx_data, ret, K_FOREVER);
+}
+
+static void mux_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct pollfd fds[CONFIG_SLM_MUX_CHANNELS];
+	struct mux_channel *polled[CONFIG_SLM_MUX_CHANNELS];
+	int nfds;
+	int ret;
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (mux_running) {
+		nfds = 0;
+
+		at_credit_send();
+
+		for (int i = 0; i < ARRAY_SIZE(channels); i++) {
+			struct mux_channel *ch = &channels[i];
+			short events = 0;
+
+			if (ch->fd == INVALID_SOCKET) {
+				continue;
+			}
+			if (atomic_cas(&ch->unbind, 1, 0)) {
+				LOG_INF("Channel %d unbound, socket %d", channel_number(ch), ch->fd);
+				channel_fd_set(ch, INVALID_SOCKET);
+				k_sem_give(&mux_unbind_done);
+				continue;
+			}
+			if (atomic_cas(&ch->close, 1, 0)) {
+				channel_close(ch);
+				continue;
+			}
+			if (channel_tx(ch)) {
+				events |= POLLOUT;
+			}
+			if (ch->fd != INVALID_SOCKET && atomic_get(&ch->credit) > 0 &&
+			    tx_space_get() > 0) {
+				events |= POLLIN;
+			}
+			if (events) {
+				fds[nfds].fd = ch->fd;
+				fds[nfds].events = events;
+				fds[nfds].revents = 0;
+				polled[nfds++] = ch;
+			}
+		}
+
+		if (nfds == 0) {
+			/* Nothing to poll, wait for data or credit from the host,
+			 * or room in the TX buffer.
+			 */
+			(void)k_sem_take(&mux_sem, K_FOREVER);
+			continue;
+		}
+
+		/* Data or credit received from the host are picked up at the latest
+		 * after the poll period.
+		 */
+		ret = poll(fds, nfds, CONFIG_SLM_MUX_POLL_TIME);
+		if (ret < 0) {
+			LOG_ERR("poll() failed: %d", -errno);
+			(void)k_sem_take(&mux_sem, K_MSEC(CONFIG_SLM_MUX_POLL_TIME));
+			continue;
+		}
+
+		for (int i = 0; i < nfds; i++) {
+			struct mux_channel *ch = polled[i];
+
+			if (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+				channel_close(ch);
+			} else if (fds[i].revents & POLLIN) {
+				channel_rx(ch);
+			}
+		}
+	}
+}
+
+static void mux_start(void)
+{
+	mux_rx.state = MUX_RX_SOF;
+	ring_buf_init(&mux_at.rb, sizeof(mux_at.buf), mux_at.buf);
+	mux_at.overruns = 0;
+	/* Let the host send up to the size of the AT channel buffer */
+	atomic_set(&mux_at.freed, sizeof(mux_at.buf));
+	mux_running = true;
+	k_thread_create(&mux_thread, mux_thread_stack,
+			K_THREAD_STACK_SIZEOF(mux_thread_stack),
+			mux_thread_fn, NULL, NULL, NULL,
+			THREAD_PRIORITY, K_USER, K_NO_WAIT);
+}
+
+static void mux_stop(void)
+{
+	mux_running = false;
+	k_sem_give(&mux_sem);
+	if (k_thread_join(&mux_thread, K_MSEC(CONFIG_SLM_MUX_POLL_TIME * 10)) != 0) {
+		LOG_WRN("Wait for thread terminate failed");
+		k_thread_abort(&mux_thread);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(channels); i++) {
+		channel_fd_set(&channels[i], INVALID_SOCKET);
+	}
+}
+
+/**@brief handle AT#XMUX commands
+ *  AT#XMUX=<op>
+ *  AT#XMUX?
+ *  AT#XMUX=?
+ */
+int handle_at_mux(enum at_cmd_type cmd_type)
+{
+	int err = -EINVAL;
+	uint16_t op;
+
+	switch (cmd_type) {
+	case AT_CMD_TYPE_SET_COMMAND:
+		err = at_params_unsigned_short_get(&at_param_list, 1, &op);
+		if (err) {
+			return err;
+		}
+		if (op == MUX_OP_START) {
+			err = enter_muxmode();
+			if (err) {
+				return err;
+			}
+			mux_start();
+		} else if (op == MUX_OP_STOP) {
+			if (!in_muxmode()) {
+				return -EINVAL;
+			}
+			mux_stop();
+			(void)exit_muxmode();
+		} else {
+			err = -EINVAL;
+		}
+		break;
+
+	case AT_CMD_TYPE_READ_COMMAND:
+		sprintf(rsp_buf, "\r\n#XMUX: %d,%d\r\n", in_muxmode() ? 1 : 0,
+			CONFIG_SLM_MUX_CHANNELS);
+		rsp_send(rsp_buf, strlen(rsp_buf));
+		err = 0;
+		break;
+
+	case AT_CMD_TYPE_TEST_COMMAND:
+		sprintf(rsp_buf, "\r\n#XMUX: (%d,%d)\r\n", MUX_OP_STOP, MUX_OP_START);
+		rsp_send(rsp_buf, strlen(rsp_buf));
+		err = 0;
+		break;
+
+	default:
+		break;
+	}
+
+	return err;
+}
+
+/**@brief handle AT#XMUXBIND commands
+ *  AT#XMUXBIND=<channel>[,<handle>]
+ *  AT#XMUXBIND?
+ *  AT#XMUXBIND=?
+ */
+int handle_at_muxbind(enum at_cmd_type cmd_type)
+{
+	int err = -EINVAL;
+	struct mux_channel *ch;
+	uint16_t channel;
+	int handle = INVALID_SOCKET;
+	char buf[64];
+
+	switch (cmd_type) {
+	case AT_CMD_TYPE_SET_COMMAND:
+		if (!in_muxmode()) {
+			LOG_ERR("Not in multiplexing mode");
+			return -EINVAL;
+		}
+		err = at_params_unsigned_short_get(&at_param_list, 1, &channel);
+		if (err) {
+			return err;
+		}
+		ch = channel_get(channel);
+		if (ch == NULL) {
+			return -EINVAL;
+		}
+		if (at_params_valid_count_get(&at_param_list) > 2) {
+			err = at_params_int_get(&at_param_list, 2, &handle);
+			if (err) {
+				return err;
+			}
+		}
+		if (handle == INVALID_SOCKET) {
+			if (ch->fd == INVALID_SOCKET) {
+				return 0;
+			}
+			/* The mux thread unbinds the socket when it is not using it */
+			k_sem_reset(&mux_unbind_done);
+			atomic_set(&ch->unbind, 1);
+			k_sem_give(&mux_sem);
+			if (k_sem_take(&mux_unbind_done, MUX_UNBIND_TIMEOUT) != 0) {
+				LOG_ERR("Unbind timeout on channel %d", channel);
+				return -ETIMEDOUT;
+			}
+			return 0;
+		}
+		if (ch->fd != INVALID_SOCKET) {
+			LOG_ERR("Channel %d already bound", channel);
+			return -EBUSY;
+		}
+		for (int i = 0; i < ARRAY_SIZE(channels); i++) {
+			if (channels[i].fd == handle) {
+				LOG_ERR("Socket %d already bound", handle);
+				return -EBUSY;
+			}
+		}
+
+		struct pollfd fd = {
+			.fd = handle,
+			.events = POLLIN
+		};
+
+		if (poll(&fd, 1, 0) < 0 || (fd.revents & POLLNVAL)) {
+			LOG_ERR("Invalid socket: %d", handle);
+			return -EBADF;
+		}
+
+		channel_bind(ch, handle);
+		/* Let the host send up to the size of the channel buffer */
+		ch->freed = sizeof(ch->buf);
+		k_sem_give(&mux_sem);
+		break;
+
+	case AT_CMD_TYPE_READ_COMMAND:
+		memset(rsp_buf, 0x00, sizeof(rsp_buf));
+		for (int i = 0; i < ARRAY_SIZE(channels); i++) {
+			if (channels[i].fd != INVALID_SOCKET) {
+				sprintf(buf, "\r\n#XMUXBIND: %d,%d,%d,%d,%d\r\n",
+					channel_number(&channels[i]), channels[i].fd,
+					channels[i].tx_bytes, channels[i].rx_bytes,
+					channels[i].overruns);
+				strcat(rsp_buf, buf);
+			}
+		}
+		rsp_send(rsp_buf, strlen(rsp_buf));
+		err = 0;
+		break;
+
+	case AT_CMD_TYPE_TEST_COMMAND:
+		sprintf(rsp_buf, "\r\n#XMUXBIND: (1-%d),<handle>\r\n", CONFIG_SLM_MUX_CHANNELS);
+		rsp_send(rsp_buf, strlen(rsp_buf));
+		err = 0;
+		break;
+
+	default:
+		break;
+	}
+
+	return err;
+}
+
+int slm_mux_init(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(channels); i++) {
+		channels[i].fd = INVALID_SOCKET;
+	}
+
+	k_work_queue_start(&mux_tx_wq, mux_tx_wq_stack,
+			   K_THREAD_STACK_SIZEOF(mux_tx_wq_stack),
+			   TX_WQ_PRIORITY, NULL);
+	k_work_init_delayable(&mux_tx_work, mux_tx);
+
+	return 0;
+}
+
+int slm_mux_uninit(void)
+{
+	if (in_muxmode()) {
+		mux_stop();
+	}
+
+	return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SLM_MUX_
+#define SLM_MUX_
+
+/**@file slm_mux.h
+ *
+ * @brief Multiplexing of AT commands and socket data over the UART.
+ * @{
+ */
+
+#include <zephyr/types.h>
+
+/** Channel that carries AT commands, responses and notifications. */
+#define SLM_MUX_AT_CHANNEL 0
+
+/**
+ * @brief Send data to the host in multiplexing mode
+ *
+ * The data is split into frames of at most CONFIG_SLM_MUX_FRAME_SIZE bytes and
+ * queued for sending. Frames that cannot be sent right away, for example
+ * while the UART is off, are retried.
+ *
+ * @param channel Channel to send the data on.
+ * @param data Data to send.
+ * @param len Length of the data.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOBUFS If the TX buffer stayed full, the rest of the data was not queued.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int slm_mux_send(uint8_t channel, const uint8_t *data, size_t len);
+
+/**
+ * @brief Handle data received from the host in multiplexing mode
+ *
+ * Called from the UART callback.
+ *
+ * @param data Received data.
+ * @param len Length of the received data.
+ */
+void slm_mux_rx(const uint8_t *data, size_t len);
+
+/**
+ * @brief Continue with the AT channel input after an AT command is done
+ *
+ * AT channel input received while a command is pending is held in a buffer.
+ * The host is given credit for the AT channel as the buffer is consumed.
+ */
+void slm_mux_cmd_done(void);
+
+/**
+ * @brief Wait until the frames queued for the host have been sent
+ *
+ * Called before leaving multiplexing mode.
+ */
+void slm_mux_tx_drain(void);
+
+/**
+ * @brief Initialize multiplexing AT command parser.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int slm_mux_init(void);
+
+/**
+ * @brief Uninitialize multiplexing AT command parser.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int slm_mux_uninit(void);
+
+/** @} */
+
+#endif /* SLM_MUX_ */
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include "slm_term.h"
+
+int slm_term_init(struct slm_term *term, const char *str)
+{
+	size_t k = 0;
+	size_t len = strlen(str);
+
+	if (len == 0 || len > SLM_TERM_MAX_LEN) {
+		return -EINVAL;
+	}
+
+	term->str = str;
+	term->len = len;
+	term->match = 0;
+
+	/* Longest proper prefix of the terminator that is also a suffix, for each length */
+	term->fallback[0] = 0;
+	for (size_t i = 1; i < len; i++) {
+		while (k > 0 && str[i] != str[k]) {
+			k = term->fallback[k - 1];
+		}
+		if (str[i] == str[k]) {
+			k++;
+		}
+		term->fallback[i] = k;
+	}
+
+	return 0;
+}
+
+void slm_term_reset(struct slm_term *term)
+{
+	term->match = 0;
+}
+
+size_t slm_term_match_update(const struct slm_term *term, size_t match,
+			     const uint8_t *data, size_t len)
+{
+	/* The match only depends on the last terminator-length bytes */
+	if (len >= term->len) {
+		data += len - term->len;
+		len = term->len;
+		match = 0;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		if (match == term->len) {
+			match = term->fallback[match - 1];
+		}
+		while (match > 0 && data[i] != (uint8_t)term->str[match]) {
+			match = term->fallback[match - 1];
+		}
+		if (data[i] == (uint8_t)term->str[match]) {
+			match++;
+		}
+	}
+
+	return match;
+}
+
+bool slm_term_chunk_send(struct slm_term *term, const uint8_t *data, size_t len,
+			 slm_term_send_t send)
+{
+	size_t held = term->match;
+	size_t match = slm_term_match_update(term, term->match, data, len);
+	/* The held back bytes and the received data, minus the new terminator prefix */
+	size_t size_send = held + len - match;
+	size_t size_held_send = held < size_send ? held : size_send;
+	bool quit = false;
+
+	term->match = match;
+
+	/* Held back bytes were a terminator prefix, not followed by the rest of it */
+	if (size_held_send > 0) {
+		quit = send((const uint8_t *)term->str, size_held_send);
+		size_send -= size_held_send;
+	}
+	if (!quit && size_send > 0) {
+		quit = send(data, size_send);
+	}
+
+	return quit;
+}
+
+bool slm_term_flush(struct slm_term *term, slm_term_send_t send)
+{
+	size_t held = term->match;
+
+	term->match = 0;
+	if (held == term->len) {
+		return true;
+	}
+	if (held > 0) {
+		return send((const uint8_t *)term->str, held);
+	}
+
+	return false;
+}
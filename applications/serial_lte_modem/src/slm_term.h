@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SLM_TERM_
+#define SLM_TERM_
+
+/**@file slm_term.h
+ *
+ * @brief Data mode terminator detection for serial LTE modem
+ * @{
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Maximum length of the data mode terminator. */
+#define SLM_TERM_MAX_LEN 16
+
+/**@brief Data mode sending function.
+ *
+ * @retval true if data mode is to be exited, false otherwise.
+ */
+typedef bool (*slm_term_send_t)(const uint8_t *data, size_t len);
+
+/**@brief Terminator matcher. */
+struct slm_term {
+	const char *str;        /* Terminator */
+	size_t len;             /* Length of the terminator */
+	size_t match;           /* Length of the terminator prefix held back from sending */
+	uint8_t fallback[SLM_TERM_MAX_LEN];
+};
+
+/**
+ * @brief Initialize terminator matcher
+ *
+ * @param term Terminator matcher
+ * @param str Terminator, at most SLM_TERM_MAX_LEN characters
+ *
+ * @retval 0 If the operation was successful.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int slm_term_init(struct slm_term *term, const char *str);
+
+/**
+ * @brief Forget the held back terminator prefix
+ *
+ * @param term Terminator matcher
+ */
+void slm_term_reset(struct slm_term *term);
+
+/**
+ * @brief Update terminator prefix match over received data
+ *
+ * Only the last terminator-length bytes of the data are examined.
+ *
+ * @param term Terminator matcher
+ * @param match Length of the terminator prefix matched before the data
+ * @param data Received data
+ * @param len Length of received data
+ *
+ * @return Length of the terminator prefix at the end of the data.
+ */
+size_t slm_term_match_update(const struct slm_term *term, size_t match,
+			     const uint8_t *data, size_t len);
+
+/**
+ * @brief Send a chunk of received data
+ *
+ * A terminator prefix at the end of the chunk is held back, and sent with the next chunk if
+ * it is not followed by the rest of the terminator.
+ *
+ * @param term Terminator matcher
+ * @param data Received data
+ * @param len Length of received data
+ * @param send Sending function
+ *
+ * @retval true if data mode is to be exited, false otherwise.
+ */
+bool slm_term_chunk_send(struct slm_term *term, const uint8_t *data, size_t len,
+			 slm_term_send_t send);
+
+/**
+ * @brief Handle the end of a burst of received data
+ *
+ * @param term Terminator matcher
+ * @param send Sending function, called with the held back bytes if they are not the terminator
+ *
+ * @retval true if data mode is to be exited, false otherwise.
+ */
+bool slm_term_flush(struct slm_term *term, slm_term_send_t send);
+
+/** @} */
+
+#endif /* SLM_TERM_ */
@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* UART towards the host, implementing the asynchronous API in place of the UARTE driver */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/pm/device.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+#include "fake_uart.h"
+
+#define UART_NODE DT_NODELABEL(uart2)
+
+struct fake_uart_data {
+	uart_callback_t callback;
+	void *user_data;
+	struct uart_config cfg;
+	bool rx_enabled;
+	bool buf_requested;
+	uint8_t *buf;
+	size_t buf_len;
+	size_t pos;             /* Bytes written to the current buffer */
+	size_t rdy;             /* Bytes of the current buffer reported as received */
+	uint8_t *next_buf;
+	size_t next_len;
+	char tx[1024];
+	size_t tx_len;
+};
+
+static struct fake_uart_data fake_uart;
+
+static void evt_send(struct uart_event *evt)
+{
+	if (fake_uart.callback) {
+		fake_uart.callback(DEVICE_DT_GET(UART_NODE), evt, fake_uart.user_data);
+	}
+}
+
+static void rx_rdy(void)
+{
+	struct uart_event evt = {
+		.type = UART_RX_RDY,
+		.data.rx.buf = fake_uart.buf,
+		.data.rx.offset = fake_uart.rdy,
+		.data.rx.len = fake_uart.pos - fake_uart.rdy
+	};
+
+	if (evt.data.rx.len == 0) {
+		return;
+	}
+	/* Updated first, as the handler may disable RX */
+	fake_uart.rdy = fake_uart.pos;
+	evt_send(&evt);
+}
+
+static void buf_released(uint8_t *buf)
+{
+	struct uart_event evt = {
+		.type = UART_RX_BUF_RELEASED,
+		.data.rx_buf.buf = buf
+	};
+
+	evt_send(&evt);
+}
+
+static void rx_disabled(void)
+{
+	struct uart_event evt = {
+		.type = UART_RX_DISABLED
+	};
+
+	fake_uart.rx_enabled = false;
+	evt_send(&evt);
+}
+
+/* Requested when the reception to the current buffer has started */
+static void buf_request(void)
+{
+	struct uart_event evt = {
+		.type = UART_RX_BUF_REQUEST
+	};
+
+	if (!fake_uart.buf_requested) {
+		fake_uart.buf_requested = true;
+		evt_send(&evt);
+	}
+}
+
+static void buf_full(void)
+{
+	uint8_t *buf = fake_uart.buf;
+
+	rx_rdy();
+	if (!fake_uart.rx_enabled) {
+		/* Disabled by the handler */
+		return;
+	}
+	if (fake_uart.next_buf == NULL) {
+		/* RX stops until enabled again */
+		fake_uart.rx_enabled = false;
+		buf_released(buf);
+		rx_disabled();
+		return;
+	}
+
+	fake_uart.buf = fake_uart.next_buf;
+	fake_uart.buf_len = fake_uart.next_len;
+	fake_uart.next_buf = NULL;
+	fake_uart.pos = 0;
+	fake_uart.rdy = 0;
+	fake_uart.buf_requested = false;
+	buf_released(buf);
+	buf_request();
+}
+
+size_t fake_uart_rx(const uint8_t *data, size_t len, size_t chunk)
+{
+	size_t received = 0;
+	unsigned int key = irq_lock();
+
+	while (received < len && fake_uart.rx_enabled) {
+		size_t size;
+
+		buf_request();
+		size = MIN(chunk, len - received);
+		size = MIN(size, fake_uart.buf_len - fake_uart.pos);
+		memcpy(fake_uart.buf + fake_uart.pos, data + received, size);
+		fake_uart.pos += size;
+		received += size;
+
+		if (fake_uart.pos == fake_uart.buf_len) {
+			buf_full();
+		} else {
+			/* RX timeout */
+			rx_rdy();
+		}
+	}
+
+	irq_unlock(key);
+
+	return received;
+}
+
+size_t fake_uart_rx_stream(const uint8_t *data, size_t len, uint32_t timeout_ms)
+{
+	/* 8 data bits, start and stop bit */
+	size_t chunk = MAX(fake_uart.cfg.baudrate / 10 / MSEC_PER_SEC, 1);
+	int64_t end = k_uptime_get() + timeout_ms;
+	size_t received = 0;
+
+	while (received < len && k_uptime_get() < end) {
+		received += fake_uart_rx(data + received, MIN(chunk, len - received), chunk);
+		k_sleep(K_MSEC(1));
+	}
+
+	return received;
+}
+
+bool fake_uart_rx_enabled(void)
+{
+	return fake_uart.rx_enabled;
+}
+
+bool fake_uart_tx_find(const char *str)
+{
+	unsigned int key = irq_lock();
+	bool found = false;
+	size_t len = strlen(str);
+
+	for (size_t i = 0; i + len <= fake_uart.tx_len && !found; i++) {
+		found = (memcmp(&fake_uart.tx[i], str, len) == 0);
+	}
+
+	irq_unlock(key);
+
+	return found;
+}
+
+void fake_uart_tx_clear(void)
+{
+	unsigned int key = irq_lock();
+
+	fake_uart.tx_len = 0;
+	irq_unlock(key);
+}
+
+static int fake_uart_callback_set(const struct device *dev, uart_callback_t callback,
+				  void *user_data)
+{
+	ARG_UNUSED(dev);
+
+	fake_uart.callback = callback;
+	fake_uart.user_data = user_data;
+
+	return 0;
+}
+
+static int fake_uart_tx(const struct device *dev, const uint8_t *buf, size_t len,
+			int32_t timeout)
+{
+	struct uart_event evt = {
+		.type = UART_TX_DONE,
+		.data.tx.buf = buf,
+		.data.tx.len = len
+	};
+	unsigned int key = irq_lock();
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(timeout);
+
+	if (fake_uart.tx_len + len > sizeof(fake_uart.tx)) {
+		/* Keep the latest output only */
+		fake_uart.tx_len = 0;
+	}
+	if (len <= sizeof(fake_uart.tx)) {
+		memcpy(&fake_uart.tx[fake_uart.tx_len], buf, len);
+		fake_uart.tx_len += len;
+	}
+	evt_send(&evt);
+
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int fake_uart_tx_abort(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return -EFAULT;
+}
+
+static int fake_uart_rx_enable(const struct device *dev, uint8_t *buf, size_t len,
+			       int32_t timeout)
+{
+	unsigned int key = irq_lock();
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(timeout);
+
+	if (fake_uart.rx_enabled) {
+		irq_unlock(key);
+		return -EBUSY;
+	}
+
+	fake_uart.rx_enabled = true;
+	fake_uart.buf_requested = false;
+	fake_uart.buf = buf;
+	fake_uart.buf_len = len;
+	fake_uart.pos = 0;
+	fake_uart.rdy = 0;
+	fake_uart.next_buf = NULL;
+
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int fake_uart_rx_buf_rsp(const struct device *dev, uint8_t *buf, size_t len)
+{
+	ARG_UNUSED(dev);
+
+	if (!fake_uart.rx_enabled) {
+		return -EACCES;
+	}
+	if (fake_uart.next_buf != NULL) {
+		return -EBUSY;
+	}
+
+	fake_uart.next_buf = buf;
+	fake_uart.next_len = len;
+
+	return 0;
+}
+
+static int fake_uart_rx_disable(const struct device *dev)
+{
+	unsigned int key = irq_lock();
+	uint8_t *next_buf = fake_uart.next_buf;
+
+	ARG_UNUSED(dev);
+
+	if (!fake_uart.rx_enabled) {
+		irq_unlock(key);
+		return -EFAULT;
+	}
+
+	fake_uart.rx_enabled = false;
+	fake_uart.next_buf = NULL;
+	rx_rdy();
+	buf_released(fake_uart.buf);
+	if (next_buf != NULL) {
+		buf_released(next_buf);
+	}
+	rx_disabled();
+
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int fake_uart_poll_in(const struct device *dev, unsigned char *c)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(c);
+
+	return -1;
+}
+
+static void fake_uart_poll_out(const struct device *dev, unsigned char c)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(c);
+}
+
+static int fake_uart_err_check(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 0;
+}
+
+static int fake_uart_configure(const struct device *dev, const struct uart_config *cfg)
+{
+	ARG_UNUSED(dev);
+
+	fake_uart.cfg = *cfg;
+
+	return 0;
+}
+
+static int fake_uart_config_get(const struct device *dev, struct uart_config *cfg)
+{
+	ARG_UNUSED(dev);
+
+	*cfg = fake_uart.cfg;
+
+	return 0;
+}
+
+static const struct uart_driver_api fake_uart_api = {
+	.callback_set = fake_uart_callback_set,
+	.tx = fake_uart_tx,
+	.tx_abort = fake_uart_tx_abort,
+	.rx_enable = fake_uart_rx_enable,
+	.rx_buf_rsp = fake_uart_rx_buf_rsp,
+	.rx_disable = fake_uart_rx_disable,
+	.poll_in = fake_uart_poll_in,
+	.poll_out = fake_uart_poll_out,
+	.err_check = fake_uart_err_check,
+	.configure = fake_uart_configure,
+	.config_get = fake_uart_config_get,
+};
+
+static int fake_uart_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	fake_uart.cfg = (struct uart_config) {
+		.baudrate = 115200,
+		.parity = UART_CFG_PARITY_NONE,
+		.stop_bits = UART_CFG_STOP_BITS_1,
+		.data_bits = UART_CFG_DATA_BITS_8,
+		.flow_ctrl = UART_CFG_FLOW_CTRL_RTS_CTS
+	};
+
+	return 0;
+}
+
+static int fake_uart_pm_action(const struct device *dev, enum pm_device_action action)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(action);
+
+	return 0;
+}
+
+PM_DEVICE_DT_DEFINE(UART_NODE, fake_uart_pm_action);
+
+DEVICE_DT_DEFINE(UART_NODE, fake_uart_init, PM_DEVICE_DT_GET(UART_NODE), NULL, NULL,
+		 POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_uart_api);
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FAKE_UART_H_
+#define FAKE_UART_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Receive data from the host
+ *
+ * The data is written to the receive buffers in DMA chunks of at most @p chunk bytes, and
+ * the events of the asynchronous UART API are generated like by the UARTE driver. The data
+ * that does not fit into the buffers is not taken, like with hardware flow control.
+ *
+ * @param data Data sent by the host
+ * @param len Length of the data
+ * @param chunk Maximum length of a DMA chunk
+ *
+ * @return Number of bytes received.
+ */
+size_t fake_uart_rx(const uint8_t *data, size_t len, size_t chunk);
+
+/**
+ * @brief Receive a stream of data from the host at the configured baud rate
+ *
+ * The data is received in DMA chunks of one millisecond worth of data, with one millisecond
+ * between the chunks. The host waits while the data is not taken, like with hardware flow
+ * control, so the line rate is lost when the receive buffers are not freed in time.
+ *
+ * @param data Data sent by the host
+ * @param len Length of the data
+ * @param timeout_ms Maximum time to wait for the data to be taken
+ *
+ * @return Number of bytes received.
+ */
+size_t fake_uart_rx_stream(const uint8_t *data, size_t len, uint32_t timeout_ms);
+
+/** @return True if UART RX is enabled. */
+bool fake_uart_rx_enabled(void);
+
+/**
+ * @brief Check the data sent to the host
+ *
+ * @param str String to look for
+ *
+ * @return True if the string was sent since the last clearing.
+ */
+bool fake_uart_tx_find(const char *str);
+
+/** @brief Forget the data sent to the host. */
+void fake_uart_tx_clear(void);
+
+#endif /* FAKE_UART_H_ */
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/uart.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include "slm_at_host.h"
+#include "fake_uart.h"
+
+#define HOST_DATA_LEN  20000
+#define MAX_MSG_COUNT  16
+#define MAX_CHUNK_LEN  300
+#define WAIT_TIME_MS   2000
+
+/* Throughput test: 2 s of data at 1 Mbaud, sent in 2 ms per buffer by the handler */
+#define FAST_BAUDRATE     1000000
+#define STREAM_LEN        200000
+#define SEND_TIME_MS      2
+#define LINE_RATE         (FAST_BAUDRATE / 10)
+#define MIN_RATE_PERCENT  90
+
+/* Defined in slm_at_host.c */
+extern uint16_t datamode_time_limit;
+int slm_uart_configure(void);
+
+/* Used by slm_at_host.c */
+bool uart_configured;
+struct uart_config slm_uart;
+
+static K_MUTEX_DEFINE(test_lock);
+static uint32_t rand_state = 12345;
+
+/* Data sent by the host in data mode */
+static uint8_t host_data[HOST_DATA_LEN];
+
+/* What the data mode handler has got */
+static uint8_t recv_data[HOST_DATA_LEN];
+static size_t recv_len;
+static size_t recv_expected;
+static size_t msg_len[MAX_MSG_COUNT];
+static size_t msg_count;
+static int exit_count;
+/* Received data is checked against stream_byte() instead of being stored */
+static bool recv_stream;
+static size_t recv_errors;
+static uint32_t send_time_ms;
+
+/* Deterministic pseudo-random numbers so that failures can be reproduced */
+static uint32_t test_rand(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return rand_state >> 8;
+}
+
+static uint8_t stream_byte(size_t offset)
+{
+	return 'a' + offset % 26;
+}
+
+static bool wait_for(bool (*cond)(void))
+{
+	for (int i = 0; i < WAIT_TIME_MS; i++) {
+		bool done;
+
+		k_mutex_lock(&test_lock, K_FOREVER);
+		done = cond();
+		k_mutex_unlock(&test_lock);
+		if (done) {
+			return true;
+		}
+		k_sleep(K_MSEC(1));
+	}
+
+	return false;
+}
+
+/* Stubs of the other files of the application */
+
+int slm_at_init(void)
+{
+	return 0;
+}
+
+void slm_at_uninit(void)
+{
+}
+
+int slm_setting_uart_save(void)
+{
+	return 0;
+}
+
+int indicate_start(void)
+{
+	return 0;
+}
+
+void slm_fota_post_process(void)
+{
+}
+
+int nrf_modem_at_cmd(void *buf, size_t len, const char *fmt, ...)
+{
+	ARG_UNUSED(buf);
+	ARG_UNUSED(len);
+	ARG_UNUSED(fmt);
+
+	return -ENOEXEC;
+}
+
+static int datamode_handler(uint8_t op, const uint8_t *data, int len)
+{
+	k_mutex_lock(&test_lock, K_FOREVER);
+
+	if (op == DATAMODE_SEND) {
+		if (recv_stream) {
+			for (int i = 0; i < len; i++) {
+				if (data[i] != stream_byte(recv_len + i)) {
+					recv_errors++;
+				}
+			}
+		} else if (recv_len + len <= sizeof(recv_data)) {
+			memcpy(&recv_data[recv_len], data, len);
+		}
+		recv_len += len;
+		if (msg_count < MAX_MSG_COUNT) {
+			msg_len[msg_count] = len;
+		}
+		msg_count++;
+	} else if (op == DATAMODE_EXIT) {
+		exit_count++;
+	}
+
+	k_mutex_unlock(&test_lock);
+
+	if (op == DATAMODE_SEND && send_time_ms > 0) {
+		/* Time taken by the socket to send the data */
+		k_sleep(K_MSEC(send_time_ms));
+	}
+
+	return 0;
+}
+
+int slm_at_parse(const char *at_cmd)
+{
+	if (strcmp(at_cmd, "AT#XSTREAM") == 0) {
+		return enter_datamode(datamode_handler, DATAMODE_STREAM);
+	} else if (strcmp(at_cmd, "AT#XMESSAGE") == 0) {
+		return enter_datamode(datamode_handler, DATAMODE_MESSAGE);
+	}
+
+	return -ENOENT;
+}
+
+/* Conditions waited for */
+
+static bool rx_enabled(void)
+{
+	return fake_uart_rx_enabled();
+}
+
+static bool ok_received(void)
+{
+	return fake_uart_tx_find("\r\nOK\r\n");
+}
+
+static bool datamode_entered(void)
+{
+	return in_datamode() && fake_uart_rx_enabled();
+}
+
+static bool datamode_exited(void)
+{
+	return fake_uart_tx_find("\r\n#XDATAMODE: 0\r\n") && !in_datamode() &&
+	       fake_uart_rx_enabled();
+}
+
+static bool all_received(void)
+{
+	return recv_len >= recv_expected;
+}
+
+/* Sends a burst of data, waiting for the receive buffers like with hardware flow control */
+static void host_send(const uint8_t *data, size_t len, size_t chunk)
+{
+	size_t sent = 0;
+
+	for (int i = 0; i < WAIT_TIME_MS && sent < len; i++) {
+		sent += fake_uart_rx(data + sent, len - sent, chunk);
+		if (sent < len) {
+			k_sleep(K_MSEC(1));
+		}
+	}
+	zassert_equal(sent, len, "UART RX stuck");
+}
+
+/* Waits until the time limit has ended the burst */
+static void host_burst_end(void)
+{
+	k_sleep(K_MSEC(2 * datamode_time_limit));
+	zassert_true(wait_for(rx_enabled), "RX not resumed");
+}
+
+/* Random letters, with the terminator in the middle of longer bursts */
+static void burst_fill(uint8_t *buf, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = 'a' + test_rand() % 26;
+	}
+	if (len >= 8) {
+		memcpy(&buf[len / 2], CONFIG_SLM_DATAMODE_TERMINATOR,
+		       strlen(CONFIG_SLM_DATAMODE_TERMINATOR));
+	}
+}
+
+static void recv_reset(void)
+{
+	k_mutex_lock(&test_lock, K_FOREVER);
+	recv_len = 0;
+	recv_expected = 0;
+	recv_errors = 0;
+	msg_count = 0;
+	exit_count = 0;
+	k_mutex_unlock(&test_lock);
+}
+
+static void datamode_enter(const char *cmd)
+{
+	recv_reset();
+	datamode_stats_reset();
+	fake_uart_tx_clear();
+	zassert_true(wait_for(rx_enabled), "RX not enabled");
+	host_send((const uint8_t *)cmd, strlen(cmd), strlen(cmd));
+	zassert_true(wait_for(ok_received), "no OK");
+	zassert_true(wait_for(datamode_entered), "data mode not entered");
+}
+
+/* Sends the data and the terminator in the same burst */
+static void datamode_exit(const char *data)
+{
+	char burst[32];
+
+	snprintf(burst, sizeof(burst), "%s%s", data, CONFIG_SLM_DATAMODE_TERMINATOR);
+	fake_uart_tx_clear();
+	host_send((const uint8_t *)burst, strlen(burst), 1);
+	zassert_true(wait_for(datamode_exited), "data mode not exited");
+	zassert_equal(exit_count, 1, "handler not called on exit");
+}
+
+static void test_stream_bursts(void)
+{
+	/* Up to more than all the data mode buffers together */
+	static const size_t sizes[] = {1, 100, 1024, 1500, 4096, 10000};
+	struct slm_datamode_stats stats;
+	size_t total = 0;
+
+	datamode_enter("AT#XSTREAM\r\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		burst_fill(&host_data[total], sizes[i]);
+		if (sizes[i] == 100) {
+			/* Terminator prefix at the end of a burst is data */
+			memset(&host_data[total + sizes[i] - 2], '+', 2);
+		}
+		host_send(&host_data[total], sizes[i], test_rand() % MAX_CHUNK_LEN + 1);
+		total += sizes[i];
+		host_burst_end();
+	}
+
+	recv_expected = total;
+	zassert_true(wait_for(all_received), "data not received");
+	zassert_equal(recv_len, total, "wrong length");
+	zassert_mem_equal(recv_data, host_data, total, "wrong data");
+
+	datamode_stats_get(&stats);
+	zassert_equal(stats.rx_bytes, total, "wrong RX bytes");
+	zassert_equal(stats.tx_bytes, total, "wrong TX bytes");
+	zassert_equal(stats.dropped, 0, "data dropped");
+	zassert_true(stats.stalls > 0, "RX not stopped when out of buffers");
+
+	datamode_exit("");
+	zassert_equal(recv_len, total, "terminator sent as data");
+}
+
+static void test_stream_terminator_split(void)
+{
+	/* The terminator crosses the boundary of the data mode buffers */
+	const size_t len = 4096 / CONFIG_SLM_DATAMODE_BUF_COUNT - 2;
+
+	datamode_enter("AT#XSTREAM\r\n");
+
+	burst_fill(host_data, len);
+	memcpy(&host_data[len], CONFIG_SLM_DATAMODE_TERMINATOR,
+	       strlen(CONFIG_SLM_DATAMODE_TERMINATOR));
+	fake_uart_tx_clear();
+	host_send(host_data, len + strlen(CONFIG_SLM_DATAMODE_TERMINATOR), 3);
+
+	zassert_true(wait_for(datamode_exited), "data mode not exited");
+	zassert_equal(exit_count, 1, "handler not called on exit");
+	zassert_equal(recv_len, len, "wrong length");
+	zassert_mem_equal(recv_data, host_data, len, "wrong data");
+}
+
+static void test_message_boundaries(void)
+{
+	/* A burst longer than the data mode buffers is split */
+	static const size_t sizes[] = {10, 1024, 3000, 4096, 5000};
+	static const size_t msgs[] = {10, 1024, 3000, 4096, 4096, 904};
+	size_t total = 0;
+
+	datamode_enter("AT#XMESSAGE\r\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		burst_fill(&host_data[total], sizes[i]);
+		host_send(&host_data[total], sizes[i], test_rand() % MAX_CHUNK_LEN + 1);
+		total += sizes[i];
+		host_burst_end();
+	}
+
+	recv_expected = total;
+	zassert_true(wait_for(all_received), "data not received");
+	zassert_equal(msg_count, ARRAY_SIZE(msgs), "wrong message count");
+	for (size_t i = 0; i < ARRAY_SIZE(msgs); i++) {
+		zassert_equal(msg_len[i], msgs[i], "wrong length of message %d", (int)i);
+	}
+	zassert_mem_equal(recv_data, host_data, total, "wrong data");
+
+	/* The terminator is removed from the end of the message */
+	datamode_exit("hello");
+	zassert_equal(msg_count, ARRAY_SIZE(msgs) + 1, "wrong message count");
+	zassert_equal(msg_len[ARRAY_SIZE(msgs)], strlen("hello"), "wrong length");
+	zassert_mem_equal(&recv_data[total], "hello", strlen("hello"), "wrong data");
+}
+
+static void test_stream_throughput(void)
+{
+	static uint8_t stream[STREAM_LEN];
+	struct slm_datamode_stats stats;
+	int64_t start;
+	uint32_t elapsed;
+	uint32_t rate;
+
+	for (size_t i = 0; i < sizeof(stream); i++) {
+		stream[i] = stream_byte(i);
+	}
+
+	/* The time limit is computed from the baud rate when entering data mode */
+	slm_uart.baudrate = FAST_BAUDRATE;
+	zassert_ok(slm_uart_configure(), "UART configuration failed");
+	datamode_time_limit = 0;
+	recv_stream = true;
+	send_time_ms = SEND_TIME_MS;
+
+	datamode_enter("AT#XSTREAM\r\n");
+
+	start = k_uptime_get();
+	zassert_equal(fake_uart_rx_stream(stream, sizeof(stream), 10 * WAIT_TIME_MS),
+		      sizeof(stream), "UART RX stuck");
+	recv_expected = sizeof(stream);
+	zassert_true(wait_for(all_received), "data not received");
+	elapsed = k_uptime_get() - start;
+	rate = sizeof(stream) * MSEC_PER_SEC / elapsed;
+
+	/* Counters reported by AT#XDATASTAT */
+	datamode_stats_get(&stats);
+	TC_PRINT("%u bytes in %u ms (%u B/s, line rate %u B/s), %u stalls\n",
+		 stats.tx_bytes, elapsed, rate, LINE_RATE, stats.stalls);
+
+	zassert_equal(recv_errors, 0, "wrong data");
+	zassert_equal(stats.rx_bytes, sizeof(stream), "wrong RX bytes");
+	zassert_equal(stats.tx_bytes, sizeof(stream), "wrong TX bytes");
+	zassert_equal(stats.dropped, 0, "data dropped");
+	zassert_equal(stats.stalls, 0, "RX stopped while the handler kept up");
+	zassert_true(rate * 100 >= LINE_RATE * MIN_RATE_PERCENT, "throughput below line rate");
+
+	datamode_exit("");
+	recv_stream = false;
+	send_time_ms = 0;
+}
+
+void test_main(void)
+{
+	zassert_ok(slm_at_host_init(), "init failed");
+
+	ztest_test_suite(slm_data_mode,
+		ztest_unit_test(test_stream_bursts),
+		ztest_unit_test(test_stream_terminator_split),
+		ztest_unit_test(test_message_boundaries),
+		ztest_unit_test(test_stream_throughput)
+	);
+
+	ztest_run_test_suite(slm_data_mode);
+}
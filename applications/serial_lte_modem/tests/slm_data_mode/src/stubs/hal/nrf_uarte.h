@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Included by slm_at_host.c, only used with CONFIG_SLM_UART_HWFC_RUNTIME. */
+
+#ifndef SLM_DATA_MODE_TEST_NRF_UARTE_H_
+#define SLM_DATA_MODE_TEST_NRF_UARTE_H_
+
+#endif /* SLM_DATA_MODE_TEST_NRF_UARTE_H_ */
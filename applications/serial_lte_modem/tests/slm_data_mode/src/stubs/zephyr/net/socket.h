@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Included through slm_util.h, the socket API is not used by slm_at_host.c. */
+
+#ifndef SLM_DATA_MODE_TEST_SOCKET_H_
+#define SLM_DATA_MODE_TEST_SOCKET_H_
+
+#include <zephyr/net/net_ip.h>
+
+#endif /* SLM_DATA_MODE_TEST_SOCKET_H_ */
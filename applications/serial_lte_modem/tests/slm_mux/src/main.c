@@ -0,0 +1,570 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
+#include <errno.h>
+#include <string.h>
+#include <modem/at_cmd_parser.h>
+#include <modem/at_params.h>
+#include "slm_defines.h"
+#include "slm_mux.h"
+
+#define SOF            0xF9
+#define HDR_LEN        6
+#define FRAME_DATA     0
+#define FRAME_CREDIT   1
+#define FRAME_CLOSE    2
+
+#define SOCK_FD        10
+#define CHANNEL        1
+
+#define UPLINK_LEN     2000
+#define DOWNLINK_LEN   3000
+#define WAIT_TIME_MS   2000
+
+int handle_at_mux(enum at_cmd_type cmd_type);
+int handle_at_muxbind(enum at_cmd_type cmd_type);
+
+/* Used by slm_mux.c */
+struct at_param_list at_param_list;
+char rsp_buf[SLM_AT_CMD_RESPONSE_MAX_LEN];
+
+static K_MUTEX_DEFINE(test_lock);
+static uint32_t rand_state = 12345;
+
+/* UART towards the host */
+static bool muxmode;
+static int uart_fail_count;
+static uint8_t uart_out[8192];
+static size_t uart_out_len;
+static size_t uart_out_pos;
+
+/* What the host has received, decoded from uart_out */
+static uint32_t host_credit[CONFIG_SLM_MUX_CHANNELS + 1];
+static bool host_closed[CONFIG_SLM_MUX_CHANNELS + 1];
+static uint8_t host_data[DOWNLINK_LEN];
+static size_t host_data_len;
+
+/* AT command parser */
+static bool cmd_pending;
+static uint8_t at_rx[256];
+static size_t at_rx_len;
+
+/* Socket bound to CHANNEL */
+static uint8_t sock_tx[UPLINK_LEN];
+static size_t sock_tx_len;
+static uint8_t sock_rx[DOWNLINK_LEN];
+static size_t sock_rx_len;
+static size_t sock_rx_pos;
+static int sock_eagain_count;
+
+/* Deterministic pseudo-random numbers so that failures can be reproduced */
+static uint32_t test_rand(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return rand_state >> 8;
+}
+
+static bool wait_for(bool (*cond)(void))
+{
+	for (int i = 0; i < WAIT_TIME_MS; i++) {
+		bool done;
+
+		k_mutex_lock(&test_lock, K_FOREVER);
+		done = cond();
+		k_mutex_unlock(&test_lock);
+		if (done) {
+			return true;
+		}
+		k_sleep(K_MSEC(1));
+	}
+
+	return false;
+}
+
+/* Stubs of slm_at_host.c */
+
+int raw_uart_send(const uint8_t *data, size_t len)
+{
+	k_mutex_lock(&test_lock, K_FOREVER);
+
+	if (uart_fail_count > 0) {
+		uart_fail_count--;
+		k_mutex_unlock(&test_lock);
+		return -EAGAIN;
+	}
+	zassert_true(uart_out_len + len <= sizeof(uart_out), "UART output full");
+	memcpy(&uart_out[uart_out_len], data, len);
+	uart_out_len += len;
+
+	k_mutex_unlock(&test_lock);
+
+	return 0;
+}
+
+void rsp_send(const char *str, size_t len)
+{
+	(void)slm_mux_send(SLM_MUX_AT_CHANNEL, str, len);
+}
+
+int enter_muxmode(void)
+{
+	return 0;
+}
+
+bool in_muxmode(void)
+{
+	return muxmode;
+}
+
+bool exit_muxmode(void)
+{
+	muxmode = false;
+	return true;
+}
+
+/* Takes characters until the end of a command, like the AT command parser */
+size_t muxmode_cmd_rx(const uint8_t *data, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len && !cmd_pending; i++) {
+		zassert_true(at_rx_len < sizeof(at_rx), "AT input full");
+		at_rx[at_rx_len++] = data[i];
+		if (data[i] == '\n') {
+			cmd_pending = true;
+		}
+	}
+
+	return i;
+}
+
+/* Fake socket */
+
+int poll(struct pollfd *fds, int nfds, int timeout)
+{
+	int ready = 0;
+
+	for (int n = 0; n < timeout && ready == 0; n++) {
+		k_mutex_lock(&test_lock, K_FOREVER);
+		for (int i = 0; i < nfds; i++) {
+			fds[i].revents = 0;
+			if (fds[i].fd != SOCK_FD) {
+				fds[i].revents = POLLNVAL;
+			} else {
+				if ((fds[i].events & POLLIN) && sock_rx_pos < sock_rx_len) {
+					fds[i].revents |= POLLIN;
+				}
+				if ((fds[i].events & POLLOUT) && sock_eagain_count == 0) {
+					fds[i].revents |= POLLOUT;
+				}
+			}
+			if (fds[i].revents) {
+				ready++;
+			}
+		}
+		k_mutex_unlock(&test_lock);
+		if (ready == 0) {
+			k_sleep(K_MSEC(1));
+		}
+	}
+
+	return ready;
+}
+
+ssize_t recv(int sock, void *buf, size_t max_len, int flags)
+{
+	size_t len;
+
+	zassert_equal(sock, SOCK_FD, "recv() on wrong socket");
+	zassert_equal(flags, MSG_DONTWAIT, "blocking recv()");
+
+	k_mutex_lock(&test_lock, K_FOREVER);
+	/* Short reads, like a socket receiving packets */
+	len = MIN(MIN(max_len, sock_rx_len - sock_rx_pos), test_rand() % 100 + 1);
+	if (len == 0) {
+		k_mutex_unlock(&test_lock);
+		errno = EAGAIN;
+		return -1;
+	}
+	memcpy(buf, &sock_rx[sock_rx_pos], len);
+	sock_rx_pos += len;
+	k_mutex_unlock(&test_lock);
+
+	return len;
+}
+
+ssize_t send(int sock, const void *buf, size_t len, int flags)
+{
+	zassert_equal(sock, SOCK_FD, "send() on wrong socket");
+	zassert_equal(flags, MSG_DONTWAIT, "blocking send()");
+
+	k_mutex_lock(&test_lock, K_FOREVER);
+	if (sock_eagain_count > 0) {
+		sock_eagain_count--;
+		k_mutex_unlock(&test_lock);
+		errno = EAGAIN;
+		return -1;
+	}
+	len = MIN(len, test_rand() % 100 + 1);
+	zassert_true(sock_tx_len + len <= sizeof(sock_tx), "socket output full");
+	memcpy(&sock_tx[sock_tx_len], buf, len);
+	sock_tx_len += len;
+	k_mutex_unlock(&test_lock);
+
+	return len;
+}
+
+/* Host side of the framing */
+
+static size_t frame_encode(uint8_t *buf, uint8_t channel, uint8_t type,
+			   const uint8_t *payload, uint16_t len)
+{
+	buf[0] = SOF;
+	buf[1] = channel;
+	buf[2] = type;
+	sys_put_le16(len, &buf[3]);
+	buf[5] = 0xFF ^ buf[1] ^ buf[2] ^ buf[3] ^ buf[4];
+	memcpy(&buf[HDR_LEN], payload, len);
+
+	return HDR_LEN + len;
+}
+
+/* Feed the data to slm_mux_rx() in chunks split at random points, like UART buffers */
+static void host_send(const uint8_t *data, size_t len)
+{
+	while (len > 0) {
+		size_t size = MIN(len, test_rand() % 16 + 1);
+
+		slm_mux_rx(data, size);
+		data += size;
+		len -= size;
+	}
+}
+
+static void host_frame_send(uint8_t channel, uint8_t type, const uint8_t *payload, uint16_t len)
+{
+	uint8_t buf[HDR_LEN + CONFIG_SLM_MUX_FRAME_SIZE];
+
+	host_send(buf, frame_encode(buf, channel, type, payload, len));
+}
+
+static void host_credit_send(uint8_t channel, uint16_t credit)
+{
+	uint8_t payload[2];
+
+	sys_put_le16(credit, payload);
+	host_frame_send(channel, FRAME_CREDIT, payload, sizeof(payload));
+}
+
+/* Decode the frames sent by the SLM, called with test_lock held */
+static void host_receive(void)
+{
+	while (uart_out_len - uart_out_pos >= HDR_LEN) {
+		const uint8_t *hdr = &uart_out[uart_out_pos];
+		uint16_t len = sys_get_le16(&hdr[3]);
+		const uint8_t *payload = &hdr[HDR_LEN];
+
+		zassert_equal(hdr[0], SOF, "no SOF at %zu", uart_out_pos);
+		zassert_equal(hdr[5], 0xFF ^ hdr[1] ^ hdr[2] ^ hdr[3] ^ hdr[4], "bad header");
+		zassert_true(hdr[1] <= CONFIG_SLM_MUX_CHANNELS, "bad channel");
+		zassert_true(len <= CONFIG_SLM_MUX_FRAME_SIZE, "frame too long");
+		if (uart_out_len - uart_out_pos < HDR_LEN + len) {
+			return;
+		}
+		uart_out_pos += HDR_LEN + len;
+
+		switch (hdr[2]) {
+		case FRAME_CREDIT:
+			zassert_equal(len, 2, "bad credit frame");
+			host_credit[hdr[1]] += sys_get_le16(payload);
+			break;
+		case FRAME_CLOSE:
+			host_closed[hdr[1]] = true;
+			break;
+		case FRAME_DATA:
+			if (hdr[1] == CHANNEL) {
+				zassert_true(host_data_len + len <= sizeof(host_data),
+					     "more data than sent by the socket");
+				memcpy(&host_data[host_data_len], payload, len);
+				host_data_len += len;
+			}
+			break;
+		default:
+			zassert_unreachable("bad frame type %d", hdr[2]);
+		}
+	}
+}
+
+static void pattern_fill(uint8_t *buf, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = test_rand();
+	}
+}
+
+static int at_set(int (*handler)(enum at_cmd_type), int p1, int p2, size_t count)
+{
+	at_params_list_clear(&at_param_list);
+	at_params_int_put(&at_param_list, 1, p1);
+	if (count > 2) {
+		at_params_int_put(&at_param_list, 2, p2);
+	}
+
+	return handler(AT_CMD_TYPE_SET_COMMAND);
+}
+
+/* Like cmd_send() once the final result has been sent */
+static void cmd_done(void)
+{
+	cmd_pending = false;
+	slm_mux_cmd_done();
+}
+
+static bool at_credit_received(void)
+{
+	host_receive();
+	return host_credit[SLM_MUX_AT_CHANNEL] > 0;
+}
+
+static bool channel_credit_received(void)
+{
+	host_receive();
+	return host_credit[CHANNEL] >= CONFIG_SLM_MUX_CHANNEL_BUF_SIZE;
+}
+
+static void mux_setup(void)
+{
+	k_mutex_lock(&test_lock, K_FOREVER);
+	uart_out_len = 0;
+	uart_out_pos = 0;
+	uart_fail_count = 0;
+	memset(host_credit, 0, sizeof(host_credit));
+	memset(host_closed, 0, sizeof(host_closed));
+	host_data_len = 0;
+	at_rx_len = 0;
+	sock_tx_len = 0;
+	sock_rx_len = 0;
+	sock_rx_pos = 0;
+	sock_eagain_count = 0;
+	k_mutex_unlock(&test_lock);
+
+	zassert_ok(at_set(handle_at_mux, 1, 0, 2), "AT#XMUX=1 failed");
+	muxmode = true;
+	cmd_done();
+	zassert_true(wait_for(at_credit_received), "no AT channel credit");
+	zassert_equal(host_credit[SLM_MUX_AT_CHANNEL], CONFIG_SLM_MUX_AT_BUF_SIZE,
+		      "wrong AT channel credit");
+
+	zassert_ok(at_set(handle_at_muxbind, CHANNEL, SOCK_FD, 3), "AT#XMUXBIND failed");
+	zassert_true(wait_for(channel_credit_received), "no channel credit");
+	zassert_equal(host_credit[CHANNEL], CONFIG_SLM_MUX_CHANNEL_BUF_SIZE,
+		      "wrong channel credit");
+}
+
+static void mux_teardown(void)
+{
+	cmd_pending = false;
+	zassert_ok(at_set(handle_at_mux, 0, 0, 2), "AT#XMUX=0 failed");
+	slm_mux_tx_drain();
+	muxmode = false;
+}
+
+static bool uplink_done(void)
+{
+	host_receive();
+	return sock_tx_len == UPLINK_LEN &&
+	       host_credit[CHANNEL] == CONFIG_SLM_MUX_CHANNEL_BUF_SIZE + UPLINK_LEN;
+}
+
+/* Data frames split at random points and mixed with noise reach the socket
+ * in order, and all the credit used is returned.
+ */
+static void test_mux_uplink(void)
+{
+	static uint8_t data[UPLINK_LEN];
+	static const uint8_t noise[] = { 0x00, SOF, 0x01, 0x02, 0x03, 0x04, 0x05 };
+	size_t sent = 0;
+
+	mux_setup();
+	pattern_fill(data, sizeof(data));
+	sock_eagain_count = 5;
+
+	while (sent < sizeof(data)) {
+		uint32_t credit;
+		size_t size;
+
+		k_mutex_lock(&test_lock, K_FOREVER);
+		host_receive();
+		credit = host_credit[CHANNEL] - sent;
+		k_mutex_unlock(&test_lock);
+
+		size = MIN(MIN(sizeof(data) - sent, CONFIG_SLM_MUX_FRAME_SIZE), credit);
+		size = MIN(size, test_rand() % CONFIG_SLM_MUX_FRAME_SIZE + 1);
+		if (size == 0) {
+			k_sleep(K_MSEC(1));
+			continue;
+		}
+		if (test_rand() % 4 == 0) {
+			host_send(noise, test_rand() % sizeof(noise) + 1);
+		}
+		host_frame_send(CHANNEL, FRAME_DATA, &data[sent], size);
+		sent += size;
+	}
+
+	zassert_true(wait_for(uplink_done), "uplink not done, %zu sent to socket", sock_tx_len);
+	zassert_mem_equal(sock_tx, data, sizeof(data), "wrong data");
+
+	mux_teardown();
+}
+
+static bool downlink_done(void)
+{
+	host_receive();
+	return host_data_len == DOWNLINK_LEN;
+}
+
+/* Socket data reaches the host within the credit, even when the UART fails
+ * and the TX buffer is full.
+ */
+static void test_mux_downlink(void)
+{
+	mux_setup();
+
+	k_mutex_lock(&test_lock, K_FOREVER);
+	pattern_fill(sock_rx, sizeof(sock_rx));
+	sock_rx_len = sizeof(sock_rx);
+	uart_fail_count = 3;
+	k_mutex_unlock(&test_lock);
+
+	/* No data without credit */
+	k_sleep(K_MSEC(50));
+	k_mutex_lock(&test_lock, K_FOREVER);
+	host_receive();
+	zassert_equal(host_data_len, 0, "data sent without credit");
+	k_mutex_unlock(&test_lock);
+
+	for (size_t credit = 0; credit < DOWNLINK_LEN; credit += 500) {
+		host_credit_send(CHANNEL, 500);
+		if (credit == 1000) {
+			/* Frames are retried while the UART is off */
+			k_mutex_lock(&test_lock, K_FOREVER);
+			uart_fail_count = 5;
+			k_mutex_unlock(&test_lock);
+		}
+		k_sleep(K_MSEC(20));
+		k_mutex_lock(&test_lock, K_FOREVER);
+		host_receive();
+		zassert_true(host_data_len <= credit + 500, "credit exceeded");
+		k_mutex_unlock(&test_lock);
+	}
+
+	zassert_true(wait_for(downlink_done), "downlink not done, %zu received", host_data_len);
+	zassert_mem_equal(host_data, sock_rx, sizeof(sock_rx), "wrong data");
+
+	mux_teardown();
+}
+
+static bool at_credit_returned(void)
+{
+	host_receive();
+	return host_credit[SLM_MUX_AT_CHANNEL] == CONFIG_SLM_MUX_AT_BUF_SIZE + at_rx_len;
+}
+
+/* AT channel input received while a command is pending is held, and credited
+ * when the command is done.
+ */
+static void test_mux_at_channel(void)
+{
+	static const char cmds[] = "AT+CFUN?\r\nAT#XMUX?\r\n";
+	static uint8_t filler[CONFIG_SLM_MUX_AT_BUF_SIZE];
+
+	mux_setup();
+
+	host_frame_send(SLM_MUX_AT_CHANNEL, FRAME_DATA, (const uint8_t *)cmds, 10);
+	host_frame_send(SLM_MUX_AT_CHANNEL, FRAME_DATA, (const uint8_t *)&cmds[10], 10);
+
+	/* Only the first command is taken before it is done */
+	zassert_true(cmd_pending, "command not pending");
+	zassert_equal(at_rx_len, 10, "wrong AT input length %zu", at_rx_len);
+	zassert_mem_equal(at_rx, cmds, 10, "wrong AT input");
+	k_sleep(K_MSEC(20));
+	k_mutex_lock(&test_lock, K_FOREVER);
+	host_receive();
+	zassert_equal(host_credit[SLM_MUX_AT_CHANNEL], CONFIG_SLM_MUX_AT_BUF_SIZE,
+		      "credit for pending input");
+	k_mutex_unlock(&test_lock);
+
+	cmd_done();
+	zassert_equal(at_rx_len, 20, "held command not handled");
+	zassert_mem_equal(at_rx, cmds, 20, "wrong AT input");
+	cmd_done();
+	zassert_true(wait_for(at_credit_returned), "AT channel credit not returned");
+
+	/* Input over the credit is dropped while the command is pending */
+	memset(filler, 'A', sizeof(filler));
+	cmd_pending = true;
+	at_rx_len = 0;
+	host_frame_send(SLM_MUX_AT_CHANNEL, FRAME_DATA, filler, sizeof(filler) - 20);
+	host_frame_send(SLM_MUX_AT_CHANNEL, FRAME_DATA, filler, 40);
+	zassert_equal(at_rx_len, 0, "input handled while command pending");
+	cmd_done();
+	zassert_equal(at_rx_len, sizeof(filler), "held input not handled");
+
+	mux_teardown();
+}
+
+static bool data_sent(void)
+{
+	return sock_tx_len == sizeof("data");
+}
+
+/* The socket is unbound by the mux thread, data is dropped after that, and
+ * the channel can be bound again.
+ */
+static void test_mux_unbind(void)
+{
+	static const uint8_t data[] = "data";
+
+	mux_setup();
+
+	zassert_ok(at_set(handle_at_muxbind, CHANNEL, INVALID_SOCKET, 3), "unbind failed");
+	zassert_equal(at_set(handle_at_muxbind, CHANNEL, INVALID_SOCKET, 3), 0,
+		      "unbind of unbound channel failed");
+
+	host_frame_send(CHANNEL, FRAME_DATA, data, sizeof(data));
+	k_sleep(K_MSEC(50));
+	zassert_equal(sock_tx_len, 0, "data sent to unbound socket");
+
+	k_mutex_lock(&test_lock, K_FOREVER);
+	host_receive();
+	zassert_false(host_closed[CHANNEL], "close frame on unbind");
+	host_credit[CHANNEL] = 0;
+	k_mutex_unlock(&test_lock);
+
+	zassert_ok(at_set(handle_at_muxbind, CHANNEL, SOCK_FD, 3), "rebind failed");
+	zassert_true(wait_for(channel_credit_received), "no credit on rebind");
+	host_frame_send(CHANNEL, FRAME_DATA, data, sizeof(data));
+	zassert_true(wait_for(data_sent), "data not sent after rebind");
+
+	mux_teardown();
+}
+
+void test_main(void)
+{
+	zassert_ok(at_params_list_init(&at_param_list, 3), "at_params init failed");
+	zassert_ok(slm_mux_init(), "init failed");
+
+	ztest_test_suite(slm_mux,
+		ztest_unit_test(test_mux_uplink),
+		ztest_unit_test(test_mux_downlink),
+		ztest_unit_test(test_mux_at_channel),
+		ztest_unit_test(test_mux_unbind)
+	);
+
+	ztest_run_test_suite(slm_mux);
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* The part of the socket API used by slm_mux.c, implemented by the test with fake sockets. */
+
+#ifndef SLM_MUX_TEST_SOCKET_H_
+#define SLM_MUX_TEST_SOCKET_H_
+
+#include <sys/types.h>
+#include <stddef.h>
+
+#define POLLIN   0x01
+#define POLLOUT  0x04
+#define POLLERR  0x08
+#define POLLHUP  0x10
+#define POLLNVAL 0x20
+
+#define MSG_DONTWAIT 0x40
+
+struct pollfd {
+	int fd;
+	short events;
+	short revents;
+};
+
+int poll(struct pollfd *fds, int nfds, int timeout);
+ssize_t recv(int sock, void *buf, size_t max_len, int flags);
+ssize_t send(int sock, const void *buf, size_t len, int flags);
+
+#endif /* SLM_MUX_TEST_SOCKET_H_ */
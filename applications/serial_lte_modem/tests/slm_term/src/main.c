@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+#include "slm_term.h"
+
+#define TEST_DATA_MAX_LEN 256
+#define TEST_ITERATIONS   2000
+
+/* Terminators, most of them overlapping with themselves */
+static const char *const terminators[] = {
+	"+++", "aaa", "abab", "aabaa", "abcab", "abacaba", "x",
+};
+
+static struct slm_term term;
+static uint8_t sent[TEST_DATA_MAX_LEN];
+static size_t sent_len;
+static uint32_t rand_state = 12345;
+
+/* Deterministic pseudo-random numbers so that failures can be reproduced */
+static uint32_t test_rand(void)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return rand_state >> 8;
+}
+
+static bool test_send(const uint8_t *data, size_t len)
+{
+	zassert_true(len > 0, "empty send");
+	zassert_true(sent_len + len <= sizeof(sent), "sent too much");
+	memcpy(sent + sent_len, data, len);
+	sent_len += len;
+
+	return false;
+}
+
+/* Naive model of the data mode: the terminator is only recognized at the end of a burst */
+static bool model_ends_with_term(const uint8_t *data, size_t len, const char *str)
+{
+	size_t str_len = strlen(str);
+
+	return len >= str_len && memcmp(data + len - str_len, str, str_len) == 0;
+}
+
+/* Naive terminator prefix match at the end of the data */
+static size_t model_match(const uint8_t *data, size_t len, const char *str)
+{
+	size_t str_len = strlen(str);
+
+	for (size_t m = MIN(len, str_len); m > 0; m--) {
+		if (memcmp(data + len - m, str, m) == 0) {
+			return m;
+		}
+	}
+
+	return 0;
+}
+
+/* Random data drawn from the terminator characters, optionally ending with the terminator */
+static size_t test_data_generate(uint8_t *data, const char *str)
+{
+	size_t str_len = strlen(str);
+	size_t len = test_rand() % (TEST_DATA_MAX_LEN - str_len);
+
+	for (size_t i = 0; i < len; i++) {
+		uint32_t r = test_rand() % (str_len + 1);
+
+		data[i] = (r == str_len) ? 'z' : str[r];
+	}
+	if (test_rand() % 2) {
+		memcpy(data + len, str, str_len);
+		len += str_len;
+	}
+
+	return len;
+}
+
+static void test_term_init(void)
+{
+	zassert_equal(slm_term_init(&term, ""), -EINVAL, "empty terminator accepted");
+	zassert_equal(slm_term_init(&term, "12345678901234567"), -EINVAL,
+		      "too long terminator accepted");
+	zassert_equal(slm_term_init(&term, "+++"), 0, "init failed");
+	zassert_equal(term.len, 3, "wrong length");
+	zassert_equal(term.match, 0, "match not reset");
+}
+
+/* Matching a buffer piecewise gives the same result as matching it at once */
+static void test_term_match_update(void)
+{
+	uint8_t data[TEST_DATA_MAX_LEN];
+
+	for (int t = 0; t < ARRAY_SIZE(terminators); t++) {
+		zassert_equal(slm_term_init(&term, terminators[t]), 0, "init failed");
+
+		for (int n = 0; n < TEST_ITERATIONS; n++) {
+			size_t len = test_data_generate(data, terminators[t]);
+			size_t match = 0;
+			size_t pos = 0;
+
+			while (pos < len) {
+				size_t part = test_rand() % 8 + 1;
+
+				part = MIN(len - pos, part);
+
+				match = slm_term_match_update(&term, match, data + pos, part);
+				pos += part;
+				zassert_equal(match, model_match(data, pos, terminators[t]),
+					      "'%s': wrong match at %zu", terminators[t], pos);
+			}
+			zassert_equal(slm_term_match_update(&term, 0, data, len),
+				      model_match(data, len, terminators[t]),
+				      "'%s': wrong match over whole data", terminators[t]);
+		}
+	}
+}
+
+/* Sending a burst in chunks split at random points sends the burst minus the terminator */
+static void test_term_chunk_send(void)
+{
+	uint8_t data[TEST_DATA_MAX_LEN];
+
+	for (int t = 0; t < ARRAY_SIZE(terminators); t++) {
+		zassert_equal(slm_term_init(&term, terminators[t]), 0, "init failed");
+
+		for (int n = 0; n < TEST_ITERATIONS; n++) {
+			size_t len = test_data_generate(data, terminators[t]);
+			size_t pos = 0;
+			bool quit;
+			bool expected_quit = model_ends_with_term(data, len, terminators[t]);
+			size_t expected_len = expected_quit ? len - strlen(terminators[t]) : len;
+
+			sent_len = 0;
+			while (pos < len) {
+				size_t part = test_rand() % 20 + 1;
+
+				part = MIN(len - pos, part);
+
+				quit = slm_term_chunk_send(&term, data + pos, part, test_send);
+				zassert_false(quit, "quit before the end of burst");
+				pos += part;
+
+				/* Only a terminator prefix is held back */
+				zassert_equal(sent_len + term.match, pos, "'%s': lost data",
+					      terminators[t]);
+				zassert_mem_equal(sent, data, sent_len, "'%s': wrong data",
+						  terminators[t]);
+			}
+			quit = slm_term_flush(&term, test_send);
+
+			zassert_equal(quit, expected_quit, "'%s': wrong quit", terminators[t]);
+			zassert_equal(sent_len, expected_len, "'%s': wrong length %zu/%zu",
+				      terminators[t], sent_len, expected_len);
+			zassert_mem_equal(sent, data, sent_len, "'%s': wrong data",
+					  terminators[t]);
+			zassert_equal(term.match, 0, "match not reset");
+		}
+	}
+}
+
+/* Terminator split over chunks at every possible point */
+static void test_term_chunk_send_split_terminator(void)
+{
+	static const uint8_t data[] = "data+++";
+	size_t len = sizeof(data) - 1;
+
+	zassert_equal(slm_term_init(&term, "+++"), 0, "init failed");
+
+	for (size_t split = 0; split <= len; split++) {
+		sent_len = 0;
+		zassert_false(slm_term_chunk_send(&term, data, split, test_send), "quit");
+		zassert_false(slm_term_chunk_send(&term, data + split, len - split, test_send),
+			      "quit");
+		zassert_true(slm_term_flush(&term, test_send), "terminator not found");
+		zassert_equal(sent_len, 4, "wrong length at split %zu", split);
+		zassert_mem_equal(sent, "data", 4, "wrong data");
+	}
+
+	/* Terminator prefix followed by data is sent as data */
+	sent_len = 0;
+	zassert_false(slm_term_chunk_send(&term, (const uint8_t *)"ab++", 4, test_send), "quit");
+	zassert_equal(sent_len, 2, "terminator prefix not held back");
+	zassert_false(slm_term_chunk_send(&term, (const uint8_t *)"c", 1, test_send), "quit");
+	zassert_false(slm_term_flush(&term, test_send), "terminator found");
+	zassert_equal(sent_len, 5, "wrong length");
+	zassert_mem_equal(sent, "ab++c", 5, "wrong data");
+
+	/* Terminator prefix at the end of burst is sent as data */
+	sent_len = 0;
+	zassert_false(slm_term_chunk_send(&term, (const uint8_t *)"ab++", 4, test_send), "quit");
+	zassert_false(slm_term_flush(&term, test_send), "terminator found");
+	zassert_equal(sent_len, 4, "wrong length");
+	zassert_mem_equal(sent, "ab++", 4, "wrong data");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(slm_term,
+		ztest_unit_test(test_term_init),
+		ztest_unit_test(test_term_match_update),
+		ztest_unit_test(test_term_chunk_send),
+		ztest_unit_test(test_term_chunk_send_split_terminator)
+	);
+
+	ztest_run_test_suite(slm_term);
+}
@@ -19,6 +19,7 @@
 
 #define MAX_PEERS 5
 #define MAX_SW_PEERS (MAX_PEERS + 1)
+#define TX_PEND_Q_HIST_BUCKETS 6
 
 #ifdef CONFIG_NRF700X_RADIO_TEST
 /**
@@ -272,6 +273,12 @@ struct wifi_nrf_fmac_buf_map_info {
  * @no_events: Total number of events received.
  * @no_events_resubmit: Total number of event pointer resubmitted back to
  *                      the RPU.
+ * @tx_desc_waits: Number of times a frame of an access category was left
+ *                 pending as no TX descriptor was free.
+ * @tx_desc_wait_us: Total time an access category waited for a TX descriptor.
+ * @tx_pend_q_ac_hist: Depth of the pending TX queue when a frame is queued, per
+ *                     access category. Bucket n counts depths [2^n, 2^(n + 1)).
+ * @tx_pend_q_peer_hist: Same as @tx_pend_q_ac_hist, per peer.
  *
  * This structure holds the host specific statistics.
  */
@@ -279,6 +286,10 @@ struct rpu_host_stats {
 	unsigned long long total_tx_pkts;
 	unsigned long long total_tx_done_pkts;
 	unsigned long long total_rx_pkts;
+	unsigned int tx_desc_waits[WIFI_NRF_FMAC_AC_MAX];
+	unsigned long long tx_desc_wait_us[WIFI_NRF_FMAC_AC_MAX];
+	unsigned int tx_pend_q_ac_hist[WIFI_NRF_FMAC_AC_MAX][TX_PEND_Q_HIST_BUCKETS];
+	unsigned int tx_pend_q_peer_hist[MAX_SW_PEERS][TX_PEND_Q_HIST_BUCKETS];
 };
 
 
@@ -332,13 +343,18 @@ struct peers_info {
  * @data_pending_txq: Queue for frames waiting to be passed to the RPU for TX.
  * @wakeup_client_q: Queue for peers which have woken up from 802.11
  *                   power save.
- * @buf_pool_bmp_p: Bitmap of the TX buffer pool.
+ * @desc_free_bmp: Free reserved TX descriptors of each access category, bit n
+ *                 is descriptor (ac + (WIFI_NRF_FMAC_AC_MAX * n)).
+ * @spare_desc_free_bmp: Free spare TX descriptors, bit n is the n-th spare
+ *                       descriptor.
  * @outstanding_descs: TX description which have been queued to the RPU.
  * @curr_peer_opp: Peer who will be get the next opportunity for TX.
  * @next_spare_desc_ac: Access category which will get the next spare
  *                      descriptor.
  * @pkt_info_p: Frame context information.
- * @spare_desc_queue_map: Map for the spare descriptor queues.
+ * @spare_desc_ac: Access category each spare descriptor is assigned to.
+ * @desc_wait_start_us: Time since when an access category has been waiting
+ *                      for a TX descriptor, 0 if it is not waiting.
  *
  * This structure holds context information for the transmit path.
  */
@@ -350,18 +366,17 @@ struct tx_config {
 	void *data_pending_txq[MAX_SW_PEERS][WIFI_NRF_FMAC_AC_MAX];
 	void *wakeup_client_q;
 
-	/* Used to store tx descs(buff pool ids) */
-	unsigned long *buf_pool_bmp_p;
+	unsigned int desc_free_bmp[WIFI_NRF_FMAC_AC_MAX];
+	unsigned int spare_desc_free_bmp;
 
 	unsigned int outstanding_descs[WIFI_NRF_FMAC_AC_MAX];
 	unsigned int curr_peer_opp[WIFI_NRF_FMAC_AC_MAX];
 	unsigned int next_spare_desc_ac;
 
 	struct tx_pkt_info *pkt_info_p;
-	/* First fout bits Spare desc1 queue number,
-	 * Second four bits Spare desc2 queue number
-	 */
-	unsigned int spare_desc_queue_map;
+	/* There are less spare descs than access categories */
+	unsigned char spare_desc_ac[WIFI_NRF_FMAC_AC_MAX];
+	unsigned long desc_wait_start_us[WIFI_NRF_FMAC_AC_MAX];
 };
 
 
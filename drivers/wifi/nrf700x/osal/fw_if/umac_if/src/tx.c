@@ -17,6 +17,7 @@
 #include "fmac_peer.h"
 #include "hal_mem.h"
 #include "fmac_util.h"
+#include "util.h"
 
 int pending_frames_count(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 			 int peer_id)
@@ -79,39 +80,55 @@ out:
 }
 
 
+static void tx_desc_wait_start(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
+			       int queue)
+{
+	struct tx_config *tx_config = &fmac_dev_ctx->tx_config;
+
+	fmac_dev_ctx->host_stats.tx_desc_waits[queue]++;
+
+	if (!tx_config->desc_wait_start_us[queue]) {
+		tx_config->desc_wait_start_us[queue] =
+			wifi_nrf_osal_time_get_curr_us(fmac_dev_ctx->fpriv->opriv) | 1;
+	}
+}
+
+
+static void tx_desc_wait_end(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
+			     int queue)
+{
+	struct tx_config *tx_config = &fmac_dev_ctx->tx_config;
+
+	if (tx_config->desc_wait_start_us[queue]) {
+		fmac_dev_ctx->host_stats.tx_desc_wait_us[queue] +=
+			wifi_nrf_osal_time_elapsed_us(fmac_dev_ctx->fpriv->opriv,
+						      tx_config->desc_wait_start_us[queue]);
+		tx_config->desc_wait_start_us[queue] = 0;
+	}
+}
+
+
 void tx_desc_free(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 		  unsigned int desc,
 		  int queue)
 {
 	struct wifi_nrf_fmac_priv *fpriv = NULL;
-	int bit = -1;
-	int pool_id = -1;
+	struct tx_config *tx_config = NULL;
+	unsigned int num_reserved = 0;
 
 	fpriv = fmac_dev_ctx->fpriv;
+	tx_config = &fmac_dev_ctx->tx_config;
 
-	bit = (desc % TX_DESC_BUCKET_BOUND);
-	pool_id = (desc / TX_DESC_BUCKET_BOUND);
-	fmac_dev_ctx->tx_config.buf_pool_bmp_p[pool_id] &= (~(1 << bit));
-
-	fmac_dev_ctx->tx_config.outstanding_descs[queue]--;
+	num_reserved = fpriv->num_tx_tokens_per_ac * WIFI_NRF_FMAC_AC_MAX;
 
-	if (desc >= (fpriv->num_tx_tokens_per_ac * WIFI_NRF_FMAC_AC_MAX)) {
-		switch (desc % (fpriv->num_tx_tokens_per_ac * WIFI_NRF_FMAC_AC_MAX)) {
-		case 0:
-			fmac_dev_ctx->tx_config.spare_desc_queue_map &= 0xfff0;
-			break;
-		case 1:
-			fmac_dev_ctx->tx_config.spare_desc_queue_map &= 0xff0f;
-			break;
-		case 2:
-			fmac_dev_ctx->tx_config.spare_desc_queue_map &= 0xf0ff;
-			break;
-		case 3:
-			fmac_dev_ctx->tx_config.spare_desc_queue_map &= 0x0fff;
-			break;
-		}
+	if (desc < num_reserved) {
+		tx_config->desc_free_bmp[desc % WIFI_NRF_FMAC_AC_MAX] |=
+			(1U << (desc / WIFI_NRF_FMAC_AC_MAX));
+	} else {
+		tx_config->spare_desc_free_bmp |= (1U << (desc - num_reserved));
 	}
 
+	tx_config->outstanding_descs[queue]--;
 }
 
 
@@ -119,87 +136,43 @@ unsigned int tx_desc_get(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 			 int queue)
 {
 	struct wifi_nrf_fmac_priv *fpriv = NULL;
-	unsigned int cnt = 0;
-	int curr_bit = 0;
+	struct tx_config *tx_config = NULL;
 	unsigned int desc = 0;
-	int pool_id = 0;
+	int bit = -1;
 
 	fpriv = fmac_dev_ctx->fpriv;
+	tx_config = &fmac_dev_ctx->tx_config;
 
-	desc = fpriv->num_tx_tokens;
-
-	/* First search for a reserved desc */
+	/* First search for a reserved desc, desc (queue + (AC_MAX * n)) is
+	 * bit n of the free bitmap of the queue.
+	 */
+	bit = wifi_nrf_utils_ffs(tx_config->desc_free_bmp[queue]);
 
-	for (cnt = 0; cnt < fpriv->num_tx_tokens_per_ac; cnt++) {
-		curr_bit = ((queue + (WIFI_NRF_FMAC_AC_MAX * cnt)));
-		curr_bit = ((queue + (WIFI_NRF_FMAC_AC_MAX * cnt)) % TX_DESC_BUCKET_BOUND);
-		pool_id = ((queue + (WIFI_NRF_FMAC_AC_MAX * cnt)) / TX_DESC_BUCKET_BOUND);
+	if (bit >= 0) {
+		tx_config->desc_free_bmp[queue] &= ~(1U << bit);
+		desc = queue + (WIFI_NRF_FMAC_AC_MAX * bit);
+	} else {
+		/* If reserved desc is not found search for a spare desc */
+		bit = wifi_nrf_utils_ffs(tx_config->spare_desc_free_bmp);
 
-		if ((((fmac_dev_ctx->tx_config.buf_pool_bmp_p[pool_id] >>
-		       curr_bit)) & 1)) {
-			continue;
-		} else {
-			fmac_dev_ctx->tx_config.buf_pool_bmp_p[pool_id] |=
-				(1 << curr_bit);
-			desc = queue + (WIFI_NRF_FMAC_AC_MAX * cnt);
-			fmac_dev_ctx->tx_config.outstanding_descs[queue]++;
-			break;
+		if (bit < 0) {
+			tx_desc_wait_start(fmac_dev_ctx, queue);
+			return fpriv->num_tx_tokens;
 		}
-	}
 
-	/* If reserved desc is not found search for a spare desc
-	 * (only for non beacon queues)
-	 */
-	if (cnt == fpriv->num_tx_tokens_per_ac) {
-		for (desc = fpriv->num_tx_tokens_per_ac * WIFI_NRF_FMAC_AC_MAX;
-		     desc < fpriv->num_tx_tokens;
-		     desc++) {
-			curr_bit = (desc % TX_DESC_BUCKET_BOUND);
-			pool_id = (desc / TX_DESC_BUCKET_BOUND);
-
-			if ((fmac_dev_ctx->tx_config.buf_pool_bmp_p[pool_id] >> curr_bit) & 1) {
-				continue;
-			} else {
-				fmac_dev_ctx->tx_config.buf_pool_bmp_p[pool_id] |=
-					(1 << curr_bit);
-				fmac_dev_ctx->tx_config.outstanding_descs[queue]++;
-				/* Keep a note which queue has been assigned the
-				 * spare desc. Need for processing of TX_DONE
-				 * event as queue number is not being provided
-				 * by UMAC.
-				 * First nibble epresent first spare desc
-				 * (B3B2B1B0: VO-VI-BE-BK)
-				 * Second nibble represent second spare desc
-				 * (B7B6B5B4 : V0-VI-BE-BK)
-				 * Third nibble represent second spare desc
-				 * (B11B10B9B8 : V0-VI-BE-BK)
-				 * Fourth nibble represent second spare desc
-				 * (B15B14B13B12 : V0-VI-BE-BK)
-				 */
-				switch (desc % (fpriv->num_tx_tokens_per_ac *
-						WIFI_NRF_FMAC_AC_MAX)) {
-				case 0:
-					fmac_dev_ctx->tx_config.spare_desc_queue_map |=
-						(1 << queue);
-					break;
-				case 1:
-					fmac_dev_ctx->tx_config.spare_desc_queue_map |=
-						(1 << (4 + queue));
-					break;
-				case 2:
-					fmac_dev_ctx->tx_config.spare_desc_queue_map |=
-						(1 << (8 + queue));
-					break;
-				case 3:
-					fmac_dev_ctx->tx_config.spare_desc_queue_map |=
-						(1 << (12 + queue));
-					break;
-				}
-				break;
-			}
-		}
+		tx_config->spare_desc_free_bmp &= ~(1U << bit);
+		desc = (fpriv->num_tx_tokens_per_ac * WIFI_NRF_FMAC_AC_MAX) + bit;
+
+		/* Keep a note which queue has been assigned the spare desc.
+		 * Needed for processing of TX_DONE event as queue number is
+		 * not being provided by UMAC.
+		 */
+		tx_config->spare_desc_ac[bit] = queue;
 	}
 
+	tx_config->outstanding_descs[queue]++;
+
+	tx_desc_wait_end(fmac_dev_ctx, queue);
 
 	return desc;
 }
@@ -689,6 +662,19 @@ out:
 }
 
 
+static int tx_pend_q_hist_bucket(unsigned int qlen)
+{
+	int bucket = 0;
+
+	/* Bucket n holds depths [2^n, 2^(n + 1)) */
+	while ((qlen >>= 1) && (bucket < (TX_PEND_Q_HIST_BUCKETS - 1))) {
+		bucket++;
+	}
+
+	return bucket;
+}
+
+
 enum wifi_nrf_status tx_enqueue(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 				void *nwb,
 				unsigned int ac,
@@ -697,6 +683,7 @@ enum wifi_nrf_status tx_enqueue(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 	enum wifi_nrf_status status = WIFI_NRF_STATUS_FAIL;
 	void *queue = NULL;
 	int qlen = 0;
+	int bucket = 0;
 
 	if (!fmac_dev_ctx || !nwb) {
 		wifi_nrf_osal_log_err(fmac_dev_ctx->fpriv->opriv,
@@ -719,6 +706,10 @@ enum wifi_nrf_status tx_enqueue(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 				 queue,
 				 nwb);
 
+	bucket = tx_pend_q_hist_bucket(qlen + 1);
+	fmac_dev_ctx->host_stats.tx_pend_q_ac_hist[ac][bucket]++;
+	fmac_dev_ctx->host_stats.tx_pend_q_peer_hist[peer_id][bucket]++;
+
 	status = update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
 
 
@@ -814,45 +805,22 @@ unsigned int tx_buff_req_free(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 	unsigned int pkts_pend = 0;
 	unsigned int desc = tx_desc_num;
 	int tx_done_q = 0, start_ac, end_ac, cnt = 0;
-	unsigned int queue_map = fmac_dev_ctx->tx_config.spare_desc_queue_map;
+	unsigned int num_reserved = 0;
 
 	fpriv = fmac_dev_ctx->fpriv;
 
+	num_reserved = fpriv->num_tx_tokens_per_ac * WIFI_NRF_FMAC_AC_MAX;
+
 	/* Determine the Queue from the descriptor */
 	/* Reserved desc */
-	if (desc < (fpriv->num_tx_tokens_per_ac * WIFI_NRF_FMAC_AC_MAX)) {
+	if (desc < num_reserved) {
 		/* Derive the queue here as it is not given by UMAC.
 		 * tx_done_q = desc
 		 */
 		tx_done_q = (desc % WIFI_NRF_FMAC_AC_MAX);
 		start_ac = end_ac = tx_done_q;
 	} else {
-		if (desc >= (fpriv->num_tx_tokens_per_ac * WIFI_NRF_FMAC_AC_MAX)) {
-			switch (desc %	(fpriv->num_tx_tokens_per_ac * WIFI_NRF_FMAC_AC_MAX)) {
-			case 0:
-				tx_done_q = (queue_map & 0x0f);
-				break;
-			case 1:
-				tx_done_q = ((queue_map & 0xf0) >> 4);
-				break;
-			case 2:
-				tx_done_q = ((queue_map & 0xf00) >> 8);
-				break;
-			case 3:
-				tx_done_q = ((queue_map & 0xf000) >> 12);
-				break;
-			}
-		}
-
-		if (tx_done_q == 1) {
-			tx_done_q = WIFI_NRF_FMAC_AC_BK;
-		} else if (tx_done_q == 2) {
-			tx_done_q = WIFI_NRF_FMAC_AC_BE;
-		} else if (tx_done_q == 4) {
-			tx_done_q = WIFI_NRF_FMAC_AC_VO;
-		} else {
-			tx_done_q = WIFI_NRF_FMAC_AC_VI;
-		}
+		tx_done_q = fmac_dev_ctx->tx_config.spare_desc_ac[desc - num_reserved];
 
 		/* Spare desc:
 		 * Loop through all AC's
@@ -872,8 +840,11 @@ unsigned int tx_buff_req_free(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
 				/*Adjust the counters*/
 				fmac_dev_ctx->tx_config.outstanding_descs[tx_done_q]--;
 				fmac_dev_ctx->tx_config.outstanding_descs[*ac]++;
+				fmac_dev_ctx->tx_config.spare_desc_ac[desc - num_reserved] = *ac;
 			}
 
+			tx_desc_wait_end(fmac_dev_ctx, cnt);
+
 			break;
 		}
 	}
@@ -1110,6 +1081,14 @@ enum wifi_nrf_status tx_init(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx)
 
 	fpriv = fmac_dev_ctx->fpriv;
 
+	if (fpriv->num_tx_tokens_per_ac > TX_DESC_BUCKET_BOUND) {
+		wifi_nrf_osal_log_err(fmac_dev_ctx->fpriv->opriv,
+				      "%s: Too many TX tokens per AC (%d)\n",
+				      __func__,
+				      fpriv->num_tx_tokens_per_ac);
+		goto out;
+	}
+
 	fmac_dev_ctx->tx_config.send_pkt_coalesce_count_p =
 		wifi_nrf_osal_mem_zalloc(fmac_dev_ctx->fpriv->opriv,
 					 (sizeof(unsigned int) *
@@ -1202,44 +1181,14 @@ enum wifi_nrf_status tx_init(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx)
 		fmac_dev_ctx->tx_config.curr_peer_opp[j] = 0;
 	}
 
-	fmac_dev_ctx->tx_config.buf_pool_bmp_p =
-		wifi_nrf_osal_mem_zalloc(fmac_dev_ctx->fpriv->opriv,
-					 (sizeof(unsigned long) *
-					  (fpriv->num_tx_tokens/TX_DESC_BUCKET_BOUND) + 1));
-
-	if (!fmac_dev_ctx->tx_config.buf_pool_bmp_p) {
-		wifi_nrf_osal_log_err(fmac_dev_ctx->fpriv->opriv,
-				      "%s: Unable to allocate buf_pool_bmp_p\n",
-				      __func__);
-
-		for (i = 0; i < fpriv->num_tx_tokens; i++) {
-			wifi_nrf_utils_list_free(fpriv->opriv,
-						 fmac_dev_ctx->tx_config.pkt_info_p[i].pkt);
-		}
-
-		wifi_nrf_osal_mem_free(fmac_dev_ctx->fpriv->opriv,
-				       fmac_dev_ctx->tx_config.pkt_info_p);
-
-		for (i = 0; i < WIFI_NRF_FMAC_AC_MAX; i++) {
-			for (j = 0; j < MAX_SW_PEERS; j++) {
-				q_ptr = fmac_dev_ctx->tx_config.data_pending_txq[j][i];
-
-				wifi_nrf_utils_q_free(fpriv->opriv,
-						      q_ptr);
-			}
-		}
-
-		wifi_nrf_osal_mem_free(fmac_dev_ctx->fpriv->opriv,
-				       fmac_dev_ctx->tx_config.send_pkt_coalesce_count_p);
-
-		goto out;
+	for (j = 0; j < WIFI_NRF_FMAC_AC_MAX; j++) {
+		fmac_dev_ctx->tx_config.desc_free_bmp[j] =
+			(fpriv->num_tx_tokens_per_ac == TX_DESC_BUCKET_BOUND) ?
+			~0U : ((1U << fpriv->num_tx_tokens_per_ac) - 1);
+		fmac_dev_ctx->tx_config.desc_wait_start_us[j] = 0;
 	}
 
-
-	wifi_nrf_osal_mem_set(fmac_dev_ctx->fpriv->opriv,
-			      fmac_dev_ctx->tx_config.buf_pool_bmp_p,
-			      0,
-			      sizeof(long)*((fpriv->num_tx_tokens/TX_DESC_BUCKET_BOUND) + 1));
+	fmac_dev_ctx->tx_config.spare_desc_free_bmp = (1U << fpriv->num_tx_tokens_spare) - 1;
 
 	for (i = 0; i < MAX_PEERS; i++) {
 		fmac_dev_ctx->tx_config.peers[i].peer_id = -1;
@@ -1252,9 +1201,6 @@ enum wifi_nrf_status tx_init(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx)
 				      "%s: Unable to allocate TX lock\n",
 				      __func__);
 
-		wifi_nrf_osal_mem_free(fmac_dev_ctx->fpriv->opriv,
-				       fmac_dev_ctx->tx_config.buf_pool_bmp_p);
-
 		for (i = 0; i < fpriv->num_tx_tokens; i++) {
 			wifi_nrf_utils_list_free(fpriv->opriv,
 						 fmac_dev_ctx->tx_config.pkt_info_p[i].pkt);
@@ -1291,9 +1237,6 @@ enum wifi_nrf_status tx_init(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx)
 		wifi_nrf_osal_spinlock_free(fmac_dev_ctx->fpriv->opriv,
 					    fmac_dev_ctx->tx_config.tx_lock);
 
-		wifi_nrf_osal_mem_free(fmac_dev_ctx->fpriv->opriv,
-				       fmac_dev_ctx->tx_config.buf_pool_bmp_p);
-
 		for (i = 0; i < fpriv->num_tx_tokens; i++) {
 			wifi_nrf_utils_list_free(fpriv->opriv,
 						 fmac_dev_ctx->tx_config.pkt_info_p[i].pkt);
@@ -1340,9 +1283,6 @@ void tx_deinit(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx)
 	wifi_nrf_osal_spinlock_free(fmac_dev_ctx->fpriv->opriv,
 				    fmac_dev_ctx->tx_config.tx_lock);
 
-	wifi_nrf_osal_mem_free(fmac_dev_ctx->fpriv->opriv,
-			       fmac_dev_ctx->tx_config.buf_pool_bmp_p);
-
 	for (i = 0; i < fpriv->num_tx_tokens; i++) {
 		if (fmac_dev_ctx->tx_config.pkt_info_p) {
 			wifi_nrf_utils_list_free(fpriv->opriv,
@@ -1431,6 +1371,8 @@ enum wifi_nrf_status wifi_nrf_fmac_start_xmit(void *dev_ctx,
 				      "%s: Got packet for unknown PEER\n",
 				      __func__);
 
+		wifi_nrf_osal_nbuf_free(fmac_dev_ctx->fpriv->opriv,
+					nbuf);
 		goto out;
 	} else if (peer_id == MAX_PEERS) {
 		ac = WIFI_NRF_FMAC_AC_MC;
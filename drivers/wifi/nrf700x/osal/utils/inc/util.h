@@ -19,4 +19,16 @@ int nrf_wifi_utils_hex_str_to_val(struct wifi_nrf_osal_priv *opriv,
 				  unsigned char *hex_arr,
 				  unsigned int hex_arr_sz,
 				  unsigned char *str);
+
+/**
+ * wifi_nrf_utils_ffs() - Find the first set bit.
+ * @val: Value to search.
+ *
+ * Return: Index of the least significant set bit, -1 if no bit is set.
+ */
+static inline int wifi_nrf_utils_ffs(unsigned int val)
+{
+	return __builtin_ffs(val) - 1;
+}
+
 #endif /* __UTIL_H__ */
@@ -24,6 +24,7 @@
 #include "timer.h"
 #include "osal_ops.h"
 #include "qspi_if.h"
+#include "fmac_rx.h"
 
 LOG_MODULE_REGISTER(wifi_nrf, CONFIG_WIFI_LOG_LEVEL);
 
@@ -197,42 +198,80 @@ struct nwb {
 	int hostbuffer;
 	void *cleanup_ctx;
 	void (*cleanup_cb)();
+	/* Slab the buffer was allocated from, NULL if allocated from the heap. */
+	struct k_mem_slab *slab;
 };
 
-static void *zep_shim_nbuf_alloc(unsigned int size)
+#ifdef CONFIG_NRF700X_NBUF_POOL
+#define NWB_POOL_DATA_SIZE MAX(CONFIG_RX_MAX_DATA_SIZE + RX_BUF_HEADROOM, \
+			       CONFIG_TX_MAX_DATA_SIZE)
+#define NWB_POOL_BLOCK_SIZE WB_UP(sizeof(struct nwb) + NWB_POOL_DATA_SIZE)
+
+K_MEM_SLAB_DEFINE(nwb_slab, NWB_POOL_BLOCK_SIZE, CONFIG_NRF700X_NBUF_POOL_COUNT, 4);
+#endif /* CONFIG_NRF700X_NBUF_POOL */
+
+#ifdef CONFIG_NRF700X_WIFI_UTIL
+static struct zep_shim_nbuf_stats nbuf_stats;
+
+#define NBUF_STATS_INC(_name) atomic_inc(&nbuf_stats._name)
+
+void zep_shim_nbuf_stats_get(struct zep_shim_nbuf_stats *stats)
 {
-	struct nwb *nwb;
+	memcpy(stats, &nbuf_stats, sizeof(*stats));
+}
+#else
+#define NBUF_STATS_INC(_name)
+#endif /* CONFIG_NRF700X_WIFI_UTIL */
 
-	nwb = (struct nwb *)k_calloc(sizeof(struct nwb), sizeof(char));
+/* Allocate a buffer descriptor followed by size bytes of data. */
+static struct nwb *nwb_alloc(unsigned int size)
+{
+	struct nwb *nwb = NULL;
+	struct k_mem_slab *slab = NULL;
 
-	if (!nwb)
-		return NULL;
+#ifdef CONFIG_NRF700X_NBUF_POOL
+	if (size <= NWB_POOL_DATA_SIZE) {
+		slab = &nwb_slab;
+	}
+#endif /* CONFIG_NRF700X_NBUF_POOL */
 
-	nwb->priv = k_calloc(size, sizeof(char));
+	if (slab && (k_mem_slab_alloc(slab, (void **)&nwb, K_NO_WAIT) == 0)) {
+		NBUF_STATS_INC(pool_allocs);
+	} else {
+		slab = NULL;
+		nwb = k_malloc(sizeof(*nwb) + size);
 
-	if (!nwb->priv) {
-		k_free(nwb);
-		return NULL;
+		if (!nwb) {
+			return NULL;
+		}
+
+		NBUF_STATS_INC(heap_allocs);
 	}
 
-	nwb->data = (unsigned char *)nwb->priv;
+	memset(nwb, 0, sizeof(*nwb));
+
+	nwb->slab = slab;
+	nwb->priv = nwb + 1;
+	nwb->data = nwb->priv;
 	nwb->tail = nwb->data;
-	nwb->len = 0;
-	nwb->headroom = 0;
-	nwb->next = NULL;
 
 	return nwb;
 }
 
-static void zep_shim_nbuf_free(void *nbuf)
+static void *zep_shim_nbuf_alloc(unsigned int size)
 {
-	struct nwb *nwb;
-
-	nwb = nbuf;
+	return nwb_alloc(size);
+}
 
-	k_free(((struct nwb *)nbuf)->priv);
+static void zep_shim_nbuf_free(void *nbuf)
+{
+	struct nwb *nwb = nbuf;
 
-	k_free(nbuf);
+	if (nwb->slab) {
+		k_mem_slab_free(nwb->slab, (void **)&nwb);
+	} else {
+		k_free(nwb);
+	}
 }
 
 static void zep_shim_nbuf_headroom_res(void *nbuf, unsigned int size)
@@ -295,26 +334,46 @@ static void *zep_shim_nbuf_data_pull(void *nbuf, unsigned int size)
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/net_core.h>
 
+#ifdef CONFIG_NRF700X_RX_ZERO_COPY
+static void nwb_rx_buf_destroy(struct net_buf *buf)
+{
+	struct nwb *nwb = *(struct nwb **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+
+	zep_shim_nbuf_free(nwb);
+}
+
+/* The data of these buffers is the RX buffer given by the FMAC layer. */
+NET_BUF_POOL_HEAP_DEFINE(nwb_rx_pool, CONFIG_NRF700X_RX_ZERO_COPY_BUF_COUNT,
+			 sizeof(struct nwb *), nwb_rx_buf_destroy);
+#endif /* CONFIG_NRF700X_RX_ZERO_COPY */
+
 void *net_pkt_to_nbuf(struct net_pkt *pkt)
 {
 	struct nwb *nwb;
 	unsigned char *data;
 	unsigned int len;
 
+	NBUF_STATS_INC(tx_frames);
+
+	/* The FMAC layer reads the frame linearly, while the stack passes the
+	 * Ethernet header in a fragment of its own, so the frame is copied.
+	 */
 	len = net_pkt_get_len(pkt);
 
-	nwb = zep_shim_nbuf_alloc(len + 100);
+	nwb = nwb_alloc(len);
 
 	if (!nwb) {
 		return NULL;
 	}
 
-	zep_shim_nbuf_headroom_res(nwb, 100);
-
 	data = zep_shim_nbuf_data_put(nwb, len);
 
 	net_pkt_read(pkt, data, len);
 
+	NBUF_STATS_INC(tx_copies);
+
 	return nwb;
 }
 
@@ -324,32 +383,72 @@ void *net_pkt_from_nbuf(void *iface, void *frm)
 	unsigned char *data;
 	unsigned int len;
 	struct nwb *nwb = frm;
+#ifdef CONFIG_NRF700X_RX_ZERO_COPY
+	struct net_buf *buf;
+#endif /* CONFIG_NRF700X_RX_ZERO_COPY */
 
 	len = zep_shim_nbuf_data_size(nwb);
 
 	data = zep_shim_nbuf_data_get(nwb);
 
-	pkt = net_pkt_rx_alloc_with_buffer(iface, len, AF_UNSPEC, 0, K_MSEC(100));
+	NBUF_STATS_INC(rx_frames);
 
-	if (!pkt) {
-		return NULL;
+#ifdef CONFIG_NRF700X_RX_ZERO_COPY
+	buf = net_buf_alloc_with_data(&nwb_rx_pool, data, len, K_NO_WAIT);
+
+	if (buf) {
+		*(struct nwb **)net_buf_user_data(buf) = nwb;
+
+		pkt = net_pkt_rx_alloc_on_iface(iface, K_MSEC(100));
+
+		if (!pkt) {
+			/* Frees the RX buffer as well. */
+			net_buf_unref(buf);
+			return NULL;
+		}
+
+		net_pkt_append_buffer(pkt, buf);
+
+		return pkt;
 	}
+#endif /* CONFIG_NRF700X_RX_ZERO_COPY */
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, len, AF_UNSPEC, 0, K_MSEC(100));
 
-	if (net_pkt_write(pkt, data, len)) {
+	if (pkt && net_pkt_write(pkt, data, len)) {
 		net_pkt_unref(pkt);
 		pkt = NULL;
 	}
 
+	if (pkt) {
+		NBUF_STATS_INC(rx_copies);
+	}
+
 	zep_shim_nbuf_free(nwb);
 
 	return pkt;
 }
 
+#if CONFIG_NRF700X_LLIST_NODE_POOL_COUNT > 0
+/* List nodes are allocated for every queued TX frame, keep them in a slab. */
+K_MEM_SLAB_DEFINE(llist_node_slab, WB_UP(sizeof(struct zep_shim_llist_node)),
+		  CONFIG_NRF700X_LLIST_NODE_POOL_COUNT, 4);
+#endif /* CONFIG_NRF700X_LLIST_NODE_POOL_COUNT > 0 */
+
 static void *zep_shim_llist_node_alloc(void)
 {
 	struct zep_shim_llist_node *llist_node = NULL;
 
-	llist_node = k_calloc(sizeof(*llist_node), sizeof(char));
+#if CONFIG_NRF700X_LLIST_NODE_POOL_COUNT > 0
+	if (k_mem_slab_alloc(&llist_node_slab, (void **)&llist_node, K_NO_WAIT) == 0) {
+		memset(llist_node, 0, sizeof(*llist_node));
+		llist_node->pooled = true;
+	}
+#endif /* CONFIG_NRF700X_LLIST_NODE_POOL_COUNT > 0 */
+
+	if (!llist_node) {
+		llist_node = k_calloc(sizeof(*llist_node), sizeof(char));
+	}
 
 	if (!llist_node) {
 		LOG_ERR("%s: Unable to allocate memory for linked list node\n", __func__);
@@ -363,6 +462,13 @@ static void *zep_shim_llist_node_alloc(void)
 
 static void zep_shim_llist_node_free(void *llist_node)
 {
+#if CONFIG_NRF700X_LLIST_NODE_POOL_COUNT > 0
+	if (((struct zep_shim_llist_node *)llist_node)->pooled) {
+		k_mem_slab_free(&llist_node_slab, &llist_node);
+		return;
+	}
+#endif /* CONFIG_NRF700X_LLIST_NODE_POOL_COUNT > 0 */
+
 	k_free(llist_node);
 }
 
@@ -48,6 +48,7 @@ struct zep_shim_intr_priv {
 struct zep_shim_llist_node {
 	sys_dnode_t head;
 	void *data;
+	bool pooled;
 };
 
 struct zep_shim_llist {
@@ -58,4 +59,24 @@ struct zep_shim_llist {
 void *net_pkt_to_nbuf(struct net_pkt *pkt);
 void *net_pkt_from_nbuf(void *iface, void *frm);
 
+/**
+ * struct zep_shim_nbuf_stats - Network buffer statistics.
+ * @pool_allocs: Buffers allocated from a memory slab.
+ * @heap_allocs: Buffers allocated from the heap.
+ * @tx_frames: Frames passed to the driver for sending.
+ * @tx_copies: TX frames copied into a driver buffer.
+ * @rx_frames: Frames received from the RPU.
+ * @rx_copies: RX frames copied into a network stack buffer.
+ */
+struct zep_shim_nbuf_stats {
+	atomic_t pool_allocs;
+	atomic_t heap_allocs;
+	atomic_t tx_frames;
+	atomic_t tx_copies;
+	atomic_t rx_frames;
+	atomic_t rx_copies;
+};
+
+void zep_shim_nbuf_stats_get(struct zep_shim_nbuf_stats *stats);
+
 #endif /* __SHIM_H__ */
@@ -32,7 +32,7 @@ void wifi_nrf_if_rx_frm(void *os_vif_ctx, void *frm)
 	struct wifi_nrf_vif_ctx_zep *vif_ctx_zep;
 	struct net_if *iface;
 	struct net_pkt *pkt;
-	uint8_t status;
+	int status;
 
 	vif_ctx_zep = os_vif_ctx;
 
@@ -40,6 +40,11 @@ void wifi_nrf_if_rx_frm(void *os_vif_ctx, void *frm)
 
 	pkt = net_pkt_from_nbuf(iface, frm);
 
+	if (!pkt) {
+		LOG_ERR("%s: Failed to allocate RX packet", __func__);
+		return;
+	}
+
 	status = net_recv_data(iface, pkt);
 
 	if (status < 0) {
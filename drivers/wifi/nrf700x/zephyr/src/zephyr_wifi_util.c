@@ -12,6 +12,7 @@
 #include "fmac_api.h"
 #include "zephyr_fmac_main.h"
 #include "zephyr_wifi_util.h"
+#include "shim.h"
 
 extern struct wifi_nrf_drv_priv_zep rpu_drv_priv_zep;
 struct wifi_nrf_ctx_zep *ctx = &rpu_drv_priv_zep.rpu_ctx_zep;
@@ -235,6 +236,108 @@ static int nrf_wifi_util_show_cfg(const struct shell *shell,
 }
 
 
+static int nrf_wifi_util_show_nbuf_stats(const struct shell *shell,
+					 size_t argc,
+					 const char *argv[])
+{
+	struct zep_shim_nbuf_stats stats;
+	unsigned int frames;
+	unsigned int allocs;
+	unsigned int copies;
+
+	zep_shim_nbuf_stats_get(&stats);
+
+	frames = atomic_get(&stats.tx_frames) + atomic_get(&stats.rx_frames);
+	allocs = atomic_get(&stats.pool_allocs) + atomic_get(&stats.heap_allocs);
+	copies = atomic_get(&stats.tx_copies) + atomic_get(&stats.rx_copies);
+
+	shell_fprintf(shell,
+		      SHELL_INFO,
+		      "pool_allocs = %ld\n"
+		      "heap_allocs = %ld\n"
+		      "tx_frames = %ld\n"
+		      "tx_copies = %ld\n"
+		      "rx_frames = %ld\n"
+		      "rx_copies = %ld\n",
+		      atomic_get(&stats.pool_allocs),
+		      atomic_get(&stats.heap_allocs),
+		      atomic_get(&stats.tx_frames),
+		      atomic_get(&stats.tx_copies),
+		      atomic_get(&stats.rx_frames),
+		      atomic_get(&stats.rx_copies));
+
+	if (frames) {
+		shell_fprintf(shell,
+			      SHELL_INFO,
+			      "allocs per 100 frames = %u\n"
+			      "copies per 100 frames = %u\n",
+			      (unsigned int)((100ULL * allocs) / frames),
+			      (unsigned int)((100ULL * copies) / frames));
+	}
+
+	return 0;
+}
+
+
+#ifdef CONFIG_NRF700X_DATA_TX
+static int nrf_wifi_util_show_tx_stats(const struct shell *shell,
+				       size_t argc,
+				       const char *argv[])
+{
+	struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx = ctx->rpu_ctx;
+	struct rpu_host_stats *host_stats = NULL;
+	int ac = 0;
+	int peer = 0;
+	int bucket = 0;
+
+	if (!fmac_dev_ctx) {
+		shell_fprintf(shell,
+			      SHELL_ERROR,
+			      "Driver not initialized\n");
+		return -ENOEXEC;
+	}
+
+	host_stats = &fmac_dev_ctx->host_stats;
+
+	for (ac = 0; ac < WIFI_NRF_FMAC_AC_MAX; ac++) {
+		shell_fprintf(shell,
+			      SHELL_INFO,
+			      "AC %d: outstanding_descs = %u, desc_waits = %u, desc_wait_us = %llu\n",
+			      ac,
+			      fmac_dev_ctx->tx_config.outstanding_descs[ac],
+			      host_stats->tx_desc_waits[ac],
+			      host_stats->tx_desc_wait_us[ac]);
+
+		shell_fprintf(shell, SHELL_INFO, "  pend_q_hist =");
+
+		for (bucket = 0; bucket < TX_PEND_Q_HIST_BUCKETS; bucket++) {
+			shell_fprintf(shell,
+				      SHELL_INFO,
+				      " %u",
+				      host_stats->tx_pend_q_ac_hist[ac][bucket]);
+		}
+
+		shell_fprintf(shell, SHELL_INFO, "\n");
+	}
+
+	for (peer = 0; peer < MAX_SW_PEERS; peer++) {
+		shell_fprintf(shell, SHELL_INFO, "Peer %d: pend_q_hist =", peer);
+
+		for (bucket = 0; bucket < TX_PEND_Q_HIST_BUCKETS; bucket++) {
+			shell_fprintf(shell,
+				      SHELL_INFO,
+				      " %u",
+				      host_stats->tx_pend_q_peer_hist[peer][bucket]);
+		}
+
+		shell_fprintf(shell, SHELL_INFO, "\n");
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NRF700X_DATA_TX */
+
+
 SHELL_STATIC_SUBCMD_SET_CREATE(
 	nrf_wifi_util_subcmds,
 	SHELL_CMD_ARG(he_ltf,
@@ -278,6 +381,20 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      nrf_wifi_util_show_cfg,
 		      1,
 		      0),
+#ifdef CONFIG_NRF700X_DATA_TX
+	SHELL_CMD_ARG(tx_stats,
+		      NULL,
+		      "Display the TX descriptor and pending queue statistics",
+		      nrf_wifi_util_show_tx_stats,
+		      1,
+		      0),
+#endif /* CONFIG_NRF700X_DATA_TX */
+	SHELL_CMD_ARG(nbuf_stats,
+		      NULL,
+		      "Display the network buffer allocation and copy counters",
+		      nrf_wifi_util_show_nbuf_stats,
+		      1,
+		      0),
 	SHELL_SUBCMD_SET_END);
 
 
@@ -50,6 +50,10 @@ enum app_event_type_flags {
 	APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+	APP_EVENT_TYPE_FLAGS_PRIORITY_HIGH,
+	APP_EVENT_TYPE_FLAGS_PRIORITY_LOW,
+	/* Only the latest event of the type matters, older ones may be dropped. */
+	APP_EVENT_TYPE_FLAGS_LATEST_VALUE,
 
 	/* Number of predefined flags. */
 	APP_EVENT_TYPE_FLAGS_COUNT,
@@ -70,6 +74,39 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	return (et->flags & BIT(flag)) != 0;
 }
 
+/**
+ * @brief Event priority classes.
+ *
+ * Priority class of an event type is selected with the
+ * @ref APP_EVENT_TYPE_FLAGS_PRIORITY_HIGH or @ref APP_EVENT_TYPE_FLAGS_PRIORITY_LOW
+ * flag. Event types without any of these flags use the normal priority class.
+ * The classes are used only if @kconfig{CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES}
+ * is enabled.
+ */
+enum app_event_priority {
+	APP_EVENT_PRIORITY_HIGH,
+	APP_EVENT_PRIORITY_NORMAL,
+	APP_EVENT_PRIORITY_LOW,
+
+	APP_EVENT_PRIORITY_COUNT
+};
+
+/** @brief Get priority class of the event type.
+ *
+ * @param et   Pointer to the event type.
+ * @retval Priority class of the event type.
+ */
+static inline enum app_event_priority app_event_get_type_priority(const struct event_type *et)
+{
+	if (app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_PRIORITY_HIGH)) {
+		return APP_EVENT_PRIORITY_HIGH;
+	} else if (app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_PRIORITY_LOW)) {
+		return APP_EVENT_PRIORITY_LOW;
+	}
+
+	return APP_EVENT_PRIORITY_NORMAL;
+}
+
 /** @brief Create an event listener object.
  *
  * @param lname   Module name.
@@ -165,6 +202,23 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
 
 
+/** @brief Define a memory slab for an event type.
+ *
+ * Events of the given type are allocated from a dedicated memory slab with
+ * @p block_cnt blocks of the event structure size. If the slab is exhausted
+ * or the event does not fit into a block (an event with dynamic data), the
+ * event is allocated using @ref app_event_manager_alloc.
+ *
+ * The memory slab is used only if @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_SLABS}
+ * is enabled. Otherwise, the macro has no effect.
+ *
+ * @param ename      Name of the event.
+ * @param block_cnt  Number of events that can be allocated from the slab.
+ */
+#define APP_EVENT_TYPE_SLAB_DEFINE(ename, block_cnt) \
+	_APP_EVENT_TYPE_SLAB_DEFINE(ename, block_cnt)
+
+
 /** @brief Verify if an event ID is valid.
  *
  * The pointer to an event type structure is used as its ID. This macro
@@ -390,6 +444,19 @@ void *app_event_manager_alloc(size_t size);
 void app_event_manager_free(void *addr);
 
 
+/** @brief Free memory occupied by the event if it was allocated from a memory slab.
+ *
+ * The default implementation of @ref app_event_manager_free calls this function
+ * first. A custom implementation of @ref app_event_manager_free must do the same
+ * if @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_SLABS} is enabled.
+ *
+ * @param addr  Pointer to previously allocated event, or NULL.
+ * @retval true  If the event was allocated from a memory slab and is now freed.
+ * @retval false Otherwise.
+ **/
+bool app_event_manager_slab_free(void *addr);
+
+
 /** @brief Log event.
  *
  * This helper macro simplifies event logging.
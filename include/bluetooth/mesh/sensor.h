@@ -210,8 +210,9 @@ struct bt_mesh_sensor_channel {
 /** Flag indicating this sensor type has a series representation. */
 #define BT_MESH_SENSOR_TYPE_FLAG_SERIES BIT(0)
 
-/** Sensor type. Should only be instantiated in sensor_types.c.
- *  See sensor_types.h for a list of all defined sensor types.
+/** Sensor type. Should only be instantiated with
+ *  @ref BT_MESH_SENSOR_TYPE_DEFINE. See sensor_types.h for a list of all
+ *  defined sensor types.
  */
 struct bt_mesh_sensor_type {
 	/** Device Property ID. */
@@ -227,6 +228,26 @@ struct bt_mesh_sensor_type {
 	const struct bt_mesh_sensor_channel *channels;
 };
 
+/** @brief Define a sensor type.
+ *
+ *  The sensor types are placed in an iterable section under a name starting
+ *  with their ID. The linker sorts the section by name, so that
+ *  @ref bt_mesh_sensor_type_get can look the types up with a binary search.
+ *  Sensor types defined in any other way are out of order, and can only be
+ *  found through a slower linear search.
+ *
+ *  @param _name Name of the sensor type. The type is defined as
+ *               @c bt_mesh_sensor_<_name>.
+ *  @param _id   Device Property ID, as a 4 digit hexadecimal literal with
+ *               uppercase digits, like @c 0x004D.
+ */
+#define BT_MESH_SENSOR_TYPE_DEFINE(_name, _id)                                 \
+	BUILD_ASSERT(sizeof(STRINGIFY(_id)) == sizeof("0x0000"),              \
+		     "Sensor type ID must be a 4 digit hexadecimal literal");  \
+	const Z_DECL_ALIGN(struct bt_mesh_sensor_type) bt_mesh_sensor_##_name  \
+		__attribute__((section("._bt_mesh_sensor_type.static."        \
+				       STRINGIFY(_id) "_" #_name))) __used
+
 struct bt_mesh_sensor;
 struct bt_mesh_sensor_srv;
 
@@ -6,6 +6,7 @@
 #ifndef AT_CMD_PARSER_H__
 #define AT_CMD_PARSER_H__
 
+#include <stdbool.h>
 #include <stdlib.h>
 #include <zephyr/types.h>
 
@@ -21,6 +22,9 @@ extern "C" {
  * @defgroup at_cmd_parser AT command parser
  * @{
  * @brief Basic parser for AT commands.
+ *
+ * Parameters can either be copied into an @ref at_param_list, or be returned as
+ * views into the parsed string using an @ref at_parser context.
  */
 
 /**
@@ -106,6 +110,152 @@ int at_parser_max_params_from_str(const char *at_params_str,
 int at_parser_params_from_str(const char *at_params_str, char **next_param_str,
 			      struct at_param_list *const list);
 
+/**
+ * @brief View of a parameter in a parsed AT string.
+ *
+ * The parameter is not copied. It is located by its offset and length in the
+ * string given to @ref at_parser_tokens_from_str.
+ */
+struct at_token {
+	/** Parameter type. */
+	enum at_param_type type;
+	/** Offset of the parameter from the start of the parsed string. */
+	uint32_t offset;
+	/** Length of the parameter in the parsed string. */
+	uint32_t len;
+};
+
+/**
+ * @brief AT parser context.
+ *
+ * Holds the parser state, so that several strings can be parsed concurrently
+ * using separate contexts. Must be initialized with @ref at_parser_init.
+ */
+struct at_parser {
+	/** String that was parsed last. Token offsets are relative to it. */
+	const char *str;
+	/** Token storage supplied by the caller. */
+	struct at_token *tokens;
+	/** Number of elements in @ref tokens. */
+	size_t tokens_max;
+	/** Number of tokens found in the last parsed string. */
+	size_t count;
+	/** Internal parser state. */
+	uint8_t state;
+	/** Internal flag, parse the remaining parameters as strings. */
+	bool set_type_string;
+	/** Internal, parameter list used by the copying API. */
+	struct at_param_list *list;
+};
+
+/**
+ * @brief Initialize an AT parser context.
+ *
+ * @param parser     Parser context.
+ * @param tokens     Array where the parameter views are stored.
+ * @param tokens_max Number of elements in @p tokens. This is the maximum number
+ *                   of parameters that are parsed from a string.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ */
+int at_parser_init(struct at_parser *parser, struct at_token *tokens, size_t tokens_max);
+
+/**
+ * @brief Parse AT command or response parameters from a string without copying them.
+ *
+ * This function finds the parameters in @p at_params_str and stores a view of each
+ * of them in the tokens of @p parser. No memory is allocated, and the parameter
+ * values are read from @p at_params_str when they are requested. Hence, the string
+ * must remain valid and unchanged for as long as the tokens are used.
+ *
+ * The parser state is kept in @p parser, so this function can be called
+ * concurrently with different parser contexts.
+ *
+ * @param parser         Initialized parser context.
+ * @param at_params_str  AT parameters as a null-terminated string.
+ * @param next_param_str See @ref at_parser_max_params_from_str.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EAGAIN New notification detected in string re-run the parser
+ *                 with the string pointed to by @p next_param_str.
+ * @retval -E2BIG  The parser does not have enough tokens to hold all detected
+ *                 parameters in string.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ */
+int at_parser_tokens_from_str(struct at_parser *parser, const char *at_params_str,
+			      char **next_param_str);
+
+/**
+ * @brief Get the type of a parsed parameter.
+ *
+ * @param parser Parser context.
+ * @param index  Parameter index.
+ *
+ * @return Parameter type, or AT_PARAM_TYPE_INVALID if there is no parameter at @p index.
+ */
+enum at_param_type at_parser_token_type_get(const struct at_parser *parser, size_t index);
+
+/**
+ * @brief Get a parsed parameter as a number.
+ *
+ * @param parser Parser context.
+ * @param index  Parameter index.
+ * @param value  Parameter value.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL The parameter does not exist or is not a number.
+ */
+int at_parser_token_int64_get(const struct at_parser *parser, size_t index, int64_t *value);
+
+/**
+ * @brief Get a pointer to a parsed string parameter.
+ *
+ * The string is not null-terminated. It points into the parsed string.
+ *
+ * @param parser Parser context.
+ * @param index  Parameter index.
+ * @param str    Start of the parameter in the parsed string.
+ * @param len    Length of the parameter.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL The parameter does not exist or is not a string.
+ */
+int at_parser_token_string_ptr_get(const struct at_parser *parser, size_t index,
+				   const char **str, size_t *len);
+
+/**
+ * @brief Copy a parsed string parameter.
+ *
+ * The string is not null-terminated.
+ *
+ * @param parser Parser context.
+ * @param index  Parameter index.
+ * @param value  Buffer where the string is copied.
+ * @param len    Size of @p value as input, length of the string as output.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOMEM @p value is too small.
+ * @retval -EINVAL The parameter does not exist or is not a string.
+ */
+int at_parser_token_string_get(const struct at_parser *parser, size_t index, char *value,
+			       size_t *len);
+
+/**
+ * @brief Get the numbers of a parsed array parameter.
+ *
+ * @param parser Parser context.
+ * @param index  Parameter index.
+ * @param array  Buffer where the numbers are stored.
+ * @param len    Size of @p array in bytes as input, number of bytes
+ *               written as output.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL The parameter does not exist or is not an array.
+ */
+int at_parser_token_array_get(const struct at_parser *parser, size_t index, uint32_t *array,
+			      size_t *len);
+
 enum at_cmd_type {
 	/** Unknown command, indicates that the actual command type could not
 	 *  be resolved.
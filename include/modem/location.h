@@ -50,6 +50,23 @@ enum location_req_mode {
 	LOCATION_REQ_MODE_FALLBACK = 0,
 	/** All requested methods are used sequentially. */
 	LOCATION_REQ_MODE_ALL,
+	/**
+	 * All requested methods are started at the same time, in the order of the list, and the
+	 * first location meeting the 'accuracy_threshold' of the location request configuration
+	 * is given.
+	 *
+	 * Cellular and Wi-Fi positioning wait for their scan results in their own work queues.
+	 * Like in the other modes, GNSS starts searching only once the LTE connection is idle,
+	 * so its fix usually comes after the other methods have sent their measurements to the
+	 * location service. Each method can be in the list only once.
+	 *
+	 * The event handler can be called from several threads at the same time, so it must be
+	 * reentrant. Location, error and timeout events are given in the system work queue.
+	 * With CONFIG_LOCATION_SERVICE_EXTERNAL, cellular and Wi-Fi location requests are given
+	 * in the work queues of these methods, and GNSS assistance and prediction requests in
+	 * the library work queue.
+	 */
+	LOCATION_REQ_MODE_CONCURRENT,
 };
 
 /** Event IDs. */
@@ -370,11 +387,32 @@ struct location_config {
 	 * @brief Location acquisition mode.
 	 */
 	enum location_req_mode mode;
+
+	/**
+	 * @brief Required location accuracy in meters in LOCATION_REQ_MODE_CONCURRENT mode.
+	 *
+	 * @details The first location with an accuracy of this value or better is given in
+	 * LOCATION_EVT_LOCATION event. If none of the methods reaches the required accuracy,
+	 * the most accurate location is given once all methods are done.
+	 * Set to 0 to accept any location.
+	 */
+	float accuracy_threshold;
+
+	/**
+	 * @brief Refine the location in LOCATION_REQ_MODE_CONCURRENT mode.
+	 *
+	 * @details If set to false, the remaining methods are cancelled once a location meeting
+	 * 'accuracy_threshold' has been given. If set to true, the remaining methods continue
+	 * and a LOCATION_EVT_LOCATION event is given again for each more accurate location.
+	 */
+	bool refine;
 };
 
 /**
  * @brief Event handler prototype.
  *
+ * @details In LOCATION_REQ_MODE_CONCURRENT, the handler must be reentrant.
+ *
  * @param[in] event_data Event data.
  */
 typedef void (*location_event_handler_t)(const struct location_event_data *event_data);
@@ -52,6 +52,19 @@ extern "C" {
 #define RSRQ_IDX_TO_DB(rsrq) ((((float)(rsrq)) * RSRQ_SCALE_VAL) - \
 			      RSRQ_OFFSET_VAL)
 
+/** Maximum length of the operator (MCC and MNC) in a snapshot. */
+#define MODEM_INFO_SNAPSHOT_OPERATOR_LEN 6
+/** Size of the operator string in a snapshot. */
+#define MODEM_INFO_SNAPSHOT_OPERATOR_SIZE (MODEM_INFO_SNAPSHOT_OPERATOR_LEN + 1)
+/** Length of the tracking area code in a snapshot. */
+#define MODEM_INFO_SNAPSHOT_AREA_CODE_LEN 4
+/** Length of the cell ID in a snapshot. */
+#define MODEM_INFO_SNAPSHOT_CELLID_LEN 8
+/** Maximum length of the access point name in a snapshot. */
+#define MODEM_INFO_SNAPSHOT_APN_LEN 63
+/** Maximum length of the IP address in a snapshot. */
+#define MODEM_INFO_SNAPSHOT_IP_ADDRESS_LEN 45
+
 /**@brief RSRP event handler function prototype. */
 typedef void (*rsrp_cb_t)(char rsrp_value);
 
@@ -135,6 +148,40 @@ struct modem_param_info {
 	struct device_param  device;/**< Device parameters. */
 };
 
+/**@brief Modem information snapshot.
+ *
+ * Parsed values of several modem information types, read with as few
+ * AT commands as possible.
+ */
+struct modem_info_snapshot {
+	/** Fields in the snapshot, as a bitmask of @c BIT(enum modem_info). */
+	uint32_t fields;
+	/** Network registration status. */
+	uint8_t reg_status;
+	/** Current operator (MCC and MNC). */
+	char operator[MODEM_INFO_SNAPSHOT_OPERATOR_SIZE];
+	/** Mobile country code. */
+	uint16_t mcc;
+	/** Mobile network code. */
+	uint16_t mnc;
+	/** Tracking area code, in HEX format. */
+	char area_code[MODEM_INFO_SNAPSHOT_AREA_CODE_LEN + 1];
+	/** Tracking area code. */
+	uint16_t area_code_value;
+	/** Cell ID, in HEX format. */
+	char cellid_hex[MODEM_INFO_SNAPSHOT_CELLID_LEN + 1];
+	/** Cell ID. */
+	uint32_t cellid;
+	/** Current LTE band. */
+	uint16_t band;
+	/** Signal strength, as an index. See @ref RSRP_IDX_TO_DBM. */
+	uint16_t rsrp;
+	/** Access point name of the default PDN connection. */
+	char apn[MODEM_INFO_SNAPSHOT_APN_LEN + 1];
+	/** IP address of the default PDN connection. */
+	char ip_address[MODEM_INFO_SNAPSHOT_IP_ADDRESS_LEN + 1];
+};
+
 /** @brief Initialize the modem information module.
  *
  * @retval 0 If the operation was successful.
@@ -221,6 +268,36 @@ enum at_param_type modem_info_type_get(enum modem_info info);
  */
 int modem_info_params_get(struct modem_param_info *modem_param);
 
+/** @brief Obtain a snapshot of modem information.
+ *
+ * The requested fields are read with as few AT commands as possible:
+ * @ref MODEM_INFO_RSRP, @ref MODEM_INFO_CUR_BAND, @ref MODEM_INFO_AREA_CODE,
+ * @ref MODEM_INFO_OPERATOR, @ref MODEM_INFO_MCC, @ref MODEM_INFO_MNC and
+ * @ref MODEM_INFO_CELLID with AT%XMONITOR, and @ref MODEM_INFO_IP_ADDRESS and
+ * @ref MODEM_INFO_APN with AT+CGDCONT?.
+ *
+ * The results are cached for CONFIG_MODEM_INFO_SNAPSHOT_TTL_MS milliseconds.
+ * The cached network information is invalidated by +CEREG and %CESQ
+ * notifications, and the cached PDN information by +CGEV notifications.
+ *
+ * @param snapshot Pointer to the snapshot to fill.
+ * @param fields   Requested fields, as a bitmask of @c BIT(enum modem_info).
+ *
+ * @retval 0 if the operation was successful.
+ * @retval -ENOTSUP if a requested field is not supported in snapshots.
+ * @retval -ENOENT if the device is not registered to a network or has no
+ *         PDN context.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int modem_info_snapshot_get(struct modem_info_snapshot *snapshot, uint32_t fields);
+
+/** @brief Invalidate the cached modem information snapshot.
+ *
+ * The next call to @ref modem_info_snapshot_get reads all requested fields
+ * from the modem.
+ */
+void modem_info_snapshot_invalidate(void);
+
 /** @brief Obtain the UUID of the modem firmware build.
  *
  * The UUID is represented as a string, for example:
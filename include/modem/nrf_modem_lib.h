@@ -170,6 +170,41 @@ int nrf_modem_lib_diag_stats_get(struct nrf_modem_lib_diag_stats *stats);
 
 #endif /* defined(CONFIG_NRF_MODEM_LIB_MEM_DIAG) || defined(__DOXYGEN__) */
 
+#if defined(CONFIG_NRF_MODEM_LIB_SOCKET_TX_STATS) || defined(__DOXYGEN__)
+
+/** @brief Transmit statistics of an offloaded socket. */
+struct nrf_modem_lib_socket_tx_stats {
+	/** Number of calls to @c nrf_sendto. */
+	uint32_t sendto;
+	/** Number of calls to @c sendmsg. */
+	uint32_t sendmsg;
+	/** Number of bytes accepted by the modem. */
+	uint32_t bytes;
+	/** Number of bytes repacked into an intermediate buffer by @c sendmsg. */
+	uint32_t copied;
+	/** Number of @c sendmsg calls that found no free intermediate buffer,
+	 *  and either waited for one or sent the message parts separately.
+	 */
+	uint32_t buf_busy;
+};
+
+/**
+ * @brief Retrieve transmit statistics of an offloaded socket.
+ *
+ * The statistics are reset when the socket is created.
+ *
+ * @param[in] fd Socket descriptor.
+ * @param[out] stats Transmit statistics.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p stats is NULL.
+ * @retval -EBADF if @p fd is not a valid descriptor.
+ * @retval -ENOTSOCK if @p fd is not an offloaded socket.
+ */
+int nrf_modem_lib_socket_tx_stats_get(int fd, struct nrf_modem_lib_socket_tx_stats *stats);
+
+#endif /* defined(CONFIG_NRF_MODEM_LIB_SOCKET_TX_STATS) || defined(__DOXYGEN__) */
+
 /** @} */
 
 #ifdef __cplusplus
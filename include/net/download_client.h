@@ -100,6 +100,10 @@ struct download_client_cfg {
 	 * configured using Kconfig shall be used.
 	 */
 	size_t frag_size_override;
+	/** Maximum number of HTTP range requests in flight. 0 indicates that
+	 * the value configured using Kconfig shall be used.
+	 */
+	uint8_t pipeline_depth;
 	/** Set hostname for TLS Server Name Indication extension */
 	bool set_tls_hostname;
 };
@@ -157,6 +161,14 @@ struct download_client {
 		bool has_header;
 		/** The server has closed the connection. */
 		bool connection_close;
+		/** Number of range requests waiting for a response. */
+		uint8_t in_flight;
+		/** Offset of the first byte that has not been requested. */
+		size_t requested;
+		/** File offset at which the current response ends. */
+		size_t resp_end;
+		/** Number of bytes of the next responses in the buffer. */
+		size_t carry;
 	} http;
 
 	struct {
@@ -21,6 +21,12 @@
  * @{
  */
 
+/** Number of fractional bits of the gain used by @ref pcm_mix_gain. */
+#define PCM_MIX_GAIN_SHIFT 14
+
+/** Gain that leaves the samples unchanged (1.0 in unsigned Q2.14 format). */
+#define PCM_MIX_GAIN_UNITY (1 << PCM_MIX_GAIN_SHIFT)
+
 enum pcm_mix_mode {
 	B_STEREO_INTO_A_STEREO,
 	B_MONO_INTO_A_MONO,
@@ -52,6 +58,34 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of PCM data with a gain applied to each buffer.
+ *
+ * @note Samples of both buffers are scaled by the respective gain, added and
+ * the result is saturated to the range of the selected bit depth.
+ * Samples of buffer A that buffer B is not mixed into are left unchanged.
+ * For the signed 16-bit PCM with unity gains, two samples are processed per step
+ * using saturating SIMD instructions if supported by the CPU.
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param gain_a        [in]     Gain of buffer A in unsigned Q2.14 format.
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param gain_b        [in]     Gain of buffer B in unsigned Q2.14 format.
+ * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
+ * @param bit_depth     [in]     Bit depth of the samples: 16, 24 or 32. The 24-bit samples
+ *				 are stored sign-extended in 32-bit containers.
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL, size_a = 0 or the bit depth is not supported.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_gain(void *const pcm_a, size_t size_a, uint16_t gain_a, void const *const pcm_b,
+		 size_t size_b, uint16_t gain_b, enum pcm_mix_mode mix_mode, uint8_t bit_depth);
+
 /**
  * @}
  */
@@ -37,20 +37,16 @@ enum at_parser_state {
 	CLAC,
 };
 
-static enum at_parser_state state;
-
-static bool set_type_string;
-
-static inline void set_new_state(enum at_parser_state new_state)
+static inline void set_new_state(struct at_parser *parser, enum at_parser_state new_state)
 {
-	state = new_state;
+	parser->state = new_state;
 }
 
-static inline void reset_state(void)
+static inline void reset_state(struct at_parser *parser)
 {
-	state = IDLE;
+	parser->state = IDLE;
 
-	set_type_string = false;
+	parser->set_type_string = false;
 }
 
 static inline void skip_command_prefix(const char **cmd)
@@ -100,7 +96,71 @@ static bool is_result(const char *str)
 	return false;
 }
 
-static int at_parse_detect_type(const char **str, int index)
+/* Store a parameter as a view into the parsed string. */
+static void at_parse_token_put(struct at_parser *parser, int index, enum at_param_type type,
+			       const char *start_ptr, size_t len)
+{
+	struct at_token *token;
+
+	if (index >= parser->tokens_max) {
+		return;
+	}
+
+	token = &parser->tokens[index];
+	token->type = type;
+	token->offset = start_ptr - parser->str;
+	token->len = len;
+
+	parser->count = MAX(parser->count, index + 1);
+}
+
+static void at_parse_string_put(struct at_parser *parser, int index, const char *start_ptr,
+				size_t len)
+{
+	if (parser->list) {
+		at_params_string_put(parser->list, index, start_ptr, len);
+	} else {
+		at_parse_token_put(parser, index, AT_PARAM_TYPE_STRING, start_ptr, len);
+	}
+}
+
+/* Parse the numbers of an array, starting after the opening parenthesis.
+ * On return, str points to the closing parenthesis or to where parsing stopped.
+ */
+static size_t at_parse_array(const char **str, uint32_t *array, size_t array_max)
+{
+	const char *tmpstr = *str;
+	char *next;
+	size_t i = 0;
+
+	array[i++] = (uint32_t)strtoul(tmpstr, &next, 10);
+	tmpstr = next;
+
+	while (!is_array_stop(*tmpstr) && !is_terminated(*tmpstr)) {
+		if (is_separator(*tmpstr)) {
+			array[i++] = (uint32_t)strtoul(++tmpstr, &next, 10);
+
+			if (next == tmpstr) {
+				/* No number was found */
+				break;
+			}
+
+			tmpstr = next;
+		} else {
+			tmpstr++;
+		}
+
+		if (i == array_max) {
+			break;
+		}
+	}
+
+	*str = tmpstr;
+
+	return i;
+}
+
+static int at_parse_detect_type(struct at_parser *parser, const char **str, int index)
 {
 	const char *tmpstr = *str;
 
@@ -108,29 +168,29 @@ static int at_parse_detect_type(const char **str, int index)
 		/* Only first parameter in the string can be
 		 * notification ID, (eg +CEREG:)
 		 */
-		set_new_state(NOTIFICATION);
+		set_new_state(parser, NOTIFICATION);
 
 		/* Check for responses we know need to be strings */
-		set_type_string = check_response_for_forced_string(tmpstr);
+		parser->set_type_string = check_response_for_forced_string(tmpstr);
 
-	} else if (set_type_string) {
-		set_new_state(STRING);
+	} else if (parser->set_type_string) {
+		set_new_state(parser, STRING);
 	} else if ((index > 0) && is_clac(tmpstr)) {
 		/* Next, check if we deal with CLAC response (eg AT+, AT%)
 		 * NOTE - need to go back to index 0 and parse as CLAC state
 		 * NOTE - AT+CLAC always returns more than one line
 		 */
-		set_new_state(CLAC);
+		set_new_state(parser, CLAC);
 		return -2;
 	} else if ((index == 0) && is_command(tmpstr)) {
 		/* Next, check if we deal with command (eg AT+CCLK) */
-		set_new_state(COMMAND);
+		set_new_state(parser, COMMAND);
 	} else if (index == 0) {
 		/* If the string start without an notification
 		 * ID, we treat the whole string as one string
 		 * parameter
 		 */
-		set_new_state(STRING);
+		set_new_state(parser, STRING);
 	} else if ((index > 0) && is_notification(*tmpstr)) {
 		/* If notifications is detected later in the
 		 * string we should stop parsing and return
@@ -139,15 +199,15 @@ static int at_parse_detect_type(const char **str, int index)
 		*str = tmpstr;
 		return -1;
 	} else if (is_number(*tmpstr)) {
-		set_new_state(NUMBER);
+		set_new_state(parser, NUMBER);
 
 	} else if (is_dblquote(*tmpstr)) {
-		set_new_state(QUOTED_STRING);
+		set_new_state(parser, QUOTED_STRING);
 		tmpstr++;
 	} else if (is_array_start(*tmpstr)) {
-		set_new_state(ARRAY);
+		set_new_state(parser, ARRAY);
 		tmpstr++;
-	} else if (is_lfcr(*tmpstr) && (state == NUMBER)) {
+	} else if (is_lfcr(*tmpstr) && (parser->state == NUMBER)) {
 		/* If \n or \r is detected in the string and the
 		 * previous param was a number we assume the
 		 * next parameter is PDU data
@@ -157,14 +217,14 @@ static int at_parse_detect_type(const char **str, int index)
 			tmpstr++;
 		}
 
-		set_new_state(SMS_PDU);
-	} else if (is_lfcr(*tmpstr) && (state == OPTIONAL)) {
-		set_new_state(OPTIONAL);
+		set_new_state(parser, SMS_PDU);
+	} else if (is_lfcr(*tmpstr) && (parser->state == OPTIONAL)) {
+		set_new_state(parser, OPTIONAL);
 	} else if (is_separator(*tmpstr)) {
 		/* If a separator is detected we have detected
 		 * and empty optional parameter
 		 */
-		set_new_state(OPTIONAL);
+		set_new_state(parser, OPTIONAL);
 	} else {
 		/* The rule set is exhausted, and cannot
 		 * continue. Break the loop and return an error
@@ -177,10 +237,10 @@ static int at_parse_detect_type(const char **str, int index)
 	return 0;
 }
 
-static int at_parse_process_element(const char **str, int index,
-				    struct at_param_list *const list)
+static int at_parse_process_element(struct at_parser *parser, const char **str, int index)
 {
 	const char *tmpstr = *str;
+	enum at_parser_state state = parser->state;
 
 	if (is_terminated(*tmpstr)) {
 		return -1;
@@ -193,8 +253,7 @@ static int at_parse_process_element(const char **str, int index,
 			tmpstr++;
 		}
 
-		at_params_string_put(list, index, start_ptr,
-				     tmpstr - start_ptr);
+		at_parse_string_put(parser, index, start_ptr, tmpstr - start_ptr);
 	} else if (state == COMMAND) {
 		const char *start_ptr = tmpstr;
 
@@ -204,8 +263,7 @@ static int at_parse_process_element(const char **str, int index,
 			tmpstr++;
 		}
 
-		at_params_string_put(list, index, start_ptr,
-				     tmpstr - start_ptr);
+		at_parse_string_put(parser, index, start_ptr, tmpstr - start_ptr);
 
 		/* Skip read/test special characters. */
 		if ((*tmpstr == AT_CMD_SEPARATOR) &&
@@ -216,7 +274,11 @@ static int at_parse_process_element(const char **str, int index,
 		}
 
 	} else if (state == OPTIONAL) {
-		at_params_empty_put(list, index);
+		if (parser->list) {
+			at_params_empty_put(parser->list, index);
+		} else {
+			at_parse_token_put(parser, index, AT_PARAM_TYPE_EMPTY, tmpstr, 0);
+		}
 
 	} else if (state == STRING) {
 		const char *start_ptr = tmpstr;
@@ -225,8 +287,7 @@ static int at_parse_process_element(const char **str, int index,
 			tmpstr++;
 		}
 
-		at_params_string_put(list, index, start_ptr,
-				     tmpstr - start_ptr);
+		at_parse_string_put(parser, index, start_ptr, tmpstr - start_ptr);
 
 		tmpstr++;
 	} else if (state == QUOTED_STRING) {
@@ -236,48 +297,35 @@ static int at_parse_process_element(const char **str, int index,
 			tmpstr++;
 		}
 
-		at_params_string_put(list, index, start_ptr,
-				     tmpstr - start_ptr);
+		at_parse_string_put(parser, index, start_ptr, tmpstr - start_ptr);
 
 		tmpstr++;
 	} else if (state == ARRAY) {
-		char *next;
-		size_t i = 0;
+		const char *start_ptr = tmpstr;
 		uint32_t tmparray[AT_CMD_MAX_ARRAY_SIZE];
+		size_t i = at_parse_array(&tmpstr, tmparray, ARRAY_SIZE(tmparray));
 
-		tmparray[i++] = (uint32_t)strtoul(tmpstr, &next, 10);
-		tmpstr = next;
-
-		while (!is_array_stop(*tmpstr) && !is_terminated(*tmpstr)) {
-			if (is_separator(*tmpstr)) {
-				tmparray[i++] =
-					(uint32_t)strtoul(++tmpstr, &next, 10);
-
-				if (strlen(tmpstr) == strlen(next)) {
-					break;
-				} else {
-					tmpstr = next;
-				}
-
-			} else {
-				tmpstr++;
-			}
-
-			if (i == AT_CMD_MAX_ARRAY_SIZE) {
-				break;
-			}
+		if (parser->list) {
+			at_params_array_put(parser->list, index, tmparray, i * sizeof(uint32_t));
+		} else {
+			at_parse_token_put(parser, index, AT_PARAM_TYPE_ARRAY, start_ptr,
+					   tmpstr - start_ptr);
 		}
 
-		at_params_array_put(list, index, tmparray, i * sizeof(uint32_t));
-
 		tmpstr++;
 	} else if (state == NUMBER) {
+		const char *start_ptr = tmpstr;
 		char *next;
 		int64_t value = (int64_t)strtoll(tmpstr, &next, 10);
 
 		tmpstr = next;
 
-		at_params_int_put(list, index, value);
+		if (parser->list) {
+			at_params_int_put(parser->list, index, value);
+		} else {
+			at_parse_token_put(parser, index, AT_PARAM_TYPE_NUM_INT, start_ptr,
+					   tmpstr - start_ptr);
+		}
 	} else if (state == SMS_PDU) {
 		const char *start_ptr = tmpstr;
 
@@ -285,8 +333,7 @@ static int at_parse_process_element(const char **str, int index,
 			tmpstr++;
 		}
 
-		at_params_string_put(list, index, start_ptr,
-				     tmpstr - start_ptr);
+		at_parse_string_put(parser, index, start_ptr, tmpstr - start_ptr);
 	} else if (state == CLAC) {
 		const char *start_ptr = tmpstr;
 
@@ -294,8 +341,7 @@ static int at_parse_process_element(const char **str, int index,
 			tmpstr++;
 		}
 
-		at_params_string_put(list, index, start_ptr,
-				     tmpstr - start_ptr);
+		at_parse_string_put(parser, index, start_ptr, tmpstr - start_ptr);
 	}
 
 	*str = tmpstr;
@@ -306,8 +352,7 @@ static int at_parse_process_element(const char **str, int index,
  * Internal function.
  * Parameters cannot be null. String must be null terminated.
  */
-static int at_parse_param(const char **at_params_str,
-			  struct at_param_list *const list,
+static int at_parse_param(struct at_parser *parser, const char **at_params_str,
 			  const size_t max_params)
 {
 	int index = 0;
@@ -315,14 +360,14 @@ static int at_parse_param(const char **at_params_str,
 	bool oversized = false;
 	int ret;
 
-	reset_state();
+	reset_state(parser);
 
 	while ((!is_terminated(*str)) && (index < max_params)) {
 		if (isspace((int)*str)) {
 			str++;
 		}
 
-		ret = at_parse_detect_type(&str, index);
+		ret = at_parse_detect_type(parser, &str, index);
 		if (ret == -1) {
 			break;
 		}
@@ -332,7 +377,7 @@ static int at_parse_param(const char **at_params_str,
 			index = 0;
 		}
 
-		if (at_parse_process_element(&str, index, list) == -1) {
+		if (at_parse_process_element(parser, &str, index) == -1) {
 			break;
 		}
 
@@ -347,12 +392,11 @@ static int at_parse_param(const char **at_params_str,
 					break;
 				}
 
-				if (at_parse_detect_type(&str, index) == -1) {
+				if (at_parse_detect_type(parser, &str, index) == -1) {
 					break;
 				}
 
-				if (at_parse_process_element(&str, index,
-							     list) == -1) {
+				if (at_parse_process_element(parser, &str, index) == -1) {
 					break;
 				}
 			}
@@ -407,6 +451,10 @@ int at_parser_max_params_from_str(const char *at_params_str,
 				  size_t max_params_count)
 {
 	int err = 0;
+	struct at_parser parser = {
+		.str = at_params_str,
+		.list = list,
+	};
 
 	if (at_params_str == NULL || list == NULL || list->params == NULL) {
 		return -EINVAL;
@@ -416,7 +464,7 @@ int at_parser_max_params_from_str(const char *at_params_str,
 
 	max_params_count = MIN(max_params_count, list->param_count);
 
-	err = at_parse_param(&at_params_str, list, max_params_count);
+	err = at_parse_param(&parser, &at_params_str, max_params_count);
 
 	if (next_param_str) {
 		*next_param_str = (char *)at_params_str;
@@ -425,6 +473,138 @@ int at_parser_max_params_from_str(const char *at_params_str,
 	return err;
 }
 
+int at_parser_init(struct at_parser *parser, struct at_token *tokens, size_t tokens_max)
+{
+	if (parser == NULL || tokens == NULL || tokens_max == 0) {
+		return -EINVAL;
+	}
+
+	*parser = (struct at_parser){
+		.tokens = tokens,
+		.tokens_max = tokens_max,
+	};
+
+	return 0;
+}
+
+int at_parser_tokens_from_str(struct at_parser *parser, const char *at_params_str,
+			      char **next_param_str)
+{
+	int err;
+
+	if (parser == NULL || parser->tokens == NULL || at_params_str == NULL) {
+		return -EINVAL;
+	}
+
+	parser->str = at_params_str;
+	parser->count = 0;
+	parser->list = NULL;
+
+	err = at_parse_param(parser, &at_params_str, parser->tokens_max);
+
+	if (next_param_str) {
+		*next_param_str = (char *)at_params_str;
+	}
+
+	return err;
+}
+
+static const struct at_token *at_parser_token_get(const struct at_parser *parser, size_t index,
+						  enum at_param_type type)
+{
+	if (parser == NULL || index >= parser->count) {
+		return NULL;
+	}
+
+	if (parser->tokens[index].type != type) {
+		return NULL;
+	}
+
+	return &parser->tokens[index];
+}
+
+enum at_param_type at_parser_token_type_get(const struct at_parser *parser, size_t index)
+{
+	if (parser == NULL || index >= parser->count) {
+		return AT_PARAM_TYPE_INVALID;
+	}
+
+	return parser->tokens[index].type;
+}
+
+int at_parser_token_int64_get(const struct at_parser *parser, size_t index, int64_t *value)
+{
+	const struct at_token *token = at_parser_token_get(parser, index, AT_PARAM_TYPE_NUM_INT);
+
+	if (token == NULL || value == NULL) {
+		return -EINVAL;
+	}
+
+	*value = (int64_t)strtoll(parser->str + token->offset, NULL, 10);
+
+	return 0;
+}
+
+int at_parser_token_string_ptr_get(const struct at_parser *parser, size_t index,
+				   const char **str, size_t *len)
+{
+	const struct at_token *token = at_parser_token_get(parser, index, AT_PARAM_TYPE_STRING);
+
+	if (token == NULL || str == NULL || len == NULL) {
+		return -EINVAL;
+	}
+
+	*str = parser->str + token->offset;
+	*len = token->len;
+
+	return 0;
+}
+
+int at_parser_token_string_get(const struct at_parser *parser, size_t index, char *value,
+			       size_t *len)
+{
+	const char *str;
+	size_t str_len;
+	int err;
+
+	if (value == NULL || len == NULL) {
+		return -EINVAL;
+	}
+
+	err = at_parser_token_string_ptr_get(parser, index, &str, &str_len);
+	if (err) {
+		return err;
+	}
+
+	if (*len < str_len) {
+		return -ENOMEM;
+	}
+
+	memcpy(value, str, str_len);
+	*len = str_len;
+
+	return 0;
+}
+
+int at_parser_token_array_get(const struct at_parser *parser, size_t index, uint32_t *array,
+			      size_t *len)
+{
+	const struct at_token *token = at_parser_token_get(parser, index, AT_PARAM_TYPE_ARRAY);
+	const char *str;
+	size_t count;
+
+	if (token == NULL || array == NULL || len == NULL || *len < sizeof(uint32_t)) {
+		return -EINVAL;
+	}
+
+	str = parser->str + token->offset;
+	count = at_parse_array(&str, array,
+			       MIN(*len / sizeof(uint32_t), AT_CMD_MAX_ARRAY_SIZE));
+	*len = count * sizeof(uint32_t);
+
+	return 0;
+}
+
 enum at_cmd_type at_parser_cmd_type_get(const char *at_cmd)
 {
 	enum at_cmd_type type;
@@ -240,10 +240,7 @@ static inline bool is_number(char chr)
  */
 static inline bool is_command(const char *str)
 {
-	if (strlen(str) < 2) {
-		return false;
-	}
-
+	/* A terminator fails the comparison, so the string is never read past its end. */
 	if ((toupper((int)str[0]) != 'A') || (toupper((int)str[1]) != 'T')) {
 		return false;
 	}
@@ -279,10 +276,9 @@ static bool is_clac(const char *str)
 		str++;
 	}
 
-	if (strlen(str) < 4) {
-		return false;
-	}
-
+	/* Checked character by character instead of using strlen(), as this is called
+	 * for every parameter of a response.
+	 */
 	if ((toupper(str[0]) != 'A') || (toupper(str[1]) != 'T')) {
 		/* Not an AT command */
 		return false;
@@ -293,6 +289,10 @@ static bool is_clac(const char *str)
 		return false;
 	}
 
+	if (is_terminated(str[3])) {
+		return false;
+	}
+
 	if ((toupper(str[2]) == '%') && (toupper(str[3]) == 'X')) {
 		/* Ignore AT%X to avoid false detect (read resp XCOEX0 etc.) */
 		return false;
@@ -90,6 +90,8 @@ int location_request(const struct location_config *config)
 			default_config.interval = config->interval;
 			default_config.timeout = config->timeout;
 			default_config.mode = config->mode;
+			default_config.accuracy_threshold = config->accuracy_threshold;
+			default_config.refine = config->refine;
 		} else {
 			LOG_DBG("No configuration given. Using default configuration.");
 		}
@@ -164,6 +166,8 @@ void location_config_defaults_set(
 	config->methods_count = methods_count;
 	config->timeout = 300 * MSEC_PER_SEC; /* 5 minutes */
 	config->mode = LOCATION_REQ_MODE_FALLBACK;
+	config->accuracy_threshold = 0;
+	config->refine = false;
 	for (int i = 0; i < methods_count; i++) {
 		location_config_method_defaults_set(&config->methods[i], method_types[i]);
 	}
@@ -42,6 +42,35 @@ static int current_method_index;
 /** Whether to perform fallback for current location request processing. */
 static bool execute_fallback = true;
 
+/***** Variables for LOCATION_REQ_MODE_CONCURRENT *****/
+
+/** State of a location method running concurrently with the other methods. */
+struct location_core_concurrent_method {
+	/** Location method. */
+	enum location_method method;
+	/** Whether the method has been started and not completed yet. */
+	bool running;
+	/** Whether 'event_data' has an event that has not been handled yet. */
+	bool event_pending;
+	/** Event given by the method. */
+	struct location_event_data event_data;
+	/** Work item for method timeout handler. */
+	struct k_work_delayable timeout_work;
+};
+
+/** Method states in the same order as in current_config.methods. */
+static struct location_core_concurrent_method
+	concurrent_methods[CONFIG_LOCATION_METHODS_LIST_SIZE];
+
+/** Lock protecting the states and events of the concurrently running methods. */
+static struct k_spinlock concurrent_lock;
+
+/** Whether a location meeting the accuracy threshold has been given to the application. */
+static bool concurrent_location_given;
+
+/** Most accurate location so far. Valid if event ID is LOCATION_EVT_LOCATION. */
+static struct location_event_data concurrent_best_event_data;
+
 /***** Work queue and work item definitions *****/
 
 #define LOCATION_CORE_STACK_SIZE CONFIG_LOCATION_WORKQUEUE_STACK_SIZE
@@ -51,6 +80,23 @@ K_THREAD_STACK_DEFINE(location_core_stack, LOCATION_CORE_STACK_SIZE);
 /** Work queue for location library. Location methods can run their tasks in it. */
 static struct k_work_q location_core_work_q;
 
+#if defined(CONFIG_LOCATION_REQ_MODE_CONCURRENT)
+/** Indexes to location_core_method_work_q. */
+enum location_core_method_work_q_index {
+	LOCATION_CORE_WORK_Q_CELLULAR,
+	LOCATION_CORE_WORK_Q_WIFI,
+	LOCATION_CORE_WORK_Q_COUNT
+};
+
+K_THREAD_STACK_ARRAY_DEFINE(location_core_method_stacks, LOCATION_CORE_WORK_Q_COUNT,
+			    LOCATION_CORE_STACK_SIZE);
+
+/** Work queues for the methods that wait for their scan results in a work item.
+ * Separate work queues allow the scans to run at the same time in concurrent mode.
+ */
+static struct k_work_q location_core_method_work_q[LOCATION_CORE_WORK_Q_COUNT];
+#endif
+
 /** Handler for periodic location requests. */
 static void location_core_periodic_work_fn(struct k_work *work);
 
@@ -75,6 +121,15 @@ static void location_core_event_cb_fn(struct k_work *work);
 /** Work item for location event callback. */
 K_WORK_DEFINE(location_event_cb_work, location_core_event_cb_fn);
 
+/** Handler for events of concurrently running methods. */
+static void location_core_concurrent_event_work_fn(struct k_work *work);
+
+/** Work item for events of concurrently running methods. */
+K_WORK_DEFINE(location_concurrent_event_work, location_core_concurrent_event_work_fn);
+
+/** Handler for method timeout of a concurrently running method. */
+static void location_core_concurrent_timeout_work_fn(struct k_work *work);
+
 /** Semaphore protecting the use of location requests. */
 K_SEM_DEFINE(location_core_sem, 1, 1);
 
@@ -248,6 +303,11 @@ int location_core_init(void)
 			methods_supported[i]->method_string);
 	}
 
+	for (int i = 0; i < ARRAY_SIZE(concurrent_methods); i++) {
+		k_work_init_delayable(&concurrent_methods[i].timeout_work,
+				      location_core_concurrent_timeout_work_fn);
+	}
+
 	k_work_queue_start(
 		&location_core_work_q,
 		location_core_stack,
@@ -255,6 +315,22 @@ int location_core_init(void)
 		LOCATION_CORE_PRIORITY,
 		&cfg);
 
+#if defined(CONFIG_LOCATION_REQ_MODE_CONCURRENT)
+	for (int i = 0; i < LOCATION_CORE_WORK_Q_COUNT; i++) {
+		struct k_work_queue_config method_cfg = {
+			.name = i == LOCATION_CORE_WORK_Q_CELLULAR ?
+				"location_cellular_workq" : "location_wifi_workq",
+		};
+
+		k_work_queue_start(
+			&location_core_method_work_q[i],
+			location_core_method_stacks[i],
+			K_THREAD_STACK_SIZEOF(location_core_method_stacks[i]),
+			LOCATION_CORE_PRIORITY,
+			&method_cfg);
+	}
+#endif
+
 	return 0;
 }
 
@@ -277,6 +353,24 @@ int location_core_validate_params(const struct location_config *config)
 			LOG_ERR("Location method (%d) not supported", config->methods[i].method);
 			return -EINVAL;
 		}
+
+		if (config->mode != LOCATION_REQ_MODE_CONCURRENT) {
+			continue;
+		}
+
+		if (!IS_ENABLED(CONFIG_LOCATION_REQ_MODE_CONCURRENT)) {
+			LOG_ERR("Concurrent mode requires CONFIG_LOCATION_REQ_MODE_CONCURRENT");
+			return -EINVAL;
+		}
+
+		/* Concurrently running methods are told apart by the method type */
+		for (int j = 0; j < i; j++) {
+			if (config->methods[j].method == config->methods[i].method) {
+				LOG_ERR("Location method (%d) given more than once in "
+					"concurrent mode", config->methods[i].method);
+				return -EINVAL;
+			}
+		}
 	}
 	return 0;
 }
@@ -285,6 +379,7 @@ void location_core_config_log(const struct location_config *config)
 {
 	enum location_method type;
 	const struct location_method_api *method_api;
+	char accuracy_str[12];
 
 	LOG_DBG("Location configuration:");
 
@@ -292,6 +387,11 @@ void location_core_config_log(const struct location_config *config)
 	LOG_DBG("  Interval: %d", config->interval);
 	LOG_DBG("  Timeout: %dms", config->timeout);
 	LOG_DBG("  Mode: %d", config->mode);
+	if (config->mode == LOCATION_REQ_MODE_CONCURRENT) {
+		sprintf(accuracy_str, "%.01f", config->accuracy_threshold);
+		LOG_DBG("  Accuracy threshold: %s m", accuracy_str);
+		LOG_DBG("  Refine: %s", config->refine ? "true" : "false");
+	}
 	LOG_DBG("  List of methods:");
 
 	for (uint8_t i = 0; i < config->methods_count; i++) {
@@ -341,22 +441,94 @@ static void location_core_current_config_set(const struct location_config *confi
 	memcpy(&current_config, config, sizeof(struct location_config));
 }
 
+static void location_core_concurrent_running_set(
+	struct location_core_concurrent_method *state,
+	bool running)
+{
+	k_spinlock_key_t key = k_spin_lock(&concurrent_lock);
+
+	state->running = running;
+	k_spin_unlock(&concurrent_lock, key);
+}
+
+/** Clear the running state of a method and return whether it was running. */
+static bool location_core_concurrent_running_clear(struct location_core_concurrent_method *state)
+{
+	k_spinlock_key_t key = k_spin_lock(&concurrent_lock);
+	bool running = state->running;
+
+	state->running = false;
+	k_spin_unlock(&concurrent_lock, key);
+
+	return running;
+}
+
+static int location_core_concurrent_location_get(void)
+{
+	const struct location_method_api *method_api;
+	k_spinlock_key_t key;
+	int started = 0;
+	int err = 0;
+
+	concurrent_location_given = false;
+	memset(&concurrent_best_event_data, 0, sizeof(concurrent_best_event_data));
+
+	key = k_spin_lock(&concurrent_lock);
+	for (int i = 0; i < current_config.methods_count; i++) {
+		concurrent_methods[i].method = current_config.methods[i].method;
+		concurrent_methods[i].running = false;
+		concurrent_methods[i].event_pending = false;
+		memset(&concurrent_methods[i].event_data, 0,
+		       sizeof(concurrent_methods[i].event_data));
+	}
+	k_spin_unlock(&concurrent_lock, key);
+
+	/* Cellular and Wi-Fi wait for their scan results in their own work queues, so all
+	 * methods run at the same time. The modem arbitrates between LTE and GNSS, and GNSS is
+	 * started only when RRC is idle like in the other modes.
+	 */
+	for (int i = 0; i < current_config.methods_count; i++) {
+		method_api = location_method_api_get(concurrent_methods[i].method);
+
+		LOG_DBG("Requesting location concurrently with '%s' method",
+			(char *)method_api->method_string);
+
+		/* Set before starting the method, because its events may be given right away */
+		location_core_concurrent_running_set(&concurrent_methods[i], true);
+		err = method_api->location_get(&current_config.methods[i]);
+		if (err) {
+			LOG_ERR("Failed to start '%s' method, error: %d",
+				(char *)method_api->method_string, err);
+			location_core_concurrent_running_set(&concurrent_methods[i], false);
+			continue;
+		}
+		started++;
+	}
+
+	return started > 0 ? 0 : err;
+}
+
 static int location_core_location_get_pos(const struct location_config *config)
 {
 	int err;
 	enum location_method requested_method;
 
 	location_core_current_config_set(config);
-	/* Location request starts from the first method */
-	execute_fallback = true;
-	current_method_index = 0;
-	requested_method = config->methods[current_method_index].method;
-	LOG_DBG("Requesting location with '%s' method",
-		(char *)location_method_api_get(requested_method)->method_string);
-	location_core_current_event_data_init(requested_method);
 
-	err = location_method_api_get(requested_method)->location_get(
-		&config->methods[current_method_index]);
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		err = location_core_concurrent_location_get();
+	} else {
+		/* Location request starts from the first method */
+		execute_fallback = true;
+		current_method_index = 0;
+		requested_method = config->methods[current_method_index].method;
+		LOG_DBG("Requesting location with '%s' method",
+			(char *)location_method_api_get(requested_method)->method_string);
+		location_core_current_event_data_init(requested_method);
+
+		err = location_method_api_get(requested_method)->location_get(
+			&config->methods[current_method_index]);
+	}
 
 	if (err == 0 && config->timeout != SYS_FOREVER_MS && config->timeout > 0) {
 		LOG_DBG("Starting request timer with timeout=%d", config->timeout);
@@ -381,20 +553,92 @@ int location_core_location_get(const struct location_config *config)
 	return location_core_location_get_pos(config);
 }
 
-void location_core_event_cb_error(void)
+static struct location_core_concurrent_method *location_core_concurrent_method_get(
+	enum location_method method)
+{
+	for (int i = 0; i < current_config.methods_count; i++) {
+		if (concurrent_methods[i].method == method) {
+			return &concurrent_methods[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void location_core_concurrent_event_set(
+	enum location_method method,
+	enum location_event_id event_id,
+	const struct location_data *location)
+{
+	struct location_core_concurrent_method *state;
+	k_spinlock_key_t key;
+
+	state = location_core_concurrent_method_get(method);
+	if (state == NULL) {
+		LOG_WRN("Event from location method (%d) that is not in use", method);
+		return;
+	}
+
+	key = k_spin_lock(&concurrent_lock);
+	state->event_data.id = event_id;
+	if (location != NULL) {
+		state->event_data.location = *location;
+	}
+	state->event_pending = true;
+	k_spin_unlock(&concurrent_lock, key);
+
+	/* Using system work queue because a method waiting for LTE to become idle may block
+	 * location_core_work_q. Method timeouts are handled in the same work queue.
+	 */
+	k_work_submit(&location_concurrent_event_work);
+}
+
+void location_core_event_cb_error(enum location_method method)
 {
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_event_set(method, LOCATION_EVT_ERROR, NULL);
+		return;
+	}
+
 	current_event_data.id = LOCATION_EVT_ERROR;
 
-	location_core_event_cb(NULL);
+	location_core_event_cb(method, NULL);
 }
 
-void location_core_event_cb_timeout(void)
+void location_core_event_cb_timeout(enum location_method method)
 {
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_event_set(method, LOCATION_EVT_TIMEOUT, NULL);
+		return;
+	}
+
 	current_event_data.id = LOCATION_EVT_TIMEOUT;
 
-	location_core_event_cb(NULL);
+	location_core_event_cb(method, NULL);
 }
 
+#if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) && \
+	(defined(CONFIG_LOCATION_METHOD_CELLULAR) || defined(CONFIG_LOCATION_METHOD_WIFI))
+static void location_core_concurrent_ext_result_set(
+	enum location_method method,
+	enum location_ext_result result,
+	const struct location_data *location)
+{
+	switch (result) {
+	case LOCATION_EXT_RESULT_SUCCESS:
+		location_core_concurrent_event_set(method, LOCATION_EVT_LOCATION, location);
+		break;
+	case LOCATION_EXT_RESULT_UNKNOWN:
+		location_core_concurrent_event_set(method, LOCATION_EVT_RESULT_UNKNOWN, NULL);
+		break;
+	case LOCATION_EXT_RESULT_ERROR:
+	default:
+		location_core_concurrent_event_set(method, LOCATION_EVT_ERROR, NULL);
+		break;
+	}
+}
+#endif
+
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) && defined(CONFIG_NRF_CLOUD_AGPS)
 void location_core_event_cb_agps_request(const struct nrf_modem_gnss_agps_data_frame *request)
 {
@@ -456,6 +700,11 @@ void location_core_cellular_ext_result_set(
 		result == LOCATION_EXT_RESULT_SUCCESS ? "success" :
 		result == LOCATION_EXT_RESULT_UNKNOWN ? "unknown" : "error");
 
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_ext_result_set(LOCATION_METHOD_CELLULAR, result, location);
+		return;
+	}
+
 	current_event_data.method = LOCATION_METHOD_CELLULAR;
 	switch (result) {
 	case LOCATION_EXT_RESULT_SUCCESS:
@@ -501,6 +750,11 @@ void location_core_wifi_ext_result_set(
 		result == LOCATION_EXT_RESULT_SUCCESS ? "success" :
 		result == LOCATION_EXT_RESULT_UNKNOWN ? "unknown" : "error");
 
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_ext_result_set(LOCATION_METHOD_WIFI, result, location);
+		return;
+	}
+
 	current_event_data.method = LOCATION_METHOD_WIFI;
 	switch (result) {
 	case LOCATION_EXT_RESULT_SUCCESS:
@@ -522,10 +776,12 @@ void location_core_wifi_ext_result_set(
 }
 #endif
 
-static void location_core_event_details_get(struct location_event_data *event)
+static void location_core_event_details_get(
+	enum location_method method,
+	struct location_event_data *event)
 {
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
-	if (location_method_api_get(current_method)->details_get != NULL) {
+	if (location_method_api_get(method)->details_get != NULL) {
 
 		struct location_data_details *details;
 
@@ -535,16 +791,63 @@ static void location_core_event_details_get(struct location_event_data *event)
 			details = &event->error.details;
 		}
 
-		location_method_api_get(current_method)->details_get(details);
+		location_method_api_get(method)->details_get(details);
 	}
 #endif
 }
 
-static void location_core_event_cb_fn(struct k_work *work)
+static void location_core_location_log(const struct location_event_data *event)
 {
 	char latitude_str[12];
 	char longitude_str[12];
 	char accuracy_str[12];
+
+	LOG_DBG("Location acquired successfully:");
+	LOG_DBG("  method: %s (%d)", (char *)location_method_api_get(
+		event->method)->method_string,
+		event->method);
+	/* Logging v1 doesn't support double and float logging. Logging v2 would support
+	 * but that's up to application to configure.
+	 */
+	sprintf(latitude_str, "%.06f", event->location.latitude);
+	LOG_DBG("  latitude: %s", latitude_str);
+	sprintf(longitude_str, "%.06f", event->location.longitude);
+	LOG_DBG("  longitude: %s", longitude_str);
+	sprintf(accuracy_str, "%.01f", event->location.accuracy);
+	LOG_DBG("  accuracy: %s m", accuracy_str);
+	if (event->location.datetime.valid) {
+		LOG_DBG("  date: %04d-%02d-%02d",
+			event->location.datetime.year,
+			event->location.datetime.month,
+			event->location.datetime.day);
+		LOG_DBG("  time: %02d:%02d:%02d.%03d UTC",
+			event->location.datetime.hour,
+			event->location.datetime.minute,
+			event->location.datetime.second,
+			event->location.datetime.ms);
+	}
+	LOG_DBG("  Google maps URL: https://maps.google.com/?q=%s,%s",
+		latitude_str, longitude_str);
+}
+
+static void location_core_request_done(void)
+{
+	k_work_cancel_delayable(&location_core_timeout_work);
+
+	if (current_config.interval > 0) {
+		k_work_schedule_for_queue(
+			location_core_work_queue_get(),
+			&location_periodic_work,
+			K_SECONDS(current_config.interval));
+	} else {
+		location_core_current_config_clear();
+
+		k_sem_give(&location_core_sem);
+	}
+}
+
+static void location_core_event_cb_fn(struct k_work *work)
+{
 	enum location_method requested_method;
 	int err;
 
@@ -552,39 +855,14 @@ static void location_core_event_cb_fn(struct k_work *work)
 	current_event_data.method = current_method;
 
 	/* Update the event structure with the details of the current method */
-	location_core_event_details_get(&current_event_data);
+	location_core_event_details_get(current_method, &current_event_data);
 
 	if (current_event_data.id == LOCATION_EVT_LOCATION) {
 		/* Location was acquired properly.
 		 * Caller sets current_event_data.location
 		 */
+		location_core_location_log(&current_event_data);
 
-		LOG_DBG("Location acquired successfully:");
-		LOG_DBG("  method: %s (%d)", (char *)location_method_api_get(
-			current_method)->method_string,
-			current_method);
-		/* Logging v1 doesn't support double and float logging. Logging v2 would support
-		 * but that's up to application to configure.
-		 */
-		sprintf(latitude_str, "%.06f", current_event_data.location.latitude);
-		LOG_DBG("  latitude: %s", latitude_str);
-		sprintf(longitude_str, "%.06f", current_event_data.location.longitude);
-		LOG_DBG("  longitude: %s", longitude_str);
-		sprintf(accuracy_str, "%.01f", current_event_data.location.accuracy);
-		LOG_DBG("  accuracy: %s m", accuracy_str);
-		if (current_event_data.location.datetime.valid) {
-			LOG_DBG("  date: %04d-%02d-%02d",
-				current_event_data.location.datetime.year,
-				current_event_data.location.datetime.month,
-				current_event_data.location.datetime.day);
-			LOG_DBG("  time: %02d:%02d:%02d.%03d UTC",
-				current_event_data.location.datetime.hour,
-				current_event_data.location.datetime.minute,
-				current_event_data.location.datetime.second,
-				current_event_data.location.datetime.ms);
-		}
-		LOG_DBG("  Google maps URL: https://maps.google.com/?q=%s,%s",
-			latitude_str, longitude_str);
 		if (current_config.mode == LOCATION_REQ_MODE_ALL) {
 			/* Get possible next method */
 			current_method_index++;
@@ -646,22 +924,145 @@ static void location_core_event_cb_fn(struct k_work *work)
 
 	event_handler(&current_event_data);
 
-	k_work_cancel_delayable(&location_core_timeout_work);
+	location_core_request_done();
+}
 
-	if (current_config.interval > 0) {
-		k_work_schedule_for_queue(
-			location_core_work_queue_get(),
-			&location_periodic_work,
-			K_SECONDS(current_config.interval));
+static void location_core_concurrent_methods_cancel(void)
+{
+	const struct location_method_api *method_api;
+
+	for (int i = 0; i < current_config.methods_count; i++) {
+		k_work_cancel_delayable(&concurrent_methods[i].timeout_work);
+
+		if (!location_core_concurrent_running_clear(&concurrent_methods[i])) {
+			continue;
+		}
+
+		method_api = location_method_api_get(concurrent_methods[i].method);
+		LOG_DBG("Cancelling location method for '%s' method",
+			(char *)method_api->method_string);
+		(void)method_api->cancel();
+	}
+}
+
+static bool location_core_concurrent_methods_running(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&concurrent_lock);
+	bool running = false;
+
+	for (int i = 0; i < current_config.methods_count; i++) {
+		if (concurrent_methods[i].running) {
+			running = true;
+			break;
+		}
+	}
+	k_spin_unlock(&concurrent_lock, key);
+
+	return running;
+}
+
+static void location_core_concurrent_done(const struct location_event_data *last_event)
+{
+	if (!concurrent_location_given) {
+		if (concurrent_best_event_data.id == LOCATION_EVT_LOCATION) {
+			LOG_INF("Required accuracy not reached, using the most accurate location");
+			event_handler(&concurrent_best_event_data);
+		} else {
+			if (last_event->id != LOCATION_EVT_RESULT_UNKNOWN) {
+				LOG_ERR("Location acquisition failed with all methods");
+			} else {
+				LOG_DBG("Location acquisition completed with all methods");
+			}
+			event_handler(last_event);
+		}
+	}
+
+	location_core_request_done();
+}
+
+static void location_core_concurrent_event_handle(
+	struct location_core_concurrent_method *state,
+	struct location_event_data *event)
+{
+	const char *method_str = location_method_api_get(state->method)->method_string;
+	bool accepted;
+
+	k_work_cancel_delayable(&state->timeout_work);
+
+	event->method = state->method;
+	location_core_event_details_get(state->method, event);
+
+	if (event->id == LOCATION_EVT_LOCATION) {
+		location_core_location_log(event);
+
+		if (concurrent_best_event_data.id == LOCATION_EVT_LOCATION &&
+		    event->location.accuracy >= concurrent_best_event_data.location.accuracy) {
+			LOG_INF("Location from '%s' is not more accurate than earlier one",
+				method_str);
+		} else {
+			concurrent_best_event_data = *event;
+
+			accepted = current_config.accuracy_threshold <= 0 ||
+				   event->location.accuracy <= current_config.accuracy_threshold;
+			if (accepted) {
+				LOG_INF("LOCATION_REQ_MODE_CONCURRENT: %s location using '%s'",
+					concurrent_location_given ? "refined" : "acquired",
+					method_str);
+
+				event_handler(event);
+				concurrent_location_given = true;
+
+				if (!current_config.refine) {
+					location_core_concurrent_methods_cancel();
+					location_core_request_done();
+					return;
+				}
+			}
+		}
 	} else {
-		location_core_current_config_clear();
+		LOG_INF("Location retrieval %s using '%s'",
+			event->id != LOCATION_EVT_RESULT_UNKNOWN ? "failed" : "completed",
+			method_str);
+	}
 
-		k_sem_give(&location_core_sem);
+	if (!location_core_concurrent_methods_running()) {
+		LOG_INF("LOCATION_REQ_MODE_CONCURRENT: all methods done");
+		location_core_concurrent_done(event);
+	}
+}
+
+static void location_core_concurrent_event_work_fn(struct k_work *work)
+{
+	struct location_event_data event;
+	k_spinlock_key_t key;
+	bool handle;
+
+	ARG_UNUSED(work);
+
+	for (int i = 0; i < current_config.methods_count; i++) {
+		key = k_spin_lock(&concurrent_lock);
+		/* Events from methods that have already completed or been cancelled are ignored */
+		handle = concurrent_methods[i].event_pending && concurrent_methods[i].running;
+		if (handle) {
+			event = concurrent_methods[i].event_data;
+			concurrent_methods[i].running = false;
+		}
+		concurrent_methods[i].event_pending = false;
+		k_spin_unlock(&concurrent_lock, key);
+
+		if (handle) {
+			location_core_concurrent_event_handle(&concurrent_methods[i], &event);
+		}
 	}
 }
 
-void location_core_event_cb(const struct location_data *location)
+void location_core_event_cb(enum location_method method, const struct location_data *location)
 {
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_event_set(method, LOCATION_EVT_LOCATION, location);
+		return;
+	}
+
 	if (location) {
 		current_event_data.id = LOCATION_EVT_LOCATION;
 		current_event_data.location = *location;
@@ -677,6 +1078,21 @@ struct k_work_q *location_core_work_queue_get(void)
 	return &location_core_work_q;
 }
 
+struct k_work_q *location_core_method_work_queue_get(enum location_method method)
+{
+#if defined(CONFIG_LOCATION_REQ_MODE_CONCURRENT)
+	switch (method) {
+	case LOCATION_METHOD_CELLULAR:
+		return &location_core_method_work_q[LOCATION_CORE_WORK_Q_CELLULAR];
+	case LOCATION_METHOD_WIFI:
+		return &location_core_method_work_q[LOCATION_CORE_WORK_Q_WIFI];
+	default:
+		break;
+	}
+#endif
+	return &location_core_work_q;
+}
+
 static void location_core_periodic_work_fn(struct k_work *work)
 {
 	ARG_UNUSED(work);
@@ -693,7 +1109,45 @@ static void location_core_method_timeout_work_fn(struct k_work *work)
 	LOG_INF("Method specific timeout expired");
 
 	location_method_api_get(current_method)->timeout();
-	location_core_event_cb_timeout();
+	location_core_event_cb_timeout(current_method);
+}
+
+static void location_core_concurrent_timeout_work_fn(struct k_work *work)
+{
+	struct k_work_delayable *timeout_work = k_work_delayable_from_work(work);
+	struct location_core_concurrent_method *state =
+		CONTAINER_OF(timeout_work, struct location_core_concurrent_method, timeout_work);
+
+	LOG_INF("Method specific timeout expired for '%s' method",
+		(char *)location_method_api_get(state->method)->method_string);
+
+	location_method_api_get(state->method)->timeout();
+	location_core_event_cb_timeout(state->method);
+}
+
+static void location_core_concurrent_request_timeout(void)
+{
+	struct location_event_data event = { .id = LOCATION_EVT_TIMEOUT };
+	const struct location_method_api *method_api;
+
+	for (int i = 0; i < current_config.methods_count; i++) {
+		k_work_cancel_delayable(&concurrent_methods[i].timeout_work);
+
+		if (!location_core_concurrent_running_clear(&concurrent_methods[i])) {
+			continue;
+		}
+
+		method_api = location_method_api_get(concurrent_methods[i].method);
+		(void)method_api->timeout();
+
+		/* Timeout event is given for the first method that was still running */
+		if (event.method == 0) {
+			event.method = concurrent_methods[i].method;
+			location_core_event_details_get(event.method, &event);
+		}
+	}
+
+	location_core_concurrent_done(&event);
 }
 
 static void location_core_timeout_work_fn(struct k_work *work)
@@ -705,6 +1159,11 @@ static void location_core_timeout_work_fn(struct k_work *work)
 
 	LOG_INF("Timeout for entire location request expired");
 
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_request_timeout();
+		return;
+	}
+
 	location_method_api_get(current_method)->timeout();
 	/* config->timeout needs to expire without fallbacks */
 
@@ -716,8 +1175,19 @@ static void location_core_timeout_work_fn(struct k_work *work)
 		&location_event_cb_work);
 }
 
-void location_core_timer_start(int32_t timeout)
+void location_core_timer_start(enum location_method method, int32_t timeout)
 {
+	struct k_work_delayable *timeout_work = &location_core_method_timeout_work;
+	struct location_core_concurrent_method *state;
+
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		state = location_core_concurrent_method_get(method);
+		if (state == NULL) {
+			return;
+		}
+		timeout_work = &state->timeout_work;
+	}
+
 	if (timeout != SYS_FOREVER_MS && timeout > 0) {
 		LOG_DBG("Starting timer with timeout=%d", timeout);
 
@@ -727,12 +1197,22 @@ void location_core_timer_start(int32_t timeout)
 		 * their operation, blocking waiting of semaphores will block the timeout from
 		 * expiring and canceling methods.
 		 */
-		k_work_schedule(&location_core_method_timeout_work, K_MSEC(timeout));
+		k_work_schedule(timeout_work, K_MSEC(timeout));
 	}
 }
 
-void location_core_timer_stop(void)
+void location_core_timer_stop(enum location_method method)
 {
+	struct location_core_concurrent_method *state;
+
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		state = location_core_concurrent_method_get(method);
+		if (state != NULL) {
+			k_work_cancel_delayable(&state->timeout_work);
+		}
+		return;
+	}
+
 	k_work_cancel_delayable(&location_core_method_timeout_work);
 }
 
@@ -747,8 +1227,11 @@ int location_core_cancel(void)
 	k_work_cancel_delayable(&location_periodic_work);
 	k_work_cancel(&location_event_cb_work);
 
-	/* Check if location has been requested using one of the methods */
-	if (current_method != 0) {
+	if (current_config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		k_work_cancel(&location_concurrent_event_work);
+		location_core_concurrent_methods_cancel();
+	} else if (current_method != 0) {
+		/* Location has been requested using one of the methods */
 		LOG_DBG("Cancelling location method for '%s' method",
 			(char *)location_method_api_get(current_method)->method_string);
 		err = location_method_api_get(current_method)->cancel();
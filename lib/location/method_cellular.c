@@ -107,7 +107,7 @@ static void method_cellular_positioning_work_fn(struct k_work *work)
 		CONTAINER_OF(work, struct method_cellular_positioning_work_args, work_item);
 	const struct location_cellular_config cellular_config = work_data->cellular_config;
 
-	location_core_timer_start(cellular_config.timeout);
+	location_core_timer_start(LOCATION_METHOD_CELLULAR, cellular_config.timeout);
 
 	ncellmeas_start_time = k_uptime_get();
 
@@ -115,7 +115,7 @@ static void method_cellular_positioning_work_fn(struct k_work *work)
 	ret = method_cellular_ncellmeas_start();
 	if (ret) {
 		LOG_WRN("Cannot start neighbor cell measurements");
-		location_core_event_cb_error();
+		location_core_event_cb_error(LOCATION_METHOD_CELLULAR);
 		running = false;
 		return;
 	}
@@ -126,7 +126,7 @@ static void method_cellular_positioning_work_fn(struct k_work *work)
 	}
 
 	/* Stop the timer and let rest_client timer handle the request */
-	location_core_timer_stop();
+	location_core_timer_stop(LOCATION_METHOD_CELLULAR);
 
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
 	location_core_event_cb_cellular_request(&cell_data);
@@ -138,7 +138,7 @@ static void method_cellular_positioning_work_fn(struct k_work *work)
 
 	if (cell_data.current_cell.id == LTE_LC_CELL_EUTRAN_ID_INVALID) {
 		LOG_WRN("Current cell ID not valid");
-		location_core_event_cb_error();
+		location_core_event_cb_error(LOCATION_METHOD_CELLULAR);
 		running = false;
 		return;
 	}
@@ -155,7 +155,7 @@ static void method_cellular_positioning_work_fn(struct k_work *work)
 		/* Check if timeout has already elapsed */
 		if (ncellmeas_time >= cellular_config.timeout) {
 			LOG_WRN("Timeout occurred during neighbour cell measurement");
-			location_core_event_cb_timeout();
+			location_core_event_cb_timeout(LOCATION_METHOD_CELLULAR);
 			running = false;
 			return;
 		}
@@ -169,9 +169,9 @@ static void method_cellular_positioning_work_fn(struct k_work *work)
 	if (ret) {
 		LOG_ERR("Failed to acquire location using cellular positioning, error: %d", ret);
 		if (ret == -ETIMEDOUT) {
-			location_core_event_cb_timeout();
+			location_core_event_cb_timeout(LOCATION_METHOD_CELLULAR);
 		} else {
-			location_core_event_cb_error();
+			location_core_event_cb_error(LOCATION_METHOD_CELLULAR);
 		}
 	} else {
 		location_result.latitude = location.latitude;
@@ -179,7 +179,7 @@ static void method_cellular_positioning_work_fn(struct k_work *work)
 		location_result.accuracy = location.accuracy;
 		if (running) {
 			running = false;
-			location_core_event_cb(&location_result);
+			location_core_event_cb(LOCATION_METHOD_CELLULAR, &location_result);
 		}
 	}
 #endif /* defined(CONFIG_LOCATION_SERVICE_EXTERNAL) */
@@ -190,7 +190,7 @@ int method_cellular_location_get(const struct location_method_config *config)
 	/* Note: LTE status not checked, let it fail in NCELLMEAS if no connection */
 
 	method_cellular_positioning_work.cellular_config = config->cellular;
-	k_work_submit_to_queue(location_core_work_queue_get(),
+	k_work_submit_to_queue(location_core_method_work_queue_get(LOCATION_METHOD_CELLULAR),
 			       &method_cellular_positioning_work.work_item);
 
 	running = true;
@@ -767,7 +767,7 @@ static void method_gnss_pvt_work_fn(struct k_work *item)
 
 	if (nrf_modem_gnss_read(&pvt_data, sizeof(pvt_data), NRF_MODEM_GNSS_DATA_PVT) != 0) {
 		LOG_ERR("Failed to read PVT data from GNSS");
-		location_core_event_cb_error();
+		location_core_event_cb_error(LOCATION_METHOD_GNSS);
 		return;
 	}
 
@@ -801,7 +801,7 @@ static void method_gnss_pvt_work_fn(struct k_work *item)
 		if (fixes_remaining <= 0) {
 			/* We are done, stop GNSS and publish the fix. */
 			method_gnss_cancel();
-			location_core_event_cb(&location_result);
+			location_core_event_cb(LOCATION_METHOD_GNSS, &location_result);
 		}
 	} else if (gnss_config.visibility_detection) {
 		if (pvt_data.execution_time >= VISIBILITY_DETECTION_EXEC_TIME &&
@@ -809,7 +809,7 @@ static void method_gnss_pvt_work_fn(struct k_work *item)
 		    satellites_tracked < VISIBILITY_DETECTION_SAT_LIMIT) {
 			LOG_DBG("GNSS visibility obstructed, canceling");
 			method_gnss_cancel();
-			location_core_event_cb_error();
+			location_core_event_cb_error(LOCATION_METHOD_GNSS);
 		}
 	}
 
@@ -899,7 +899,7 @@ static void method_gnss_positioning_work_fn(struct k_work *work)
 
 	if (err) {
 		LOG_ERR("Failed to configure GNSS");
-		location_core_event_cb_error();
+		location_core_event_cb_error(LOCATION_METHOD_GNSS);
 		running = false;
 		return;
 	}
@@ -907,12 +907,12 @@ static void method_gnss_positioning_work_fn(struct k_work *work)
 	err = nrf_modem_gnss_start();
 	if (err) {
 		LOG_ERR("Failed to start GNSS");
-		location_core_event_cb_error();
+		location_core_event_cb_error(LOCATION_METHOD_GNSS);
 		running = false;
 		return;
 	}
 
-	location_core_timer_start(gnss_config.timeout);
+	location_core_timer_start(LOCATION_METHOD_GNSS, gnss_config.timeout);
 }
 
 #if defined(CONFIG_NRF_CLOUD_AGPS) || defined(CONFIG_NRF_CLOUD_PGPS)
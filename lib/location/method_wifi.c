@@ -149,7 +149,7 @@ static void method_wifi_positioning_work_fn(struct k_work *work)
 	int64_t starting_uptime_ms = work_data->starting_uptime_ms;
 	int err;
 
-	location_core_timer_start(wifi_config.timeout);
+	location_core_timer_start(LOCATION_METHOD_WIFI, wifi_config.timeout);
 
 	err = method_wifi_scanning_start();
 	if (err) {
@@ -162,7 +162,7 @@ static void method_wifi_positioning_work_fn(struct k_work *work)
 		goto end;
 	}
 	/* Stop the timer and let rest_client timer handle the request */
-	location_core_timer_stop();
+	location_core_timer_stop(LOCATION_METHOD_WIFI);
 
 	/* Scanning done at this point of time. Store current time to response. */
 	location_utils_systime_to_location_datetime(&location_result.datetime);
@@ -211,7 +211,7 @@ static void method_wifi_positioning_work_fn(struct k_work *work)
 			location_result.accuracy = result.accuracy;
 			if (running) {
 				running = false;
-				location_core_event_cb(&location_result);
+				location_core_event_cb(LOCATION_METHOD_WIFI, &location_result);
 			}
 		}
 #endif
@@ -230,10 +230,10 @@ static void method_wifi_positioning_work_fn(struct k_work *work)
 	}
 end:
 	if (err == -ETIMEDOUT) {
-		location_core_event_cb_timeout();
+		location_core_event_cb_timeout(LOCATION_METHOD_WIFI);
 		running = false;
 	} else if (err) {
-		location_core_event_cb_error();
+		location_core_event_cb_error(LOCATION_METHOD_WIFI);
 		running = false;
 	}
 }
@@ -254,7 +254,8 @@ int method_wifi_location_get(const struct location_method_config *config)
 	k_work_init(&method_wifi_start_work.work_item, method_wifi_positioning_work_fn);
 	method_wifi_start_work.wifi_config = config->wifi;
 	method_wifi_start_work.starting_uptime_ms = k_uptime_get();
-	k_work_submit_to_queue(location_core_work_queue_get(), &method_wifi_start_work.work_item);
+	k_work_submit_to_queue(location_core_method_work_queue_get(LOCATION_METHOD_WIFI),
+			       &method_wifi_start_work.work_item);
 
 	running = true;
 
@@ -129,6 +129,34 @@ static int modem_data_get(struct lte_param *param)
 	return 0;
 }
 
+#if defined(CONFIG_MODEM_INFO_SNAPSHOT)
+static int network_snapshot_get(struct network_param *network)
+{
+	struct modem_info_snapshot snapshot;
+	int ret;
+
+	ret = modem_info_snapshot_get(&snapshot,
+				      BIT(MODEM_INFO_CUR_BAND) | BIT(MODEM_INFO_IP_ADDRESS) |
+				      BIT(MODEM_INFO_OPERATOR) | BIT(MODEM_INFO_CELLID) |
+				      BIT(MODEM_INFO_AREA_CODE) | BIT(MODEM_INFO_APN) |
+				      BIT(MODEM_INFO_RSRP));
+	if (ret) {
+		LOG_ERR("Network snapshot not obtained: %d", ret);
+		return ret;
+	}
+
+	network->current_band.value = snapshot.band;
+	network->rsrp.value = snapshot.rsrp;
+	strcpy(network->current_operator.value_string, snapshot.operator);
+	strcpy(network->cellid_hex.value_string, snapshot.cellid_hex);
+	strcpy(network->area_code.value_string, snapshot.area_code);
+	strcpy(network->ip_address.value_string, snapshot.ip_address);
+	strcpy(network->apn.value_string, snapshot.apn);
+
+	return 0;
+}
+#endif /* defined(CONFIG_MODEM_INFO_SNAPSHOT) */
+
 int modem_info_params_get(struct modem_param_info *modem)
 {
 	int ret;
@@ -142,19 +170,21 @@ int modem_info_params_get(struct modem_param_info *modem)
 	    IS_ENABLED(CONFIG_MODEM_INFO_ADD_DEVICE)) {
 		struct lte_param *params[] = {
 #if IS_ENABLED(CONFIG_MODEM_INFO_ADD_NETWORK)
-			&modem->network.current_band,
 			&modem->network.sup_band,
-			&modem->network.ip_address,
 			&modem->network.ue_mode,
-			&modem->network.current_operator,
-			&modem->network.cellid_hex,
-			&modem->network.area_code,
 			&modem->network.lte_mode,
 			&modem->network.nbiot_mode,
 			&modem->network.gps_mode,
+#if !IS_ENABLED(CONFIG_MODEM_INFO_SNAPSHOT)
+			&modem->network.current_band,
+			&modem->network.ip_address,
+			&modem->network.current_operator,
+			&modem->network.cellid_hex,
+			&modem->network.area_code,
 			&modem->network.apn,
 			&modem->network.rsrp,
 #endif
+#endif
 #if IS_ENABLED(CONFIG_MODEM_INFO_ADD_SIM_ICCID)
 			&modem->sim.iccid,
 #endif
@@ -176,6 +206,15 @@ int modem_info_params_get(struct modem_param_info *modem)
 		}
 	}
 
+#if defined(CONFIG_MODEM_INFO_SNAPSHOT)
+	if (IS_ENABLED(CONFIG_MODEM_INFO_ADD_NETWORK)) {
+		ret = network_snapshot_get(&modem->network);
+		if (ret) {
+			return ret;
+		}
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_MODEM_INFO_ADD_NETWORK)) {
 		if (IS_ENABLED(CONFIG_MODEM_INFO_ADD_DATE_TIME)) {
 			ret = modem_data_get(&modem->network.date_time);
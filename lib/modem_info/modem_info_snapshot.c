@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <nrf_modem_at.h>
+#include <nrf_errno.h>
+#include <modem/at_monitor.h>
+#include <modem/modem_info.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(modem_info_snapshot);
+
+#define XMONITOR_PARAM_COUNT	6
+#define CGDCONT_PARAM_COUNT	2
+
+#define MCC_LEN			3
+
+/* Fields read with AT%XMONITOR. */
+#define XMONITOR_FIELDS (BIT(MODEM_INFO_RSRP) | BIT(MODEM_INFO_CUR_BAND) |		\
+			 BIT(MODEM_INFO_AREA_CODE) | BIT(MODEM_INFO_OPERATOR) |		\
+			 BIT(MODEM_INFO_MCC) | BIT(MODEM_INFO_MNC) |			\
+			 BIT(MODEM_INFO_CELLID))
+
+/* Fields read with AT+CGDCONT?. */
+#define CGDCONT_FIELDS (BIT(MODEM_INFO_IP_ADDRESS) | BIT(MODEM_INFO_APN))
+
+/* Commands needed to read a group of snapshot fields. */
+enum snapshot_cmd {
+	SNAPSHOT_CMD_XMONITOR,
+	SNAPSHOT_CMD_CGDCONT,
+	SNAPSHOT_CMD_COUNT,
+};
+
+static const uint32_t cmd_fields[SNAPSHOT_CMD_COUNT] = {
+	[SNAPSHOT_CMD_XMONITOR] = XMONITOR_FIELDS,
+	[SNAPSHOT_CMD_CGDCONT] = CGDCONT_FIELDS,
+};
+
+static struct modem_info_snapshot cache;
+static int64_t cache_time[SNAPSHOT_CMD_COUNT];
+static atomic_t cache_valid;
+/* Incremented on every invalidation, so that a result read while a
+ * notification was handled is not marked valid.
+ */
+static atomic_t cache_gen[SNAPSHOT_CMD_COUNT];
+static K_MUTEX_DEFINE(cache_lock);
+
+static void cache_invalidate(enum snapshot_cmd cmd)
+{
+	atomic_inc(&cache_gen[cmd]);
+	atomic_clear_bit(&cache_valid, cmd);
+}
+
+static bool cache_is_valid(enum snapshot_cmd cmd)
+{
+	return atomic_test_bit(&cache_valid, cmd) &&
+	       (k_uptime_get() - cache_time[cmd] < CONFIG_MODEM_INFO_SNAPSHOT_TTL_MS);
+}
+
+static void network_notif_handler(const char *notif)
+{
+	/* Registration, cell or signal changed. */
+	cache_invalidate(SNAPSHOT_CMD_XMONITOR);
+}
+
+static void pdn_notif_handler(const char *notif)
+{
+	/* PDN connection activated, deactivated or changed. */
+	cache_invalidate(SNAPSHOT_CMD_CGDCONT);
+}
+
+AT_MONITOR(modem_info_snapshot_cereg_mon, "+CEREG", network_notif_handler);
+AT_MONITOR(modem_info_snapshot_cesq_mon, "%CESQ", network_notif_handler);
+AT_MONITOR(modem_info_snapshot_cgev_mon, "+CGEV", pdn_notif_handler);
+
+static int map_nrf_modem_at_scanf_error(int err)
+{
+	switch (err) {
+	case -NRF_EPERM:
+		return -EPERM;
+	case -NRF_EFAULT:
+		return -EFAULT;
+	case -NRF_EBADMSG:
+		return -EBADMSG;
+	case -NRF_ENOMEM:
+		return -ENOMEM;
+	default:
+		return -EIO;
+	}
+}
+
+static int xmonitor_read(struct modem_info_snapshot *snapshot)
+{
+	char mnc[MODEM_INFO_SNAPSHOT_OPERATOR_SIZE - MCC_LEN];
+	char mcc[MCC_LEN + 1];
+	int ret;
+
+	/* %XMONITOR: <reg_status>,<full_name>,<short_name>,<plmn>,<tac>,<AcT>,<band>,
+	 *            <cell_id>,<phys_cell_id>,<EARFCN>,<rsrp>,...
+	 */
+	ret = nrf_modem_at_scanf("AT%XMONITOR",
+		"%%XMONITOR: %hhu,%*[^,],%*[^,],"
+		"\"%" STRINGIFY(MODEM_INFO_SNAPSHOT_OPERATOR_LEN) "[^\"]\","
+		"\"%" STRINGIFY(MODEM_INFO_SNAPSHOT_AREA_CODE_LEN) "[^\"]\",%*d,%hu,"
+		"\"%" STRINGIFY(MODEM_INFO_SNAPSHOT_CELLID_LEN) "[^\"]\",%*d,%*d,%hu",
+		&snapshot->reg_status, snapshot->operator, snapshot->area_code,
+		&snapshot->band, snapshot->cellid_hex, &snapshot->rsrp);
+	if (ret < 0) {
+		LOG_ERR("Could not get network information, error: %d", ret);
+		return map_nrf_modem_at_scanf_error(ret);
+	}
+
+	if (ret != XMONITOR_PARAM_COUNT) {
+		/* Only the registration status is given when not registered. */
+		LOG_DBG("No network information, registration status: %d",
+			snapshot->reg_status);
+		return -ENOENT;
+	}
+
+	memcpy(mcc, snapshot->operator, MCC_LEN);
+	mcc[MCC_LEN] = '\0';
+	strcpy(mnc, &snapshot->operator[MCC_LEN]);
+
+	snapshot->mcc = strtoul(mcc, NULL, 10);
+	snapshot->mnc = strtoul(mnc, NULL, 10);
+	snapshot->area_code_value = strtoul(snapshot->area_code, NULL, 16);
+	snapshot->cellid = strtoul(snapshot->cellid_hex, NULL, 16);
+
+	return 0;
+}
+
+static int cgdcont_read(struct modem_info_snapshot *snapshot)
+{
+	int ret;
+
+	/* +CGDCONT: <cid>,<PDN_type>,<APN>,<PDP_addr>,... of the default context.
+	 * If both IPv4 and IPv6 addresses are given, only the IPv4 one is used.
+	 */
+	ret = nrf_modem_at_scanf("AT+CGDCONT?",
+		"+CGDCONT: %*d,\"%*[^\"]\","
+		"\"%" STRINGIFY(MODEM_INFO_SNAPSHOT_APN_LEN) "[^\"]\","
+		"\"%" STRINGIFY(MODEM_INFO_SNAPSHOT_IP_ADDRESS_LEN) "[^\" ]",
+		snapshot->apn, snapshot->ip_address);
+	if (ret < 0) {
+		LOG_ERR("Could not get PDN information, error: %d", ret);
+		return map_nrf_modem_at_scanf_error(ret);
+	}
+
+	if (ret != CGDCONT_PARAM_COUNT) {
+		LOG_DBG("No PDN context");
+		return -ENOENT;
+	}
+
+	return 0;
+}
+
+static int cmd_read(enum snapshot_cmd cmd)
+{
+	atomic_val_t gen = atomic_get(&cache_gen[cmd]);
+	int err;
+
+	switch (cmd) {
+	case SNAPSHOT_CMD_XMONITOR:
+		err = xmonitor_read(&cache);
+		break;
+	case SNAPSHOT_CMD_CGDCONT:
+		err = cgdcont_read(&cache);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if (err) {
+		return err;
+	}
+
+	cache_time[cmd] = k_uptime_get();
+	atomic_set_bit(&cache_valid, cmd);
+
+	/* The generation is checked after setting the valid bit, because an
+	 * invalidation clears the bit only after incrementing the generation.
+	 */
+	if (atomic_get(&cache_gen[cmd]) != gen) {
+		LOG_DBG("Invalidated while reading, not cached");
+		atomic_clear_bit(&cache_valid, cmd);
+	}
+
+	return 0;
+}
+
+int modem_info_snapshot_get(struct modem_info_snapshot *snapshot, uint32_t fields)
+{
+	uint32_t supported = 0;
+	int err = 0;
+
+	if (snapshot == NULL) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(cmd_fields); i++) {
+		supported |= cmd_fields[i];
+	}
+
+	if ((fields == 0) || (fields & ~supported)) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	/* Issue each command at most once, and only if it is needed for the
+	 * requested fields and its cached result is not valid anymore.
+	 */
+	for (size_t i = 0; i < ARRAY_SIZE(cmd_fields); i++) {
+		if (!(fields & cmd_fields[i]) || cache_is_valid(i)) {
+			continue;
+		}
+
+		err = cmd_read(i);
+		if (err) {
+			break;
+		}
+	}
+
+	if (!err) {
+		*snapshot = cache;
+		snapshot->fields = fields;
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return err;
+}
+
+void modem_info_snapshot_invalidate(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_gen); i++) {
+		cache_invalidate(i);
+	}
+}
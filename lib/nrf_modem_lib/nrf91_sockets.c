@@ -22,6 +22,7 @@
 #include <sockets_internal.h>
 #include <zephyr/sys/fdtable.h>
 #include <zephyr/kernel.h>
+#include <modem/nrf_modem_lib.h>
 
 #if defined(CONFIG_POSIX_API)
 #include <zephyr/posix/poll.h>
@@ -44,10 +45,25 @@
 static struct nrf_sock_ctx {
 	int nrf_fd; /* nRF socket descriptior. */
 	struct k_mutex *lock; /* Mutex associated with the socket. */
+#if defined(CONFIG_NRF_MODEM_LIB_SOCKET_TX_STATS)
+	struct {
+		atomic_t sendto; /* Calls to nrf_sendto(). */
+		atomic_t sendmsg; /* Calls to sendmsg(). */
+		atomic_t bytes; /* Bytes accepted by the modem. */
+		atomic_t copied; /* Bytes copied into a sendmsg buffer. */
+		atomic_t buf_busy; /* Times no sendmsg buffer was free. */
+	} tx_stats;
+#endif
 } offload_ctx[NRF_MODEM_MAX_SOCKET_COUNT];
 
 static K_MUTEX_DEFINE(ctx_lock);
 
+#if defined(CONFIG_NRF_MODEM_LIB_SOCKET_TX_STATS)
+#define TX_STATS_ADD(obj, field, val) atomic_add(&OBJ_TO_CTX(obj)->tx_stats.field, (val))
+#else
+#define TX_STATS_ADD(obj, field, val)
+#endif
+
 static const struct socket_op_vtable nrf91_socket_fd_op_vtable;
 
 /* Offloading disabled in general. */
@@ -65,6 +81,9 @@ static struct nrf_sock_ctx *allocate_ctx(int nrf_fd)
 		if (offload_ctx[i].nrf_fd == -1) {
 			ctx = &offload_ctx[i];
 			ctx->nrf_fd = nrf_fd;
+#if defined(CONFIG_NRF_MODEM_LIB_SOCKET_TX_STATS)
+			memset(&ctx->tx_stats, 0, sizeof(ctx->tx_stats));
+#endif
 			break;
 		}
 	}
@@ -588,21 +607,85 @@ static ssize_t nrf91_socket_offload_sendto(void *obj, const void *buf,
 				    (struct nrf_sockaddr*)&ipv6, sock_len);
 	} else {
 		errno = EAFNOSUPPORT;
-		retval = -1;
+		return -1;
+	}
+
+	TX_STATS_ADD(obj, sendto, 1);
+	if (retval > 0) {
+		TX_STATS_ADD(obj, bytes, retval);
 	}
 
 	return retval;
 }
 
+/* Intermediate buffers used by `sendmsg` to repack message parts. Each send
+ * reserves its own buffer, so that sends on different sockets don't block
+ * each other while buffers are free.
+ */
+static uint8_t sendmsg_buf[CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_COUNT]
+			  [CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE];
+static ATOMIC_DEFINE(sendmsg_buf_used, CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_COUNT);
+static K_SEM_DEFINE(sendmsg_buf_free, CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_COUNT,
+		    CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_COUNT);
+
+/* Message parts of at least half the buffer size are sent directly from the
+ * caller's memory, as repacking them would save at most one `sendto` call.
+ */
+#define SENDMSG_REPACK_MAX (CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE / 2)
+
+static uint8_t *sendmsg_buf_reserve(k_timeout_t timeout)
+{
+	if (k_sem_take(&sendmsg_buf_free, timeout) != 0) {
+		return NULL;
+	}
+
+	/* The semaphore guarantees that one of the buffers is free. */
+	for (int i = 0; i < ARRAY_SIZE(sendmsg_buf); i++) {
+		if (!atomic_test_and_set_bit(sendmsg_buf_used, i)) {
+			return sendmsg_buf[i];
+		}
+	}
+
+	__ASSERT(false, "No free sendmsg buffer");
+	return NULL;
+}
+
+static void sendmsg_buf_release(uint8_t *buf)
+{
+	atomic_clear_bit(sendmsg_buf_used,
+			 (buf - sendmsg_buf[0]) / CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE);
+	k_sem_give(&sendmsg_buf_free);
+}
+
+static ssize_t sendmsg_part(void *obj, const uint8_t *data, size_t len,
+			    int flags, const struct msghdr *msg)
+{
+	ssize_t offset = 0;
+	ssize_t ret;
+
+	while (offset < len) {
+		ret = nrf91_socket_offload_sendto(obj, data + offset,
+			len - offset, flags, msg->msg_name, msg->msg_namelen);
+		if (ret < 0) {
+			return ret;
+		}
+		offset += ret;
+	}
+
+	return offset;
+}
+
 static ssize_t nrf91_socket_offload_sendmsg(void *obj, const struct msghdr *msg,
 					    int flags)
 {
 	ssize_t len = 0;
+	ssize_t sent = 0;
 	ssize_t ret;
-	ssize_t offset;
+	size_t buf_len = 0;
+	uint8_t *buf = NULL;
+	int parts = 0;
+	bool repack;
 	int i;
-	static K_MUTEX_DEFINE(sendmsg_lock);
-	static uint8_t buf[CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE];
 
 	if (msg == NULL) {
 		errno = EINVAL;
@@ -616,66 +699,82 @@ static ssize_t nrf91_socket_offload_sendmsg(void *obj, const struct msghdr *msg,
 	 * <http://pubs.opengroup.org/onlinepubs/9699919799/functions/sendmsg.html>
 	 */
 
-	/* Try to reduce number of `sendto` calls - copy data if they fit into
-	 * a single buffer
-	 */
+	TX_STATS_ADD(obj, sendmsg, 1);
 
 	for (i = 0; i < msg->msg_iovlen; i++) {
-		len += msg->msg_iov[i].iov_len;
-	}
-
-	if (len <= sizeof(buf)) {
-		/* Protect `buf` access with a mutex. */
-		k_mutex_lock(&sendmsg_lock, K_FOREVER);
-		len = 0;
-
-		for (i = 0; i < msg->msg_iovlen; i++) {
-			memcpy(buf + len, msg->msg_iov[i].iov_base,
-			       msg->msg_iov[i].iov_len);
+		if (msg->msg_iov[i].iov_len > 0) {
 			len += msg->msg_iov[i].iov_len;
+			parts++;
 		}
+	}
 
-		offset = 0;
-		ret = 0;
-		while ((offset < len) && (ret >= 0)) {
-			ret = nrf91_socket_offload_sendto(obj,
-				(buf + offset), (len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
-			if (ret > 0) {
-				offset += ret;
+	/* A single part is sent directly. Otherwise, the whole message is
+	 * repacked if it fits into an intermediate buffer, waiting for a free
+	 * buffer if needed, so that a datagram is never split. A larger
+	 * message has to be sent with several `sendto` calls anyway, so it
+	 * only repacks consecutive small parts if a buffer is free.
+	 */
+	if (parts > 1) {
+		buf = sendmsg_buf_reserve(K_NO_WAIT);
+		if (buf == NULL) {
+			TX_STATS_ADD(obj, buf_busy, 1);
+			if (len <= CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE) {
+				buf = sendmsg_buf_reserve(K_FOREVER);
 			}
 		}
-
-		k_mutex_unlock(&sendmsg_lock);
-		return ret;
 	}
 
-	/* If the data won't fit into intermediate buffer, send the buffers
-	 * separately
-	 */
-
-	len = 0;
-
 	for (i = 0; i < msg->msg_iovlen; i++) {
-		if (msg->msg_iov[i].iov_len == 0) {
+		const struct iovec *iov = &msg->msg_iov[i];
+
+		if (iov->iov_len == 0) {
 			continue;
 		}
 
-		offset = 0;
-		while (offset < msg->msg_iov[i].iov_len) {
-			ret = nrf91_socket_offload_sendto(obj,
-				(((uint8_t *) msg->msg_iov[i].iov_base) + offset),
-				(msg->msg_iov[i].iov_len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
+		repack = (buf != NULL) &&
+			 (len <= CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE ||
+			  iov->iov_len < SENDMSG_REPACK_MAX);
+
+		if (buf_len > 0 &&
+		    (!repack || buf_len + iov->iov_len > CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE)) {
+			ret = sendmsg_part(obj, buf, buf_len, flags, msg);
 			if (ret < 0) {
-				return ret;
+				goto out;
 			}
-			offset += ret;
-			len += ret;
+			sent += ret;
+			buf_len = 0;
+		}
+
+		if (repack) {
+			memcpy(buf + buf_len, iov->iov_base, iov->iov_len);
+			buf_len += iov->iov_len;
+			TX_STATS_ADD(obj, copied, iov->iov_len);
+			continue;
 		}
+
+		ret = sendmsg_part(obj, iov->iov_base, iov->iov_len, flags, msg);
+		if (ret < 0) {
+			goto out;
+		}
+		sent += ret;
 	}
 
-	return len;
+	if (buf_len > 0) {
+		ret = sendmsg_part(obj, buf, buf_len, flags, msg);
+		if (ret < 0) {
+			goto out;
+		}
+		sent += ret;
+	}
+
+	ret = sent;
+
+out:
+	if (buf != NULL) {
+		sendmsg_buf_release(buf);
+	}
+
+	return ret;
 }
 
 static inline int nrf91_socket_offload_poll(struct pollfd *fds, int nfds,
@@ -930,6 +1029,31 @@ static const struct socket_op_vtable nrf91_socket_fd_op_vtable = {
 	.setsockopt = nrf91_socket_offload_setsockopt,
 };
 
+#if defined(CONFIG_NRF_MODEM_LIB_SOCKET_TX_STATS)
+int nrf_modem_lib_socket_tx_stats_get(int fd, struct nrf_modem_lib_socket_tx_stats *stats)
+{
+	struct nrf_sock_ctx *ctx;
+
+	if (stats == NULL) {
+		return -EINVAL;
+	}
+
+	ctx = z_get_fd_obj(fd, (const struct fd_op_vtable *)&nrf91_socket_fd_op_vtable,
+			   ENOTSOCK);
+	if (ctx == NULL) {
+		return -errno;
+	}
+
+	stats->sendto = atomic_get(&ctx->tx_stats.sendto);
+	stats->sendmsg = atomic_get(&ctx->tx_stats.sendmsg);
+	stats->bytes = atomic_get(&ctx->tx_stats.bytes);
+	stats->copied = atomic_get(&ctx->tx_stats.copied);
+	stats->buf_busy = atomic_get(&ctx->tx_stats.buf_busy);
+
+	return 0;
+}
+#endif /* defined(CONFIG_NRF_MODEM_LIB_SOCKET_TX_STATS) */
+
 static inline bool proto_is_secure(int proto)
 {
 	return (proto >= IPPROTO_TLS_1_0 && proto <= IPPROTO_TLS_1_2) ||
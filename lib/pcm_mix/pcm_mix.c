@@ -6,126 +6,250 @@
 
 #include "pcm_mix.h"
 
+#include <string.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define PCM_MIX_SIMD32 1
+#else
+#define PCM_MIX_SIMD32 0
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
-/* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+#define INT24_MAX (BIT(23) - 1)
+#define INT24_MIN (-INT24_MAX - 1)
+
+/* Positions in buffer A where a sample of buffer B is mixed in. */
+struct mix_layout {
+	/* Distance between consecutive target samples in buffer A. */
+	uint8_t a_step;
+	/* Index of the first target sample in buffer A. */
+	uint8_t a_offset;
+	/* Mix every sample of buffer B into two consecutive samples of buffer A. */
+	bool dup;
+};
+
+static const struct mix_layout layouts[] = {
+	[B_STEREO_INTO_A_STEREO] = { .a_step = 1, .a_offset = 0, .dup = false },
+	[B_MONO_INTO_A_MONO] = { .a_step = 1, .a_offset = 0, .dup = false },
+	[B_MONO_INTO_A_STEREO_LR] = { .a_step = 2, .a_offset = 0, .dup = true },
+	[B_MONO_INTO_A_STEREO_L] = { .a_step = 2, .a_offset = 0, .dup = false },
+	[B_MONO_INTO_A_STEREO_R] = { .a_step = 2, .a_offset = 1, .dup = false },
+};
+
+static inline uint32_t word_get(const void *p)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
-	}
+	uint32_t w;
+
+	memcpy(&w, p, sizeof(w));
+	return w;
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+static inline void word_put(void *p, uint32_t w)
+{
+	memcpy(p, &w, sizeof(w));
+}
+
+/* Saturating addition of two pairs of signed 16-bit samples packed in words.
+ * The sample from the lower address is stored in the lower halfword.
+ */
+static inline uint32_t qadd16(uint32_t a, uint32_t b)
 {
-	int32_t res;
+#if PCM_MIX_SIMD32
+	return (uint32_t)__qadd16((int16x2_t)a, (int16x2_t)b);
+#else
+	int32_t lo = (int16_t)(a & 0xFFFF) + (int16_t)(b & 0xFFFF);
+	int32_t hi = (int16_t)(a >> 16) + (int16_t)(b >> 16);
+
+	lo = CLAMP(lo, INT16_MIN, INT16_MAX);
+	hi = CLAMP(hi, INT16_MIN, INT16_MAX);
+
+	return (uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+#endif
+}
+
+static inline int16_t qadd16_single(int16_t a, int16_t b)
+{
+	int32_t res = a + b;
+
+	return (int16_t)CLAMP(res, INT16_MIN, INT16_MAX);
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_identical_s16(int16_t *pcm_a, const int16_t *pcm_b, size_t samples)
+{
+	size_t i;
 
-		hard_limiter(&res);
+	/* Two samples per step. */
+	for (i = 0; i + 1 < samples; i += 2) {
+		word_put(&pcm_a[i], qadd16(word_get(&pcm_a[i]), word_get(&pcm_b[i])));
+	}
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+	if (i < samples) {
+		pcm_a[i] = qadd16_single(pcm_a[i], pcm_b[i]);
 	}
 }
 
 /* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+static void pcm_mix_b_mono_into_a_stereo_lr_s16(int16_t *pcm_a, const int16_t *pcm_b,
+						size_t samples)
 {
-	int32_t res;
+	size_t i;
 
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
-	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+	/* Two mono samples, i.e. four stereo samples, per step. */
+	for (i = 0; i + 1 < samples; i += 2) {
+		uint32_t b = word_get(&pcm_b[i]);
+		uint32_t b_first = (b & 0xFFFF) | (b << 16);
+		uint32_t b_second = (b & 0xFFFF0000) | (b >> 16);
+
+		word_put(&pcm_a[2 * i], qadd16(word_get(&pcm_a[2 * i]), b_first));
+		word_put(&pcm_a[2 * i + 2], qadd16(word_get(&pcm_a[2 * i + 2]), b_second));
+	}
 
-		hard_limiter(&res);
+	if (i < samples) {
+		uint32_t b = (uint16_t)pcm_b[i];
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+		word_put(&pcm_a[2 * i], qadd16(word_get(&pcm_a[2 * i]), b | (b << 16)));
 	}
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Mix mono into a single channel of a stereo buffer.
+ * Mixing zero into the other channel leaves it unchanged.
+ */
+static void pcm_mix_b_mono_into_a_stereo_single_s16(int16_t *pcm_a, const int16_t *pcm_b,
+						    size_t samples, bool right)
 {
-	int32_t res;
-
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
+	uint8_t shift = right ? 16 : 0;
 
-		hard_limiter(&res);
+	for (size_t i = 0; i < samples; i++) {
+		uint32_t b = (uint32_t)(uint16_t)pcm_b[i] << shift;
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+		word_put(&pcm_a[2 * i], qadd16(word_get(&pcm_a[2 * i]), b));
 	}
 }
 
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Reference path used for 24 and 32 bit samples and when a gain is applied.
+ * Samples are scaled by the gains before the addition and the result is saturated
+ * to the range of the given bit depth.
+ */
+static void pcm_mix_generic(void *const pcm_a, uint16_t gain_a, void const *const pcm_b,
+			    uint16_t gain_b, size_t samples, const struct mix_layout *layout,
+			    uint8_t bit_depth)
 {
-	int32_t res;
+	bool unity = (gain_a == PCM_MIX_GAIN_UNITY) && (gain_b == PCM_MIX_GAIN_UNITY);
+	int64_t min;
+	int64_t max;
+
+	switch (bit_depth) {
+	case 16:
+		min = INT16_MIN;
+		max = INT16_MAX;
+		break;
+	case 24:
+		min = INT24_MIN;
+		max = INT24_MAX;
+		break;
+	default:
+		min = INT32_MIN;
+		max = INT32_MAX;
+		break;
+	}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
+	for (size_t i = 0; i < samples; i++) {
+		int64_t b = (bit_depth == 16) ? ((const int16_t *)pcm_b)[i] :
+						((const int32_t *)pcm_b)[i];
 
-		hard_limiter(&res);
+		for (size_t j = 0; j < (layout->dup ? 2 : 1); j++) {
+			size_t idx = i * layout->a_step + layout->a_offset + j;
+			int64_t a = (bit_depth == 16) ? ((int16_t *)pcm_a)[idx] :
+							((int32_t *)pcm_a)[idx];
+			int64_t res;
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+			if (unity) {
+				res = a + b;
+			} else {
+				res = (a * gain_a + b * gain_b) >> PCM_MIX_GAIN_SHIFT;
+			}
+
+			res = CLAMP(res, min, max);
+
+			if (bit_depth == 16) {
+				((int16_t *)pcm_a)[idx] = (int16_t)res;
+			} else {
+				((int32_t *)pcm_a)[idx] = (int32_t)res;
+			}
+		}
 	}
 }
 
-int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
-	    enum pcm_mix_mode mix_mode)
+int pcm_mix_gain(void *const pcm_a, size_t size_a, uint16_t gain_a, void const *const pcm_b,
+		 size_t size_b, uint16_t gain_b, enum pcm_mix_mode mix_mode, uint8_t bit_depth)
 {
+	size_t sample_size;
+	size_t samples;
+
 	if (pcm_a == NULL || size_a == 0) {
 		return -EINVAL;
 	}
 
+	switch (bit_depth) {
+	case 16:
+		sample_size = sizeof(int16_t);
+		break;
+	case 24:
+		/* Fall through */
+	case 32:
+		sample_size = sizeof(int32_t);
+		break;
+	default:
+		return -EINVAL;
+	}
+
 	if (pcm_b == NULL || size_b == 0) {
 		/* Nothing to mix, returning */
 		return 0;
 	}
 
+	if (mix_mode >= ARRAY_SIZE(layouts)) {
+		return -ESRCH;
+	}
+
+	if (layouts[mix_mode].a_step == 1) {
+		if (size_b > size_a) {
+			return -EPERM;
+		}
+	} else if (size_b > (size_a / 2)) {
+		LOG_ERR("size a %zu size b %zu", size_a, size_b);
+		return -EPERM;
+	}
+
+	samples = size_b / sample_size;
+
+	if ((bit_depth != 16) || (gain_a != PCM_MIX_GAIN_UNITY) ||
+	    (gain_b != PCM_MIX_GAIN_UNITY)) {
+		pcm_mix_generic(pcm_a, gain_a, pcm_b, gain_b, samples, &layouts[mix_mode],
+				bit_depth);
+		return 0;
+	}
+
 	switch (mix_mode) {
 	case B_STEREO_INTO_A_STEREO:
 		/* Fall through */
 	case B_MONO_INTO_A_MONO:
-		if (size_b > size_a) {
-			return -EPERM;
-		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
+		pcm_mix_identical_s16(pcm_a, pcm_b, samples);
 		break;
 	case B_MONO_INTO_A_STEREO_LR:
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
+		pcm_mix_b_mono_into_a_stereo_lr_s16(pcm_a, pcm_b, samples);
 		break;
 	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
-			return -EPERM;
-		}
+		pcm_mix_b_mono_into_a_stereo_single_s16(pcm_a, pcm_b, samples, false);
 		break;
 	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
+		pcm_mix_b_mono_into_a_stereo_single_s16(pcm_a, pcm_b, samples, true);
 		break;
 	default:
 		return -ESRCH;
@@ -133,3 +257,10 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 
 	return 0;
 }
+
+int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	    enum pcm_mix_mode mix_mode)
+{
+	return pcm_mix_gain(pcm_a, size_a, PCM_MIX_GAIN_UNITY, pcm_b, size_b, PCM_MIX_GAIN_UNITY,
+			    mix_mode, 16);
+}
@@ -69,6 +69,7 @@ static const char location_usage_str[] =
 static const char location_get_usage_str[] =
 	"Usage: location get [--mode <mode>] [--method <method>]\n"
 	"[--timeout <secs>] [--interval <secs>]\n"
+	"[--accuracy <meters>] [--refine]\n"
 	"[--gnss_accuracy <acc>] [--gnss_num_fixes <number of fixes>]\n"
 	"[--gnss_timeout <timeout in secs>] [--gnss_visibility]\n"
 	"[--gnss_priority] [--gnss_cloud_nmea] [--gnss_cloud_pvt]\n"
@@ -79,11 +80,16 @@ static const char location_get_usage_str[] =
 	"  -m, --method, [str]         Location method: 'gnss', 'cellular' or 'wifi'. Multiple\n"
 	"                              '--method' parameters may be given to indicate list of\n"
 	"                              methods in priority order.\n"
-	"  --mode, [str]               Location request mode: 'fallback' (default) or 'all'.\n"
+	"  --mode, [str]               Location request mode: 'fallback' (default), 'all' or\n"
+	"                              'concurrent'.\n"
 	"  --interval, [int]           Position update interval in seconds\n"
 	"                              (default: 0 = single position)\n"
 	"  -t, --timeout, [float]      Timeout for the entire location request in seconds.\n"
 	"                              Zero means timeout is disabled.\n"
+	"  --accuracy, [float]         Required accuracy in meters in 'concurrent' mode.\n"
+	"                              Zero means any location is accepted (default).\n"
+	"  --refine,                   Continue with the remaining methods in 'concurrent' mode\n"
+	"                              and give more accurate locations as they are acquired\n"
 	"  --gnss_accuracy, [str]      Used GNSS accuracy: 'low', 'normal' or 'high'\n"
 	"  --gnss_num_fixes, [int]     Number of consecutive fix attempts (if gnss_accuracy\n"
 	"                              set to 'high', default: 3)\n"
@@ -106,6 +112,8 @@ static const char location_get_usage_str[] =
 enum {
 	LOCATION_SHELL_OPT_INTERVAL         = 1001,
 	LOCATION_SHELL_OPT_MODE,
+	LOCATION_SHELL_OPT_ACCURACY,
+	LOCATION_SHELL_OPT_REFINE,
 	LOCATION_SHELL_OPT_GNSS_ACCURACY,
 	LOCATION_SHELL_OPT_GNSS_TIMEOUT,
 	LOCATION_SHELL_OPT_GNSS_NUM_FIXES,
@@ -124,6 +132,8 @@ static struct option long_options[] = {
 	{ "method", required_argument, 0, 'm' },
 	{ "mode", required_argument, 0, LOCATION_SHELL_OPT_MODE },
 	{ "interval", required_argument, 0, LOCATION_SHELL_OPT_INTERVAL },
+	{ "accuracy", required_argument, 0, LOCATION_SHELL_OPT_ACCURACY },
+	{ "refine", no_argument, 0, LOCATION_SHELL_OPT_REFINE },
 	{ "timeout", required_argument, 0, 't' },
 	{ "gnss_accuracy", required_argument, 0, LOCATION_SHELL_OPT_GNSS_ACCURACY },
 	{ "gnss_timeout", required_argument, 0, LOCATION_SHELL_OPT_GNSS_TIMEOUT },
@@ -557,6 +567,8 @@ int location_shell(const struct shell *shell, size_t argc, char **argv)
 	int method_count = 0;
 
 	enum location_req_mode req_mode = LOCATION_REQ_MODE_FALLBACK;
+	float accuracy_threshold = 0;
+	bool refine = false;
 
 	int opt;
 	int ret = 0;
@@ -631,6 +643,14 @@ int location_shell(const struct shell *shell, size_t argc, char **argv)
 			}
 			break;
 
+		case LOCATION_SHELL_OPT_ACCURACY:
+			accuracy_threshold = atof(optarg);
+			break;
+
+		case LOCATION_SHELL_OPT_REFINE:
+			refine = true;
+			break;
+
 		case LOCATION_SHELL_OPT_INTERVAL:
 			interval = atoi(optarg);
 			interval_set = true;
@@ -667,6 +687,8 @@ int location_shell(const struct shell *shell, size_t argc, char **argv)
 				req_mode = LOCATION_REQ_MODE_FALLBACK;
 			} else if (strcmp(optarg, "all") == 0) {
 				req_mode = LOCATION_REQ_MODE_ALL;
+			} else if (strcmp(optarg, "concurrent") == 0) {
+				req_mode = LOCATION_REQ_MODE_CONCURRENT;
 			} else {
 				mosh_error(
 					"Unknown location request mode (%s) was given. See usage:",
@@ -769,6 +791,8 @@ int location_shell(const struct shell *shell, size_t argc, char **argv)
 				SYS_FOREVER_MS : timeout * MSEC_PER_SEC;
 		}
 		config.mode = req_mode;
+		config.accuracy_threshold = accuracy_threshold;
+		config.refine = refine;
 
 		ret = location_request(real_config);
 		if (ret) {
@@ -17,10 +17,11 @@ def signal_handler(sig, frame):
     global is_waiting
     is_waiting = False
 
-def rtt2stream(stream, event, event_close, log_lvl_number):
+def rtt2stream(stream, event, event_close, log_lvl_number, capture_filename):
     signal.signal(signal.SIGINT, signal.SIG_IGN)
     try:
-        rtt2s = Rtt2Stream(stream, event_close, log_lvl=log_lvl_number)
+        rtt2s = Rtt2Stream(stream, event_close, log_lvl=log_lvl_number,
+                           capture_filename=capture_filename)
         event.wait()
         rtt2s.read_and_transmit_data()
     except Exception as e:
@@ -50,6 +51,7 @@ def main():
     parser.add_argument('time', type=int, help='Time of collecting data [s]')
     parser.add_argument('dataset_name', help='Name of dataset')
     parser.add_argument('--log', help='Log level')
+    parser.add_argument('--capture', help='Record raw data received from device to a file')
     args = parser.parse_args()
 
     if args.log is not None:
@@ -67,7 +69,8 @@ def main():
 
     processes = []
     processes.append((Process(target=rtt2stream,
-                                args=(streams[0], event, event_close_rtt2stream, log_lvl_number),
+                                args=(streams[0], event, event_close_rtt2stream, log_lvl_number,
+                                      args.capture),
                                 daemon=True),
                         event_close_rtt2stream))
     processes.append((Process(target=model_creator,
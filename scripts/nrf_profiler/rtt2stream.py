@@ -18,11 +18,17 @@ class Command(Enum):
     INFO = 3
 
 class Rtt2Stream:
-    def __init__(self, out_stream, event_close, config=RttNordicConfig, log_lvl=logging.INFO):
+    def __init__(self, out_stream, event_close, config=RttNordicConfig, log_lvl=logging.INFO,
+                 capture_filename=None):
         self.config = config
 
         self.out_stream = out_stream
 
+        # Raw data received from device can be recorded for decoding it later on.
+        self.capture_file = None
+        if capture_filename is not None:
+            self.capture_file = open(capture_filename, 'wb')
+
         self.event_close = event_close
 
         self.logger = logging.getLogger('Profiler Rtt to stream')
@@ -146,6 +152,9 @@ class Rtt2Stream:
             self._disconnect_rtt()
             sys.exit()
 
+        if self.capture_file is not None:
+            self.capture_file.write(buf)
+
         return buf
 
     def _read_all_events_descriptions(self):
@@ -174,6 +183,8 @@ class Rtt2Stream:
 
     def read_and_transmit_data(self):
         desc_buf = self._read_all_events_descriptions()
+        if self.capture_file is not None:
+            self.capture_file.write(desc_buf)
         try:
             self.out_stream.send_desc(desc_buf)
         except StreamError as err:
@@ -217,4 +228,6 @@ class Rtt2Stream:
         self.logger.info("Real time transmission closed")
         self._read_remaining_rtt_data()
         self._disconnect_rtt()
+        if self.capture_file is not None:
+            self.capture_file.close()
         sys.exit()
@@ -0,0 +1,248 @@
+#
+# Copyright (c) 2022 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+import argparse
+import csv
+import struct
+import time
+from io import StringIO
+from events import Event, EventType
+from rtt_nordic_config import RttNordicConfig
+
+NRF_PROFILER_BATCH_EVENT_NAME = "_nrf_profiler_batch_"
+
+# Batch frame: event type ID (u8), frame length (u16), followed by frame length bytes of
+# base timestamp, number of dropped events (u16) and events. Every event in the batch is
+# made of its type ID (u8), zigzag varint encoded timestamp delta to the previous event and
+# the event data.
+# A single event sent without batching: type ID (u8), timestamp and the event data.
+# Byte order and timestamp width are taken from the configuration.
+
+BYTEORDER_FORMATS = {
+    "little": "<",
+    "big": ">",
+}
+
+TIMESTAMP_FORMATS = {
+    2**8: "B",
+    2**16: "H",
+    2**32: "I",
+    2**64: "Q",
+}
+
+DATA_TYPE_FORMATS = {
+    "u8": "B",
+    "s8": "b",
+    "u16": "H",
+    "s16": "h",
+    "u32": "I",
+    "s32": "i",
+    "t": "I",
+}
+
+
+class IncompleteData(Exception):
+    pass
+
+
+def parse_descriptions(desc_buf):
+    """Parse event descriptions sent by the device on the info channel."""
+    registered_events_types = {}
+    reader = csv.reader(StringIO(desc_buf), delimiter=',')
+    for row in reader:
+        # Empty field is sent after last event description
+        if len(row) == 0:
+            break
+        name = row[0]
+        id = int(row[1])
+        data_type = row[2:len(row) // 2 + 1]
+        data = row[len(row) // 2 + 1:]
+        registered_events_types[id] = EventType(name, data_type, data)
+    return registered_events_types
+
+
+class EventDataDecoder():
+    """Decoder of the data of a single event type.
+
+    Consecutive fixed size fields are decoded with one precompiled struct.
+    """
+    def __init__(self, data_types, byteorder='<'):
+        self.parts = []
+        fmt = ''
+        for data_type in data_types:
+            if data_type == 's':
+                if fmt:
+                    self.parts.append(struct.Struct(byteorder + fmt))
+                    fmt = ''
+                self.parts.append(None)
+            else:
+                fmt += DATA_TYPE_FORMATS[data_type]
+        if fmt:
+            self.parts.append(struct.Struct(byteorder + fmt))
+        self.fixed = (len(self.parts) == 1) and (self.parts[0] is not None)
+
+    def decode(self, buf, pos, end):
+        if self.fixed:
+            part = self.parts[0]
+            if pos + part.size > end:
+                raise IncompleteData()
+            return list(part.unpack_from(buf, pos)), pos + part.size
+
+        data = []
+        for part in self.parts:
+            if part is None:
+                if pos >= end:
+                    raise IncompleteData()
+                str_len = buf[pos]
+                pos += 1
+                if pos + str_len > end:
+                    raise IncompleteData()
+                data.append(bytes(buf[pos:pos + str_len]).decode())
+                pos += str_len
+            else:
+                if pos + part.size > end:
+                    raise IncompleteData()
+                data.extend(part.unpack_from(buf, pos))
+                pos += part.size
+        return data, pos
+
+
+class StreamDecoder():
+    """Streaming decoder of the nRF Profiler data channel.
+
+    Bytes are fed in chunks of any size. Both events sent one by one and batch frames
+    are supported. Timestamps are unwrapped into a monotonic tick count.
+    """
+    def __init__(self, registered_events_types, config=RttNordicConfig):
+        self.s_per_tick = config['ms_per_timestamp_tick'] / 1000
+        self.timestamp_raw_max = config['timestamp_raw_max']
+        byteorder = BYTEORDER_FORMATS[config['byteorder']]
+        timestamp_fmt = TIMESTAMP_FORMATS[self.timestamp_raw_max]
+        self.batch_len_struct = struct.Struct(byteorder + 'H')
+        self.batch_info_struct = struct.Struct(byteorder + timestamp_fmt + 'H')
+        self.event_timestamp_struct = struct.Struct(byteorder + timestamp_fmt)
+        self.decoders = dict((id, EventDataDecoder(et.data_types, byteorder))
+                             for id, et in registered_events_types.items())
+        self.batch_event_id = None
+        for id, et in registered_events_types.items():
+            if et.name == NRF_PROFILER_BATCH_EVENT_NAME:
+                self.batch_event_id = id
+
+        self.buf = bytearray()
+        self.last_ticks = None
+        self.dropped = 0
+        self.event_cnt = 0
+
+    def _unwrap(self, raw):
+        if self.last_ticks is None:
+            return raw
+        delta = (raw - self.last_ticks) % self.timestamp_raw_max
+        if delta >= self.timestamp_raw_max // 2:
+            delta -= self.timestamp_raw_max
+        return self.last_ticks + delta
+
+    def _decode_batch(self, buf, pos, end, events):
+        base, dropped = self.batch_info_struct.unpack_from(buf, pos)
+        pos += self.batch_info_struct.size
+        self.dropped += dropped
+
+        ticks = self._unwrap(base)
+        decoders = self.decoders
+        s_per_tick = self.s_per_tick
+        while pos < end:
+            id = buf[pos]
+            pos += 1
+
+            shift = 0
+            zigzag = 0
+            while True:
+                b = buf[pos]
+                pos += 1
+                zigzag |= (b & 0x7F) << shift
+                if b < 0x80:
+                    break
+                shift += 7
+            ticks += (zigzag >> 1) ^ -(zigzag & 1)
+
+            data, pos = decoders[id].decode(buf, pos, end)
+            events.append(Event(id, ticks * s_per_tick, data))
+
+        self.last_ticks = ticks
+
+    def _decode_single(self, buf, pos, end, events):
+        id = buf[pos]
+        ts_struct = self.event_timestamp_struct
+        if pos + 1 + ts_struct.size > end:
+            raise IncompleteData()
+        raw, = ts_struct.unpack_from(buf, pos + 1)
+        data, pos = self.decoders[id].decode(buf, pos + 1 + ts_struct.size, end)
+        self.last_ticks = self._unwrap(raw)
+        events.append(Event(id, self.last_ticks * self.s_per_tick, data))
+        return pos
+
+    def decode(self, data):
+        """Decode a chunk of the data channel and return the completely received events."""
+        self.buf.extend(data)
+        buf = self.buf
+        end = len(buf)
+        pos = 0
+        events = []
+
+        while pos < end:
+            if buf[pos] == self.batch_event_id:
+                len_struct = self.batch_len_struct
+                if pos + 1 + len_struct.size > end:
+                    break
+                frame_len, = len_struct.unpack_from(buf, pos + 1)
+                frame_start = pos + 1 + len_struct.size
+                if frame_start + frame_len > end:
+                    break
+                self._decode_batch(buf, frame_start, frame_start + frame_len, events)
+                pos = frame_start + frame_len
+            else:
+                try:
+                    pos = self._decode_single(buf, pos, end, events)
+                except IncompleteData:
+                    break
+
+        del buf[:pos]
+        self.event_cnt += len(events)
+        return events
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Decoding events from a raw nRF Profiler capture file.',
+        allow_abbrev=False)
+    parser.add_argument('capture', help='Capture file: event descriptions followed by raw data')
+    parser.add_argument('--chunk-size', type=int, default=RttNordicConfig['rtt_read_chunk_size'],
+                        help='Number of bytes decoded at once')
+    args = parser.parse_args()
+
+    with open(args.capture, 'rb') as f:
+        capture = f.read()
+
+    # Empty line is sent after last event description
+    desc_end = capture.index(b'\n\n') + 2
+    decoder = StreamDecoder(parse_descriptions(capture[:desc_end].decode()))
+
+    start = time.perf_counter()
+    first = last = None
+    for i in range(desc_end, len(capture), args.chunk_size):
+        events = decoder.decode(capture[i:i + args.chunk_size])
+        if events:
+            if first is None:
+                first = events[0].timestamp
+            last = events[-1].timestamp
+    elapsed = time.perf_counter() - start
+
+    print("Decoded {} events ({} dropped on device) in {:.3f} s".format(
+        decoder.event_cnt, decoder.dropped, elapsed))
+    if first is not None and elapsed > 0:
+        print("Capture length {:.3f} s, {:.1f} times faster than real time".format(
+            last - first, (last - first) / elapsed))
+
+if __name__ == "__main__":
+    main()
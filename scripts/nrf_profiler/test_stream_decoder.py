@@ -0,0 +1,207 @@
+#
+# Copyright (c) 2022 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+# Replay test of the nRF Profiler stream decoder.
+# Run with: python3 -m unittest test_stream_decoder
+
+import random
+import struct
+import time
+import unittest
+from stream_decoder import StreamDecoder, parse_descriptions, DATA_TYPE_FORMATS, \
+    BYTEORDER_FORMATS, TIMESTAMP_FORMATS
+from rtt_nordic_config import RttNordicConfig
+
+DESCRIPTIONS = ("_nrf_profiler_fatal_error_event_,0\n"
+                "_nrf_profiler_batch_,1\n"
+                "no data event,2\n"
+                "data event,3,u32,value1\n"
+                "big event,4,u32,s32,u16,s16,u8,s8,s,value1,value2,value3,value4,"
+                "value5,value6,string\n"
+                "motion,5,s16,s16,t,dx,dy,time\n"
+                "\n")
+
+BATCH_EVENT_ID = 1
+EVENTS_NB = 200000
+# Mean time between events on device, in timestamp ticks.
+EVENT_INTERVAL_TICKS = 3
+BATCH_SIZE_MAX = 512
+# Decoding must be at least that much faster than the capture length.
+REAL_TIME_FACTOR_MIN = 5
+
+
+def encode_data(data_types, data, byteorder):
+    buf = bytearray()
+    for data_type, value in zip(data_types, data):
+        if data_type == 's':
+            encoded = value.encode()
+            buf.append(len(encoded))
+            buf.extend(encoded)
+        else:
+            buf.extend(struct.pack(byteorder + DATA_TYPE_FORMATS[data_type], value))
+    return buf
+
+
+def encode_varint(value):
+    buf = bytearray()
+    while value >= 0x80:
+        buf.append((value & 0x7F) | 0x80)
+        value >>= 7
+    buf.append(value)
+    return buf
+
+
+def random_data(rnd, data_types):
+    ranges = {
+        "u8": (0, 2**8 - 1),
+        "s8": (-2**7, 2**7 - 1),
+        "u16": (0, 2**16 - 1),
+        "s16": (-2**15, 2**15 - 1),
+        "u32": (0, 2**32 - 1),
+        "s32": (-2**31, 2**31 - 1),
+        "t": (0, 2**32 - 1),
+    }
+    data = []
+    for data_type in data_types:
+        if data_type == 's':
+            data.append(''.join(rnd.choice('abcdefgh ') for _ in range(rnd.randint(0, 20))))
+        else:
+            data.append(rnd.randint(*ranges[data_type]))
+    return data
+
+
+class Capture():
+    """Synthetic data channel content encoded the same way as on the device."""
+    def __init__(self, seed, config=RttNordicConfig):
+        rnd = random.Random(seed)
+        self.config = config
+        self.byteorder = BYTEORDER_FORMATS[config['byteorder']]
+        self.timestamp_fmt = TIMESTAMP_FORMATS[config['timestamp_raw_max']]
+        raw_max = config['timestamp_raw_max']
+        self.event_types = parse_descriptions(DESCRIPTIONS)
+        self.events = []
+        self.dropped = 0
+        self.data = bytearray()
+
+        event_ids = [id for id, et in self.event_types.items() if not et.name.startswith('_')]
+        # Start close to the timestamp wrap-around.
+        ticks = raw_max - 1000
+        batch = bytearray()
+        batch_base = None
+        batch_dropped = 0
+        prev = None
+
+        for i in range(EVENTS_NB):
+            id = rnd.choice(event_ids)
+            et = self.event_types[id]
+            data = random_data(rnd, et.data_types)
+            # Events logged from preempting contexts can go back in time.
+            ticks += rnd.randint(-2, 2 * EVENT_INTERVAL_TICKS)
+            self.events.append((id, ticks, data))
+            payload = encode_data(et.data_types, data, self.byteorder)
+            raw = ticks % raw_max
+
+            if i < 100:
+                # Events sent one by one
+                self.data.append(id)
+                self.data.extend(struct.pack(self.byteorder + self.timestamp_fmt, raw))
+                self.data.extend(payload)
+                continue
+
+            if rnd.random() < 0.001:
+                batch_dropped += rnd.randint(1, 10)
+
+            delta = 0 if batch_base is None else ticks - prev
+            record = bytearray([id]) + encode_varint(((delta << 1) ^ (delta >> 31)) &
+                                                     0xFFFFFFFF) + payload
+            if batch_base is not None and len(batch) + len(record) > BATCH_SIZE_MAX:
+                self._add_batch(batch_base, batch_dropped, batch)
+                batch = bytearray()
+                batch_dropped = 0
+                record = bytearray([id]) + encode_varint(0) + payload
+                batch_base = None
+            if batch_base is None:
+                batch_base = raw
+            batch.extend(record)
+            prev = ticks
+
+        self._add_batch(batch_base, batch_dropped, batch)
+        self.duration = (self.events[-1][1] - self.events[0][1]) * \
+            config['ms_per_timestamp_tick'] / 1000
+
+    def _add_batch(self, base, dropped, batch):
+        self.dropped += dropped
+        self.data.append(BATCH_EVENT_ID)
+        info = struct.pack(self.byteorder + self.timestamp_fmt + 'H', base, dropped)
+        self.data.extend(struct.pack(self.byteorder + 'H', len(info) + len(batch)))
+        self.data.extend(info)
+        self.data.extend(batch)
+
+
+class TestStreamDecoder(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.capture = Capture(seed=0)
+
+    def _replay(self, chunk_sizes):
+        decoder = StreamDecoder(self.capture.event_types, self.capture.config)
+        data = self.capture.data
+        events = []
+        pos = 0
+        i = 0
+        start = time.perf_counter()
+        while pos < len(data):
+            size = chunk_sizes[i % len(chunk_sizes)]
+            events.extend(decoder.decode(data[pos:pos + size]))
+            pos += size
+            i += 1
+        elapsed = time.perf_counter() - start
+        return decoder, events, elapsed
+
+    def _check_round_trip(self, decoder, events):
+        self.assertEqual(len(events), len(self.capture.events))
+        self.assertEqual(decoder.dropped, self.capture.dropped)
+        self.assertEqual(len(decoder.buf), 0)
+
+        first_ticks = self.capture.events[0][1]
+        raw_max = self.capture.config['timestamp_raw_max']
+        s_per_tick = self.capture.config['ms_per_timestamp_tick'] / 1000
+        for event, (id, ticks, data) in zip(events, self.capture.events):
+            self.assertEqual(event.type_id, id)
+            self.assertEqual(event.data, data)
+            self.assertAlmostEqual(event.timestamp, (ticks - first_ticks + first_ticks % raw_max) *
+                                   s_per_tick)
+
+    def test_round_trip(self):
+        decoder, events, _ = self._replay([RttNordicConfig['rtt_read_chunk_size']])
+        self._check_round_trip(decoder, events)
+
+    def test_round_trip_split(self):
+        # Frames and events split at every possible position
+        decoder, events, _ = self._replay([1, 2, 3, 5, 7, 11, 13, 17, 1000])
+        self._check_round_trip(decoder, events)
+
+    def test_throughput(self):
+        decoder, events, elapsed = self._replay([RttNordicConfig['rtt_read_chunk_size']])
+        rate = len(events) / elapsed
+        factor = self.capture.duration / elapsed
+        print("\nDecoded {} events in {:.3f} s ({:.0f} events/s), {:.1f} times faster than "
+              "real time".format(len(events), elapsed, rate, factor))
+        self.assertGreater(factor, REAL_TIME_FACTOR_MIN)
+
+
+class TestStreamDecoderConfig(TestStreamDecoder):
+    """Byte order and timestamp width other than the default ones."""
+    @classmethod
+    def setUpClass(cls):
+        config = dict(RttNordicConfig, byteorder='big', timestamp_raw_max=2**16)
+        cls.capture = Capture(seed=1, config=config)
+
+    def test_throughput(self):
+        pass
+
+
+if __name__ == '__main__':
+    unittest.main()
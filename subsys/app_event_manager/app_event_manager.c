@@ -15,14 +15,31 @@
 LOG_MODULE_REGISTER(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES)
+#define EVENTQ_COUNT APP_EVENT_PRIORITY_COUNT
+#else
+#define EVENTQ_COUNT 1
+#endif
+
 static void event_processor_fn(struct k_work *work);
 
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
 static K_WORK_DEFINE(event_processor, event_processor_fn);
-static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
+
+/* Zero-initialized list is a valid empty list. */
+static sys_slist_t eventq[EVENTQ_COUNT];
 static struct k_spinlock lock;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_WORKQ)
+static void high_prio_event_processor_fn(struct k_work *work);
+
+static K_WORK_DEFINE(high_prio_event_processor, high_prio_event_processor_fn);
+static K_THREAD_STACK_DEFINE(high_prio_workq_stack,
+			     CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_WORKQ_STACK_SIZE);
+static struct k_work_q high_prio_workq;
+#endif
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	size_t idx = et - _event_type_list_start;
@@ -134,81 +151,256 @@ void * __weak app_event_manager_alloc(size_t size)
 
 void __weak app_event_manager_free(void *addr)
 {
+	if (app_event_manager_slab_free(addr)) {
+		return;
+	}
+
 	k_free(addr);
 }
 
-static void event_processor_fn(struct k_work *work)
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+/* Memory slabs indexed by event type index. */
+static const struct app_event_slab *event_slabs[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+
+static const struct app_event_slab *event_slab_get(const struct event_type *et)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	size_t idx = et - _event_type_list_start;
 
-	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	if (idx >= ARRAY_SIZE(event_slabs)) {
+		return NULL;
+	}
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
-		return;
+	return event_slabs[idx];
+}
+
+static void event_slabs_init(void)
+{
+	STRUCT_SECTION_FOREACH(app_event_slab, es) {
+		size_t idx = es->type - _event_type_list_start;
+
+		__ASSERT_NO_MSG(idx < ARRAY_SIZE(event_slabs));
+		__ASSERT(!event_slabs[idx], "Memory slab defined twice for %s", es->type->name);
+		event_slabs[idx] = es;
 	}
+}
 
-	sys_slist_merge_slist(&events, &eventq);
+static void event_slab_max_used_update(const struct app_event_slab *es)
+{
+	atomic_val_t used = k_mem_slab_num_used_get(es->slab);
+	atomic_val_t max_used = atomic_get(&es->stats->max_used);
 
-	k_spin_unlock(&lock, key);
+	while ((used > max_used) && !atomic_cas(&es->stats->max_used, max_used, used)) {
+		max_used = atomic_get(&es->stats->max_used);
+	}
+}
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct app_event_header *aeh = CONTAINER_OF(node,
-						       struct app_event_header,
-						       node);
+void *_app_event_manager_alloc_event(const struct event_type *et, size_t size)
+{
+	const struct app_event_slab *es = event_slab_get(et);
+	void *event;
+
+	if (!es) {
+		return app_event_manager_alloc(size);
+	}
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
+	if ((size <= es->slab->block_size) &&
+	    !k_mem_slab_alloc(es->slab, &event, K_NO_WAIT)) {
+		event_slab_max_used_update(es);
+		return event;
+	}
 
-		const struct event_type *et = aeh->type_id;
+	atomic_inc(&es->stats->fallbacks);
+	event = app_event_manager_alloc(size);
+	if (!event) {
+		atomic_inc(&es->stats->failures);
+	}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
-			}
+	return event;
+}
+
+bool app_event_manager_slab_free(void *addr)
+{
+	const struct app_event_header *aeh = addr;
+	const struct app_event_slab *es;
+
+	if (!aeh) {
+		return false;
+	}
+
+	es = event_slab_get(aeh->type_id);
+	if (!es) {
+		return false;
+	}
+
+	const char *start = es->slab->buffer;
+	const char *end = start + es->slab->num_blocks * es->slab->block_size;
+
+	if (((const char *)addr < start) || ((const char *)addr >= end)) {
+		return false;
+	}
+
+	k_mem_slab_free(es->slab, &addr);
+
+	return true;
+}
+#else
+static void event_slabs_init(void)
+{
+}
+
+bool app_event_manager_slab_free(void *addr)
+{
+	return false;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_SLABS */
+
+static void event_process(struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	const struct event_type *et = aeh->type_id;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			h->hook(aeh);
 		}
+	}
 
-		log_event(aeh);
+	log_event(aeh);
 
-		bool consumed = false;
+	bool consumed = false;
 
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
+	for (const struct event_subscriber *es = et->subs_start;
+	     (es != et->subs_stop) && !consumed;
+	     es++) {
 
-			__ASSERT_NO_MSG(es != NULL);
+		__ASSERT_NO_MSG(es != NULL);
 
-			const struct event_listener *el = es->listener;
+		const struct event_listener *el = es->listener;
 
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
+		__ASSERT_NO_MSG(el != NULL);
+		__ASSERT_NO_MSG(el->notification != NULL);
 
-			log_event_progress(et, el);
+		log_event_progress(et, el);
 
-			consumed = el->notification(aeh);
+		consumed = el->notification(aeh);
 
-			if (consumed) {
-				log_event_consumed(et);
-			}
+		if (consumed) {
+			log_event_consumed(et);
 		}
+	}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+	app_event_manager_free(aeh);
+}
+
+static size_t eventq_idx(const struct event_type *et)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES)) {
+		return 0;
+	}
+
+	return app_event_get_type_priority(et);
+}
+
+/* Get the oldest event from the highest priority non-empty queue within
+ * the given range of queues.
+ */
+static struct app_event_header *eventq_get(size_t first_idx, size_t last_idx)
+{
+	sys_snode_t *node = NULL;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = first_idx; (i <= last_idx) && !node; i++) {
+		node = sys_slist_get(&eventq[i]);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return node ? CONTAINER_OF(node, struct app_event_header, node) : NULL;
+}
+
+static void event_processor_fn(struct k_work *work)
+{
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES)) {
+		/* Events are taken one by one to let a newly submitted event of
+		 * higher priority overtake pending events of lower priority.
+		 */
+		size_t first_idx = IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_WORKQ) ?
+				   (APP_EVENT_PRIORITY_HIGH + 1) : 0;
+		struct app_event_header *aeh;
+
+		while ((aeh = eventq_get(first_idx, EVENTQ_COUNT - 1)) != NULL) {
+			event_process(aeh);
+
+			if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_WORKQ) &&
+			    !sys_slist_is_empty(&eventq[APP_EVENT_PRIORITY_HIGH])) {
+				/* Let the high priority work queue run. */
+				k_yield();
 			}
 		}
 
-		app_event_manager_free(aeh);
+		return;
+	}
+
+	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+
+	/* Make current event list local. */
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (sys_slist_is_empty(&eventq[0])) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	sys_slist_merge_slist(&events, &eventq[0]);
+
+	k_spin_unlock(&lock, key);
+
+	/* Traverse the list of events. */
+	sys_snode_t *node;
+	while (NULL != (node = sys_slist_get(&events))) {
+		struct app_event_header *aeh = CONTAINER_OF(node,
+						       struct app_event_header,
+						       node);
+
+		event_process(aeh);
 	}
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_WORKQ)
+static void high_prio_event_processor_fn(struct k_work *work)
+{
+	struct app_event_header *aeh;
+
+	while ((aeh = eventq_get(APP_EVENT_PRIORITY_HIGH, APP_EVENT_PRIORITY_HIGH)) != NULL) {
+		event_process(aeh);
+	}
+}
+#endif
+
+static void event_processor_submit(size_t idx)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_WORKQ)
+	if (idx == APP_EVENT_PRIORITY_HIGH) {
+		k_work_submit_to_queue(&high_prio_workq, &high_prio_event_processor);
+		return;
+	}
+#endif
+	k_work_submit(&event_processor);
+}
+
 void _event_submit(struct app_event_header *aeh)
 {
 	__ASSERT_NO_MSG(aeh);
 	APP_EVENT_ASSERT_ID(aeh->type_id);
 
+	size_t idx = eventq_idx(aeh->type_id);
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
@@ -216,10 +408,10 @@ void _event_submit(struct app_event_header *aeh)
 			h->hook(aeh);
 		}
 	}
-	sys_slist_append(&eventq, &aeh->node);
+	sys_slist_append(&eventq[idx], &aeh->node);
 	k_spin_unlock(&lock, key);
 
-	k_work_submit(&event_processor);
+	event_processor_submit(idx);
 }
 
 int app_event_manager_init(void)
@@ -230,6 +422,14 @@ int app_event_manager_init(void)
 			CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT);
 
 	log_event_init();
+	event_slabs_init();
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_WORKQ)
+	k_work_queue_start(&high_prio_workq, high_prio_workq_stack,
+			   K_THREAD_STACK_SIZEOF(high_prio_workq_stack),
+			   CONFIG_APP_EVENT_MANAGER_HIGH_PRIORITY_WORKQ_PRIORITY, NULL);
+	k_thread_name_set(&high_prio_workq.thread, "app_event_manager_high_prio");
+#endif
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
 		STRUCT_SECTION_FOREACH(app_event_manager_postinit_hook, h) {
@@ -121,6 +121,14 @@ extern "C" {
 #define _EVENT_ID(ename) (&_CONCAT(__event_type_, ename))
 
 
+/* Allocate memory for an event of the given ename type. */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+#define _APP_EVENT_ALLOC(ename, size) _app_event_manager_alloc_event(_EVENT_ID(ename), (size))
+#else
+#define _APP_EVENT_ALLOC(ename, size) app_event_manager_alloc(size)
+#endif
+
+
 /* Macro generates a function of name new_ename where ename is provided as
  * an argument. Allocator function is used to create an event of the given
  * ename type.
@@ -129,7 +137,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(void)			\
 	{									\
 		struct ename *event =						\
-			(struct ename *)app_event_manager_alloc(sizeof(*event));\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event));\
 		BUILD_ASSERT(offsetof(struct ename, header) == 0,		\
 				 "");						\
 		if (event != NULL) {						\
@@ -147,7 +155,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(size_t size)			\
 	{										\
 		struct ename *event =							\
-			(struct ename *)app_event_manager_alloc(sizeof(*event) + size);	\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event) + size);	\
 		BUILD_ASSERT((offsetof(struct ename, dyndata) +				\
 				  sizeof(event->dyndata.size)) ==			\
 				 sizeof(*event), "");					\
@@ -305,6 +313,11 @@ extern struct event_type _event_type_list_end[];
 	BUILD_ASSERT(((et_flags) & ((BIT_MASK(APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START-	\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
+	BUILD_ASSERT(((et_flags) & (BIT(APP_EVENT_TYPE_FLAGS_PRIORITY_HIGH) |		\
+		BIT(APP_EVENT_TYPE_FLAGS_PRIORITY_LOW))) !=				\
+		(BIT(APP_EVENT_TYPE_FLAGS_PRIORITY_HIGH) |				\
+		BIT(APP_EVENT_TYPE_FLAGS_PRIORITY_LOW)),				\
+		"Event type cannot have both high and low priority");		\
 	_APP_EVENT_SUBSCRIBERS_ARRAY_TAGS(ename);					\
 	STRUCT_SECTION_ITERABLE(event_type, _CONCAT(__event_type_, ename)) = {		\
 		.name            = STRINGIFY(ename),					\
@@ -319,6 +332,51 @@ extern struct event_type _event_type_list_end[];
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
 	}
 
+/** @brief Statistics of the event type memory slab.
+ */
+struct app_event_slab_stats {
+	/** Maximum number of blocks that were allocated at the same time. */
+	atomic_t max_used;
+
+	/** Number of allocations that fell back to the heap. */
+	atomic_t fallbacks;
+
+	/** Number of failed allocations. */
+	atomic_t failures;
+};
+
+/** @brief Event type memory slab.
+ */
+struct app_event_slab {
+	/** Pointer to the event type object. */
+	const struct event_type *type;
+
+	/** Memory slab used to allocate events of the given type. */
+	struct k_mem_slab *slab;
+
+	/** Allocation statistics. */
+	struct app_event_slab_stats *stats;
+};
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+#define _APP_EVENT_SLAB_ALIGN(ename) MAX(sizeof(void *), __alignof(struct ename))
+
+#define _APP_EVENT_TYPE_SLAB_DEFINE(ename, block_cnt)					\
+	BUILD_ASSERT((block_cnt) > 0);							\
+	K_MEM_SLAB_DEFINE_STATIC(_CONCAT(__event_slab_mem_, ename),			\
+		ROUND_UP(sizeof(struct ename), _APP_EVENT_SLAB_ALIGN(ename)),		\
+		(block_cnt), _APP_EVENT_SLAB_ALIGN(ename));				\
+	static struct app_event_slab_stats _CONCAT(__event_slab_stats_, ename);		\
+	STRUCT_SECTION_ITERABLE(app_event_slab, _CONCAT(__event_slab_, ename)) = {	\
+		.type  = _EVENT_ID(ename),						\
+		.slab  = &_CONCAT(__event_slab_mem_, ename),				\
+		.stats = &_CONCAT(__event_slab_stats_, ename),				\
+	}
+#else
+#define _APP_EVENT_TYPE_SLAB_DEFINE(ename, block_cnt)					\
+	BUILD_ASSERT((block_cnt) > 0)
+#endif
+
 /**
  * @brief Bitmask indicating event is displayed.
  */
@@ -429,6 +487,18 @@ struct event_postprocess_hook {
 
 
 
+/** @brief Allocate an event of the given type.
+ *
+ * The event is allocated from the memory slab of the event type. If the
+ * event type has no memory slab or the slab is exhausted, the event is
+ * allocated using @ref app_event_manager_alloc.
+ *
+ * @param et    Pointer to the event type.
+ * @param size  Size of the event (in bytes).
+ * @retval Address of the allocated memory if successful, otherwise NULL.
+ */
+void *_app_event_manager_alloc_event(const struct event_type *et, size_t size);
+
 /** @brief Submit an event to the Application Event Manager.
  *
  * @param aeh  Pointer to the application event header element in the event object.
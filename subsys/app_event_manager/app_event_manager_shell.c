@@ -5,6 +5,7 @@
  */
 
 #include <stdlib.h>
+#include <inttypes.h>
 #include <zephyr/shell/shell.h>
 #include <app_event_manager.h>
 
@@ -81,6 +82,28 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+static int show_slabs(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event Memory Slabs:\n");
+
+	STRUCT_SECTION_FOREACH(app_event_slab, es) {
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[E:%s] used %" PRIu32 "/%" PRIu32 " max used %ld"
+			      " fallbacks %ld failures %ld\n",
+			      es->type->name,
+			      k_mem_slab_num_used_get(es->slab),
+			      es->slab->num_blocks,
+			      atomic_get(&es->stats->max_used),
+			      atomic_get(&es->stats->fallbacks),
+			      atomic_get(&es->stats->failures));
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_SLABS */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +178,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS, show_slabs, NULL,
+			   "Show event memory slabs statistics", show_slabs, 0, 0),
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
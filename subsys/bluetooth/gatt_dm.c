@@ -10,6 +10,12 @@
 
 #include <bluetooth/gatt_dm.h>
 
+#if CONFIG_BT_GATT_DM_CACHE
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/settings/settings.h>
+#endif
+
 LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
 
 /* Available sizes: 128, 512, 2048... */
@@ -22,6 +28,22 @@ LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
 BUILD_ASSERT(sizeof(struct bt_gatt_service_val) % DATA_ALIGN == 0);
 BUILD_ASSERT(sizeof(struct bt_gatt_chrc) % DATA_ALIGN == 0);
 
+#if CONFIG_BT_GATT_DM_CACHE
+#define CACHE_VERSION 1
+#define CACHE_DB_HASH_LEN 16
+#define CACHE_SUBTREE "bt_dm"
+/* Subtree, peer address and type */
+#define CACHE_SUBTREE_LEN (sizeof(CACHE_SUBTREE) + 1 + 2 * sizeof(bt_addr_t) + 3)
+#define CACHE_KEY_LEN (CACHE_SUBTREE_LEN + 1 + BT_UUID_STR_LEN)
+/* Length byte and the longest UUID value */
+#define CACHE_UUID_LEN_MAX (1 + 16)
+/* Handle, permissions, UUID and the longest service or characteristic data */
+#define CACHE_ATTR_LEN_MAX (2 + 1 + CACHE_UUID_LEN_MAX + 2 + 1 + CACHE_UUID_LEN_MAX)
+/* Version, Database Hash, attribute count and attributes */
+#define CACHE_DATA_LEN_MAX (1 + CACHE_DB_HASH_LEN + 2 + \
+			    CONFIG_BT_GATT_DM_MAX_ATTRS * CACHE_ATTR_LEN_MAX)
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 /* Flags for parsed attribute array state */
 enum {
 	STATE_ATTRS_LOCKED,
@@ -71,11 +93,35 @@ struct bt_gatt_dm {
 
 	/* Indicates that services should be searched by the UUID. */
 	bool search_svc_by_uuid;
+
+#if CONFIG_BT_GATT_DM_CACHE
+	/* The Database Hash read parameters */
+	struct bt_gatt_read_params hash_read_params;
+	/* The Database Hash of the peer */
+	uint8_t db_hash[CACHE_DB_HASH_LEN];
+	/* Indicates that the discovered data should be stored in the cache. */
+	bool cache_store_pending;
+#endif
 };
 
 /* Currently only one instance is supported */
 static struct bt_gatt_dm bt_gatt_dm_inst;
 
+#if CONFIG_BT_GATT_DM_CACHE
+/* UUID storage used when restoring attributes from the cache */
+union cache_uuid {
+	struct bt_uuid uuid;
+	struct bt_uuid_16 u16;
+	struct bt_uuid_32 u32;
+	struct bt_uuid_128 u128;
+};
+
+/* Serialized discovery data */
+static uint8_t cache_data[CACHE_DATA_LEN_MAX];
+
+static void cache_store(struct bt_gatt_dm *dm);
+#endif
+
 /* Returns pointer to newly allocated space in a dm->data_chunk */
 static void *user_data_alloc(struct bt_gatt_dm *dm,
 			     size_t len)
@@ -250,6 +296,12 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 static void discovery_complete(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discovery complete.");
+#if CONFIG_BT_GATT_DM_CACHE
+	if (dm->cache_store_pending) {
+		dm->cache_store_pending = false;
+		cache_store(dm);
+	}
+#endif
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
@@ -601,6 +653,404 @@ const struct bt_gatt_dm_attr *bt_gatt_dm_desc_next(
 	return curr;
 }
 
+#if CONFIG_BT_GATT_DM_CACHE
+static void cache_subtree_get(const bt_addr_le_t *addr, char *subtree)
+{
+	const uint8_t *a = addr->a.val;
+
+	snprintk(subtree, CACHE_SUBTREE_LEN, CACHE_SUBTREE "/%02x%02x%02x%02x%02x%02x%u",
+		 a[5], a[4], a[3], a[2], a[1], a[0], addr->type);
+}
+
+static void cache_key_get(const struct bt_gatt_dm *dm, char *key)
+{
+	struct bt_conn_info info;
+	char subtree[CACHE_SUBTREE_LEN];
+	char uuid_str[BT_UUID_STR_LEN];
+	int err;
+
+	err = bt_conn_get_info(dm->conn, &info);
+	__ASSERT_NO_MSG(!err);
+
+	cache_subtree_get(info.le.dst, subtree);
+	bt_uuid_to_str(&dm->svc_uuid.uuid, uuid_str, sizeof(uuid_str));
+	snprintk(key, CACHE_KEY_LEN, "%s/%s", subtree, uuid_str);
+}
+
+static void cache_uuid_push(struct net_buf_simple *buf, const struct bt_uuid *uuid)
+{
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		net_buf_simple_add_u8(buf, sizeof(uint16_t));
+		net_buf_simple_add_le16(buf, BT_UUID_16(uuid)->val);
+		break;
+	case BT_UUID_TYPE_32:
+		net_buf_simple_add_u8(buf, sizeof(uint32_t));
+		net_buf_simple_add_le32(buf, BT_UUID_32(uuid)->val);
+		break;
+	case BT_UUID_TYPE_128:
+		net_buf_simple_add_u8(buf, sizeof(BT_UUID_128(uuid)->val));
+		net_buf_simple_add_mem(buf, BT_UUID_128(uuid)->val,
+				       sizeof(BT_UUID_128(uuid)->val));
+		break;
+	default:
+		__ASSERT_NO_MSG(false);
+		break;
+	}
+}
+
+static int cache_uuid_pull(struct net_buf_simple *buf, union cache_uuid *uuid)
+{
+	uint8_t len;
+
+	if (buf->len < sizeof(len)) {
+		return -EINVAL;
+	}
+
+	len = net_buf_simple_pull_u8(buf);
+
+	if ((buf->len < len) || !bt_uuid_create(&uuid->uuid, buf->data, len)) {
+		return -EINVAL;
+	}
+
+	net_buf_simple_pull(buf, len);
+
+	return 0;
+}
+
+static void cache_store(struct bt_gatt_dm *dm)
+{
+	struct net_buf_simple buf;
+	char key[CACHE_KEY_LEN];
+	int err;
+
+	net_buf_simple_init_with_data(&buf, cache_data, sizeof(cache_data));
+	net_buf_simple_reset(&buf);
+
+	net_buf_simple_add_u8(&buf, CACHE_VERSION);
+	net_buf_simple_add_mem(&buf, dm->db_hash, sizeof(dm->db_hash));
+	net_buf_simple_add_le16(&buf, dm->cur_attr_id);
+
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		const struct bt_gatt_dm_attr *attr = &dm->attrs[i];
+		const struct bt_gatt_service_val *service_val;
+		const struct bt_gatt_chrc *chrc;
+
+		net_buf_simple_add_le16(&buf, attr->handle);
+		net_buf_simple_add_u8(&buf, attr->perm);
+		cache_uuid_push(&buf, attr->uuid);
+
+		service_val = bt_gatt_dm_attr_service_val(attr);
+		if (service_val) {
+			net_buf_simple_add_le16(&buf, service_val->end_handle);
+			cache_uuid_push(&buf, service_val->uuid);
+			continue;
+		}
+
+		chrc = bt_gatt_dm_attr_chrc_val(attr);
+		if (chrc) {
+			net_buf_simple_add_le16(&buf, chrc->value_handle);
+			net_buf_simple_add_u8(&buf, chrc->properties);
+			cache_uuid_push(&buf, chrc->uuid);
+		}
+	}
+
+	cache_key_get(dm, key);
+
+	err = settings_save_one(key, buf.data, buf.len);
+	if (err) {
+		LOG_WRN("Cannot store discovery data, error: %d", err);
+	} else {
+		LOG_DBG("Discovery data stored (%s, %u bytes)", key, buf.len);
+	}
+}
+
+static int cache_attr_restore(struct bt_gatt_dm *dm, struct net_buf_simple *buf)
+{
+	union cache_uuid uuid;
+	struct bt_gatt_attr attr = {.uuid = &uuid.uuid};
+	struct bt_gatt_dm_attr *cur_attr;
+	int err;
+
+	if (buf->len < sizeof(attr.handle) + sizeof(uint8_t)) {
+		return -EINVAL;
+	}
+
+	attr.handle = net_buf_simple_pull_le16(buf);
+	attr.perm = net_buf_simple_pull_u8(buf);
+
+	err = cache_uuid_pull(buf, &uuid);
+	if (err) {
+		return err;
+	}
+
+	if ((bt_uuid_cmp(attr.uuid, BT_UUID_GATT_PRIMARY) == 0) ||
+	    (bt_uuid_cmp(attr.uuid, BT_UUID_GATT_SECONDARY) == 0)) {
+		struct bt_gatt_service_val *service_val;
+
+		cur_attr = attr_store(dm, &attr, sizeof(*service_val));
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+
+		if (buf->len < sizeof(service_val->end_handle)) {
+			return -EINVAL;
+		}
+
+		service_val = bt_gatt_dm_attr_service_val(cur_attr);
+		service_val->end_handle = net_buf_simple_pull_le16(buf);
+
+		err = cache_uuid_pull(buf, &uuid);
+		if (err) {
+			return err;
+		}
+
+		service_val->uuid = uuid_store(dm, &uuid.uuid);
+		if (!service_val->uuid) {
+			return -ENOMEM;
+		}
+	} else if (bt_uuid_cmp(attr.uuid, BT_UUID_GATT_CHRC) == 0) {
+		struct bt_gatt_chrc *chrc;
+
+		cur_attr = attr_store(dm, &attr, sizeof(*chrc));
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+
+		if (buf->len < sizeof(chrc->value_handle) + sizeof(chrc->properties)) {
+			return -EINVAL;
+		}
+
+		chrc = bt_gatt_dm_attr_chrc_val(cur_attr);
+		chrc->value_handle = net_buf_simple_pull_le16(buf);
+		chrc->properties = net_buf_simple_pull_u8(buf);
+
+		err = cache_uuid_pull(buf, &uuid);
+		if (err) {
+			return err;
+		}
+
+		chrc->uuid = uuid_store(dm, &uuid.uuid);
+		if (!chrc->uuid) {
+			return -ENOMEM;
+		}
+	} else {
+		cur_attr = attr_store(dm, &attr, 0);
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+static int cache_restore(struct bt_gatt_dm *dm, size_t len)
+{
+	struct net_buf_simple buf;
+	uint16_t attr_cnt;
+	int err;
+
+	net_buf_simple_init_with_data(&buf, cache_data, len);
+
+	if ((buf.len < 1 + sizeof(dm->db_hash) + sizeof(attr_cnt)) ||
+	    (net_buf_simple_pull_u8(&buf) != CACHE_VERSION)) {
+		return -EINVAL;
+	}
+
+	if (memcmp(net_buf_simple_pull_mem(&buf, sizeof(dm->db_hash)), dm->db_hash,
+		   sizeof(dm->db_hash))) {
+		LOG_DBG("Database Hash changed");
+		return -ESTALE;
+	}
+
+	attr_cnt = net_buf_simple_pull_le16(&buf);
+	if ((attr_cnt == 0) || (attr_cnt > ARRAY_SIZE(dm->attrs))) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < attr_cnt; i++) {
+		err = cache_attr_restore(dm, &buf);
+		if (err) {
+			return err;
+		}
+	}
+
+	return (buf.len == 0) ? 0 : -EINVAL;
+}
+
+struct cache_load_ctx {
+	const char *name;
+	ssize_t len;
+};
+
+static int cache_load_cb(const char *key, size_t len, settings_read_cb read_cb,
+			 void *cb_arg, void *param)
+{
+	struct cache_load_ctx *ctx = param;
+	const char *next;
+
+	if (!settings_name_steq(key, ctx->name, &next) || next) {
+		return 0;
+	}
+
+	if (len > sizeof(cache_data)) {
+		ctx->len = -ENOMEM;
+	} else {
+		ctx->len = read_cb(cb_arg, cache_data, len);
+	}
+
+	return 0;
+}
+
+static int cache_load(struct bt_gatt_dm *dm)
+{
+	char key[CACHE_KEY_LEN];
+	char *name;
+	struct cache_load_ctx ctx = {.len = -ENOENT};
+	const struct bt_gatt_service_val *service_val;
+	int err;
+
+	cache_key_get(dm, key);
+
+	/* Split the key into the peer subtree and the service name. */
+	name = strrchr(key, '/');
+	*name = '\0';
+	ctx.name = name + 1;
+
+	err = settings_load_subtree_direct(key, cache_load_cb, &ctx);
+	if (err) {
+		return err;
+	}
+
+	if (ctx.len <= 0) {
+		return (ctx.len < 0) ? ctx.len : -ENOENT;
+	}
+
+	err = cache_restore(dm, ctx.len);
+	service_val = err ? NULL : bt_gatt_dm_attr_service_val(&dm->attrs[0]);
+	if (!service_val) {
+		svc_attr_memory_release(dm);
+		return err ? err : -EINVAL;
+	}
+
+	dm->discover_params.uuid = NULL;
+	dm->discover_params.end_handle = service_val->end_handle;
+
+	return 0;
+}
+
+static uint8_t cache_hash_read_cb(struct bt_conn *conn, uint8_t err,
+				  struct bt_gatt_read_params *params,
+				  const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(params, struct bt_gatt_dm, hash_read_params);
+	int ret;
+
+	if (err) {
+		LOG_DBG("Database Hash read failed, error: %u", err);
+	} else if (!data) {
+		LOG_DBG("Database Hash not found");
+	} else if (length != sizeof(dm->db_hash)) {
+		LOG_WRN("Invalid Database Hash length: %u", length);
+	} else {
+		memcpy(dm->db_hash, data, length);
+
+		ret = cache_load(dm);
+		if (!ret) {
+			LOG_DBG("Discovery data restored from cache");
+			discovery_complete(dm);
+			return BT_GATT_ITER_STOP;
+		}
+
+		LOG_DBG("Discovery data not restored from cache: %d", ret);
+		dm->cache_store_pending = true;
+	}
+
+	ret = bt_gatt_discover(dm->conn, &dm->discover_params);
+	if (ret) {
+		LOG_ERR("Discover failed, error: %d.", ret);
+		discovery_complete_error(dm, ret);
+	}
+
+	return BT_GATT_ITER_STOP;
+}
+
+struct cache_names_ctx {
+	char names[4][BT_UUID_STR_LEN];
+	size_t cnt;
+};
+
+static int cache_names_cb(const char *key, size_t len, settings_read_cb read_cb,
+			  void *cb_arg, void *param)
+{
+	struct cache_names_ctx *ctx = param;
+
+	if (!key || (len == 0) || (ctx->cnt >= ARRAY_SIZE(ctx->names))) {
+		return 0;
+	}
+
+	strncpy(ctx->names[ctx->cnt], key, sizeof(ctx->names[0]) - 1);
+	ctx->names[ctx->cnt][sizeof(ctx->names[0]) - 1] = '\0';
+	ctx->cnt++;
+
+	return 0;
+}
+
+static void cache_bond_deleted(uint8_t id, const bt_addr_le_t *peer)
+{
+	char subtree[CACHE_SUBTREE_LEN];
+	char key[CACHE_KEY_LEN];
+	struct cache_names_ctx ctx;
+
+	cache_subtree_get(peer, subtree);
+
+	/* Settings must not be deleted while they are loaded. */
+	do {
+		ctx.cnt = 0;
+		(void)settings_load_subtree_direct(subtree, cache_names_cb, &ctx);
+
+		for (size_t i = 0; i < ctx.cnt; i++) {
+			snprintk(key, sizeof(key), "%s/%s", subtree, ctx.names[i]);
+			(void)settings_delete(key);
+		}
+	} while (ctx.cnt == ARRAY_SIZE(ctx.names));
+}
+
+static struct bt_conn_auth_info_cb cache_auth_info_cb = {
+	.bond_deleted = cache_bond_deleted,
+};
+
+/* Read the Database Hash before the discovery if the peer is bonded. */
+static int cache_discover(struct bt_gatt_dm *dm)
+{
+	static bool auth_info_cb_registered;
+	struct bt_conn_info info;
+	int err;
+
+	if (!auth_info_cb_registered) {
+		err = bt_conn_auth_info_cb_register(&cache_auth_info_cb);
+		if (err) {
+			LOG_WRN("Cannot register bond callbacks, error: %d", err);
+		} else {
+			auth_info_cb_registered = true;
+		}
+	}
+
+	err = bt_conn_get_info(dm->conn, &info);
+	if (err || !bt_addr_le_is_bonded(info.id, info.le.dst)) {
+		return bt_gatt_discover(dm->conn, &dm->discover_params);
+	}
+
+	dm->hash_read_params.func = cache_hash_read_cb;
+	dm->hash_read_params.handle_count = 0;
+	dm->hash_read_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+	dm->hash_read_params.by_uuid.start_handle = 0x0001;
+	dm->hash_read_params.by_uuid.end_handle = 0xffff;
+
+	return bt_gatt_read(dm->conn, &dm->hash_read_params);
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 int bt_gatt_dm_start(struct bt_conn *conn,
 		     const struct bt_uuid *svc_uuid,
 		     const struct bt_gatt_dm_cb *cb,
@@ -646,7 +1096,17 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.end_handle = 0xffff;
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 
+#if CONFIG_BT_GATT_DM_CACHE
+	dm->cache_store_pending = false;
+
+	if (svc_uuid) {
+		err = cache_discover(dm);
+	} else {
+		err = bt_gatt_discover(conn, &dm->discover_params);
+	}
+#else
 	err = bt_gatt_discover(conn, &dm->discover_params);
+#endif
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
 		atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
@@ -8,6 +8,7 @@
 #include <errno.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include <zephyr/bluetooth/mesh.h>
 
 #define LOG_LEVEL CONFIG_BT_MESH_RPL_LOG_LEVEL
@@ -18,10 +19,123 @@ LOG_MODULE_REGISTER(bt_mesh_rpl);
 #include <mesh/rpl.h>
 #include <emds/emds.h>
 
-static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
+/* The replay list is an open addressing hash table on the source address with
+ * linear probing. It has more slots than the CONFIG_BT_MESH_CRPL entries it can
+ * hold, so that a probe sequence always ends at an empty slot within a few steps.
+ */
+#define RPL_TABLE_SIZE (CONFIG_BT_MESH_CRPL + CONFIG_BT_MESH_CRPL / 2 + 1)
+
+static struct bt_mesh_rpl replay_list[RPL_TABLE_SIZE];
+static size_t rpl_cnt;
+static bool rpl_cnt_valid;
+
+#if defined(CONFIG_BT_MESH_RPL_FULL_EVICT_LRU)
+/* Time of the last update of each slot, not stored in the EMDS. */
+static uint32_t rpl_used[RPL_TABLE_SIZE];
+static uint32_t rpl_clock;
+#endif
 
 EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
 
+static size_t rpl_hash(uint16_t src)
+{
+	/* Multiplicative hashing spreads consecutive unicast addresses over the table. */
+	return ((uint32_t)src * 2654435761U) % RPL_TABLE_SIZE;
+}
+
+/* Check if b is in the cyclic range (a, c]. */
+static bool rpl_in_range(size_t a, size_t b, size_t c)
+{
+	return (a <= c) ? ((a < b) && (b <= c)) : ((a < b) || (b <= c));
+}
+
+/* Get the slot of the given address, or the empty slot where it should be added. */
+static struct bt_mesh_rpl *rpl_find(uint16_t src)
+{
+	size_t i = rpl_hash(src);
+
+	while (replay_list[i].src && replay_list[i].src != src) {
+		i = (i + 1) % RPL_TABLE_SIZE;
+	}
+
+	return &replay_list[i];
+}
+
+static void rpl_remove(size_t i)
+{
+	size_t j = i;
+
+	(void)memset(&replay_list[i], 0, sizeof(replay_list[i]));
+	rpl_cnt--;
+
+	/* Shift back the following entries of the cluster, so that no entry is
+	 * separated from its hash slot by the new empty slot.
+	 */
+	while (true) {
+		j = (j + 1) % RPL_TABLE_SIZE;
+
+		if (!replay_list[j].src) {
+			return;
+		}
+
+		if (rpl_in_range(i, rpl_hash(replay_list[j].src), j)) {
+			continue;
+		}
+
+		replay_list[i] = replay_list[j];
+#if defined(CONFIG_BT_MESH_RPL_FULL_EVICT_LRU)
+		rpl_used[i] = rpl_used[j];
+#endif
+		(void)memset(&replay_list[j], 0, sizeof(replay_list[j]));
+		i = j;
+	}
+}
+
+/* Count the entries restored from the EMDS on first use. */
+static void rpl_cnt_init(void)
+{
+	if (rpl_cnt_valid) {
+		return;
+	}
+
+	rpl_cnt_valid = true;
+	rpl_cnt = 0;
+
+	for (size_t i = 0; i < RPL_TABLE_SIZE; i++) {
+		if (!replay_list[i].src) {
+			continue;
+		}
+
+		/* Entries stored with a different table layout can not be found. */
+		if (rpl_find(replay_list[i].src) != &replay_list[i] ||
+		    rpl_cnt == CONFIG_BT_MESH_CRPL) {
+			LOG_WRN("Invalid RPL restored, clearing");
+			bt_mesh_rpl_clear();
+			return;
+		}
+
+		rpl_cnt++;
+	}
+}
+
+#if defined(CONFIG_BT_MESH_RPL_FULL_EVICT_LRU)
+static void rpl_evict(void)
+{
+	size_t lru = 0;
+	uint32_t age = 0;
+
+	for (size_t i = 0; i < RPL_TABLE_SIZE; i++) {
+		if (replay_list[i].src && (rpl_clock - rpl_used[i]) >= age) {
+			age = rpl_clock - rpl_used[i];
+			lru = i;
+		}
+	}
+
+	LOG_DBG("Evicting 0x%04x", replay_list[lru].src);
+	rpl_remove(lru);
+}
+#endif
+
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
@@ -32,9 +146,17 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
+	if (!rpl->src) {
+		rpl_cnt++;
+	}
+
 	rpl->src = rx->ctx.addr;
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
+
+#if defined(CONFIG_BT_MESH_RPL_FULL_EVICT_LRU)
+	rpl_used[rpl - replay_list] = ++rpl_clock;
+#endif
 }
 
 /* Check the Replay Protection List for a replay attempt. If non-NULL match
@@ -45,7 +167,7 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match)
 {
-	int i;
+	struct bt_mesh_rpl *rpl;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -57,79 +179,84 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
+	rpl_cnt_init();
+
+	rpl = rpl_find(rx->ctx.addr);
 
-		/* Empty slot */
-		if (!rpl->src) {
-			if (match) {
-				*match = rpl;
-			} else {
-				bt_mesh_rpl_update(rpl, rx);
-			}
+	/* Empty slot */
+	if (!rpl->src) {
+		if (rpl_cnt >= CONFIG_BT_MESH_CRPL) {
+#if defined(CONFIG_BT_MESH_RPL_FULL_EVICT_LRU)
+			rpl_evict();
+			rpl = rpl_find(rx->ctx.addr);
+#else
+			LOG_ERR("RPL is full!");
+			return true;
+#endif
+		}
 
-			return false;
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
-
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
-
-				return false;
-			} else {
-				return true;
-			}
+		return false;
+	}
+
+	/* Existing slot for given address */
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
+
+	if ((!rx->old_iv && rpl->old_iv) ||
+	    rpl->seq < rx->seq) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
 		}
+
+		return false;
 	}
 
-	LOG_ERR("RPL is full!");
 	return true;
 }
 
 void bt_mesh_rpl_clear(void)
 {
 	(void)memset(replay_list, 0, sizeof(replay_list));
+	rpl_cnt = 0;
+	rpl_cnt_valid = true;
 }
 
 void bt_mesh_rpl_reset(void)
 {
-	int shift = 0;
-	int last = 0;
+	size_t start = 0;
+
+	rpl_cnt_init();
+
+	/* Start right after an empty slot, so that entries shifted back on removal
+	 * always come from the slots that are not visited yet.
+	 */
+	while (replay_list[start].src) {
+		start++;
+	}
 
 	/* Discard "old" IV Index entries from RPL and flag
 	 * any other ones (which are valid) as old.
 	 */
-	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
+	for (size_t n = 1; n <= RPL_TABLE_SIZE; n++) {
+		size_t i = (start + n) % RPL_TABLE_SIZE;
 
-		if (rpl->src) {
-			if (rpl->old_iv) {
-				(void)memset(rpl, 0, sizeof(*rpl));
-
-				shift++;
-			} else {
-				rpl->old_iv = true;
-
-				if (shift > 0) {
-					replay_list[i - shift] = *rpl;
-				}
-			}
+		while (replay_list[i].src && replay_list[i].old_iv) {
+			rpl_remove(i);
+		}
 
-			last = i;
+		if (replay_list[i].src) {
+			replay_list[i].old_iv = true;
 		}
 	}
-
-	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
@@ -239,14 +239,9 @@ int sensor_status_encode(struct net_buf_simple *buf,
 			 const struct sensor_value *values)
 {
 	const struct bt_mesh_sensor_type *type = sensor->type;
-	size_t size = 0;
 	int err;
 
-	for (uint32_t i = 0; i < type->channel_count; ++i) {
-		size += type->channels[i].format->size;
-	}
-
-	err = sensor_status_id_encode(buf, size, type->id);
+	err = sensor_status_id_encode(buf, sensor_value_len(type), type->id);
 	if (err) {
 		return err;
 	}
@@ -144,9 +144,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_FOREACH_CB_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_foreach_cb_callback,
-			 BT_CONN_FOREACH_CB_CALLBACK_RPC_CMD,
-			 bt_conn_foreach_cb_callback_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_foreach_cb_callback,
+		   BT_CONN_FOREACH_CB_CALLBACK_RPC_CMD,
+		   bt_conn_foreach_cb_callback_rpc_handler, NULL);
 
 void bt_conn_foreach(int type, void (*func)(struct bt_conn *conn, void *data),
 		     void *data)
@@ -745,8 +745,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_CB_CONNECTED_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_connected_call, BT_CONN_CB_CONNECTED_CALL_RPC_CMD,
-			 bt_conn_cb_connected_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_connected_call, BT_CONN_CB_CONNECTED_CALL_RPC_CMD,
+		   bt_conn_cb_connected_call_rpc_handler, NULL);
 
 static void bt_conn_cb_disconnected_call(struct bt_conn *conn, uint8_t reason)
 {
@@ -788,9 +788,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_CB_DISCONNECTED_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_disconnected_call,
-			 BT_CONN_CB_DISCONNECTED_CALL_RPC_CMD,
-			 bt_conn_cb_disconnected_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_disconnected_call,
+		   BT_CONN_CB_DISCONNECTED_CALL_RPC_CMD,
+		   bt_conn_cb_disconnected_call_rpc_handler, NULL);
 
 static bool bt_conn_cb_le_param_req_call(struct bt_conn *conn, struct bt_le_conn_param *param)
 {
@@ -839,9 +839,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_CB_LE_PARAM_REQ_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_le_param_req_call,
-			 BT_CONN_CB_LE_PARAM_REQ_CALL_RPC_CMD,
-			 bt_conn_cb_le_param_req_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_le_param_req_call,
+		   BT_CONN_CB_LE_PARAM_REQ_CALL_RPC_CMD,
+		   bt_conn_cb_le_param_req_call_rpc_handler, NULL);
 
 static void bt_conn_cb_le_param_updated_call(struct bt_conn *conn, uint16_t interval, uint16_t
 					     latency, uint16_t timeout)
@@ -888,9 +888,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_CB_LE_PARAM_UPDATED_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_le_param_updated_call,
-			 BT_CONN_CB_LE_PARAM_UPDATED_CALL_RPC_CMD,
-			 bt_conn_cb_le_param_updated_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_le_param_updated_call,
+		   BT_CONN_CB_LE_PARAM_UPDATED_CALL_RPC_CMD,
+		   bt_conn_cb_le_param_updated_call_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_SMP)
 static void bt_conn_cb_identity_resolved_call(struct bt_conn *conn, const bt_addr_le_t *rpa, const
@@ -938,9 +938,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_CB_IDENTITY_RESOLVED_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_identity_resolved_call,
-			 BT_CONN_CB_IDENTITY_RESOLVED_CALL_RPC_CMD,
-			 bt_conn_cb_identity_resolved_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_identity_resolved_call,
+		   BT_CONN_CB_IDENTITY_RESOLVED_CALL_RPC_CMD,
+		   bt_conn_cb_identity_resolved_call_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_SMP) */
 
 #if defined(CONFIG_BT_SMP)
@@ -987,9 +987,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_CB_SECURITY_CHANGED_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_security_changed_call,
-			 BT_CONN_CB_SECURITY_CHANGED_CALL_RPC_CMD,
-			 bt_conn_cb_security_changed_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_security_changed_call,
+		   BT_CONN_CB_SECURITY_CHANGED_CALL_RPC_CMD,
+		   bt_conn_cb_security_changed_call_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_SMP) */
 
 #if defined(CONFIG_BT_REMOTE_INFO)
@@ -1036,9 +1036,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_CB_REMOTE_INFO_AVAILABLE_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_remote_info_available_call,
-			 BT_CONN_CB_REMOTE_INFO_AVAILABLE_CALL_RPC_CMD,
-			 bt_conn_cb_remote_info_available_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_remote_info_available_call,
+		   BT_CONN_CB_REMOTE_INFO_AVAILABLE_CALL_RPC_CMD,
+		   bt_conn_cb_remote_info_available_call_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_REMOTE_INFO) */
 
 #if defined(CONFIG_BT_USER_PHY_UPDATE)
@@ -1082,9 +1082,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_CB_LE_PHY_UPDATED_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_le_phy_updated_call,
-			 BT_CONN_CB_LE_PHY_UPDATED_CALL_RPC_CMD,
-			 bt_conn_cb_le_phy_updated_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_le_phy_updated_call,
+		   BT_CONN_CB_LE_PHY_UPDATED_CALL_RPC_CMD,
+		   bt_conn_cb_le_phy_updated_call_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_USER_PHY_UPDATE) */
 
 #if defined(CONFIG_BT_USER_DATA_LEN_UPDATE)
@@ -1129,9 +1129,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_CB_LE_DATA_LEN_UPDATED_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_le_data_len_updated_call,
-			 BT_CONN_CB_LE_DATA_LEN_UPDATED_CALL_RPC_CMD,
-			 bt_conn_cb_le_data_len_updated_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_le_data_len_updated_call,
+		   BT_CONN_CB_LE_DATA_LEN_UPDATED_CALL_RPC_CMD,
+		   bt_conn_cb_le_data_len_updated_call_rpc_handler, NULL);
 
 #endif /* defined(CONFIG_BT_USER_DATA_LEN_UPDATE) */
 
@@ -1391,9 +1391,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_CB_PAIRING_ACCEPT_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_pairing_accept,
-			 BT_RPC_AUTH_CB_PAIRING_ACCEPT_RPC_CMD,
-			 bt_rpc_auth_cb_pairing_accept_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_pairing_accept,
+		   BT_RPC_AUTH_CB_PAIRING_ACCEPT_RPC_CMD,
+		   bt_rpc_auth_cb_pairing_accept_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_SMP_APP_PAIRING_ACCEPT) */
 
 static void bt_rpc_auth_cb_passkey_display_rpc_handler(const struct nrf_rpc_group *group,
@@ -1421,9 +1421,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_CB_PASSKEY_DISPLAY_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_passkey_display,
-			 BT_RPC_AUTH_CB_PASSKEY_DISPLAY_RPC_CMD,
-			 bt_rpc_auth_cb_passkey_display_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_passkey_display,
+		   BT_RPC_AUTH_CB_PASSKEY_DISPLAY_RPC_CMD,
+		   bt_rpc_auth_cb_passkey_display_rpc_handler, NULL);
 
 static void bt_rpc_auth_cb_passkey_entry_rpc_handler(const struct nrf_rpc_group *group,
 						     struct nrf_rpc_cbor_ctx *ctx,
@@ -1448,9 +1448,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_CB_PASSKEY_ENTRY_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_passkey_entry,
-			 BT_RPC_AUTH_CB_PASSKEY_ENTRY_RPC_CMD,
-			 bt_rpc_auth_cb_passkey_entry_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_passkey_entry,
+		   BT_RPC_AUTH_CB_PASSKEY_ENTRY_RPC_CMD,
+		   bt_rpc_auth_cb_passkey_entry_rpc_handler, NULL);
 
 static void bt_rpc_auth_cb_passkey_confirm_rpc_handler(const struct nrf_rpc_group *group,
 						       struct nrf_rpc_cbor_ctx *ctx,
@@ -1477,9 +1477,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_CB_PASSKEY_CONFIRM_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_passkey_confirm,
-			 BT_RPC_AUTH_CB_PASSKEY_CONFIRM_RPC_CMD,
-			 bt_rpc_auth_cb_passkey_confirm_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_passkey_confirm,
+		   BT_RPC_AUTH_CB_PASSKEY_CONFIRM_RPC_CMD,
+		   bt_rpc_auth_cb_passkey_confirm_rpc_handler, NULL);
 
 static void bt_rpc_auth_cb_oob_data_request_rpc_handler(const struct nrf_rpc_group *group,
 							struct nrf_rpc_cbor_ctx *ctx,
@@ -1507,9 +1507,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_CB_OOB_DATA_REQUEST_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_oob_data_request,
-			 BT_RPC_AUTH_CB_OOB_DATA_REQUEST_RPC_CMD,
-			 bt_rpc_auth_cb_oob_data_request_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_oob_data_request,
+		   BT_RPC_AUTH_CB_OOB_DATA_REQUEST_RPC_CMD,
+		   bt_rpc_auth_cb_oob_data_request_rpc_handler, NULL);
 
 static void bt_rpc_auth_cb_cancel_rpc_handler(const struct nrf_rpc_group *group,
 					      struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1533,8 +1533,8 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_CB_CANCEL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_cancel, BT_RPC_AUTH_CB_CANCEL_RPC_CMD,
-			 bt_rpc_auth_cb_cancel_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_cancel, BT_RPC_AUTH_CB_CANCEL_RPC_CMD,
+		   bt_rpc_auth_cb_cancel_rpc_handler, NULL);
 
 static void bt_rpc_auth_cb_pairing_confirm_rpc_handler(const struct nrf_rpc_group *group,
 						       struct nrf_rpc_cbor_ctx *ctx,
@@ -1559,9 +1559,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_CB_PAIRING_CONFIRM_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_pairing_confirm,
-			 BT_RPC_AUTH_CB_PAIRING_CONFIRM_RPC_CMD,
-			 bt_rpc_auth_cb_pairing_confirm_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_cb_pairing_confirm,
+		   BT_RPC_AUTH_CB_PAIRING_CONFIRM_RPC_CMD,
+		   bt_rpc_auth_cb_pairing_confirm_rpc_handler, NULL);
 
 int bt_conn_auth_cb_register_on_remote(uint16_t flags)
 {
@@ -1636,9 +1636,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_INFO_CB_BOND_DELETED_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_info_cb_bond_deleted,
-			 BT_RPC_AUTH_INFO_CB_BOND_DELETED_RPC_CMD,
-			 bt_rpc_auth_info_cb_bond_deleted_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_info_cb_bond_deleted,
+		   BT_RPC_AUTH_INFO_CB_BOND_DELETED_RPC_CMD,
+		   bt_rpc_auth_info_cb_bond_deleted_rpc_handler, NULL);
 
 static void bt_rpc_auth_info_cb_pairing_complete_rpc_handler(const struct nrf_rpc_group *group,
 							     struct nrf_rpc_cbor_ctx *ctx,
@@ -1668,9 +1668,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_INFO_CB_PAIRING_COMPLETE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_info_cb_pairing_complete,
-			 BT_RPC_AUTH_INFO_CB_PAIRING_COMPLETE_RPC_CMD,
-			 bt_rpc_auth_info_cb_pairing_complete_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_info_cb_pairing_complete,
+		   BT_RPC_AUTH_INFO_CB_PAIRING_COMPLETE_RPC_CMD,
+		   bt_rpc_auth_info_cb_pairing_complete_rpc_handler, NULL);
 
 static void bt_rpc_auth_info_cb_pairing_failed_rpc_handler(const struct nrf_rpc_group *group,
 							   struct nrf_rpc_cbor_ctx *ctx,
@@ -1700,9 +1700,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_AUTH_INFO_CB_PAIRING_FAILED_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_info_cb_pairing_failed,
-			 BT_RPC_AUTH_INFO_CB_PAIRING_FAILED_RPC_CMD,
-			 bt_rpc_auth_info_cb_pairing_failed_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_auth_info_cb_pairing_failed,
+		   BT_RPC_AUTH_INFO_CB_PAIRING_FAILED_RPC_CMD,
+		   bt_rpc_auth_info_cb_pairing_failed_rpc_handler, NULL);
 
 int bt_conn_auth_info_cb_register_on_remote(uint16_t flags)
 {
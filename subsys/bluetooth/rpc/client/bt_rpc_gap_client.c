@@ -102,8 +102,8 @@ decoding_error:
 	report_decoding_error(BT_READY_CB_T_CALLBACK_RPC_EVT, handler_data);
 }
 
-NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_ready_cb_t_callback, BT_READY_CB_T_CALLBACK_RPC_EVT,
-			 bt_ready_cb_t_callback_rpc_handler, NULL);
+BT_RPC_EVT_DECODER(bt_rpc_grp, bt_ready_cb_t_callback, BT_READY_CB_T_CALLBACK_RPC_EVT,
+		   bt_ready_cb_t_callback_rpc_handler, NULL);
 
 int bt_enable(bt_ready_cb_t cb)
 {
@@ -531,8 +531,8 @@ decoding_error:
 	report_decoding_error(BT_LE_SCAN_CB_T_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_t_callback, BT_LE_SCAN_CB_T_CALLBACK_RPC_CMD,
-			 bt_le_scan_cb_t_callback_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_t_callback, BT_LE_SCAN_CB_T_CALLBACK_RPC_CMD,
+		   bt_le_scan_cb_t_callback_rpc_handler, NULL);
 
 size_t bt_le_adv_param_sp_size(const struct bt_le_adv_param *data)
 {
@@ -710,9 +710,9 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_CB_SENT_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_cb_sent_callback,
-			 BT_LE_EXT_ADV_CB_SENT_CALLBACK_RPC_CMD,
-			 bt_le_ext_adv_cb_sent_callback_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_cb_sent_callback,
+		   BT_LE_EXT_ADV_CB_SENT_CALLBACK_RPC_CMD,
+		   bt_le_ext_adv_cb_sent_callback_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_CONN)
 void bt_le_ext_adv_connected_info_dec(struct nrf_rpc_cbor_ctx *ctx,
@@ -746,9 +746,9 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_CB_CONNECTED_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_cb_connected_callback,
-			 BT_LE_EXT_ADV_CB_CONNECTED_CALLBACK_RPC_CMD,
-			 bt_le_ext_adv_cb_connected_callback_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_cb_connected_callback,
+		   BT_LE_EXT_ADV_CB_CONNECTED_CALLBACK_RPC_CMD,
+		   bt_le_ext_adv_cb_connected_callback_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_CONN) */
 
 static void bt_le_ext_adv_cb_scanned_callback_rpc_handler(const struct nrf_rpc_group *group,
@@ -779,9 +779,9 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_CB_SCANNED_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_cb_scanned_callback,
-			 BT_LE_EXT_ADV_CB_SCANNED_CALLBACK_RPC_CMD,
-			 bt_le_ext_adv_cb_scanned_callback_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_cb_scanned_callback,
+		   BT_LE_EXT_ADV_CB_SCANNED_CALLBACK_RPC_CMD,
+		   bt_le_ext_adv_cb_scanned_callback_rpc_handler, NULL);
 
 static const size_t bt_le_ext_adv_cb_buf_size = 15;
 
@@ -1472,8 +1472,8 @@ decoding_error:
 	report_decoding_error(PER_ADV_SYNC_CB_SYNCED_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, per_adv_sync_cb_synced, PER_ADV_SYNC_CB_SYNCED_RPC_CMD,
-			 per_adv_sync_cb_synced_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, per_adv_sync_cb_synced, PER_ADV_SYNC_CB_SYNCED_RPC_CMD,
+		   per_adv_sync_cb_synced_rpc_handler, NULL);
 
 void bt_le_per_adv_sync_term_info_dec(struct ser_scratchpad *scratchpad,
 				      struct bt_le_per_adv_sync_term_info *data)
@@ -1539,8 +1539,8 @@ decoding_error:
 	report_decoding_error(PER_ADV_SYNC_CB_TERM_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, per_adv_sync_cb_term, PER_ADV_SYNC_CB_TERM_RPC_CMD,
-			 per_adv_sync_cb_term_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, per_adv_sync_cb_term, PER_ADV_SYNC_CB_TERM_RPC_CMD,
+		   per_adv_sync_cb_term_rpc_handler, NULL);
 
 void per_adv_sync_cb_recv(struct bt_le_per_adv_sync *sync,
 			  const struct bt_le_per_adv_sync_recv_info *info,
@@ -1585,8 +1585,8 @@ decoding_error:
 	report_decoding_error(PER_ADV_SYNC_CB_RECV_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, per_adv_sync_cb_recv, PER_ADV_SYNC_CB_RECV_RPC_CMD,
-			 per_adv_sync_cb_recv_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, per_adv_sync_cb_recv, PER_ADV_SYNC_CB_RECV_RPC_CMD,
+		   per_adv_sync_cb_recv_rpc_handler, NULL);
 
 void per_adv_sync_cb_state_changed(struct bt_le_per_adv_sync *sync,
 				   const struct bt_le_per_adv_sync_state_info *info)
@@ -1623,9 +1623,9 @@ decoding_error:
 	report_decoding_error(PER_ADV_SYNC_CB_STATE_CHANGED_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, per_adv_sync_cb_state_changed,
-			 PER_ADV_SYNC_CB_STATE_CHANGED_RPC_CMD,
-			 per_adv_sync_cb_state_changed_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, per_adv_sync_cb_state_changed,
+		   PER_ADV_SYNC_CB_STATE_CHANGED_RPC_CMD,
+		   per_adv_sync_cb_state_changed_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_PER_ADV_SYNC) */
 
 #if defined(CONFIG_BT_OBSERVER)
@@ -1719,8 +1719,8 @@ decoding_error:
 	report_decoding_error(BT_LE_SCAN_CB_RECV_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_recv, BT_LE_SCAN_CB_RECV_RPC_CMD,
-			 bt_le_scan_cb_recv_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_recv, BT_LE_SCAN_CB_RECV_RPC_CMD,
+		   bt_le_scan_cb_recv_rpc_handler, NULL);
 
 static void bt_le_scan_cb_timeout(void)
 {
@@ -1741,8 +1741,8 @@ static void bt_le_scan_cb_timeout_rpc_handler(const struct nrf_rpc_group *group,
 	ser_rsp_send_void(group);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_timeout, BT_LE_SCAN_CB_TIMEOUT_RPC_CMD,
-			 bt_le_scan_cb_timeout_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_timeout, BT_LE_SCAN_CB_TIMEOUT_RPC_CMD,
+		   bt_le_scan_cb_timeout_rpc_handler, NULL);
 
 static void bt_le_scan_cb_register_on_remote(void)
 {
@@ -2016,9 +2016,9 @@ decoding_error:
 	report_decoding_error(BT_FOREACH_BOND_CB_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_foreach_bond_cb_callback,
-			 BT_FOREACH_BOND_CB_CALLBACK_RPC_CMD,
-			 bt_foreach_bond_cb_callback_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_foreach_bond_cb_callback,
+		   BT_FOREACH_BOND_CB_CALLBACK_RPC_CMD,
+		   bt_foreach_bond_cb_callback_rpc_handler, NULL);
 
 void bt_foreach_bond(uint8_t id, void (*func)(const struct bt_bond_info *info,
 					      void *user_data),
@@ -132,9 +132,9 @@ decoding_error:
 	report_decoding_error(BT_GATT_COMPLETE_FUNC_T_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_complete_func_t_callback,
-			 BT_GATT_COMPLETE_FUNC_T_CALLBACK_RPC_CMD,
-			 bt_gatt_complete_func_t_callback_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_complete_func_t_callback,
+		   BT_GATT_COMPLETE_FUNC_T_CALLBACK_RPC_CMD,
+		   bt_gatt_complete_func_t_callback_rpc_handler, NULL);
 
 static void bt_rpc_gatt_ccc_cfg_changed_cb_rpc_handler(const struct nrf_rpc_group *group,
 						       struct nrf_rpc_cbor_ctx *ctx,
@@ -170,9 +170,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_GATT_CB_CCC_CFG_CHANGED_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_ccc_cfg_changed_cb,
-			 BT_RPC_GATT_CB_CCC_CFG_CHANGED_RPC_CMD,
-			 bt_rpc_gatt_ccc_cfg_changed_cb_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_ccc_cfg_changed_cb,
+		   BT_RPC_GATT_CB_CCC_CFG_CHANGED_RPC_CMD,
+		   bt_rpc_gatt_ccc_cfg_changed_cb_rpc_handler, NULL);
 
 static void bt_rpc_gatt_ccc_cfg_write_cb_rpc_handler(const struct nrf_rpc_group *group,
 						     struct nrf_rpc_cbor_ctx *ctx,
@@ -211,9 +211,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_GATT_CB_CCC_CFG_WRITE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_ccc_cfg_write_cb,
-			 BT_RPC_GATT_CB_CCC_CFG_WRITE_RPC_CMD,
-			 bt_rpc_gatt_ccc_cfg_write_cb_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_ccc_cfg_write_cb,
+		   BT_RPC_GATT_CB_CCC_CFG_WRITE_RPC_CMD,
+		   bt_rpc_gatt_ccc_cfg_write_cb_rpc_handler, NULL);
 
 static void bt_rpc_gatt_ccc_cfg_match_cb_rpc_handler(const struct nrf_rpc_group *group,
 						     struct nrf_rpc_cbor_ctx *ctx,
@@ -250,9 +250,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_GATT_CB_CCC_CFG_MATCH_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_ccc_cfg_match_cb,
-			 BT_RPC_GATT_CB_CCC_CFG_MATCH_RPC_CMD,
-			 bt_rpc_gatt_ccc_cfg_match_cb_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_ccc_cfg_match_cb,
+		   BT_RPC_GATT_CB_CCC_CFG_MATCH_RPC_CMD,
+		   bt_rpc_gatt_ccc_cfg_match_cb_rpc_handler, NULL);
 
 static void bt_rpc_gatt_attr_read_cb_rpc_handler(const struct nrf_rpc_group *group,
 						 struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -308,7 +308,7 @@ decoding_error:
 	report_decoding_error(BT_RPC_GATT_CB_ATTR_READ_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_attr_read_cb, BT_RPC_GATT_CB_ATTR_READ_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_attr_read_cb, BT_RPC_GATT_CB_ATTR_READ_RPC_CMD,
 	bt_rpc_gatt_attr_read_cb_rpc_handler, NULL);
 
 static void bt_rpc_gatt_attr_write_cb_rpc_handler(const struct nrf_rpc_group *group,
@@ -354,7 +354,7 @@ decoding_error:
 	report_decoding_error(BT_RPC_GATT_CB_ATTR_WRITE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_attr_write_cb, BT_RPC_GATT_CB_ATTR_WRITE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_attr_write_cb, BT_RPC_GATT_CB_ATTR_WRITE_RPC_CMD,
 	bt_rpc_gatt_attr_write_cb_rpc_handler, NULL);
 
 static int bt_rpc_gatt_start_service(uint8_t service_index, size_t attr_count)
@@ -886,9 +886,9 @@ decoding_error:
 	report_decoding_error(BT_GATT_INDICATE_FUNC_T_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_indicate_func_t_callback,
-			 BT_GATT_INDICATE_FUNC_T_CALLBACK_RPC_CMD,
-			 bt_gatt_indicate_func_t_callback_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_indicate_func_t_callback,
+		   BT_GATT_INDICATE_FUNC_T_CALLBACK_RPC_CMD,
+		   bt_gatt_indicate_func_t_callback_rpc_handler, NULL);
 
 static void bt_gatt_indicate_params_destroy_t_callback_rpc_handler(
 						const struct nrf_rpc_group *group,
@@ -913,9 +913,9 @@ decoding_error:
 	report_decoding_error(BT_GATT_INDICATE_PARAMS_DESTROY_T_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_indicate_params_destroy_t_callback,
-			 BT_GATT_INDICATE_PARAMS_DESTROY_T_CALLBACK_RPC_CMD,
-			 bt_gatt_indicate_params_destroy_t_callback_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_indicate_params_destroy_t_callback,
+		   BT_GATT_INDICATE_PARAMS_DESTROY_T_CALLBACK_RPC_CMD,
+		   bt_gatt_indicate_params_destroy_t_callback_rpc_handler, NULL);
 
 bool bt_gatt_is_subscribed(struct bt_conn *conn,
 			   const struct bt_gatt_attr *attr, uint16_t ccc_value)
@@ -980,7 +980,7 @@ decoding_error:
 	report_decoding_error(BT_GATT_EXCHANGE_MTU_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_exchange_mtu_callback,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_exchange_mtu_callback,
 	BT_GATT_EXCHANGE_MTU_CALLBACK_RPC_CMD, bt_gatt_exchange_mtu_callback_rpc_handler, NULL);
 
 int bt_gatt_exchange_mtu(struct bt_conn *conn,
@@ -1138,9 +1138,9 @@ decoding_error:
 	report_decoding_error(BT_GATT_CB_ATT_MTU_UPDATE_CALL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_cb_att_mtu_update_call,
-			 BT_GATT_CB_ATT_MTU_UPDATE_CALL_RPC_CMD,
-			 bt_gatt_cb_att_mtu_update_call_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_cb_att_mtu_update_call,
+		   BT_GATT_CB_ATT_MTU_UPDATE_CALL_RPC_CMD,
+		   bt_gatt_cb_att_mtu_update_call_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_GATT_CLIENT)
 
@@ -1246,7 +1246,7 @@ decoding_error:
 	report_decoding_error(BT_GATT_DISCOVER_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_discover_callback, BT_GATT_DISCOVER_CALLBACK_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_discover_callback, BT_GATT_DISCOVER_CALLBACK_RPC_CMD,
 	bt_gatt_discover_callback_rpc_handler, NULL);
 
 static size_t bt_gatt_read_params_buf_size(const struct bt_gatt_read_params *data)
@@ -1333,7 +1333,7 @@ decoding_error:
 	report_decoding_error(BT_GATT_READ_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_read_callback, BT_GATT_READ_CALLBACK_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_read_callback, BT_GATT_READ_CALLBACK_RPC_CMD,
 	bt_gatt_read_callback_rpc_handler, NULL);
 
 static size_t bt_gatt_write_params_buf_size(const struct bt_gatt_write_params *data)
@@ -1391,7 +1391,7 @@ decoding_error:
 	report_decoding_error(BT_GATT_WRITE_CALLBACK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_write_callback, BT_GATT_WRITE_CALLBACK_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_write_callback, BT_GATT_WRITE_CALLBACK_RPC_CMD,
 	bt_gatt_write_callback_rpc_handler, NULL);
 
 int bt_gatt_write_without_response_cb(struct bt_conn *conn, uint16_t handle,
@@ -1584,7 +1584,7 @@ decoding_error:
 	report_decoding_error(BT_GATT_SUBSCRIBE_PARAMS_NOTIFY_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_subscribe_params_notify,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_subscribe_params_notify,
 	BT_GATT_SUBSCRIBE_PARAMS_NOTIFY_RPC_CMD, bt_gatt_subscribe_params_notify_rpc_handler, NULL);
 
 static void bt_gatt_subscribe_params_write_rpc_handler(const struct nrf_rpc_group *group,
@@ -1629,7 +1629,7 @@ decoding_error:
 	report_decoding_error(BT_GATT_SUBSCRIBE_PARAMS_WRITE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_subscribe_params_write,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_subscribe_params_write,
 	BT_GATT_SUBSCRIBE_PARAMS_WRITE_RPC_CMD, bt_gatt_subscribe_params_write_rpc_handler, NULL);
 
 #endif /* CONFIG_BT_GATT_CLIENT */
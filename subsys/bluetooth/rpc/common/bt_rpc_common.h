@@ -20,6 +20,7 @@
 
 #include <nrf_rpc_cbor.h>
 #include <cbkproxy.h>
+#include <bt_rpc_stats.h>
 
 #define BT_RPC_SIZE_OF_FIELD(structure, field) (sizeof(((structure *)NULL)->field))
 
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/atomic.h>
+
+#include "bt_rpc_stats.h"
+
+/* Upper bounds of the handling time histogram buckets in microseconds. */
+static const uint32_t time_bounds[] = {50, 100, 200, 500, 1000, 2000};
+/* Upper bounds of the data size histogram buckets in bytes. */
+static const uint32_t size_bounds[] = {16, 32, 64, 128, 256};
+
+struct cmd_stats {
+	bool used;
+	bool evt;
+	uint8_t id;
+	uint32_t cnt;
+	uint32_t bytes;
+	uint32_t time_max;
+	uint32_t time_hist[ARRAY_SIZE(time_bounds) + 1];
+	uint32_t size_hist[ARRAY_SIZE(size_bounds) + 1];
+};
+
+static struct cmd_stats cmd_stats[CONFIG_BT_RPC_STATS_CMD_MAX];
+static struct k_spinlock lock;
+static uint32_t untracked_cnt;
+static atomic_t copied_bytes;
+static atomic_t copied_cnt;
+static atomic_t in_place_bytes;
+static atomic_t in_place_cnt;
+
+static size_t bucket_get(const uint32_t *bounds, size_t bounds_cnt, uint32_t value)
+{
+	size_t i;
+
+	for (i = 0; i < bounds_cnt; i++) {
+		if (value < bounds[i]) {
+			break;
+		}
+	}
+
+	return i;
+}
+
+static struct cmd_stats *cmd_stats_get(uint8_t id, bool evt)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cmd_stats); i++) {
+		if (!cmd_stats[i].used) {
+			cmd_stats[i].used = true;
+			cmd_stats[i].evt = evt;
+			cmd_stats[i].id = id;
+			return &cmd_stats[i];
+		}
+
+		if (cmd_stats[i].id == id && cmd_stats[i].evt == evt) {
+			return &cmd_stats[i];
+		}
+	}
+
+	return NULL;
+}
+
+void bt_rpc_stats_handle(uint8_t id, bool evt, nrf_rpc_cbor_handler_t handler,
+			 const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
+			 void *handler_data)
+{
+	/* The packet is released by the handler, take its size before. */
+	size_t len = ctx->zs->payload_end - ctx->zs->payload;
+	uint32_t start = k_cycle_get_32();
+	uint32_t time;
+	k_spinlock_key_t key;
+	struct cmd_stats *stats;
+
+	handler(group, ctx, handler_data);
+
+	time = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	key = k_spin_lock(&lock);
+
+	stats = cmd_stats_get(id, evt);
+	if (stats) {
+		stats->cnt++;
+		stats->bytes += len;
+		stats->time_max = MAX(stats->time_max, time);
+		stats->time_hist[bucket_get(time_bounds, ARRAY_SIZE(time_bounds), time)]++;
+		stats->size_hist[bucket_get(size_bounds, ARRAY_SIZE(size_bounds), len)]++;
+	} else {
+		untracked_cnt++;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void bt_rpc_stats_copy_record(size_t len)
+{
+	atomic_inc(&copied_cnt);
+	atomic_add(&copied_bytes, len);
+}
+
+void bt_rpc_stats_in_place_record(size_t len)
+{
+	atomic_inc(&in_place_cnt);
+	atomic_add(&in_place_bytes, len);
+}
+
+void bt_rpc_stats_buffers_get(struct bt_rpc_stats_buffers *buffers)
+{
+	buffers->copied_cnt = atomic_get(&copied_cnt);
+	buffers->copied_bytes = atomic_get(&copied_bytes);
+	buffers->in_place_cnt = atomic_get(&in_place_cnt);
+	buffers->in_place_bytes = atomic_get(&in_place_bytes);
+}
+
+#if defined(CONFIG_SHELL)
+static void hist_print(const struct shell *shell, const char *name, const uint32_t *bounds,
+		       size_t bounds_cnt, const uint32_t *hist)
+{
+	char line[128];
+	int pos;
+
+	pos = snprintk(line, sizeof(line), "\t%s:", name);
+
+	for (size_t i = 0; (i <= bounds_cnt) && (pos < sizeof(line)); i++) {
+		if (i < bounds_cnt) {
+			pos += snprintk(&line[pos], sizeof(line) - pos, " <%u: %u", bounds[i],
+					hist[i]);
+		} else {
+			pos += snprintk(&line[pos], sizeof(line) - pos, " more: %u", hist[i]);
+		}
+	}
+
+	shell_print(shell, "%s", line);
+}
+
+static int cmd_stats_print(const struct shell *shell, size_t argc, char **argv)
+{
+	struct cmd_stats stats;
+	struct bt_rpc_stats_buffers buffers;
+
+	bt_rpc_stats_buffers_get(&buffers);
+
+	shell_print(shell, "Copied: %u buffers, %u bytes", buffers.copied_cnt,
+		    buffers.copied_bytes);
+	shell_print(shell, "In place: %u buffers, %u bytes", buffers.in_place_cnt,
+		    buffers.in_place_bytes);
+	shell_print(shell, "Not tracked: %u calls", untracked_cnt);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cmd_stats); i++) {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		stats = cmd_stats[i];
+		k_spin_unlock(&lock, key);
+
+		if (!stats.used) {
+			break;
+		}
+
+		shell_print(shell, "%s %u: %u calls, %u bytes, max time %u us",
+			    stats.evt ? "Event" : "Command", stats.id, stats.cnt, stats.bytes,
+			    stats.time_max);
+		hist_print(shell, "time [us]", time_bounds, ARRAY_SIZE(time_bounds),
+			   stats.time_hist);
+		hist_print(shell, "size [B]", size_bounds, ARRAY_SIZE(size_bounds),
+			   stats.size_hist);
+	}
+
+	return 0;
+}
+
+SHELL_CMD_REGISTER(bt_rpc_stats, NULL, "Print Bluetooth RPC statistics", cmd_stats_print);
+#endif /* defined(CONFIG_SHELL) */
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ * @defgroup bt_rpc_stats Bluetooth RPC statistics
+ * @{
+ * @brief Statistics of the Bluetooth RPC commands.
+ */
+
+#ifndef BT_RPC_STATS_H_
+#define BT_RPC_STATS_H_
+
+#include <zephyr/kernel.h>
+#include <nrf_rpc_cbor.h>
+
+/** @brief Statistics of the data buffers decoded from the received packets. */
+struct bt_rpc_stats_buffers {
+	/** Number of buffers copied from the received packets. */
+	uint32_t copied_cnt;
+
+	/** Number of bytes copied from the received packets. */
+	uint32_t copied_bytes;
+
+	/** Number of buffers referenced in place in the received packets. */
+	uint32_t in_place_cnt;
+
+	/** Number of bytes referenced in place in the received packets. */
+	uint32_t in_place_bytes;
+};
+
+#if defined(CONFIG_BT_RPC_STATS)
+
+/** @brief Handle a received command or event and record its statistics.
+ *
+ * @param[in] id Command or event ID.
+ * @param[in] evt True for an event.
+ * @param[in] handler Decoder of the command or event.
+ * @param[in] group nRF RPC group.
+ * @param[in,out] ctx CBOR decoding context.
+ * @param[in] handler_data Handler data.
+ */
+void bt_rpc_stats_handle(uint8_t id, bool evt, nrf_rpc_cbor_handler_t handler,
+			 const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
+			 void *handler_data);
+
+#define _BT_RPC_STATS_DECODER(_decoder, _group, _name, _id, _evt, _handler, _data)	\
+	static void _name##_stats_handler(const struct nrf_rpc_group *group,		\
+					  struct nrf_rpc_cbor_ctx *ctx,			\
+					  void *handler_data)				\
+	{										\
+		bt_rpc_stats_handle(_id, _evt, _handler, group, ctx, handler_data);	\
+	}										\
+	_decoder(_group, _name, _id, _name##_stats_handler, _data)
+
+/** @brief Register a command decoder, recording the statistics of the command.
+ *
+ * Takes the same parameters as NRF_RPC_CBOR_CMD_DECODER.
+ */
+#define BT_RPC_CMD_DECODER(_group, _name, _cmd, _handler, _data)			\
+	_BT_RPC_STATS_DECODER(NRF_RPC_CBOR_CMD_DECODER, _group, _name, _cmd, false,	\
+			      _handler, _data)
+
+/** @brief Register an event decoder, recording the statistics of the event.
+ *
+ * Takes the same parameters as NRF_RPC_CBOR_EVT_DECODER.
+ */
+#define BT_RPC_EVT_DECODER(_group, _name, _evt, _handler, _data)			\
+	_BT_RPC_STATS_DECODER(NRF_RPC_CBOR_EVT_DECODER, _group, _name, _evt, true,	\
+			      _handler, _data)
+
+/** @brief Record data copied from a received packet.
+ *
+ * @param[in] len Number of bytes copied.
+ */
+void bt_rpc_stats_copy_record(size_t len);
+
+/** @brief Record data referenced in place in a received packet.
+ *
+ * @param[in] len Number of bytes referenced.
+ */
+void bt_rpc_stats_in_place_record(size_t len);
+
+/** @brief Get the statistics of the decoded data buffers.
+ *
+ * @param[out] buffers Statistics of the decoded data buffers.
+ */
+void bt_rpc_stats_buffers_get(struct bt_rpc_stats_buffers *buffers);
+
+#else
+
+#define BT_RPC_CMD_DECODER(_group, _name, _cmd, _handler, _data) \
+	NRF_RPC_CBOR_CMD_DECODER(_group, _name, _cmd, _handler, _data)
+
+#define BT_RPC_EVT_DECODER(_group, _name, _evt, _handler, _data) \
+	NRF_RPC_CBOR_EVT_DECODER(_group, _name, _evt, _handler, _data)
+
+static inline void bt_rpc_stats_copy_record(size_t len) {}
+
+static inline void bt_rpc_stats_in_place_record(size_t len) {}
+
+#endif /* defined(CONFIG_BT_RPC_STATS) */
+
+/**
+ * @}
+ */
+
+#endif /* BT_RPC_STATS_H_ */
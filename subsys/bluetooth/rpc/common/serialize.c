@@ -7,6 +7,7 @@
 #include <string.h>
 #include "cbkproxy.h"
 #include "serialize.h"
+#include "bt_rpc_stats.h"
 
 static inline bool is_decoder_invalid(const struct nrf_rpc_cbor_ctx *ctx)
 {
@@ -358,6 +359,7 @@ void *ser_decode_buffer_into_scratchpad(struct ser_scratchpad *scratchpad, size_
 	}
 
 	memcpy(result, zst.value, zst.len);
+	bt_rpc_stats_copy_record(zst.len);
 
 	if (len != NULL) {
 		*len = zst.len;
@@ -370,6 +372,27 @@ error_exit:
 	return NULL;
 }
 
+void *ser_decode_buffer_in_place(struct ser_scratchpad *scratchpad, size_t *len)
+{
+	const void *result;
+	size_t size = 0;
+
+	if (!IS_ENABLED(CONFIG_BT_RPC_ADV_DATA_IN_PLACE)) {
+		return ser_decode_buffer_into_scratchpad(scratchpad, len);
+	}
+
+	result = ser_decode_buffer_ptr_and_size(scratchpad->ctx, &size);
+	if (result) {
+		bt_rpc_stats_in_place_record(size);
+	}
+
+	if (len != NULL) {
+		*len = size;
+	}
+
+	return (void *)result;
+}
+
 void *ser_decode_callback_call(struct nrf_rpc_cbor_ctx *ctx)
 {
 	int slot = ser_decode_uint(ctx);
@@ -425,6 +448,22 @@ bool ser_decoding_done_and_check(const struct nrf_rpc_group *group, struct nrf_r
 	return !is_decoder_invalid(ctx);
 }
 
+bool ser_decoding_done_and_keep(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx)
+{
+	if (!IS_ENABLED(CONFIG_BT_RPC_ADV_DATA_IN_PLACE) || is_decoder_invalid(ctx)) {
+		return ser_decoding_done_and_check(group, ctx);
+	}
+
+	return true;
+}
+
+void ser_decoding_release(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx)
+{
+	if (IS_ENABLED(CONFIG_BT_RPC_ADV_DATA_IN_PLACE)) {
+		nrf_rpc_cbor_decoding_done(group, ctx);
+	}
+}
+
 void ser_rsp_decode_i32(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 			void *handler_data)
 {
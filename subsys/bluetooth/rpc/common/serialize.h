@@ -264,6 +264,23 @@ const void *ser_decode_buffer_ptr_and_size(struct nrf_rpc_cbor_ctx *ctx, size_t
  */
 void *ser_decode_buffer_into_scratchpad(struct ser_scratchpad *scratchpad, size_t *len);
 
+/** @brief Decode buffer in place or into a scratchpad.
+ *
+ * If @kconfig{CONFIG_BT_RPC_ADV_DATA_IN_PLACE} is enabled, the returned pointer refers to
+ * the received packet and is valid until @ref ser_decoding_release is called.
+ * Otherwise, the buffer is decoded into the scratchpad.
+ *
+ * No other packets are received until the packet is released. Use this function
+ * only when the decoded buffer is passed to a call that cannot wait for another
+ * Bluetooth RPC command, which excludes application callbacks.
+ *
+ * @param[in] scratchpad Pointer to the scratchpad.
+ * @param[out] len Length of the decoded buffer, can be NULL.
+ *
+ * @retval Pointer to the decoded buffer.
+ */
+void *ser_decode_buffer_in_place(struct ser_scratchpad *scratchpad, size_t *len);
+
 /** @brief Decode a callback.
  *
  * This function will use callback proxy module to associate decoded integer
@@ -318,6 +335,28 @@ bool ser_decode_valid(const struct nrf_rpc_cbor_ctx *ctx);
  */
 bool ser_decoding_done_and_check(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx);
 
+/** @brief Signalize that decoding is done, but keep the received packet.
+ *
+ * Use this function instead of @ref ser_decoding_done_and_check when the decoded data
+ * is referenced in place by @ref ser_decode_buffer_in_place. If the decoding finished
+ * with success, call @ref ser_decoding_release after the decoded data is used.
+ * Otherwise, the packet is already released.
+ *
+ * @param[in] group nRF RPC group.
+ * @param[in,out] ctx CBOR decoding context.
+ *
+ * @retval True if decoding finshed with success.
+ *         Otherwise, false will be returned.
+ */
+bool ser_decoding_done_and_keep(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx);
+
+/** @brief Release the received packet kept by @ref ser_decoding_done_and_keep.
+ *
+ * @param[in] group nRF RPC group.
+ * @param[in,out] ctx CBOR decoding context.
+ */
+void ser_decoding_release(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx);
+
 /** @brief Decode a command response as a boolean value.
  *
  * @param[in] group nRF RPC group.
@@ -87,8 +87,8 @@ decoding_error:
 }
 
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_remote_update_ref, BT_CONN_REMOTE_UPDATE_REF_RPC_CMD,
-			 bt_conn_remote_update_ref_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_remote_update_ref, BT_CONN_REMOTE_UPDATE_REF_RPC_CMD,
+		   bt_conn_remote_update_ref_rpc_handler, NULL);
 
 static inline void bt_conn_foreach_cb_callback(struct bt_conn *conn, void *data,
 					       uint32_t callback_slot)
@@ -133,8 +133,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_FOREACH_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_foreach, BT_CONN_FOREACH_RPC_CMD,
-			 bt_conn_foreach_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_foreach, BT_CONN_FOREACH_RPC_CMD,
+		   bt_conn_foreach_rpc_handler, NULL);
 
 
 static void bt_conn_lookup_addr_le_rpc_handler(const struct nrf_rpc_group *group,
@@ -170,8 +170,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_LOOKUP_ADDR_LE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_lookup_addr_le, BT_CONN_LOOKUP_ADDR_LE_RPC_CMD,
-			 bt_conn_lookup_addr_le_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_lookup_addr_le, BT_CONN_LOOKUP_ADDR_LE_RPC_CMD,
+		   bt_conn_lookup_addr_le_rpc_handler, NULL);
 
 static void bt_conn_get_dst_out_rpc_handler(const struct nrf_rpc_group *group,
 					    struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -209,8 +209,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_GET_DST_OUT_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_get_dst_out, BT_CONN_GET_DST_OUT_RPC_CMD,
-			 bt_conn_get_dst_out_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_get_dst_out, BT_CONN_GET_DST_OUT_RPC_CMD,
+		   bt_conn_get_dst_out_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_USER_PHY_UPDATE)
 static const size_t bt_conn_le_phy_info_buf_size =
@@ -329,8 +329,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_GET_INFO_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_get_info, BT_CONN_GET_INFO_RPC_CMD,
-			 bt_conn_get_info_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_get_info, BT_CONN_GET_INFO_RPC_CMD,
+		   bt_conn_get_info_rpc_handler, NULL);
 
 
 static const size_t bt_conn_remote_info_buf_size =
@@ -392,8 +392,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_GET_REMOTE_INFO_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_get_remote_info, BT_CONN_GET_REMOTE_INFO_RPC_CMD,
-			 bt_conn_get_remote_info_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_get_remote_info, BT_CONN_GET_REMOTE_INFO_RPC_CMD,
+		   bt_conn_get_remote_info_rpc_handler, NULL);
 
 void bt_le_conn_param_enc(struct nrf_rpc_cbor_ctx *encoder,
 	const struct bt_le_conn_param *data)
@@ -436,8 +436,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_LE_PARAM_UPDATE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_le_param_update, BT_CONN_LE_PARAM_UPDATE_RPC_CMD,
-			 bt_conn_le_param_update_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_le_param_update, BT_CONN_LE_PARAM_UPDATE_RPC_CMD,
+		   bt_conn_le_param_update_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_USER_DATA_LEN_UPDATE)
 void bt_conn_le_data_len_param_dec(struct nrf_rpc_cbor_ctx *ctx,
@@ -470,8 +470,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_LE_DATA_LEN_UPDATE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_le_data_len_update, BT_CONN_LE_DATA_LEN_UPDATE_RPC_CMD,
-			 bt_conn_le_data_len_update_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_le_data_len_update, BT_CONN_LE_DATA_LEN_UPDATE_RPC_CMD,
+		   bt_conn_le_data_len_update_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_USER_DATA_LEN_UPDATE) */
 
 #if defined(CONFIG_BT_USER_PHY_UPDATE)
@@ -505,8 +505,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_LE_PHY_UPDATE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_le_phy_update, BT_CONN_LE_PHY_UPDATE_RPC_CMD,
-			 bt_conn_le_phy_update_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_le_phy_update, BT_CONN_LE_PHY_UPDATE_RPC_CMD,
+		   bt_conn_le_phy_update_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_USER_PHY_UPDATE) */
 
 static void bt_conn_disconnect_rpc_handler(const struct nrf_rpc_group *group,
@@ -532,8 +532,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_DISCONNECT_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_disconnect, BT_CONN_DISCONNECT_RPC_CMD,
-			 bt_conn_disconnect_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_disconnect, BT_CONN_DISCONNECT_RPC_CMD,
+		   bt_conn_disconnect_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_CENTRAL)
 void bt_conn_le_create_param_dec(struct nrf_rpc_cbor_ctx *ctx, struct bt_conn_le_create_param *data)
@@ -584,8 +584,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_LE_CREATE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_le_create, BT_CONN_LE_CREATE_RPC_CMD,
-			 bt_conn_le_create_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_le_create, BT_CONN_LE_CREATE_RPC_CMD,
+		   bt_conn_le_create_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_FILTER_ACCEPT_LIST)
 static void bt_conn_le_create_auto_rpc_handler(const struct nrf_rpc_group *group,
@@ -611,8 +611,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_LE_CREATE_AUTO_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_le_create_auto, BT_CONN_LE_CREATE_AUTO_RPC_CMD,
-			 bt_conn_le_create_auto_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_le_create_auto, BT_CONN_LE_CREATE_AUTO_RPC_CMD,
+		   bt_conn_le_create_auto_rpc_handler, NULL);
 
 static void bt_conn_create_auto_stop_rpc_handler(const struct nrf_rpc_group *group,
 						 struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -626,8 +626,8 @@ static void bt_conn_create_auto_stop_rpc_handler(const struct nrf_rpc_group *gro
 	ser_rsp_send_int(group, result);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_create_auto_stop, BT_CONN_CREATE_AUTO_STOP_RPC_CMD,
-			 bt_conn_create_auto_stop_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_create_auto_stop, BT_CONN_CREATE_AUTO_STOP_RPC_CMD,
+		   bt_conn_create_auto_stop_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_FILTER_ACCEPT_LIST) */
 
 #if !defined(CONFIG_BT_FILTER_ACCEPT_LIST)
@@ -661,8 +661,8 @@ decoding_error:
 	report_decoding_error(BT_LE_SET_AUTO_CONN_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_set_auto_conn, BT_LE_SET_AUTO_CONN_RPC_CMD,
-			 bt_le_set_auto_conn_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_set_auto_conn, BT_LE_SET_AUTO_CONN_RPC_CMD,
+		   bt_le_set_auto_conn_rpc_handler, NULL);
 #endif  /* !defined(CONFIG_BT_FILTER_ACCEPT_LIST) */
 #endif  /* defined(CONFIG_BT_CENTRAL) */
 
@@ -690,8 +690,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_SET_SECURITY_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_set_security, BT_CONN_SET_SECURITY_RPC_CMD,
-			 bt_conn_set_security_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_set_security, BT_CONN_SET_SECURITY_RPC_CMD,
+		   bt_conn_set_security_rpc_handler, NULL);
 
 static void bt_conn_get_security_rpc_handler(const struct nrf_rpc_group *group,
 					     struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -723,8 +723,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_GET_SECURITY_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_get_security, BT_CONN_GET_SECURITY_RPC_CMD,
-			 bt_conn_get_security_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_get_security, BT_CONN_GET_SECURITY_RPC_CMD,
+		   bt_conn_get_security_rpc_handler, NULL);
 
 static void bt_conn_enc_key_size_rpc_handler(const struct nrf_rpc_group *group,
 					     struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -747,8 +747,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_ENC_KEY_SIZE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_enc_key_size, BT_CONN_ENC_KEY_SIZE_RPC_CMD,
-			 bt_conn_enc_key_size_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_enc_key_size, BT_CONN_ENC_KEY_SIZE_RPC_CMD,
+		   bt_conn_enc_key_size_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_SMP) */
 
 static void bt_conn_cb_connected_call(struct bt_conn *conn, uint8_t err)
@@ -935,9 +935,9 @@ static void bt_conn_cb_register_on_remote_rpc_handler(const struct nrf_rpc_group
 	ser_rsp_send_void(group);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_cb_register_on_remote,
-			 BT_CONN_CB_REGISTER_ON_REMOTE_RPC_CMD,
-			 bt_conn_cb_register_on_remote_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_cb_register_on_remote,
+		   BT_CONN_CB_REGISTER_ON_REMOTE_RPC_CMD,
+		   bt_conn_cb_register_on_remote_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_SMP)
 static void bt_set_bondable_rpc_handler(const struct nrf_rpc_group *group,
@@ -960,8 +960,8 @@ decoding_error:
 	report_decoding_error(BT_SET_BONDABLE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_set_bondable, BT_SET_BONDABLE_RPC_CMD,
-			 bt_set_bondable_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_set_bondable, BT_SET_BONDABLE_RPC_CMD,
+		   bt_set_bondable_rpc_handler, NULL);
 
 
 static void bt_set_oob_data_flag_rpc_handler(const struct nrf_rpc_group *group,
@@ -984,8 +984,8 @@ decoding_error:
 	report_decoding_error(BT_SET_OOB_DATA_FLAG_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_set_oob_data_flag, BT_SET_OOB_DATA_FLAG_RPC_CMD,
-			 bt_set_oob_data_flag_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_set_oob_data_flag, BT_SET_OOB_DATA_FLAG_RPC_CMD,
+		   bt_set_oob_data_flag_rpc_handler, NULL);
 
 #if !defined(CONFIG_BT_SMP_SC_PAIR_ONLY)
 static void bt_le_oob_set_legacy_tk_rpc_handler(const struct nrf_rpc_group *group,
@@ -1014,8 +1014,8 @@ decoding_error:
 	report_decoding_error(BT_LE_OOB_SET_LEGACY_TK_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_oob_set_legacy_tk, BT_LE_OOB_SET_LEGACY_TK_RPC_CMD,
-			 bt_le_oob_set_legacy_tk_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_oob_set_legacy_tk, BT_LE_OOB_SET_LEGACY_TK_RPC_CMD,
+		   bt_le_oob_set_legacy_tk_rpc_handler, NULL);
 #endif /* !defined(CONFIG_BT_SMP_SC_PAIR_ONLY) */
 
 #if !defined(CONFIG_BT_SMP_OOB_LEGACY_PAIR_ONLY)
@@ -1078,8 +1078,8 @@ decoding_error:
 	report_decoding_error(BT_LE_OOB_SET_SC_DATA_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_oob_set_sc_data, BT_LE_OOB_SET_SC_DATA_RPC_CMD,
-			 bt_le_oob_set_sc_data_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_oob_set_sc_data, BT_LE_OOB_SET_SC_DATA_RPC_CMD,
+		   bt_le_oob_set_sc_data_rpc_handler, NULL);
 
 static void bt_le_oob_get_sc_data_rpc_handler(const struct nrf_rpc_group *group,
 					      struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1129,8 +1129,8 @@ decoding_error:
 	report_decoding_error(BT_LE_OOB_GET_SC_DATA_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_oob_get_sc_data, BT_LE_OOB_GET_SC_DATA_RPC_CMD,
-			 bt_le_oob_get_sc_data_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_oob_get_sc_data, BT_LE_OOB_GET_SC_DATA_RPC_CMD,
+		   bt_le_oob_get_sc_data_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_SMP) && !defined(CONFIG_BT_SMP_OOB_LEGACY_PAIR_ONLY) */
 
 #if defined(CONFIG_BT_FIXED_PASSKEY)
@@ -1155,8 +1155,8 @@ decoding_error:
 	report_decoding_error(BT_PASSKEY_SET_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_passkey_set, BT_PASSKEY_SET_RPC_CMD,
-			 bt_passkey_set_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_passkey_set, BT_PASSKEY_SET_RPC_CMD,
+		   bt_passkey_set_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_FIXED_PASSKEY) */
 
 static struct bt_conn_auth_cb remote_auth_cb;
@@ -1341,9 +1341,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_AUTH_CB_REGISTER_ON_REMOTE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_auth_cb_register_on_remote,
-			 BT_CONN_AUTH_CB_REGISTER_ON_REMOTE_RPC_CMD,
-			 bt_conn_auth_cb_register_on_remote_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_auth_cb_register_on_remote,
+		   BT_CONN_AUTH_CB_REGISTER_ON_REMOTE_RPC_CMD,
+		   bt_conn_auth_cb_register_on_remote_rpc_handler, NULL);
 
 static struct bt_conn_auth_info_cb remote_auth_info_cb;
 
@@ -1429,9 +1429,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_AUTH_INFO_CB_REGISTER_ON_REMOTE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_auth_info_cb_register_on_remote,
-			 BT_CONN_AUTH_INFO_CB_REGISTER_ON_REMOTE_RPC_CMD,
-			 bt_conn_auth_info_cb_register_on_remote_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_auth_info_cb_register_on_remote,
+		   BT_CONN_AUTH_INFO_CB_REGISTER_ON_REMOTE_RPC_CMD,
+		   bt_conn_auth_info_cb_register_on_remote_rpc_handler, NULL);
 
 static void bt_conn_auth_info_cb_unregister_on_remote_rpc_handler(const struct nrf_rpc_group *group,
 								  struct nrf_rpc_cbor_ctx *ctx,
@@ -1453,9 +1453,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_AUTH_INFO_CB_UNREGISTER_ON_REMOTE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_auth_info_cb_unregister_on_remote,
-			 BT_CONN_AUTH_INFO_CB_UNREGISTER_ON_REMOTE_RPC_CMD,
-			 bt_conn_auth_info_cb_unregister_on_remote_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_auth_info_cb_unregister_on_remote,
+		   BT_CONN_AUTH_INFO_CB_UNREGISTER_ON_REMOTE_RPC_CMD,
+		   bt_conn_auth_info_cb_unregister_on_remote_rpc_handler, NULL);
 
 static void bt_conn_auth_passkey_entry_rpc_handler(const struct nrf_rpc_group *group,
 						   struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1480,8 +1480,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_AUTH_PASSKEY_ENTRY_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_auth_passkey_entry, BT_CONN_AUTH_PASSKEY_ENTRY_RPC_CMD,
-			 bt_conn_auth_passkey_entry_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_auth_passkey_entry, BT_CONN_AUTH_PASSKEY_ENTRY_RPC_CMD,
+		   bt_conn_auth_passkey_entry_rpc_handler, NULL);
 
 static void bt_conn_auth_cancel_rpc_handler(const struct nrf_rpc_group *group,
 					    struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1504,8 +1504,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_AUTH_CANCEL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_auth_cancel, BT_CONN_AUTH_CANCEL_RPC_CMD,
-			 bt_conn_auth_cancel_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_auth_cancel, BT_CONN_AUTH_CANCEL_RPC_CMD,
+		   bt_conn_auth_cancel_rpc_handler, NULL);
 
 static void bt_conn_auth_passkey_confirm_rpc_handler(const struct nrf_rpc_group *group,
 						     struct nrf_rpc_cbor_ctx *ctx,
@@ -1529,9 +1529,9 @@ decoding_error:
 	report_decoding_error(BT_CONN_AUTH_PASSKEY_CONFIRM_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_auth_passkey_confirm,
-			 BT_CONN_AUTH_PASSKEY_CONFIRM_RPC_CMD,
-			 bt_conn_auth_passkey_confirm_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_auth_passkey_confirm,
+		   BT_CONN_AUTH_PASSKEY_CONFIRM_RPC_CMD,
+		   bt_conn_auth_passkey_confirm_rpc_handler, NULL);
 
 static void bt_conn_auth_pairing_confirm_rpc_handler(const struct nrf_rpc_group *group,
 						     struct nrf_rpc_cbor_ctx *ctx,
@@ -1555,8 +1555,8 @@ decoding_error:
 	report_decoding_error(BT_CONN_AUTH_PAIRING_CONFIRM_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_auth_pairing_confirm,
-			 BT_CONN_AUTH_PAIRING_CONFIRM_RPC_CMD,
-			 bt_conn_auth_pairing_confirm_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_conn_auth_pairing_confirm,
+		   BT_CONN_AUTH_PAIRING_CONFIRM_RPC_CMD,
+		   bt_conn_auth_pairing_confirm_rpc_handler, NULL);
 
 #endif /* defined(CONFIG_BT_SMP) */
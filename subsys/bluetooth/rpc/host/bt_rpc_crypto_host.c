@@ -49,7 +49,7 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_encrypt_le, BT_ENCRYPT_LE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_encrypt_le, BT_ENCRYPT_LE_RPC_CMD,
 	bt_encrypt_le_rpc_handler, NULL);
 
 static void bt_encrypt_be_rpc_handler(const struct nrf_rpc_group *group,
@@ -82,7 +82,7 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_encrypt_be, BT_ENCRYPT_BE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_encrypt_be, BT_ENCRYPT_BE_RPC_CMD,
 	bt_encrypt_be_rpc_handler, NULL);
 
 static void bt_rand_rpc_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
@@ -125,7 +125,7 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rand, BT_RAND_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rand, BT_RAND_RPC_CMD,
 	bt_rand_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_HOST_CCM)
@@ -181,7 +181,7 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_ccm_encrypt, BT_CCM_ENCRYPT_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_ccm_encrypt, BT_CCM_ENCRYPT_RPC_CMD,
 	bt_ccm_encrypt_rpc_handler, NULL);
 
 static void bt_ccm_decrypt_rpc_handler(const struct nrf_rpc_group *group,
@@ -235,6 +235,6 @@ decoding_error:
 	report_decoding_error(BT_CCM_DECRYPT_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_ccm_decrypt, BT_CCM_DECRYPT_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_ccm_decrypt, BT_CCM_DECRYPT_RPC_CMD,
 	bt_ccm_decrypt_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_HOST_CCM) */
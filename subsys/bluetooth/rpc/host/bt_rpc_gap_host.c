@@ -58,8 +58,8 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_get_check_list, BT_RPC_GET_CHECK_LIST_RPC_CMD,
-			 bt_rpc_get_check_list_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_get_check_list, BT_RPC_GET_CHECK_LIST_RPC_CMD,
+		   bt_rpc_get_check_list_rpc_handler, NULL);
 
 
 static inline void bt_ready_cb_t_callback(int err,
@@ -100,8 +100,8 @@ decoding_error:
 	report_decoding_error(BT_ENABLE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_enable, BT_ENABLE_RPC_CMD,
-			 bt_enable_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_enable, BT_ENABLE_RPC_CMD,
+		   bt_enable_rpc_handler, NULL);
 
 static void bt_disable_rpc_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 				   void *handler_data)
@@ -122,8 +122,8 @@ decoding_error:
 	report_decoding_error(BT_DISABLE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_disable, BT_DISABLE_RPC_CMD,
-			 bt_disable_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_disable, BT_DISABLE_RPC_CMD,
+		   bt_disable_rpc_handler, NULL);
 
 static void bt_is_ready_rpc_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 				    void *handler_data)
@@ -144,8 +144,8 @@ decoding_error:
 	report_decoding_error(BT_IS_READY_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_is_ready, BT_IS_READY_RPC_CMD,
-			 bt_is_ready_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_is_ready, BT_IS_READY_RPC_CMD,
+		   bt_is_ready_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_DEVICE_NAME_DYNAMIC)
 
@@ -173,8 +173,8 @@ decoding_error:
 	report_decoding_error(BT_SET_NAME_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_set_name, BT_SET_NAME_RPC_CMD,
-			 bt_set_name_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_set_name, BT_SET_NAME_RPC_CMD,
+		   bt_set_name_rpc_handler, NULL);
 
 static bool bt_get_name_out(char *name, size_t size)
 {
@@ -232,8 +232,8 @@ decoding_error:
 	report_decoding_error(BT_GET_NAME_OUT_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_get_name_out, BT_GET_NAME_OUT_RPC_CMD,
-			 bt_get_name_out_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_get_name_out, BT_GET_NAME_OUT_RPC_CMD,
+		   bt_get_name_out_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_DEVICE_NAME_DYNAMIC) */
 
 #if defined(CONFIG_BT_DEVICE_APPEARANCE_DYNAMIC)
@@ -256,8 +256,8 @@ decoding_error:
 	report_decoding_error(BT_GET_APPEARANCE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_get_appearance, BT_GET_APPEARANCE_RPC_CMD,
-			 bt_get_appearance_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_get_appearance, BT_GET_APPEARANCE_RPC_CMD,
+		   bt_get_appearance_rpc_handler, NULL);
 
 void bt_set_appearance_rpc_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 				   void *handler_data)
@@ -280,8 +280,8 @@ decoding_error:
 	report_decoding_error(BT_SET_APPEARANCE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_set_appearance, BT_SET_APPEARANCE_RPC_CMD,
-			 bt_set_appearance_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_set_appearance, BT_SET_APPEARANCE_RPC_CMD,
+		   bt_set_appearance_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_DEVICE_APPEARANCE_DYNAMIC) */
 
 static void bt_id_get_rpc_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
@@ -323,8 +323,8 @@ decoding_error:
 	report_decoding_error(BT_ID_GET_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_id_get, BT_ID_GET_RPC_CMD,
-			 bt_id_get_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_id_get, BT_ID_GET_RPC_CMD,
+		   bt_id_get_rpc_handler, NULL);
 
 static void bt_id_create_rpc_handler(const struct nrf_rpc_group *group,
 				     struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -367,8 +367,8 @@ decoding_error:
 	report_decoding_error(BT_ID_CREATE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_id_create, BT_ID_CREATE_RPC_CMD,
-			 bt_id_create_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_id_create, BT_ID_CREATE_RPC_CMD,
+		   bt_id_create_rpc_handler, NULL);
 
 static void bt_id_reset_rpc_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 				    void *handler_data)
@@ -413,8 +413,8 @@ decoding_error:
 	report_decoding_error(BT_ID_RESET_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_id_reset, BT_ID_RESET_RPC_CMD,
-			 bt_id_reset_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_id_reset, BT_ID_RESET_RPC_CMD,
+		   bt_id_reset_rpc_handler, NULL);
 
 static void bt_id_delete_rpc_handler(const struct nrf_rpc_group *group,
 				     struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -437,8 +437,8 @@ decoding_error:
 	report_decoding_error(BT_ID_DELETE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_id_delete, BT_ID_DELETE_RPC_CMD,
-			 bt_id_delete_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_id_delete, BT_ID_DELETE_RPC_CMD,
+		   bt_id_delete_rpc_handler, NULL);
 
 void bt_data_dec(struct ser_scratchpad *scratchpad, struct bt_data *data)
 {
@@ -446,7 +446,7 @@ void bt_data_dec(struct ser_scratchpad *scratchpad, struct bt_data *data)
 
 	data->type = ser_decode_uint(ctx);
 	data->data_len = ser_decode_uint(ctx);
-	data->data = ser_decode_buffer_into_scratchpad(scratchpad, NULL);
+	data->data = ser_decode_buffer_in_place(scratchpad, NULL);
 }
 
 void bt_le_scan_param_dec(struct nrf_rpc_cbor_ctx *ctx, struct bt_le_scan_param *data)
@@ -558,12 +558,13 @@ static void bt_le_adv_start_rpc_handler(const struct nrf_rpc_group *group,
 		bt_data_dec(&scratchpad, &sd[i]);
 	}
 
-	if (!ser_decoding_done_and_check(group, ctx)) {
+	if (!ser_decoding_done_and_keep(group, ctx)) {
 		goto decoding_error;
 	}
 
 	result = bt_le_adv_start(&param, ad, ad_len, sd, sd_len);
 
+	ser_decoding_release(group, ctx);
 	ser_rsp_send_int(group, result);
 
 	return;
@@ -571,8 +572,8 @@ decoding_error:
 	report_decoding_error(BT_LE_ADV_START_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_adv_start, BT_LE_ADV_START_RPC_CMD,
-			 bt_le_adv_start_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_adv_start, BT_LE_ADV_START_RPC_CMD,
+		   bt_le_adv_start_rpc_handler, NULL);
 
 static void bt_le_adv_update_data_rpc_handler(const struct nrf_rpc_group *group,
 					      struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -605,12 +606,13 @@ static void bt_le_adv_update_data_rpc_handler(const struct nrf_rpc_group *group,
 		bt_data_dec(&scratchpad, &sd[i]);
 	}
 
-	if (!ser_decoding_done_and_check(group, ctx)) {
+	if (!ser_decoding_done_and_keep(group, ctx)) {
 		goto decoding_error;
 	}
 
 	result = bt_le_adv_update_data(ad, ad_len, sd, sd_len);
 
+	ser_decoding_release(group, ctx);
 	ser_rsp_send_int(group, result);
 
 	return;
@@ -618,8 +620,8 @@ decoding_error:
 	report_decoding_error(BT_LE_ADV_UPDATE_DATA_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_adv_update_data, BT_LE_ADV_UPDATE_DATA_RPC_CMD,
-			 bt_le_adv_update_data_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_adv_update_data, BT_LE_ADV_UPDATE_DATA_RPC_CMD,
+		   bt_le_adv_update_data_rpc_handler, NULL);
 
 static void bt_le_adv_stop_rpc_handler(const struct nrf_rpc_group *group,
 				       struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -633,8 +635,8 @@ static void bt_le_adv_stop_rpc_handler(const struct nrf_rpc_group *group,
 	ser_rsp_send_int(group, result);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_adv_stop, BT_LE_ADV_STOP_RPC_CMD,
-			 bt_le_adv_stop_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_adv_stop, BT_LE_ADV_STOP_RPC_CMD,
+		   bt_le_adv_stop_rpc_handler, NULL);
 
 #endif /* defined(CONFIG_BT_BROADCASTER) */
 
@@ -842,8 +844,8 @@ decoding_error:
 	}
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_create, BT_LE_EXT_ADV_CREATE_RPC_CMD,
-			 bt_le_ext_adv_create_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_create, BT_LE_EXT_ADV_CREATE_RPC_CMD,
+		   bt_le_ext_adv_create_rpc_handler, NULL);
 
 
 void bt_le_ext_adv_start_param_dec(struct nrf_rpc_cbor_ctx *ctx, struct bt_le_ext_adv_start_param *data)
@@ -875,8 +877,8 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_START_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_start, BT_LE_EXT_ADV_START_RPC_CMD,
-			 bt_le_ext_adv_start_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_start, BT_LE_EXT_ADV_START_RPC_CMD,
+		   bt_le_ext_adv_start_rpc_handler, NULL);
 
 static void bt_le_ext_adv_stop_rpc_handler(const struct nrf_rpc_group *group,
 					   struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -899,8 +901,8 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_STOP_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_stop, BT_LE_EXT_ADV_STOP_RPC_CMD,
-			 bt_le_ext_adv_stop_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_stop, BT_LE_EXT_ADV_STOP_RPC_CMD,
+		   bt_le_ext_adv_stop_rpc_handler, NULL);
 
 static void bt_le_ext_adv_set_data_rpc_handler(const struct nrf_rpc_group *group,
 					       struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -936,12 +938,13 @@ static void bt_le_ext_adv_set_data_rpc_handler(const struct nrf_rpc_group *group
 		bt_data_dec(&scratchpad, &sd[i]);
 	}
 
-	if (!ser_decoding_done_and_check(group, ctx)) {
+	if (!ser_decoding_done_and_keep(group, ctx)) {
 		goto decoding_error;
 	}
 
 	result = bt_le_ext_adv_set_data(adv, ad, ad_len, sd, sd_len);
 
+	ser_decoding_release(group, ctx);
 	ser_rsp_send_int(group, result);
 
 	return;
@@ -949,8 +952,8 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_SET_DATA_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_set_data, BT_LE_EXT_ADV_SET_DATA_RPC_CMD,
-			 bt_le_ext_adv_set_data_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_set_data, BT_LE_EXT_ADV_SET_DATA_RPC_CMD,
+		   bt_le_ext_adv_set_data_rpc_handler, NULL);
 
 static void bt_le_ext_adv_update_param_rpc_handler(const struct nrf_rpc_group *group,
 						   struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -978,8 +981,8 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_UPDATE_PARAM_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_update_param, BT_LE_EXT_ADV_UPDATE_PARAM_RPC_CMD,
-			 bt_le_ext_adv_update_param_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_update_param, BT_LE_EXT_ADV_UPDATE_PARAM_RPC_CMD,
+		   bt_le_ext_adv_update_param_rpc_handler, NULL);
 
 static void bt_le_ext_adv_delete_rpc_handler(const struct nrf_rpc_group *group,
 					     struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1012,8 +1015,8 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_DELETE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_delete, BT_LE_EXT_ADV_DELETE_RPC_CMD,
-			 bt_le_ext_adv_delete_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_delete, BT_LE_EXT_ADV_DELETE_RPC_CMD,
+		   bt_le_ext_adv_delete_rpc_handler, NULL);
 
 static void bt_le_ext_adv_get_index_rpc_handler(const struct nrf_rpc_group *group,
 						struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1036,8 +1039,8 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_GET_INDEX_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_get_index, BT_LE_EXT_ADV_GET_INDEX_RPC_CMD,
-			 bt_le_ext_adv_get_index_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_get_index, BT_LE_EXT_ADV_GET_INDEX_RPC_CMD,
+		   bt_le_ext_adv_get_index_rpc_handler, NULL);
 
 void bt_le_ext_adv_info_dec(struct nrf_rpc_cbor_ctx *ctx, struct bt_le_ext_adv_info *data)
 {
@@ -1068,8 +1071,8 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_GET_INFO_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_get_info, BT_LE_EXT_ADV_GET_INFO_RPC_CMD,
-			 bt_le_ext_adv_get_info_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_get_info, BT_LE_EXT_ADV_GET_INFO_RPC_CMD,
+		   bt_le_ext_adv_get_info_rpc_handler, NULL);
 
 static void bt_le_ext_adv_oob_get_local_rpc_handler(const struct nrf_rpc_group *group,
 						    struct nrf_rpc_cbor_ctx *ctx,
@@ -1107,9 +1110,9 @@ decoding_error:
 	report_decoding_error(BT_LE_EXT_ADV_OOB_GET_LOCAL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_oob_get_local,
-			 BT_LE_EXT_ADV_OOB_GET_LOCAL_RPC_CMD,
-			 bt_le_ext_adv_oob_get_local_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_ext_adv_oob_get_local,
+		   BT_LE_EXT_ADV_OOB_GET_LOCAL_RPC_CMD,
+		   bt_le_ext_adv_oob_get_local_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_EXT_ADV) */
 
 #if defined(CONFIG_BT_OBSERVER)
@@ -1136,8 +1139,8 @@ decoding_error:
 	report_decoding_error(BT_LE_SCAN_START_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_scan_start, BT_LE_SCAN_START_RPC_CMD,
-			 bt_le_scan_start_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_scan_start, BT_LE_SCAN_START_RPC_CMD,
+		   bt_le_scan_start_rpc_handler, NULL);
 
 static void bt_le_scan_stop_rpc_handler(const struct nrf_rpc_group *group,
 					struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1151,8 +1154,8 @@ static void bt_le_scan_stop_rpc_handler(const struct nrf_rpc_group *group,
 	ser_rsp_send_int(group, result);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_scan_stop, BT_LE_SCAN_STOP_RPC_CMD,
-			 bt_le_scan_stop_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_scan_stop, BT_LE_SCAN_STOP_RPC_CMD,
+		   bt_le_scan_stop_rpc_handler, NULL);
 
 size_t bt_le_scan_recv_info_sp_size(const struct bt_le_scan_recv_info *data)
 {
@@ -1236,9 +1239,9 @@ static void bt_le_scan_cb_register_on_remote_rpc_handler(const struct nrf_rpc_gr
 	ser_rsp_send_void(group);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_register_on_remote,
-			 BT_LE_SCAN_CB_REGISTER_ON_REMOTE_RPC_CMD,
-			 bt_le_scan_cb_register_on_remote_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_register_on_remote,
+		   BT_LE_SCAN_CB_REGISTER_ON_REMOTE_RPC_CMD,
+		   bt_le_scan_cb_register_on_remote_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_OBSERVER) */
 
 #if defined(CONFIG_BT_FILTER_ACCEPT_LIST)
@@ -1265,9 +1268,9 @@ decoding_error:
 	report_decoding_error(BT_LE_FILTER_ACCEPT_LIST_ADD_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_filter_accept_list_add,
-			 BT_LE_FILTER_ACCEPT_LIST_ADD_RPC_CMD,
-			 bt_le_filter_accept_list_add_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_filter_accept_list_add,
+		   BT_LE_FILTER_ACCEPT_LIST_ADD_RPC_CMD,
+		   bt_le_filter_accept_list_add_rpc_handler, NULL);
 
 static void bt_le_filter_accept_list_remove_rpc_handler(const struct nrf_rpc_group *group,
 							struct nrf_rpc_cbor_ctx *ctx,
@@ -1292,9 +1295,9 @@ decoding_error:
 	report_decoding_error(BT_LE_FILTER_ACCEPT_LIST_REMOVE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_filter_accept_list_remove,
-			 BT_LE_FILTER_ACCEPT_LIST_REMOVE_RPC_CMD,
-			 bt_le_filter_accept_list_remove_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_filter_accept_list_remove,
+		   BT_LE_FILTER_ACCEPT_LIST_REMOVE_RPC_CMD,
+		   bt_le_filter_accept_list_remove_rpc_handler, NULL);
 
 static void bt_le_filter_accept_list_clear_rpc_handler(const struct nrf_rpc_group *group,
 						       struct nrf_rpc_cbor_ctx *ctx,
@@ -1309,9 +1312,9 @@ static void bt_le_filter_accept_list_clear_rpc_handler(const struct nrf_rpc_grou
 	ser_rsp_send_int(group, result);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_filter_accept_list_clear,
-			 BT_LE_ACCEPT_LIST_CLEAR_RPC_CMD,
-			 bt_le_filter_accept_list_clear_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_filter_accept_list_clear,
+		   BT_LE_ACCEPT_LIST_CLEAR_RPC_CMD,
+		   bt_le_filter_accept_list_clear_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_FILTER_ACCEPT_LIST) */
 
 static void bt_le_set_chan_map_rpc_handler(const struct nrf_rpc_group *group,
@@ -1338,8 +1341,8 @@ decoding_error:
 	report_decoding_error(BT_LE_SET_CHAN_MAP_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_set_chan_map, BT_LE_SET_CHAN_MAP_RPC_CMD,
-			 bt_le_set_chan_map_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_set_chan_map, BT_LE_SET_CHAN_MAP_RPC_CMD,
+		   bt_le_set_chan_map_rpc_handler, NULL);
 
 static void bt_le_oob_get_local_rpc_handler(const struct nrf_rpc_group *group,
 					    struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1376,8 +1379,8 @@ decoding_error:
 	report_decoding_error(BT_LE_OOB_GET_LOCAL_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_oob_get_local, BT_LE_OOB_GET_LOCAL_RPC_CMD,
-			 bt_le_oob_get_local_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_oob_get_local, BT_LE_OOB_GET_LOCAL_RPC_CMD,
+		   bt_le_oob_get_local_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_CONN)
 static void bt_unpair_rpc_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
@@ -1404,8 +1407,8 @@ decoding_error:
 	report_decoding_error(BT_UNPAIR_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_unpair, BT_UNPAIR_RPC_CMD,
-			 bt_unpair_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_unpair, BT_UNPAIR_RPC_CMD,
+		   bt_unpair_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_CONN) */
 
 #if (defined(CONFIG_BT_CONN) && defined(CONFIG_BT_SMP))
@@ -1469,8 +1472,8 @@ decoding_error:
 	report_decoding_error(BT_FOREACH_BOND_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_foreach_bond, BT_FOREACH_BOND_RPC_CMD,
-			 bt_foreach_bond_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_foreach_bond, BT_FOREACH_BOND_RPC_CMD,
+		   bt_foreach_bond_rpc_handler, NULL);
 #endif /* (defined(CONFIG_BT_CONN) && defined(CONFIG_BT_SMP)) */
 
 #if defined(CONFIG_BT_PER_ADV)
@@ -1486,8 +1489,8 @@ static void bt_le_per_adv_list_clear_rpc_handler(const struct nrf_rpc_group *gro
 	ser_rsp_send_int(group, result);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_list_clear, BT_LE_PER_ADV_LIST_CLEAR_RPC_CMD,
-			 bt_le_per_adv_list_clear_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_list_clear, BT_LE_PER_ADV_LIST_CLEAR_RPC_CMD,
+		   bt_le_per_adv_list_clear_rpc_handler, NULL);
 
 static void bt_le_per_adv_list_add_rpc_handler(const struct nrf_rpc_group *group,
 					       struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1513,8 +1516,8 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_LIST_ADD_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_list_add, BT_LE_PER_ADV_LIST_ADD_RPC_CMD,
-			 bt_le_per_adv_list_add_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_list_add, BT_LE_PER_ADV_LIST_ADD_RPC_CMD,
+		   bt_le_per_adv_list_add_rpc_handler, NULL);
 
 static void bt_le_per_adv_list_remove_rpc_handler(const struct nrf_rpc_group *group,
 						  struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1540,8 +1543,8 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_LIST_REMOVE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_list_remove, BT_LE_PER_ADV_LIST_REMOVE_RPC_CMD,
-			 bt_le_per_adv_list_remove_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_list_remove, BT_LE_PER_ADV_LIST_REMOVE_RPC_CMD,
+		   bt_le_per_adv_list_remove_rpc_handler, NULL);
 
 void bt_le_per_adv_param_dec(struct nrf_rpc_cbor_ctx *ctx, struct bt_le_per_adv_param *data)
 {
@@ -1573,8 +1576,8 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SET_PARAM_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_set_param, BT_LE_PER_ADV_SET_PARAM_RPC_CMD,
-			 bt_le_per_adv_set_param_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_set_param, BT_LE_PER_ADV_SET_PARAM_RPC_CMD,
+		   bt_le_per_adv_set_param_rpc_handler, NULL);
 
 static void bt_le_per_adv_set_data_rpc_handler(const struct nrf_rpc_group *group,
 					       struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1598,12 +1601,13 @@ static void bt_le_per_adv_set_data_rpc_handler(const struct nrf_rpc_group *group
 		bt_data_dec(&scratchpad, &ad[i]);
 	}
 
-	if (!ser_decoding_done_and_check(group, ctx)) {
+	if (!ser_decoding_done_and_keep(group, ctx)) {
 		goto decoding_error;
 	}
 
 	result = bt_le_per_adv_set_data(adv, ad, ad_len);
 
+	ser_decoding_release(group, ctx);
 	ser_rsp_send_int(group, result);
 
 	return;
@@ -1611,8 +1615,8 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SET_DATA_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_set_data, BT_LE_PER_ADV_SET_DATA_RPC_CMD,
-			 bt_le_per_adv_set_data_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_set_data, BT_LE_PER_ADV_SET_DATA_RPC_CMD,
+		   bt_le_per_adv_set_data_rpc_handler, NULL);
 
 static void bt_le_per_adv_start_rpc_handler(const struct nrf_rpc_group *group,
 					    struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1635,8 +1639,8 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_START_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_start, BT_LE_PER_ADV_START_RPC_CMD,
-			 bt_le_per_adv_start_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_start, BT_LE_PER_ADV_START_RPC_CMD,
+		   bt_le_per_adv_start_rpc_handler, NULL);
 
 static void bt_le_per_adv_stop_rpc_handler(const struct nrf_rpc_group *group,
 					   struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1659,8 +1663,8 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_STOP_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_stop, BT_LE_PER_ADV_STOP_RPC_CMD,
-			 bt_le_per_adv_stop_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_stop, BT_LE_PER_ADV_STOP_RPC_CMD,
+		   bt_le_per_adv_stop_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_CONN)
 static void bt_le_per_adv_set_info_transfer_rpc_handler(const struct nrf_rpc_group *group,
@@ -1689,9 +1693,9 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SET_INFO_TRANSFER_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_set_info_transfer,
-			 BT_LE_PER_ADV_SET_INFO_TRANSFER_RPC_CMD,
-			 bt_le_per_adv_set_info_transfer_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_set_info_transfer,
+		   BT_LE_PER_ADV_SET_INFO_TRANSFER_RPC_CMD,
+		   bt_le_per_adv_set_info_transfer_rpc_handler, NULL);
 #endif  /* defined(CONFIG_BT_CONN) */
 #endif  /* defined(CONFIG_BT_PER_ADV) */
 
@@ -1718,9 +1722,9 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SYNC_GET_INDEX_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_get_index,
-			 BT_LE_PER_ADV_SYNC_GET_INDEX_RPC_CMD,
-			 bt_le_per_adv_sync_get_index_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_get_index,
+		   BT_LE_PER_ADV_SYNC_GET_INDEX_RPC_CMD,
+		   bt_le_per_adv_sync_get_index_rpc_handler, NULL);
 
 void bt_le_per_adv_sync_param_dec(struct nrf_rpc_cbor_ctx *ctx,
 				  struct bt_le_per_adv_sync_param *data)
@@ -1765,8 +1769,8 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SYNC_CREATE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_create, BT_LE_PER_ADV_SYNC_CREATE_RPC_CMD,
-			 bt_le_per_adv_sync_create_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_create, BT_LE_PER_ADV_SYNC_CREATE_RPC_CMD,
+		   bt_le_per_adv_sync_create_rpc_handler, NULL);
 
 static void bt_le_per_adv_sync_delete_rpc_handler(const struct nrf_rpc_group *group,
 						  struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -1789,8 +1793,8 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SYNC_DELETE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_delete, BT_LE_PER_ADV_SYNC_DELETE_RPC_CMD,
-			 bt_le_per_adv_sync_delete_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_delete, BT_LE_PER_ADV_SYNC_DELETE_RPC_CMD,
+		   bt_le_per_adv_sync_delete_rpc_handler, NULL);
 
 static void bt_le_per_adv_sync_recv_enable_rpc_handler(const struct nrf_rpc_group *group,
 						       struct nrf_rpc_cbor_ctx *ctx,
@@ -1814,9 +1818,9 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SYNC_RECV_ENABLE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_recv_enable,
-			 BT_LE_PER_ADV_SYNC_RECV_ENABLE_RPC_CMD,
-			 bt_le_per_adv_sync_recv_enable_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_recv_enable,
+		   BT_LE_PER_ADV_SYNC_RECV_ENABLE_RPC_CMD,
+		   bt_le_per_adv_sync_recv_enable_rpc_handler, NULL);
 
 static void bt_le_per_adv_sync_recv_disable_rpc_handler(const struct nrf_rpc_group *group,
 							struct nrf_rpc_cbor_ctx *ctx,
@@ -1840,9 +1844,9 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SYNC_RECV_DISABLE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_recv_disable,
-			 BT_LE_PER_ADV_SYNC_RECV_DISABLE_RPC_CMD,
-			 bt_le_per_adv_sync_recv_disable_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_recv_disable,
+		   BT_LE_PER_ADV_SYNC_RECV_DISABLE_RPC_CMD,
+		   bt_le_per_adv_sync_recv_disable_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_CONN)
 static void bt_le_per_adv_sync_transfer_rpc_handler(const struct nrf_rpc_group *group,
@@ -1871,9 +1875,9 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SYNC_TRANSFER_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_transfer,
-			 BT_LE_PER_ADV_SYNC_TRANSFER_RPC_CMD,
-			 bt_le_per_adv_sync_transfer_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_transfer,
+		   BT_LE_PER_ADV_SYNC_TRANSFER_RPC_CMD,
+		   bt_le_per_adv_sync_transfer_rpc_handler, NULL);
 
 static void bt_le_per_adv_sync_transfer_unsubscribe_rpc_handler(const struct nrf_rpc_group *group,
 								struct nrf_rpc_cbor_ctx *ctx,
@@ -1897,9 +1901,9 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SYNC_TRANSFER_UNSUBSCRIBE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_transfer_unsubscribe,
-			 BT_LE_PER_ADV_SYNC_TRANSFER_UNSUBSCRIBE_RPC_CMD,
-			 bt_le_per_adv_sync_transfer_unsubscribe_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_transfer_unsubscribe,
+		   BT_LE_PER_ADV_SYNC_TRANSFER_UNSUBSCRIBE_RPC_CMD,
+		   bt_le_per_adv_sync_transfer_unsubscribe_rpc_handler, NULL);
 
 void bt_le_per_adv_sync_transfer_param_dec(struct nrf_rpc_cbor_ctx *ctx,
 					   struct bt_le_per_adv_sync_transfer_param *data)
@@ -1933,9 +1937,9 @@ decoding_error:
 	report_decoding_error(BT_LE_PER_ADV_SYNC_TRANSFER_SUBSCRIBE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_transfer_subscribe,
-			 BT_LE_PER_ADV_SYNC_TRANSFER_SUBSCRIBE_RPC_CMD,
-			 bt_le_per_adv_sync_transfer_subscribe_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_transfer_subscribe,
+		   BT_LE_PER_ADV_SYNC_TRANSFER_SUBSCRIBE_RPC_CMD,
+		   bt_le_per_adv_sync_transfer_subscribe_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_CONN) */
 
 size_t bt_le_per_adv_sync_synced_info_sp_size(const struct bt_le_per_adv_sync_synced_info *data)
@@ -2127,9 +2131,9 @@ static void bt_le_per_adv_sync_cb_register_on_remote_rpc_handler(const struct nr
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_cb_register_on_remote,
-			 BT_LE_PER_ADV_SYNC_CB_REGISTER_ON_REMOTE_RPC_CMD,
-			 bt_le_per_adv_sync_cb_register_on_remote_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_le_per_adv_sync_cb_register_on_remote,
+		   BT_LE_PER_ADV_SYNC_CB_REGISTER_ON_REMOTE_RPC_CMD,
+		   bt_le_per_adv_sync_cb_register_on_remote_rpc_handler, NULL);
 #endif /* defined(CONFIG_BT_PER_ADV_SYNC) */
 
 #if defined(CONFIG_SETTINGS)
@@ -2142,7 +2146,7 @@ static void bt_rpc_settings_load_rpc_handler(const struct nrf_rpc_group *group,
 	ser_rsp_send_void(group);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_settings_load,
-			 BT_SETTINGS_LOAD_RPC_CMD,
-			 bt_rpc_settings_load_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_settings_load,
+		   BT_SETTINGS_LOAD_RPC_CMD,
+		   bt_rpc_settings_load_rpc_handler, NULL);
 #endif /* defined(CONFIG_SETTINGS) */
@@ -253,7 +253,7 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_start_service, BT_RPC_GATT_START_SERVICE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_start_service, BT_RPC_GATT_START_SERVICE_RPC_CMD,
 	bt_rpc_gatt_start_service_rpc_handler, NULL);
 
 struct bt_normal_attr_read_res {
@@ -655,9 +655,9 @@ static int bt_rpc_gatt_send_desc_attr(uint8_t special_attr, uint16_t param, uint
 	return err;
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_send_simple_attr,
-			 BT_RPC_GATT_SEND_SIMPLE_ATTR_RPC_CMD,
-			 bt_rpc_gatt_send_simple_attr_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_send_simple_attr,
+		   BT_RPC_GATT_SEND_SIMPLE_ATTR_RPC_CMD,
+		   bt_rpc_gatt_send_simple_attr_rpc_handler, NULL);
 
 static void bt_rpc_gatt_send_desc_attr_rpc_handler(const struct nrf_rpc_group *group,
 						   struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -690,9 +690,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_GATT_SEND_DESC_ATTR_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_send_desc_attr,
-			 BT_RPC_GATT_SEND_DESC_ATTR_RPC_CMD,
-			 bt_rpc_gatt_send_desc_attr_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_send_desc_attr,
+		   BT_RPC_GATT_SEND_DESC_ATTR_RPC_CMD,
+		   bt_rpc_gatt_send_desc_attr_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_GATT_DYNAMIC_DB)
 static int bt_rpc_gatt_end_service(void)
@@ -721,7 +721,7 @@ static void bt_rpc_gatt_end_service_rpc_handler(const struct nrf_rpc_group *grou
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_end_service, BT_RPC_GATT_END_SERVICE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_end_service, BT_RPC_GATT_END_SERVICE_RPC_CMD,
 	bt_rpc_gatt_end_service_rpc_handler, NULL);
 
 static void bt_rpc_gatt_service_unregister_rpc_handler(const struct nrf_rpc_group *group,
@@ -757,9 +757,9 @@ decoding_error:
 	report_decoding_error(BT_RPC_GATT_SERVICE_UNREGISTER_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_service_unregister,
-			 BT_RPC_GATT_SERVICE_UNREGISTER_RPC_CMD,
-			 bt_rpc_gatt_service_unregister_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_service_unregister,
+		   BT_RPC_GATT_SERVICE_UNREGISTER_RPC_CMD,
+		   bt_rpc_gatt_service_unregister_rpc_handler, NULL);
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 
 static inline void bt_gatt_complete_func_t_callback(struct bt_conn *conn, void *user_data,
@@ -825,7 +825,7 @@ decoding_error:
 	report_decoding_error(BT_GATT_NOTIFY_CB_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_notify_cb, BT_GATT_NOTIFY_CB_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_notify_cb, BT_GATT_NOTIFY_CB_RPC_CMD,
 	bt_gatt_notify_cb_rpc_handler, NULL);
 
 void bt_gatt_indicate_params_dec(struct ser_scratchpad *scratchpad,
@@ -915,7 +915,7 @@ decoding_error:
 	report_decoding_error(BT_GATT_INDICATE_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_indicate, BT_GATT_INDICATE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_indicate, BT_GATT_INDICATE_RPC_CMD,
 	bt_gatt_indicate_rpc_handler, NULL);
 
 static void bt_gatt_is_subscribed_rpc_handler(const struct nrf_rpc_group *group,
@@ -944,8 +944,8 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_is_subscribed, BT_GATT_IS_SUBSCRIBED_RPC_CMD,
-			 bt_gatt_is_subscribed_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_is_subscribed, BT_GATT_IS_SUBSCRIBED_RPC_CMD,
+		   bt_gatt_is_subscribed_rpc_handler, NULL);
 
 static void bt_gatt_get_mtu_rpc_handler(const struct nrf_rpc_group *group,
 					struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
@@ -969,8 +969,8 @@ decoding_error:
 	report_decoding_error(BT_GATT_GET_MTU_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_get_mtu, BT_GATT_GET_MTU_RPC_CMD,
-			 bt_gatt_get_mtu_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_get_mtu, BT_GATT_GET_MTU_RPC_CMD,
+		   bt_gatt_get_mtu_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_GATT_CLIENT)
 
@@ -1036,7 +1036,7 @@ alloc_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_exchange_mtu, BT_GATT_EXCHANGE_MTU_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_exchange_mtu, BT_GATT_EXCHANGE_MTU_RPC_CMD,
 	bt_gatt_exchange_mtu_rpc_handler, NULL);
 
 #endif /* CONFIG_BT_GATT_CLIENT */
@@ -1064,8 +1064,8 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_attr_get_handle, BT_GATT_ATTR_GET_HANDLE_RPC_CMD,
-			 bt_gatt_attr_get_handle_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_attr_get_handle, BT_GATT_ATTR_GET_HANDLE_RPC_CMD,
+		   bt_gatt_attr_get_handle_rpc_handler, NULL);
 
 void bt_gatt_cb_att_mtu_update_call(struct bt_conn *conn, uint16_t tx, uint16_t rx)
 {
@@ -1096,8 +1096,8 @@ static void bt_gatt_cb_register_handler(const struct nrf_rpc_group *group,
 	ser_rsp_send_void(group);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_cb_register, BT_LE_GATT_CB_REGISTER_ON_REMOTE_RPC_CMD,
-			 bt_gatt_cb_register_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_cb_register, BT_LE_GATT_CB_REGISTER_ON_REMOTE_RPC_CMD,
+		   bt_gatt_cb_register_handler, NULL);
 
 #if defined(CONFIG_BT_GATT_CLIENT)
 
@@ -1217,7 +1217,7 @@ alloc_error:
 	report_decoding_error(BT_GATT_DISCOVER_RPC_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_discover, BT_GATT_DISCOVER_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_discover, BT_GATT_DISCOVER_RPC_CMD,
 	bt_gatt_discover_rpc_handler, NULL);
 
 uint8_t bt_gatt_read_callback(struct bt_conn *conn, uint8_t err,
@@ -1309,7 +1309,7 @@ alloc_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_read, BT_GATT_READ_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_read, BT_GATT_READ_RPC_CMD,
 	bt_gatt_read_rpc_handler, NULL);
 
 void bt_gatt_write_callback(struct bt_conn *conn, uint8_t err,
@@ -1382,7 +1382,7 @@ alloc_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_write, BT_GATT_WRITE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_write, BT_GATT_WRITE_RPC_CMD,
 	bt_gatt_write_rpc_handler, NULL);
 
 static void bt_gatt_write_without_response_cb_rpc_handler(const struct nrf_rpc_group *group,
@@ -1425,7 +1425,7 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_write_without_response_cb,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_write_without_response_cb,
 	BT_GATT_WRITE_WITHOUT_RESPONSE_CB_RPC_CMD, bt_gatt_write_without_response_cb_rpc_handler,
 	NULL);
 
@@ -1592,7 +1592,7 @@ alloc_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_subscribe, BT_GATT_SUBSCRIBE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_subscribe, BT_GATT_SUBSCRIBE_RPC_CMD,
 	bt_gatt_subscribe_rpc_handler, NULL);
 
 static void bt_gatt_resubscribe_rpc_handler(const struct nrf_rpc_group *group,
@@ -1639,7 +1639,7 @@ alloc_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_resubscribe, BT_GATT_RESUBSCRIBE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_resubscribe, BT_GATT_RESUBSCRIBE_RPC_CMD,
 	bt_gatt_resubscribe_rpc_handler, NULL);
 
 static void bt_gatt_unsubscribe_rpc_handler(const struct nrf_rpc_group *group,
@@ -1675,7 +1675,7 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_unsubscribe, BT_GATT_UNSUBSCRIBE_RPC_CMD,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_gatt_unsubscribe, BT_GATT_UNSUBSCRIBE_RPC_CMD,
 	bt_gatt_unsubscribe_rpc_handler, NULL);
 
 static void bt_rpc_gatt_subscribe_flag_update_rpc_handler(const struct nrf_rpc_group *group,
@@ -1722,7 +1722,7 @@ decoding_error:
 
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_subscribe_flag_update,
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_subscribe_flag_update,
 	BT_RPC_GATT_SUBSCRIBE_FLAG_UPDATE_RPC_CMD, bt_rpc_gatt_subscribe_flag_update_rpc_handler,
 	NULL);
 
@@ -50,8 +50,8 @@ decoding_error:
 	report_decoding_error(BT_ADDR_LE_IS_BONDED_CMD, handler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_addr_le_is_bonded, BT_ADDR_LE_IS_BONDED_CMD,
-			 bt_addr_le_is_bonded_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_addr_le_is_bonded, BT_ADDR_LE_IS_BONDED_CMD,
+		   bt_addr_le_is_bonded_rpc_handler, NULL);
 
 static void decode_net_buf(struct ser_scratchpad *scratchpad, struct net_buf *data)
 {
@@ -139,5 +139,5 @@ decoding_error:
 	report_decoding_error(BT_HCI_CMD_SEND_SYNC_RPC_CMD, hanler_data);
 }
 
-NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_hci_cmd_send_sync, BT_HCI_CMD_SEND_SYNC_RPC_CMD,
-			 bt_hci_cmd_send_sync_rpc_handler, NULL);
+BT_RPC_CMD_DECODER(bt_rpc_grp, bt_hci_cmd_send_sync, BT_HCI_CMD_SEND_SYNC_RPC_CMD,
+		   bt_hci_cmd_send_sync_rpc_handler, NULL);
@@ -18,6 +18,23 @@ LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+/* Number of slots of a hash table indexing the given number of filters.
+ * The table is kept at most half full, so that the probe sequences stay short.
+ */
+#define INDEX_SLOTS(cnt) (2 * (cnt) + 1)
+
+/* Hash table slot value marking an empty slot. Other slots hold
+ * the index of the filter incremented by one.
+ */
+#define INDEX_SLOT_EMPTY 0
+
+BUILD_ASSERT(MAX(MAX(MAX(CONFIG_BT_SCAN_UUID_CNT, CONFIG_BT_SCAN_NAME_CNT),
+		     MAX(CONFIG_BT_SCAN_SHORT_NAME_CNT, CONFIG_BT_SCAN_ADDRESS_CNT)),
+		 MAX(CONFIG_BT_SCAN_APPEARANCE_CNT, CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT)) <
+	     UINT16_MAX, "Too many filters for the filter index");
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 /* Scan filter mutex. */
 K_MUTEX_DEFINE(scan_mutex);
 
@@ -55,8 +72,13 @@ struct bt_scan_name_filter {
 	 */
 	char target_name[CONFIG_BT_SCAN_NAME_CNT][CONFIG_BT_SCAN_NAME_MAX_LEN];
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* Indexes of the names sorted in the lexicographical order. */
+	uint16_t sorted[CONFIG_BT_SCAN_NAME_CNT];
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	/* Name filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter.
 	 */
@@ -76,8 +98,13 @@ struct bt_scan_short_name_filter {
 		uint8_t min_len;
 	} name[CONFIG_BT_SCAN_SHORT_NAME_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* Indexes of the short names sorted in the lexicographical order. */
+	uint16_t sorted[CONFIG_BT_SCAN_SHORT_NAME_CNT];
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	/* Short name filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -89,8 +116,13 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* Hash table of the addresses. */
+	uint16_t index[INDEX_SLOTS(CONFIG_BT_SCAN_ADDRESS_CNT)];
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	/* Address filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -120,8 +152,13 @@ struct bt_scan_uuid_filter {
 	 */
 	struct bt_scan_uuid uuid[CONFIG_BT_SCAN_UUID_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* Hash table of the UUIDs, keyed by their 128-bit representation. */
+	uint16_t index[INDEX_SLOTS(CONFIG_BT_SCAN_UUID_CNT)];
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	/* UUID filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -133,8 +170,13 @@ struct bt_scan_appearance_filter {
 	 */
 	uint16_t appearance[CONFIG_BT_SCAN_APPEARANCE_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* Hash table of the appearances. */
+	uint16_t index[INDEX_SLOTS(CONFIG_BT_SCAN_APPEARANCE_CNT)];
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	/* Appearance filter counter. */
-	uint8_t cnt;
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -155,8 +197,16 @@ struct bt_scan_manufacturer_data_filter {
 		uint8_t data_len;
 	} manufacturer_data[CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT];
 
-	/* Name filter counter. */
-	uint8_t cnt;
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* Hash table of the manufacturer data. */
+	uint16_t index[INDEX_SLOTS(CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT)];
+
+	/* Lengths of the manufacturer data filters in use. */
+	bool len_used[CONFIG_BT_SCAN_MANUFACTURER_DATA_MAX_LEN + 1];
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
+	/* Manufacturer data filter counter. */
+	uint16_t cnt;
 
 	/* Flag to inform about enabling or disabling this filter. */
 	bool enabled;
@@ -506,12 +556,129 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 }
 #endif /* CONFIG_BT_CENTRAL */
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+#define INDEX_HASH_INIT 2166136261U
+
+/* Single step of the FNV-1a hash. */
+static inline uint32_t index_hash_update(uint32_t hash, uint8_t byte)
+{
+	return (hash ^ byte) * 16777619U;
+}
+
+static uint32_t index_hash(const void *data, size_t len)
+{
+	const uint8_t *bytes = data;
+	uint32_t hash = INDEX_HASH_INIT;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = index_hash_update(hash, bytes[i]);
+	}
+
+	return hash;
+}
+
+/* Check if the filter with the given index matches the key. */
+typedef bool (*index_match_t)(uint16_t idx, const void *key, size_t key_len);
+
+static int index_find(const uint16_t *index, size_t slots, uint32_t hash,
+		      index_match_t match, const void *key, size_t key_len)
+{
+	size_t slot = hash % slots;
+
+	/* The table is never full, so every probe sequence ends
+	 * with an empty slot.
+	 */
+	while (index[slot] != INDEX_SLOT_EMPTY) {
+		uint16_t idx = index[slot] - 1;
+
+		if (match(idx, key, key_len)) {
+			return idx;
+		}
+
+		slot = (slot + 1) % slots;
+	}
+
+	return -ENOENT;
+}
+
+static void index_insert(uint16_t *index, size_t slots, uint32_t hash,
+			 uint16_t idx)
+{
+	size_t slot = hash % slots;
+
+	while (index[slot] != INDEX_SLOT_EMPTY) {
+		slot = (slot + 1) % slots;
+	}
+
+	index[slot] = idx + 1;
+}
+
+/* Find the position of the first name in the sorted index that is not
+ * smaller than the key. At most key_len characters are compared, so all
+ * names starting with the key follow this position.
+ */
+static size_t name_index_lower_bound(const uint16_t *sorted, size_t cnt,
+				     const char *names, size_t name_size,
+				     const char *key, size_t key_len)
+{
+	size_t low = 0;
+	size_t high = cnt;
+
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		const char *name = &names[sorted[mid] * name_size];
+
+		if (strncmp(name, key, key_len) < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+static void name_index_insert(uint16_t *sorted, size_t cnt, size_t pos,
+			      uint16_t idx)
+{
+	memmove(&sorted[pos + 1], &sorted[pos], (cnt - pos) * sizeof(sorted[0]));
+	sorted[pos] = idx;
+}
+
+static bool addr_index_match(uint16_t idx, const void *key, size_t key_len)
+{
+	ARG_UNUSED(key_len);
+
+	return bt_addr_le_cmp(&bt_scan.scan_filters.addr.target_addr[idx],
+			      key) == 0;
+}
+
+static int addr_index_find(const bt_addr_le_t *addr)
+{
+	const uint16_t *index = bt_scan.scan_filters.addr.index;
+
+	return index_find(index, ARRAY_SIZE(bt_scan.scan_filters.addr.index),
+			  index_hash(addr, sizeof(*addr)), addr_index_match,
+			  addr, sizeof(*addr));
+}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			     struct bt_scan_control *control)
 {
 	const bt_addr_le_t *addr =
 			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	int idx = addr_index_find(target_addr);
+
+	if (idx >= 0) {
+		control->filter_status.addr.addr = &addr[idx];
+
+		return true;
+	}
+#else
+	uint16_t counter = bt_scan.scan_filters.addr.cnt;
 
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
@@ -520,6 +687,7 @@ static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			return true;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	return false;
 }
@@ -548,7 +716,7 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	char addr[BT_ADDR_LE_STR_LEN];
 	bt_addr_le_t *addr_filter =
 			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+	uint16_t counter = bt_scan.scan_filters.addr.cnt;
 
 	/* If no memory for filter. */
 	if (counter >= CONFIG_BT_SCAN_ADDRESS_CNT) {
@@ -556,15 +724,27 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	}
 
 	/* Check for duplicated filter. */
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	if (addr_index_find(target_addr) >= 0) {
+		return 0;
+	}
+#else
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_addr_le_cmp(target_addr, &addr_filter[i]) == 0) {
 			return 0;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	index_insert(bt_scan.scan_filters.addr.index,
+		     ARRAY_SIZE(bt_scan.scan_filters.addr.index),
+		     index_hash(target_addr, sizeof(*target_addr)), counter);
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
 
@@ -590,9 +770,33 @@ static bool adv_name_compare(const struct bt_data *data,
 {
 	struct bt_scan_name_filter const *name_filter =
 			&bt_scan.scan_filters.name;
-	uint8_t counter = bt_scan.scan_filters.name.cnt;
+	uint16_t counter = bt_scan.scan_filters.name.cnt;
 	uint8_t data_len = data->data_len;
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* The advertised name must be a prefix of the filter name. */
+	if (data_len > CONFIG_BT_SCAN_NAME_MAX_LEN) {
+		return false;
+	}
+
+	size_t pos = name_index_lower_bound(name_filter->sorted, counter,
+					    (const char *)name_filter->target_name,
+					    sizeof(name_filter->target_name[0]),
+					    (const char *)data->data, data_len);
+
+	if (pos < counter) {
+		uint16_t idx = name_filter->sorted[pos];
+
+		if (adv_name_cmp(data->data, data_len,
+				 name_filter->target_name[idx])) {
+			control->filter_status.name.name =
+				name_filter->target_name[idx];
+			control->filter_status.name.len = data_len;
+
+			return true;
+		}
+	}
+#else
 	/* Compare the name found with the name filter. */
 	for (size_t i = 0; i < counter; i++) {
 		if (adv_name_cmp(data->data,
@@ -606,6 +810,7 @@ static bool adv_name_compare(const struct bt_data *data,
 			return true;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	return false;
 }
@@ -631,7 +836,8 @@ static void name_check(struct bt_scan_control *control,
 
 static int scan_name_filter_add(const char *name)
 {
-	uint8_t counter = bt_scan.scan_filters.name.cnt;
+	struct bt_scan_name_filter *name_filter = &bt_scan.scan_filters.name;
+	uint16_t counter = bt_scan.scan_filters.name.cnt;
 	size_t name_len;
 
 	/* If no memory for filter. */
@@ -647,15 +853,36 @@ static int scan_name_filter_add(const char *name)
 	}
 
 	/* Check for duplicated filter. */
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	size_t pos = name_index_lower_bound(name_filter->sorted, counter,
+					    (const char *)name_filter->target_name,
+					    sizeof(name_filter->target_name[0]),
+					    name, name_len);
+
+	if ((pos < counter) &&
+	    !strncmp(name_filter->target_name[name_filter->sorted[pos]], name,
+		     CONFIG_BT_SCAN_NAME_MAX_LEN)) {
+		return 0;
+	}
+#else
 	for (size_t i = 0; i < counter; i++) {
-		if (!strcmp(bt_scan.scan_filters.name.target_name[i], name)) {
+		if (!strncmp(name_filter->target_name[i], name,
+			     CONFIG_BT_SCAN_NAME_MAX_LEN)) {
 			return 0;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
-	/* Add name to filter. */
-	memcpy(bt_scan.scan_filters.name.target_name[counter],
-	       name, name_len);
+	/* Add name to filter. The slot can hold a longer name
+	 * from before the filters were removed.
+	 */
+	memset(name_filter->target_name[counter], 0,
+	       sizeof(name_filter->target_name[counter]));
+	memcpy(name_filter->target_name[counter], name, name_len);
+
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	name_index_insert(name_filter->sorted, counter, pos, counter);
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	bt_scan.scan_filters.name.cnt++;
 
@@ -664,6 +891,7 @@ static int scan_name_filter_add(const char *name)
 	return 0;
 }
 
+#if !CONFIG_BT_SCAN_FILTER_INDEX
 static bool adv_short_name_cmp(const uint8_t *data,
 			       uint8_t data_len,
 			       const char *target_name,
@@ -676,15 +904,47 @@ static bool adv_short_name_cmp(const uint8_t *data,
 
 	return false;
 }
+#endif /* !CONFIG_BT_SCAN_FILTER_INDEX */
 
 static bool adv_short_name_compare(const struct bt_data *data,
 				   struct bt_scan_control *control)
 {
 	const struct bt_scan_short_name_filter *name_filter =
 			&bt_scan.scan_filters.short_name;
-	uint8_t counter = bt_scan.scan_filters.short_name.cnt;
+	uint16_t counter = bt_scan.scan_filters.short_name.cnt;
 	uint8_t data_len = data->data_len;
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	/* The advertised name must be a prefix of the filter name. */
+	if (data_len > CONFIG_BT_SCAN_SHORT_NAME_MAX_LEN) {
+		return false;
+	}
+
+	size_t pos = name_index_lower_bound(name_filter->sorted, counter,
+					    name_filter->name[0].target_name,
+					    sizeof(name_filter->name[0]),
+					    (const char *)data->data, data_len);
+
+	/* All filter names starting with the advertised name
+	 * follow each other in the index.
+	 */
+	for (; pos < counter; pos++) {
+		uint16_t idx = name_filter->sorted[pos];
+
+		if (strncmp(name_filter->name[idx].target_name, data->data,
+			    data_len) != 0) {
+			break;
+		}
+
+		if (data_len >= name_filter->name[idx].min_len) {
+			control->filter_status.short_name.name =
+				name_filter->name[idx].target_name;
+			control->filter_status.short_name.len = data_len;
+
+			return true;
+		}
+	}
+#else
 	/* Compare the name found with the name filters. */
 	for (size_t i = 0; i < counter; i++) {
 		if (adv_short_name_cmp(data->data,
@@ -699,6 +959,7 @@ static bool adv_short_name_compare(const struct bt_data *data,
 			return true;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	return false;
 }
@@ -724,7 +985,7 @@ static void short_name_check(struct bt_scan_control *control,
 
 static int scan_short_name_filter_add(const struct bt_scan_short_name *short_name)
 {
-	uint8_t counter =
+	uint16_t counter =
 		bt_scan.scan_filters.short_name.cnt;
 	struct bt_scan_short_name_filter *short_name_filter =
 		    &bt_scan.scan_filters.short_name;
@@ -744,19 +1005,41 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	}
 
 	/* Check for duplicated filter. */
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	size_t pos = name_index_lower_bound(short_name_filter->sorted, counter,
+					    short_name_filter->name[0].target_name,
+					    sizeof(short_name_filter->name[0]),
+					    short_name->name, name_len);
+
+	if ((pos < counter) &&
+	    !strncmp(short_name_filter->name[short_name_filter->sorted[pos]].target_name,
+		     short_name->name, CONFIG_BT_SCAN_SHORT_NAME_MAX_LEN)) {
+		return 0;
+	}
+#else
 	for (size_t i = 0; i < counter; i++) {
-		if (!strcmp(short_name_filter->name[i].target_name,
-			    short_name->name)) {
+		if (!strncmp(short_name_filter->name[i].target_name,
+			     short_name->name,
+			     CONFIG_BT_SCAN_SHORT_NAME_MAX_LEN)) {
 			return 0;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
-	/* Add name to the filter. */
+	/* Add name to the filter. The slot can hold a longer name
+	 * from before the filters were removed.
+	 */
 	short_name_filter->name[counter].min_len = short_name->min_len;
+	memset(short_name_filter->name[counter].target_name, 0,
+	       sizeof(short_name_filter->name[counter].target_name));
 	memcpy(short_name_filter->name[counter].target_name,
 	       short_name->name,
 	       name_len);
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	name_index_insert(short_name_filter->sorted, counter, pos, counter);
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	bt_scan.scan_filters.short_name.cnt++;
 
 	LOG_DBG("Adding filter on %s name", short_name->name);
@@ -764,6 +1047,156 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	return 0;
 }
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+/* Convert the UUID in the little-endian encoding used in the advertising data
+ * to the 128-bit representation, so that UUIDs of different types that have
+ * the same value are equal.
+ */
+static void uuid_index_key_from_le(const uint8_t *data, uint8_t len,
+				   uint8_t key[BT_SCAN_UUID_128_SIZE])
+{
+	static const uint8_t base_uuid[BT_SCAN_UUID_128_SIZE] = {
+		BT_UUID_128_ENCODE(0x00000000, 0x0000, 0x1000, 0x8000, 0x00805F9B34FB)
+	};
+
+	if (len == BT_SCAN_UUID_128_SIZE) {
+		memcpy(key, data, len);
+		return;
+	}
+
+	/* 16 and 32-bit UUIDs replace bytes 12-15 of the Bluetooth Base UUID. */
+	memcpy(key, base_uuid, sizeof(base_uuid));
+	memcpy(&key[12], data, len);
+}
+
+static void uuid_index_key(const struct bt_uuid *uuid,
+			   uint8_t key[BT_SCAN_UUID_128_SIZE])
+{
+	uint8_t val[sizeof(uint32_t)];
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		sys_put_le16(BT_UUID_16(uuid)->val, val);
+		uuid_index_key_from_le(val, sizeof(uint16_t), key);
+		break;
+
+	case BT_UUID_TYPE_32:
+		sys_put_le32(BT_UUID_32(uuid)->val, val);
+		uuid_index_key_from_le(val, sizeof(uint32_t), key);
+		break;
+
+	default:
+		uuid_index_key_from_le(BT_UUID_128(uuid)->val,
+				       BT_SCAN_UUID_128_SIZE, key);
+		break;
+	}
+}
+
+static bool uuid_index_match(uint16_t idx, const void *key, size_t key_len)
+{
+	uint8_t filter_key[BT_SCAN_UUID_128_SIZE];
+
+	uuid_index_key(bt_scan.scan_filters.uuid.uuid[idx].uuid, filter_key);
+
+	return memcmp(filter_key, key, key_len) == 0;
+}
+
+static int uuid_index_find(const uint8_t key[BT_SCAN_UUID_128_SIZE])
+{
+	const uint16_t *index = bt_scan.scan_filters.uuid.index;
+
+	return index_find(index, ARRAY_SIZE(bt_scan.scan_filters.uuid.index),
+			  index_hash(key, BT_SCAN_UUID_128_SIZE),
+			  uuid_index_match, key, BT_SCAN_UUID_128_SIZE);
+}
+
+static bool uuid_match_recorded(const struct bt_scan_control *control,
+				const struct bt_uuid *uuid)
+{
+	const struct bt_scan_uuid_filter_status *status =
+			&control->filter_status.uuid;
+
+	for (size_t i = 0; i < status->count; i++) {
+		if (status->uuid[i] == uuid) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
+			     struct bt_scan_control *control)
+{
+	const struct bt_scan_uuid_filter *uuid_filter =
+			&bt_scan.scan_filters.uuid;
+	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
+	const uint16_t counter = bt_scan.scan_filters.uuid.cnt;
+	struct bt_scan_uuid_filter_status *status = &control->filter_status.uuid;
+	uint8_t uuid_len;
+
+	switch (uuid_type) {
+	case BT_UUID_TYPE_16:
+		uuid_len = sizeof(uint16_t);
+		break;
+
+	case BT_UUID_TYPE_32:
+		uuid_len = sizeof(uint32_t);
+		break;
+
+	case BT_UUID_TYPE_128:
+		uuid_len = BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
+		break;
+
+	default:
+		return false;
+	}
+
+	status->count = 0;
+
+	/* Look up every advertised UUID instead of searching
+	 * the advertising data for every filter.
+	 */
+	for (size_t i = 0; i + uuid_len <= data->data_len; i += uuid_len) {
+		uint8_t key[BT_SCAN_UUID_128_SIZE];
+		const struct bt_uuid *uuid;
+		int idx;
+
+		uuid_index_key_from_le(&data->data[i], uuid_len, key);
+
+		idx = uuid_index_find(key);
+		if (idx < 0) {
+			continue;
+		}
+
+		/* The same UUID can be advertised more than once. */
+		uuid = uuid_filter->uuid[idx].uuid;
+		if (uuid_match_recorded(control, uuid)) {
+			continue;
+		}
+
+		status->uuid[status->count] = uuid;
+		status->count++;
+
+		/* In the normal filter mode,
+		 * only one UUID is needed to match.
+		 */
+		if (!all_filters_mode) {
+			break;
+		}
+	}
+
+	/* In the multifilter mode, all UUIDs must be found in
+	 * the advertisement packets.
+	 */
+	if ((all_filters_mode && (status->count == counter)) ||
+	    ((!all_filters_mode) && (status->count > 0))) {
+		return true;
+	}
+
+	return false;
+}
+#else
 static bool find_uuid(const uint8_t *data,
 		      uint8_t data_len,
 		      uint8_t uuid_type,
@@ -809,9 +1242,9 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 	const struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
 	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
-	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
+	const uint16_t counter = bt_scan.scan_filters.uuid.cnt;
 	uint8_t data_len = data->data_len;
-	uint8_t uuid_match_cnt = 0;
+	uint16_t uuid_match_cnt = 0;
 
 	for (size_t i = 0; i < counter; i++) {
 
@@ -846,6 +1279,7 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 
 	return false;
 }
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 static bool is_uuid_filter_enabled(void)
 {
@@ -870,7 +1304,7 @@ static void uuid_check(struct bt_scan_control *control,
 static int scan_uuid_filter_add(struct bt_uuid *uuid)
 {
 	struct bt_scan_uuid *uuid_filter = bt_scan.scan_filters.uuid.uuid;
-	uint8_t counter = bt_scan.scan_filters.uuid.cnt;
+	uint16_t counter = bt_scan.scan_filters.uuid.cnt;
 	struct bt_uuid_16 *uuid_16;
 	struct bt_uuid_32 *uuid_32;
 	struct bt_uuid_128 *uuid_128;
@@ -881,11 +1315,21 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 	}
 
 	/* Check for duplicated filter. */
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	uint8_t key[BT_SCAN_UUID_128_SIZE];
+
+	uuid_index_key(uuid, key);
+
+	if (uuid_index_find(key) >= 0) {
+		return 0;
+	}
+#else
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_uuid_cmp(uuid_filter[i].uuid, uuid) == 0) {
 			return 0;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	/* Add UUID to the filter. */
 	switch (uuid->type) {
@@ -917,12 +1361,19 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -EINVAL;
 	}
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	index_insert(bt_scan.scan_filters.uuid.index,
+		     ARRAY_SIZE(bt_scan.scan_filters.uuid.index),
+		     index_hash(key, sizeof(key)), counter);
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
 	return 0;
 }
 
+#if !CONFIG_BT_SCAN_FILTER_INDEX
 static bool find_appearance(const uint8_t *data,
 			    uint8_t data_len,
 			    const uint16_t *appearance)
@@ -940,16 +1391,52 @@ static bool find_appearance(const uint8_t *data,
 	/* Could not find the appearance among the encoded data. */
 	return false;
 }
+#endif /* !CONFIG_BT_SCAN_FILTER_INDEX */
+
+#if CONFIG_BT_SCAN_FILTER_INDEX
+static bool appearance_index_match(uint16_t idx, const void *key,
+				   size_t key_len)
+{
+	ARG_UNUSED(key_len);
+
+	return bt_scan.scan_filters.appearance.appearance[idx] ==
+	       *(const uint16_t *)key;
+}
+
+static int appearance_index_find(uint16_t appearance)
+{
+	const uint16_t *index = bt_scan.scan_filters.appearance.index;
+
+	return index_find(index, ARRAY_SIZE(bt_scan.scan_filters.appearance.index),
+			  index_hash(&appearance, sizeof(appearance)),
+			  appearance_index_match, &appearance, sizeof(appearance));
+}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 static bool adv_appearance_compare(const struct bt_data *data,
 				   struct bt_scan_control *control)
 {
 	const struct bt_scan_appearance_filter *appearance_filter =
 			&bt_scan.scan_filters.appearance;
-	const uint8_t counter =
-			bt_scan.scan_filters.appearance.cnt;
 	uint8_t data_len = data->data_len;
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	if (data_len != sizeof(uint16_t)) {
+		return false;
+	}
+
+	int idx = appearance_index_find(sys_get_be16(data->data));
+
+	if (idx >= 0) {
+		control->filter_status.appearance.appearance =
+				&appearance_filter->appearance[idx];
+
+		return true;
+	}
+#else
+	const uint16_t counter =
+			bt_scan.scan_filters.appearance.cnt;
+
 	/* Verify if the advertised appearance matches
 	 * the provided appearance.
 	 */
@@ -964,6 +1451,7 @@ static bool adv_appearance_compare(const struct bt_data *data,
 			return true;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	return false;
 }
@@ -990,7 +1478,7 @@ static void appearance_check(struct bt_scan_control *control,
 static int scan_appearance_filter_add(uint16_t appearance)
 {
 	uint16_t *appearance_filter = bt_scan.scan_filters.appearance.appearance;
-	uint8_t counter = bt_scan.scan_filters.appearance.cnt;
+	uint16_t counter = bt_scan.scan_filters.appearance.cnt;
 
 	/* If no memory. */
 	if (counter >= CONFIG_BT_SCAN_APPEARANCE_CNT) {
@@ -998,14 +1486,26 @@ static int scan_appearance_filter_add(uint16_t appearance)
 	}
 
 	/* Check for duplicated filter. */
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	if (appearance_index_find(appearance) >= 0) {
+		return 0;
+	}
+#else
 	for (size_t i = 0; i < counter; i++) {
 		if (appearance_filter[i] == appearance) {
 			return 0;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	/* Add appearance to the filter. */
 	appearance_filter[counter] = appearance;
+
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	index_insert(bt_scan.scan_filters.appearance.index,
+		     ARRAY_SIZE(bt_scan.scan_filters.appearance.index),
+		     index_hash(&appearance, sizeof(appearance)), counter);
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 	bt_scan.scan_filters.appearance.cnt++;
 
 	LOG_DBG("Added filter on appearance %x", appearance);
@@ -1029,12 +1529,69 @@ static bool adv_manufacturer_data_cmp(const uint8_t *data,
 	return true;
 }
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+static bool manufacturer_data_index_match(uint16_t idx, const void *key,
+					  size_t key_len)
+{
+	const struct bt_scan_manufacturer_data_filter *md_filter =
+		&bt_scan.scan_filters.manufacturer_data;
+
+	return (md_filter->manufacturer_data[idx].data_len == key_len) &&
+	       adv_manufacturer_data_cmp(key, key_len,
+					 md_filter->manufacturer_data[idx].data,
+					 md_filter->manufacturer_data[idx].data_len);
+}
+
+/* Find the filter which data is a prefix of the given data. */
+static int manufacturer_data_index_find(const uint8_t *data, uint8_t data_len)
+{
+	const struct bt_scan_manufacturer_data_filter *md_filter =
+		&bt_scan.scan_filters.manufacturer_data;
+	size_t len_max = MIN(data_len, CONFIG_BT_SCAN_MANUFACTURER_DATA_MAX_LEN);
+	uint32_t hash = INDEX_HASH_INIT;
+
+	/* Hash the prefixes incrementally and look up only
+	 * the lengths that the filters use.
+	 */
+	for (size_t len = 1; len <= len_max; len++) {
+		int idx;
+
+		hash = index_hash_update(hash, data[len - 1]);
+
+		if (!md_filter->len_used[len]) {
+			continue;
+		}
+
+		idx = index_find(md_filter->index, ARRAY_SIZE(md_filter->index),
+				 hash, manufacturer_data_index_match, data, len);
+		if (idx >= 0) {
+			return idx;
+		}
+	}
+
+	return -ENOENT;
+}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 static bool adv_manufacturer_data_compare(const struct bt_data *data,
 					  struct bt_scan_control *control)
 {
 	const struct bt_scan_manufacturer_data_filter *md_filter =
 		&bt_scan.scan_filters.manufacturer_data;
-	uint8_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
+
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	int idx = manufacturer_data_index_find(data->data, data->data_len);
+
+	if (idx >= 0) {
+		control->filter_status.manufacturer_data.data =
+			md_filter->manufacturer_data[idx].data;
+		control->filter_status.manufacturer_data.len =
+			md_filter->manufacturer_data[idx].data_len;
+
+		return true;
+	}
+#else
+	uint16_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
 
 	/* Compare the name found with the name filter. */
 	for (size_t i = 0; i < counter; i++) {
@@ -1051,6 +1608,7 @@ static bool adv_manufacturer_data_compare(const struct bt_data *data,
 			return true;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	return false;
 }
@@ -1078,7 +1636,7 @@ static int scan_manufacturer_data_filter_add(const struct bt_scan_manufacturer_d
 {
 	struct bt_scan_manufacturer_data_filter *md_filter =
 		&bt_scan.scan_filters.manufacturer_data;
-	uint8_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
+	uint16_t counter = bt_scan.scan_filters.manufacturer_data.cnt;
 
 	/* If no memory for filter. */
 	if (counter >= CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT) {
@@ -1093,6 +1651,12 @@ static int scan_manufacturer_data_filter_add(const struct bt_scan_manufacturer_d
 	}
 
 	/* Check for duplicated filter. */
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	if (manufacturer_data_index_find(manufacturer_data->data,
+					 manufacturer_data->data_len) >= 0) {
+		return 0;
+	}
+#else
 	for (size_t i = 0; i < counter; i++) {
 		if (adv_manufacturer_data_cmp(manufacturer_data->data,
 				manufacturer_data->data_len,
@@ -1101,6 +1665,7 @@ static int scan_manufacturer_data_filter_add(const struct bt_scan_manufacturer_d
 			return 0;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
 
 	/* Add manufacturer data to filter. */
 	memcpy(md_filter->manufacturer_data[counter].data,
@@ -1108,6 +1673,14 @@ static int scan_manufacturer_data_filter_add(const struct bt_scan_manufacturer_d
 	md_filter->manufacturer_data[counter].data_len =
 		manufacturer_data->data_len;
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	index_insert(md_filter->index, ARRAY_SIZE(md_filter->index),
+		     index_hash(manufacturer_data->data,
+				manufacturer_data->data_len),
+		     counter);
+	md_filter->len_used[manufacturer_data->data_len] = true;
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	bt_scan.scan_filters.manufacturer_data.cnt++;
 
 	LOG_DBG("Adding filter on manufacturer data");
@@ -1242,6 +1815,16 @@ void bt_scan_filter_remove_all(void)
 		&bt_scan.scan_filters.manufacturer_data;
 	manufacturer_data_filter->cnt = 0;
 
+#if CONFIG_BT_SCAN_FILTER_INDEX
+	memset(addr_filter->index, 0, sizeof(addr_filter->index));
+	memset(uuid_filter->index, 0, sizeof(uuid_filter->index));
+	memset(appearance_filter->index, 0, sizeof(appearance_filter->index));
+	memset(manufacturer_data_filter->index, 0,
+	       sizeof(manufacturer_data_filter->index));
+	memset(manufacturer_data_filter->len_used, 0,
+	       sizeof(manufacturer_data_filter->len_used));
+#endif /* CONFIG_BT_SCAN_FILTER_INDEX */
+
 	k_mutex_unlock(&scan_mutex);
 }
 
@@ -1457,6 +2040,22 @@ static bool adv_data_found(struct bt_data *data, void *user_data)
 	return true;
 }
 
+static bool adv_data_check_needed(const struct bt_scan_control *control)
+{
+	uint8_t adv_data_filter_cnt = control->filter_cnt;
+
+	if (is_addr_filter_enabled()) {
+		adv_data_filter_cnt--;
+
+		/* In the multifilter mode, all filter types must match. */
+		if (control->all_mode && !control->filter_status.addr.match) {
+			return false;
+		}
+	}
+
+	return adv_data_filter_cnt > 0;
+}
+
 static void filter_state_check(struct bt_scan_control *control,
 			       const bt_addr_le_t *addr)
 {
@@ -1511,10 +2110,13 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 
 	/* Save advertising buffer state to transfer it
 	 * data to application if futher processing is needed.
+	 * Skip the advertising data if it cannot change the result.
 	 */
-	net_buf_simple_save(ad, &state);
-	bt_data_parse(ad, adv_data_found, (void *)&scan_control);
-	net_buf_simple_restore(ad, &state);
+	if (adv_data_check_needed(&scan_control)) {
+		net_buf_simple_save(ad, &state);
+		bt_data_parse(ad, adv_data_found, (void *)&scan_control);
+		net_buf_simple_restore(ad, &state);
+	}
 
 	scan_control.device_info.recv_info = info;
 	scan_control.device_info.conn_param = &bt_scan.conn_param;
@@ -42,6 +42,24 @@ struct emp_cmd {
 	enum emp_cmd_code code;
 };
 
+/** @brief Flags of the start command. */
+enum emp_start_flags {
+	/** The core is able to receive batch messages. */
+	EMP_START_FLAG_BATCH_RX = BIT(0),
+	/** The core sends batch messages to the remotes able to receive them. */
+	EMP_START_FLAG_BATCH_TX = BIT(1),
+};
+
+/**
+ * @brief The command structure used to start.
+ *
+ * Older versions of the proxy send the command without the flags.
+ */
+struct emp_cmd_start {
+	enum emp_cmd_code code;
+	uint32_t flags;
+};
+
 /**
  * @brief The command structure used to subscribe.
  */
@@ -51,14 +69,46 @@ struct emp_cmd_subscribe {
 	char name[];
 };
 
+/**
+ * @brief Header of an event in a batch message.
+ *
+ * The header is followed by the event, padded to a multiple of 4 bytes.
+ */
+struct emp_batch_rec {
+	uint32_t len;
+};
+
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+/** @brief Events to be sent to the remote in one message. */
+struct emp_batch {
+	size_t len;
+	uint8_t send_attempts;
+	uint32_t buf[CONFIG_EVENT_MANAGER_PROXY_BATCH_SIZE / sizeof(uint32_t)];
+};
+#endif
+
 /** @brief Inter-core communication data. */
 struct emp_ipc_data {
 	struct ipc_ept ept;
 	struct ipc_ept_cfg ept_cfg;
 	bool used;
 	bool started;
+	/** Events sent to the remote are packed in batches. */
+	bool batch_tx;
+	/** Events received from the remote are packed in batches. */
+	bool batch_rx;
 	struct k_event bound;
 	const struct event_type **event_type_map;
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+	struct k_mutex batch_lock;
+	struct k_work_delayable batch_work;
+	/** Ring of batches, all but the last one are waiting to be sent. */
+	struct emp_batch batches[CONFIG_EVENT_MANAGER_PROXY_BATCH_COUNT];
+	uint8_t batch_first;
+	uint8_t batch_cnt;
+	/** The last batch is still being filled. */
+	bool batch_open;
+#endif
 };
 
 
@@ -159,6 +209,35 @@ static void handle_remote_event(struct emp_ipc_data *ipc, const void *data, size
 	_event_submit(event);
 }
 
+static void handle_remote_batch(struct emp_ipc_data *ipc, const void *data, size_t len)
+{
+	const uint8_t *buf = data;
+	size_t pos = 0;
+
+	while (pos < len) {
+		struct emp_batch_rec rec;
+
+		if ((len - pos) < sizeof(rec)) {
+			break;
+		}
+
+		memcpy(&rec, &buf[pos], sizeof(rec));
+		pos += sizeof(rec);
+
+		if (rec.len > (len - pos)) {
+			break;
+		}
+
+		handle_remote_event(ipc, &buf[pos], rec.len);
+		pos += ROUND_UP(rec.len, sizeof(uint32_t));
+	}
+
+	if (pos < len) {
+		LOG_ERR("Malformed event batch of size: %zu", len);
+		__ASSERT_NO_MSG(false);
+	}
+}
+
 static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
 	if (ipc->started) {
@@ -197,6 +276,14 @@ static void handle_remote_command_start(struct emp_ipc_data *ipc, const void *da
 		return;
 	}
 
+	const struct emp_cmd_start *cmd = data;
+
+	if (len >= sizeof(*cmd)) {
+		ipc->batch_tx = IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH) &&
+				(cmd->flags & EMP_START_FLAG_BATCH_RX);
+		ipc->batch_rx = (cmd->flags & EMP_START_FLAG_BATCH_TX) != 0;
+	}
+
 	ipc->started = true;
 
 	LOG_DBG("Event transmission on ipc %d started", ipc2idx(ipc));
@@ -256,7 +343,11 @@ static void handle_ipc_data_receive(const void *data, size_t len, void *priv)
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
 	if (ipc->started && emp_started) {
-		handle_remote_event(ipc, data, len);
+		if (ipc->batch_rx) {
+			handle_remote_batch(ipc, data, len);
+		} else {
+			handle_remote_event(ipc, data, len);
+		}
 	} else {
 		handle_remote_command(ipc, data, len);
 	}
@@ -274,24 +365,12 @@ static void handle_ipc_endpoint_error(const char *message, void *priv)
 	__ASSERT_NO_MSG(false);
 }
 
-static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+static int send_to_remote(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
-	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
 	int ret;
 
-	if (remote_ev == NULL) {
-		return 0;
-	}
-
-	size_t size = app_event_manager_event_size(eh);
-	uint32_t buffer[ceiling_fraction(size, sizeof(uint32_t))];
-	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
-
-	memcpy(buffer, eh, sizeof(buffer));
-	remote_eh->type_id = remote_ev;
-
 	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
-		ret = ipc_service_send(&ipc->ept, buffer, sizeof(buffer));
+		ret = ipc_service_send(&ipc->ept, data, len);
 		if (ret >= 0) {
 			break;
 		}
@@ -306,6 +385,216 @@ static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event
 	return ret;
 }
 
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+/**
+ * @brief Send the batches that are waiting, oldest first.
+ *
+ * A batch that cannot be sent is kept for a later attempt, unless it already
+ * failed @kconfig{CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES} times.
+ * Must be called with the batch lock held.
+ *
+ * @retval 0       All the batches that were waiting have been sent.
+ * @retval -EAGAIN Some batches are still waiting.
+ */
+static int batch_send_pending(struct emp_ipc_data *ipc)
+{
+	size_t waiting = ipc->batch_cnt - (ipc->batch_open ? 1 : 0);
+
+	while (waiting > 0) {
+		struct emp_batch *batch = &ipc->batches[ipc->batch_first];
+		int ret = ipc_service_send(&ipc->ept, batch->buf, batch->len);
+
+		if (ret < 0) {
+			if (++batch->send_attempts <= CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES) {
+				return -EAGAIN;
+			}
+
+			LOG_ERR("Cannot send event batch to remote %p, err: %d", ipc, ret);
+			__ASSERT_NO_MSG(false);
+		}
+
+		ipc->batch_first = (ipc->batch_first + 1) % ARRAY_SIZE(ipc->batches);
+		ipc->batch_cnt--;
+		waiting--;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Close the batch being filled and send it.
+ *
+ * Must be called with the batch lock held.
+ */
+static void batch_flush(struct emp_ipc_data *ipc)
+{
+	ipc->batch_open = false;
+
+	if (batch_send_pending(ipc)) {
+		k_work_reschedule(&ipc->batch_work, K_MSEC(1));
+	}
+}
+
+/**
+ * @brief Wait until at most the given number of batches are waiting to be sent.
+ *
+ * Must be called with the batch lock held, the lock is released while waiting.
+ */
+static void batch_wait(struct emp_ipc_data *ipc, size_t max_waiting)
+{
+	while ((ipc->batch_cnt - (ipc->batch_open ? 1 : 0)) > max_waiting) {
+		if (batch_send_pending(ipc)) {
+			k_mutex_unlock(&ipc->batch_lock);
+			k_sleep(K_MSEC(1));
+			k_mutex_lock(&ipc->batch_lock, K_FOREVER);
+		}
+	}
+}
+
+static void batch_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct emp_ipc_data *ipc = CONTAINER_OF(dwork, struct emp_ipc_data, batch_work);
+
+	k_mutex_lock(&ipc->batch_lock, K_FOREVER);
+	batch_flush(ipc);
+	k_mutex_unlock(&ipc->batch_lock);
+}
+
+/**
+ * @brief Drop an event of the same type from the batch being filled.
+ *
+ * The events that follow the dropped one are moved back, so that the new event
+ * appended to the batch does not overtake the events submitted before it.
+ */
+static void batch_coalesce(struct emp_batch *batch, const struct event_type *remote_ev)
+{
+	uint8_t *buf = (uint8_t *)batch->buf;
+	size_t pos = 0;
+
+	while (pos < batch->len) {
+		struct emp_batch_rec rec;
+		const struct event_type *rec_ev;
+		size_t rec_size;
+
+		memcpy(&rec, &buf[pos], sizeof(rec));
+		memcpy(&rec_ev, &buf[pos + sizeof(rec) + offsetof(struct app_event_header, type_id)],
+		       sizeof(rec_ev));
+		rec_size = sizeof(rec) + ROUND_UP(rec.len, sizeof(uint32_t));
+
+		if (rec_ev == remote_ev) {
+			memmove(&buf[pos], &buf[pos + rec_size], batch->len - pos - rec_size);
+			batch->len -= rec_size;
+			return;
+		}
+
+		pos += rec_size;
+	}
+}
+
+static int batch_add_event(struct emp_ipc_data *ipc, const struct app_event_header *eh,
+			   const struct event_type *remote_ev)
+{
+	size_t size = app_event_manager_event_size(eh);
+	struct emp_batch_rec rec = {.len = size};
+	size_t rec_size = sizeof(rec) + ROUND_UP(size, sizeof(uint32_t));
+	struct emp_batch *batch = NULL;
+	int ret = 0;
+
+	k_mutex_lock(&ipc->batch_lock, K_FOREVER);
+
+retry:
+	if (ipc->batch_open) {
+		batch = &ipc->batches[(ipc->batch_first + ipc->batch_cnt - 1) %
+				      ARRAY_SIZE(ipc->batches)];
+
+		if (app_event_get_type_flag(eh->type_id, APP_EVENT_TYPE_FLAGS_LATEST_VALUE)) {
+			batch_coalesce(batch, remote_ev);
+		}
+
+		if ((batch->len + rec_size) > sizeof(batch->buf)) {
+			batch_flush(ipc);
+			batch = NULL;
+		}
+	}
+
+	if (rec_size > sizeof(ipc->batches[0].buf)) {
+		/* Does not fit in a batch, send it alone after the batched events. */
+		uint32_t buffer[ceiling_fraction(rec_size, sizeof(uint32_t))];
+
+		batch_wait(ipc, 0);
+
+		memcpy(buffer, &rec, sizeof(rec));
+		memcpy(&buffer[1], eh, size);
+		memcpy((uint8_t *)&buffer[1] + offsetof(struct app_event_header, type_id),
+		       &remote_ev, sizeof(remote_ev));
+
+		ret = send_to_remote(ipc, buffer, rec_size);
+		goto out;
+	}
+
+	if (!batch) {
+		batch_wait(ipc, ARRAY_SIZE(ipc->batches) - 1);
+
+		if (ipc->batch_open) {
+			/* Another thread opened a batch while the lock was released. */
+			goto retry;
+		}
+
+		batch = &ipc->batches[(ipc->batch_first + ipc->batch_cnt) %
+				      ARRAY_SIZE(ipc->batches)];
+		batch->len = 0;
+		batch->send_attempts = 0;
+		ipc->batch_cnt++;
+		ipc->batch_open = true;
+
+		k_work_schedule(&ipc->batch_work,
+				K_MSEC(CONFIG_EVENT_MANAGER_PROXY_BATCH_TIMEOUT_MS));
+	}
+
+	uint8_t *pos = (uint8_t *)batch->buf + batch->len;
+
+	memcpy(pos, &rec, sizeof(rec));
+	memcpy(pos + sizeof(rec), eh, size);
+	memcpy(pos + sizeof(rec) + offsetof(struct app_event_header, type_id), &remote_ev,
+	       sizeof(remote_ev));
+	batch->len += rec_size;
+
+	if (app_event_get_type_flag(eh->type_id, APP_EVENT_TYPE_FLAGS_PRIORITY_HIGH)) {
+		batch_flush(ipc);
+	}
+
+out:
+	k_mutex_unlock(&ipc->batch_lock);
+
+	return ret;
+}
+#endif /* CONFIG_EVENT_MANAGER_PROXY_BATCH */
+
+static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+{
+	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
+
+	if (remote_ev == NULL) {
+		return 0;
+	}
+
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+	if (ipc->batch_tx) {
+		return batch_add_event(ipc, eh, remote_ev);
+	}
+#endif
+
+	size_t size = app_event_manager_event_size(eh);
+	uint32_t buffer[ceiling_fraction(size, sizeof(uint32_t))];
+	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
+
+	memcpy(buffer, eh, sizeof(buffer));
+	remote_eh->type_id = remote_ev;
+
+	return send_to_remote(ipc, buffer, sizeof(buffer));
+}
+
 static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
 {
 	int ret = 0;
@@ -336,6 +625,15 @@ static int add_ipc_instace(struct emp_ipc_data *ipc, const struct device *instan
 	}
 
 	ipc->started = false;
+	ipc->batch_tx = false;
+	ipc->batch_rx = false;
+#ifdef CONFIG_EVENT_MANAGER_PROXY_BATCH
+	k_mutex_init(&ipc->batch_lock);
+	k_work_init_delayable(&ipc->batch_work, batch_work_handler);
+	ipc->batch_first = 0;
+	ipc->batch_cnt = 0;
+	ipc->batch_open = false;
+#endif
 	ipc->ept_cfg = (struct ipc_ept_cfg) {
 		.name = "event_manager_proxy",
 		.cb = {
@@ -428,7 +726,12 @@ int event_manager_proxy_subscribe(const struct device *instance,
 
 static int send_start_command_to_remote(struct emp_ipc_data *ipc)
 {
-	const struct emp_cmd cmd = {.code = EMP_CMD_START};
+	const struct emp_cmd_start cmd = {
+		.code = EMP_CMD_START,
+		.flags = EMP_START_FLAG_BATCH_RX |
+			 (IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH) ?
+			  EMP_START_FLAG_BATCH_TX : 0)
+	};
 
 	__ASSERT_NO_MSG(ipc);
 
@@ -333,7 +333,8 @@ cleanup:
 	return err;
 }
 
-int socket_send(const struct download_client *client, size_t len, int timeout)
+int socket_send_buf(const struct download_client *client, const char *buf,
+		    size_t len, int timeout)
 {
 	int err;
 	int sent;
@@ -345,7 +346,7 @@ int socket_send(const struct download_client *client, size_t len, int timeout)
 	}
 
 	while (len) {
-		sent = send(client->fd, client->buf + off, len, 0);
+		sent = send(client->fd, buf + off, len, 0);
 		if (sent < 0) {
 			return -errno;
 		}
@@ -357,6 +358,11 @@ int socket_send(const struct download_client *client, size_t len, int timeout)
 	return 0;
 }
 
+int socket_send(const struct download_client *client, size_t len, int timeout)
+{
+	return socket_send_buf(client, client->buf, len, timeout);
+}
+
 static int request_send(struct download_client *dl)
 {
 	switch (dl->proto) {
@@ -417,6 +423,13 @@ static int reconnect(struct download_client *dl)
 		return err;
 	}
 
+	/* The requests in flight are lost with the connection,
+	 * request again from the last byte handed to the application.
+	 */
+	dl->http.requested = dl->progress;
+	dl->http.in_flight = 0;
+	dl->http.carry = 0;
+
 	return 0;
 }
 
@@ -496,7 +509,15 @@ wait_for_download:
 		LOG_DBG("Receiving up to %d bytes at %p...",
 			(sizeof(dl->buf) - dl->offset), (dl->buf + dl->offset));
 
-		len = socket_recv(dl);
+		if (dl->http.carry) {
+			/* Process the beginning of the next pipelined
+			 * response(s), received with the last fragment.
+			 */
+			len = dl->http.carry;
+			dl->http.carry = 0;
+		} else {
+			len = socket_recv(dl);
+		}
 
 		if ((len == 0) || (len == -1)) {
 			/* We just had an unexpected socket error or closure */
@@ -617,6 +638,9 @@ wait_for_download:
 		}
 
 send_again:
+		if (dl->http.carry) {
+			memmove(dl->buf, dl->buf + dl->offset, dl->http.carry);
+		}
 		dl->offset = 0;
 		/* Request next fragment, if necessary (HTTPS/CoAP) */
 		if (dl->proto != IPPROTO_TCP || len == 0
@@ -751,12 +775,23 @@ int download_client_start(struct download_client *client, const char *file,
 		return -ENOTCONN;
 	}
 
+	if (client->http.in_flight) {
+		/* A stopped download left responses pending on the socket */
+		err = reconnect(client);
+		if (err) {
+			return err;
+		}
+	}
+
 	client->file = file;
 	client->file_size = 0;
 	client->progress = from;
 
 	client->offset = 0;
 	client->http.has_header = false;
+	client->http.requested = from;
+	client->http.in_flight = 0;
+	client->http.carry = 0;
 
 	if (client->proto == IPPROTO_UDP || client->proto == IPPROTO_DTLS_1_2) {
 		if (IS_ENABLED(CONFIG_COAP)) {
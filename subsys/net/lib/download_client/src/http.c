@@ -43,12 +43,103 @@ LOG_MODULE_DECLARE(download_client, CONFIG_DOWNLOAD_CLIENT_LOG_LEVEL);
 int url_parse_host(const char *url, char *host, size_t len);
 int url_parse_file(const char *url, char *file, size_t len);
 int socket_send(const struct download_client *client, size_t len, int timeout);
+int socket_send_buf(const struct download_client *client, const char *buf,
+		    size_t len, int timeout);
 
-int http_get_request_send(struct download_client *client)
+static size_t http_frag_size(const struct download_client *client)
+{
+	if (client->config.frag_size_override) {
+		return client->config.frag_size_override;
+	}
+
+	return CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE;
+}
+
+static size_t http_pipeline_depth(const struct download_client *client)
+{
+	if (client->config.pipeline_depth) {
+		return client->config.pipeline_depth;
+	}
+
+	return CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINE_DEPTH;
+}
+
+/* Whether the file is requested one fragment at a time */
+static bool http_range_requests(const struct download_client *client)
+{
+	return (client->proto == IPPROTO_TLS_1_2 ||
+		IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_RANGE_REQUESTS));
+}
+
+static int http_range_request_send(struct download_client *client,
+				   const char *host, const char *file)
 {
 	int err;
 	int len;
 	size_t off;
+	char *req;
+	size_t req_size;
+
+	/* Keep sending requests for the next fragments until the pipeline
+	 * is full. Only one request is sent until the file size is known.
+	 */
+	while (client->http.in_flight < http_pipeline_depth(client)) {
+		if (client->file_size == 0 && client->http.in_flight > 0) {
+			break;
+		}
+
+		if (client->file_size != 0 &&
+		    client->http.requested >= client->file_size) {
+			break;
+		}
+
+		/* Offset of last byte in range (Content-Range) */
+		off = client->http.requested + http_frag_size(client) - 1;
+
+		if (client->file_size != 0) {
+			/* Don't request bytes past the end of file */
+			off = MIN(off, client->file_size - 1);
+		}
+
+		/* Do not overwrite the bytes of the next responses
+		 * which have been received with the last fragment.
+		 */
+		req = client->buf + client->http.carry;
+		req_size = sizeof(client->buf) - client->http.carry;
+
+		len = snprintf(req, req_size, HTTP_GET_RANGE, file, host,
+			       client->http.requested, off);
+		if (len < 0 || (size_t)len >= req_size) {
+			if (client->http.in_flight > 0) {
+				/* Try again after the next fragment */
+				break;
+			}
+
+			LOG_ERR("Cannot create GET request, buffer too small");
+			return -ENOMEM;
+		}
+
+		if (IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_LOG_HEADERS)) {
+			LOG_HEXDUMP_DBG(req, len, "HTTP request");
+		}
+
+		err = socket_send_buf(client, req, len, 0);
+		if (err) {
+			LOG_ERR("Failed to send HTTP request, errno %d", errno);
+			return err;
+		}
+
+		client->http.requested = off + 1;
+		client->http.in_flight++;
+	}
+
+	return 0;
+}
+
+int http_get_request_send(struct download_client *client)
+{
+	int err;
+	int len;
 	char host[HOSTNAME_SIZE];
 	char file[FILENAME_SIZE];
 
@@ -65,25 +156,11 @@ int http_get_request_send(struct download_client *client)
 		return err;
 	}
 
-	/* Offset of last byte in range (Content-Range) */
-	if (client->config.frag_size_override) {
-		off = client->progress + client->config.frag_size_override - 1;
-	} else {
-		off = client->progress +
-			CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE - 1;
-	}
-
-	if (client->file_size != 0) {
-		/* Don't request bytes past the end of file */
-		off = MIN(off, client->file_size - 1);
+	if (http_range_requests(client)) {
+		return http_range_request_send(client, host, file);
 	}
 
-	if (client->proto == IPPROTO_TLS_1_2
-	   || IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_RANGE_REQUESTS)) {
-		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
-			HTTP_GET_RANGE, file, host, client->progress, off);
-	} else if (client->progress) {
+	if (client->progress) {
 		len = snprintf(client->buf,
 			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
 			HTTP_GET_OFFSET, file, host, client->progress);
@@ -122,14 +199,12 @@ static int http_header_parse(struct download_client *client, size_t *hdr_len)
 	char *q;
 	unsigned int http_status;
 	const bool using_range_requests =
-		(client->proto == IPPROTO_TLS_1_2 ||
-		 IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_RANGE_REQUESTS) ||
-		 client->progress);
+		(http_range_requests(client) || client->progress);
 
 	const unsigned int expected_status = using_range_requests ? 206 : 200;
 
 	p = strstr(client->buf, "\r\n\r\n");
-	if (!p || p > client->buf + client->offset) {
+	if (!p || p + strlen("\r\n\r\n") > client->buf + client->offset) {
 		/* Waiting full HTTP header */
 		LOG_DBG("Waiting full header in response");
 		return 1;
@@ -235,6 +310,7 @@ int http_parse(struct download_client *client, size_t len)
 {
 	int rc;
 	size_t hdr_len;
+	size_t received;
 
 	/* Accumulate buffer offset */
 	client->offset += len;
@@ -257,8 +333,8 @@ int http_parse(struct download_client *client, size_t len)
 			 */
 			LOG_DBG("Copying %u payload bytes",
 				client->offset - hdr_len);
-			memcpy(client->buf, client->buf + hdr_len,
-			       client->offset - hdr_len);
+			memmove(client->buf, client->buf + hdr_len,
+				client->offset - hdr_len);
 
 			client->offset -= hdr_len;
 		} else {
@@ -267,6 +343,13 @@ int http_parse(struct download_client *client, size_t len)
 			 */
 			client->offset = 0;
 		}
+
+		if (http_range_requests(client)) {
+			/* Responses come in the order of the requests */
+			client->http.resp_end =
+				MIN(client->progress + http_frag_size(client),
+				    client->file_size);
+		}
 	}
 
 	/* Accumulate overall file progress.
@@ -276,15 +359,31 @@ int http_parse(struct download_client *client, size_t len)
 	 * `offset` is less than `len` and it represents
 	 * the actual payload bytes.
 	 */
-	client->progress += MIN(client->offset, len);
+	received = MIN(client->offset, len);
+
+	if (http_range_requests(client) &&
+	    client->progress + received > client->http.resp_end) {
+		/* The buffer also holds the beginning of the next pipelined
+		 * response(s). Leave it out of this fragment, it is
+		 * processed once the fragment has been handed over.
+		 */
+		client->http.carry =
+			client->progress + received - client->http.resp_end;
+		client->offset -= client->http.carry;
+		received -= client->http.carry;
+	}
+
+	client->progress += received;
 
 	/* Have we received a whole fragment or the whole file? */
 	if (client->progress != client->file_size &&
-	    client->offset < (client->config.frag_size_override != 0 ?
-			      client->config.frag_size_override :
-			      CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE)) {
+	    client->offset < http_frag_size(client)) {
 		return 1;
 	}
 
+	if (http_range_requests(client)) {
+		client->http.in_flight--;
+	}
+
 	return 0;
 }
@@ -199,6 +199,18 @@ void nrf_cloud_fota_job_free(struct nrf_cloud_fota_job_info *const job);
 int nrf_cloud_rest_fota_execution_parse(const char *const response,
 					struct nrf_cloud_fota_job_info *const job);
 
+/** @brief Decode a FOTA job array received over MQTT.
+ * The strings are unescaped in place, the job info and BLE ID point into the payload.
+ * If the job ID was decoded but another item was not, the job ID is kept
+ * so that the job can be rejected.
+ *
+ * @param[out] job_info Decoded job, the type is NRF_CLOUD_FOTA_TYPE__INVALID on failure.
+ * @param[out] ble_id If not NULL, a BLE job is expected and this is set to its BLE ID.
+ * @param[in,out] payload NULL-terminated job array, modified by the decoding.
+ */
+int nrf_cloud_fota_job_decode(struct nrf_cloud_fota_job_info *const job_info,
+			      char **const ble_id, char *const payload);
+
 #if defined(CONFIG_NRF_CLOUD_PGPS)
 /** @brief Parse the PGPS response (REST and MQTT) from nRF Cloud */
 int nrf_cloud_parse_pgps_response(const char *const response,
@@ -221,12 +233,22 @@ int nrf_cloud_format_single_cell_pos_req_json(cJSON * const req_obj_out);
 
 /** @brief Build a location request string using the provided info.
  * If successful, memory will be allocated for the output string and the user is
- * responsible for freeing it using @ref cJSON_free.
+ * responsible for freeing it using @ref nrf_cloud_free.
  */
 int nrf_cloud_format_location_req(struct lte_lc_cells_info const *const cell_info,
 				  struct wifi_scan_info const *const wifi_info,
 				  char **string_out);
 
+/** @brief Build a location request device message, to be sent on the d2c topic,
+ * using the provided info.
+ * If successful, memory will be allocated for the output data and the user is
+ * responsible for freeing it using @ref nrf_cloud_free.
+ */
+int nrf_cloud_location_req_msg_encode(struct lte_lc_cells_info const *const cell_info,
+				      struct wifi_scan_info const *const wifi_info,
+				      const bool request_loc,
+				      struct nrf_cloud_data *const output);
+
 /** @brief Build a WiFi positioning request in the provided cJSON object
  * using the provided WiFi info
  */
@@ -271,6 +293,13 @@ int nrf_cloud_parse_rest_error(const char *const buf, enum nrf_cloud_error *cons
 int nrf_cloud_pvt_data_encode(const struct nrf_cloud_gnss_pvt * const pvt,
 			      cJSON * const pvt_data_obj);
 
+/** @brief Encode a GNSS device message to be sent to nRF Cloud.
+ * If successful, memory will be allocated for the output data and the user is
+ * responsible for freeing it using @ref nrf_cloud_free.
+ */
+int nrf_cloud_gnss_msg_encode(const struct nrf_cloud_gnss_data *const gnss,
+			      struct nrf_cloud_data *const output);
+
 #if defined(CONFIG_NRF_MODEM)
 /** @brief Encode a modem PVT data frame to be sent to nRF Cloud */
 int nrf_cloud_modem_pvt_data_encode(const struct nrf_modem_gnss_pvt_data_frame	* const mdm_pvt,
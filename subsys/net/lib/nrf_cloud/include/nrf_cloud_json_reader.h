@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_JSON_READER_H__
+#define NRF_CLOUD_JSON_READER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum nesting depth of objects and arrays. */
+#define NRF_CLOUD_JSON_READER_DEPTH_MAX 32
+
+/** Maximum length of a number, longer numbers are not accepted by cJSON either. */
+#define NRF_CLOUD_JSON_NUM_LEN_MAX 63
+
+/** Token types. */
+enum nrf_cloud_json_type {
+	NRF_CLOUD_JSON_TOK_INVALID,
+	/** Start of an object, or a complete object if returned by @ref nrf_cloud_json_find. */
+	NRF_CLOUD_JSON_TOK_OBJ,
+	/** Start of an array, or a complete array if returned by @ref nrf_cloud_json_find. */
+	NRF_CLOUD_JSON_TOK_ARR,
+	NRF_CLOUD_JSON_TOK_OBJ_END,
+	NRF_CLOUD_JSON_TOK_ARR_END,
+	/** Key of an object member, always followed by the value. */
+	NRF_CLOUD_JSON_TOK_KEY,
+	NRF_CLOUD_JSON_TOK_STR,
+	NRF_CLOUD_JSON_TOK_NUM,
+	NRF_CLOUD_JSON_TOK_TRUE,
+	NRF_CLOUD_JSON_TOK_FALSE,
+	NRF_CLOUD_JSON_TOK_NULL,
+};
+
+/** @brief JSON token, referencing the input buffer.
+ *
+ * For keys and strings, the token holds the characters between the quotes,
+ * still escaped. For objects and arrays found with @ref nrf_cloud_json_find,
+ * the token holds the whole value, so that it can be searched in turn.
+ */
+struct nrf_cloud_json_tok {
+	const char *ptr;
+	size_t len;
+	enum nrf_cloud_json_type type;
+};
+
+/** @brief Pull JSON reader.
+ *
+ * Tokenizes a JSON document in place, one token per call to
+ * @ref nrf_cloud_json_next, without allocating any memory. The document is
+ * validated while it is read, and only the first root value is read,
+ * matching what cJSON_Parse() accepts.
+ */
+struct nrf_cloud_json_reader {
+	/** Input buffer. */
+	const char *buf;
+	/** Length of the input. */
+	size_t len;
+	/** Current position in the input. */
+	size_t pos;
+	/** First error that occurred, 0 if none. */
+	int err;
+	/** Current nesting depth. */
+	uint8_t depth;
+	/** Expected next token, internal. */
+	uint8_t state;
+	/** Bit per nesting level, set if the container is an array. */
+	uint32_t arrays;
+};
+
+/** @brief Initialize the reader.
+ *
+ * @param[out] r Reader.
+ * @param[in] buf Input buffer, does not need to be NULL terminated.
+ * @param[in] len Length of the input.
+ */
+void nrf_cloud_json_reader_init(struct nrf_cloud_json_reader *const r,
+				const char *const buf, const size_t len);
+
+/** @brief Read the next token.
+ *
+ * @retval 0 A token was read.
+ * @retval -ENODATA The root value has been read completely.
+ * @retval -EBADMSG The input is not valid JSON.
+ * @retval -E2BIG The input is nested too deeply.
+ */
+int nrf_cloud_json_next(struct nrf_cloud_json_reader *const r, struct nrf_cloud_json_tok *const tok);
+
+/** @brief Skip the value starting with the token just read.
+ *
+ * For an object or array start, all tokens up to and including the matching
+ * end are read. For any other token, nothing is done.
+ */
+int nrf_cloud_json_skip(struct nrf_cloud_json_reader *const r,
+			const struct nrf_cloud_json_tok *const tok);
+
+/** @brief Check that the input starts with a valid JSON value.
+ *
+ * @retval 0 The input is valid.
+ * @retval -EBADMSG The input is not valid JSON.
+ * @retval -E2BIG The input is nested too deeply.
+ */
+int nrf_cloud_json_validate(const char *const buf, const size_t len);
+
+/** @brief Find a value by its path.
+ *
+ * The path is a list of object keys and array indexes separated by '.',
+ * for example "state.pairing.topics.d2c" or "1". Keys are compared without
+ * regard to case, and the first matching member is used, the same way as
+ * cJSON_GetObjectItem() does. An empty path selects the root value.
+ *
+ * Only the part of the input needed to find the value is read, use
+ * @ref nrf_cloud_json_validate to check the whole input. As objects and
+ * arrays are read completely, finding the root value with an empty path
+ * also validates the input.
+ *
+ * @retval 0 The value was found.
+ * @retval -ENOENT The value was not found.
+ * @retval -EBADMSG The input is not valid JSON.
+ * @retval -E2BIG The input is nested too deeply.
+ */
+int nrf_cloud_json_find(const char *const buf, const size_t len, const char *const path,
+			struct nrf_cloud_json_tok *const tok);
+
+/** @brief Find a value by its path within an object or array found previously.
+ *
+ * @retval -ENOENT The value was not found, or the container is not an object or array.
+ */
+static inline int nrf_cloud_json_tok_find(const struct nrf_cloud_json_tok *const container,
+					  const char *const path,
+					  struct nrf_cloud_json_tok *const tok)
+{
+	if ((container->type != NRF_CLOUD_JSON_TOK_OBJ) &&
+	    (container->type != NRF_CLOUD_JSON_TOK_ARR)) {
+		return -ENOENT;
+	}
+
+	return nrf_cloud_json_find(container->ptr, container->len, path, tok);
+}
+
+/** @brief Compare a key or string with a NULL terminated string.
+ *
+ * @param[in] case_sensitive If false, ASCII letters are compared without regard to case.
+ *
+ * @return true if the unescaped token equals the string.
+ */
+bool nrf_cloud_json_str_eq(const struct nrf_cloud_json_tok *const tok, const char *const str,
+			   const bool case_sensitive);
+
+/** @brief Unescape a key or string into a NULL terminated string.
+ *
+ * The output can be the token itself, to unescape the string in place if the
+ * input buffer is writable. The string ends at the first escaped NULL
+ * character, if any.
+ *
+ * @retval Length of the string, excluding the NULL terminator.
+ * @retval -EINVAL The token is not a key or string.
+ * @retval -ENOBUFS The output buffer is too small.
+ */
+int nrf_cloud_json_str_get(const struct nrf_cloud_json_tok *const tok, char *const buf,
+			   const size_t size);
+
+/** @brief Unescape a key or string into a buffer allocated with nrf_cloud_malloc().
+ *
+ * @return The string, or NULL if the token is not a key or string or memory
+ *         could not be allocated. Free it with nrf_cloud_free().
+ */
+char *nrf_cloud_json_str_dup(const struct nrf_cloud_json_tok *const tok);
+
+/** @brief Get the value of a number.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL The token is not a number.
+ */
+int nrf_cloud_json_num_get(const struct nrf_cloud_json_tok *const tok, double *const val);
+
+/** @brief Get the value of a number as an integer, saturated the same way as
+ *  the valueint of cJSON is.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL The token is not a number.
+ */
+int nrf_cloud_json_int_get(const struct nrf_cloud_json_tok *const tok, int *const val);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_JSON_READER_H__ */
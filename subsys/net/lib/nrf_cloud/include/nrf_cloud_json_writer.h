@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_JSON_WRITER_H__
+#define NRF_CLOUD_JSON_WRITER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum nesting depth of objects and arrays. */
+#define NRF_CLOUD_JSON_WRITER_DEPTH_MAX 32
+
+/** @brief Streaming JSON writer.
+ *
+ * Encodes unformatted JSON directly into a caller-provided buffer, in the same
+ * format as cJSON_PrintUnformatted() would print the equivalent cJSON tree.
+ * If the writer is initialized without a buffer, nothing is stored and only the
+ * length of the output is computed.
+ *
+ * Errors are sticky: once an operation fails, all following operations are
+ * ignored and the error is reported by @ref nrf_cloud_json_writer_finish.
+ */
+struct nrf_cloud_json_writer {
+	/** Output buffer, NULL when only computing the size. */
+	char *buf;
+	/** Size of the output buffer. */
+	size_t size;
+	/** Length of the output encoded so far. */
+	size_t len;
+	/** First error that occurred, 0 if none. */
+	int err;
+	/** Current nesting depth. */
+	uint8_t depth;
+	/** Bit per nesting level, set if the container is an array. */
+	uint32_t arrays;
+	/** Bit per nesting level, set if the container already holds an item. */
+	uint32_t items;
+};
+
+/** @brief Encoding function used by @ref nrf_cloud_json_encode_alloc.
+ *
+ * The function must produce the same output every time it is called with the
+ * same context.
+ *
+ * @return 0 on success, otherwise a negative error code.
+ */
+typedef int (*nrf_cloud_json_encode_t)(struct nrf_cloud_json_writer *const w,
+				       const void *const ctx);
+
+/** @brief Initialize the writer.
+ *
+ * @param[out] w Writer.
+ * @param[in] buf Output buffer, or NULL to only compute the size of the output.
+ * @param[in] size Size of the output buffer, including the NULL terminator.
+ */
+void nrf_cloud_json_writer_init(struct nrf_cloud_json_writer *const w,
+				char *const buf, const size_t size);
+
+/** @brief Start an object.
+ *
+ * @param[in] key Key of the object in the enclosing object, NULL in an array
+ *		  or for the root object.
+ */
+int nrf_cloud_json_obj_start(struct nrf_cloud_json_writer *const w, const char *const key);
+
+/** @brief End the current object. */
+int nrf_cloud_json_obj_end(struct nrf_cloud_json_writer *const w);
+
+/** @brief Start an array.
+ *
+ * @param[in] key Key of the array in the enclosing object, NULL in an array
+ *		  or for the root array.
+ */
+int nrf_cloud_json_arr_start(struct nrf_cloud_json_writer *const w, const char *const key);
+
+/** @brief End the current array. */
+int nrf_cloud_json_arr_end(struct nrf_cloud_json_writer *const w);
+
+/** @brief Add a string. */
+int nrf_cloud_json_str_add(struct nrf_cloud_json_writer *const w, const char *const key,
+			   const char *const val);
+
+/** @brief Add a number, formatted the same way as cJSON formats it. */
+int nrf_cloud_json_num_add(struct nrf_cloud_json_writer *const w, const char *const key,
+			   const double val);
+
+/** @brief Add a null value. */
+int nrf_cloud_json_null_add(struct nrf_cloud_json_writer *const w, const char *const key);
+
+/** @brief Complete the output and NULL terminate it if a buffer is used.
+ *
+ * @retval Length of the output, excluding the NULL terminator.
+ * @retval -ENOBUFS The output buffer is too small.
+ * @retval -EINVAL The operations did not form a single complete JSON value.
+ */
+int nrf_cloud_json_writer_finish(struct nrf_cloud_json_writer *const w);
+
+/** @brief Encode into a buffer allocated with nrf_cloud_malloc().
+ *
+ * The encoding function is called twice: first to compute the size of the output,
+ * then to write it into a buffer of exactly that size. Only the output buffer
+ * is allocated. The user is responsible for freeing it with nrf_cloud_free().
+ *
+ * @param[in] encode Encoding function.
+ * @param[in] ctx Context passed to the encoding function.
+ * @param[out] string_out NULL terminated output.
+ * @param[out] len_out Length of the output, excluding the NULL terminator. Can be NULL.
+ *
+ * @retval 0 on success, otherwise a negative error code.
+ */
+int nrf_cloud_json_encode_alloc(nrf_cloud_json_encode_t encode, const void *const ctx,
+				char **string_out, size_t *len_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_JSON_WRITER_H__ */
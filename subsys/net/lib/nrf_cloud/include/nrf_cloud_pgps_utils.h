@@ -42,6 +42,16 @@ struct gps_location {
 	int64_t gps_sec;
 };
 
+/* Flash block of each stored prediction, in time order, for the set of
+ * predictions that starts at gps_day and gps_time_of_day
+ */
+struct npgps_block_map {
+	uint16_t gps_day;
+	uint32_t gps_time_of_day;
+	uint16_t prediction_count;
+	uint8_t blocks[NUM_PREDICTIONS];
+};
+
 struct nrf_cloud_pgps_header;
 
 typedef int (*npgps_buffer_handler_t)(uint8_t *buf, size_t len);
@@ -56,6 +66,9 @@ void npgps_download_unlock(void);
 int npgps_save_header(struct nrf_cloud_pgps_header *header);
 const struct nrf_cloud_pgps_header *npgps_get_saved_header(void);
 const struct gps_location *npgps_get_saved_location(void);
+int npgps_save_block_map(const struct npgps_block_map *map);
+int npgps_delete_block_map(void);
+const struct npgps_block_map *npgps_get_saved_block_map(void);
 int npgps_settings_init(void);
 
 /* time functions */
@@ -6,6 +6,8 @@
 
 #include "nrf_cloud_codec.h"
 #include "nrf_cloud_mem.h"
+#include "nrf_cloud_json_writer.h"
+#include "nrf_cloud_json_reader.h"
 #include "nrf_cloud_fsm.h"
 #include <net/nrf_cloud_location.h>
 #include <stdbool.h>
@@ -143,23 +145,6 @@ cJSON *json_create_req_obj(const char *const app_id, const char *const msg_type)
 	return req_obj;
 }
 
-static char *json_strdup(cJSON *const string_obj)
-{
-	char *dest;
-	char *src = cJSON_GetStringValue(string_obj);
-
-	if (!src) {
-		return NULL;
-	}
-
-	dest = nrf_cloud_calloc(strlen(src) + 1, 1);
-	if (dest) {
-		strcpy(dest, src);
-	}
-
-	return dest;
-}
-
 static int get_modem_info(struct modem_param_info *const modem_info)
 {
 	__ASSERT_NO_MSG(modem_info != NULL);
@@ -262,19 +247,52 @@ static int get_error_code_value(cJSON *const obj, enum nrf_cloud_error * const e
 	return 0;
 }
 
-#if defined(CONFIG_NRF_CLOUD_MQTT)
-static cJSON *json_object_decode(cJSON *obj, const char *str)
+static int json_tok_error_code_get(const struct nrf_cloud_json_tok *const obj,
+				   enum nrf_cloud_error *const err)
+{
+	struct nrf_cloud_json_tok err_tok;
+	double val;
+
+	if (nrf_cloud_json_tok_find(obj, NRF_CLOUD_JSON_ERR_KEY, &err_tok)) {
+		return -ENOMSG;
+	}
+
+	if (nrf_cloud_json_num_get(&err_tok, &val)) {
+		LOG_WRN("Invalid JSON data type for error value");
+		return -EBADMSG;
+	}
+
+	*err = (enum nrf_cloud_error)val;
+
+	return 0;
+}
+
+/* Check for a string member with the specified value, or a null member if val is NULL */
+static bool json_tok_string_exists(const struct nrf_cloud_json_tok *const obj,
+				   const char *const key, const char *const val)
 {
-	return obj ? cJSON_GetObjectItem(obj, str) : NULL;
+	struct nrf_cloud_json_tok item;
+
+	if (nrf_cloud_json_tok_find(obj, key, &item)) {
+		return false;
+	}
+
+	if (!val) {
+		return item.type == NRF_CLOUD_JSON_TOK_NULL;
+	}
+
+	return nrf_cloud_json_str_eq(&item, val, true);
 }
 
-static int json_decode_and_alloc(cJSON *obj, struct nrf_cloud_data *data)
+#if defined(CONFIG_NRF_CLOUD_MQTT)
+static int json_tok_decode_and_alloc(const struct nrf_cloud_json_tok *const tok,
+				     struct nrf_cloud_data *const data)
 {
-	if (!data || !cJSON_IsString(obj)) {
+	if (!data || tok->type != NRF_CLOUD_JSON_TOK_STR) {
 		return -EINVAL;
 	}
 
-	data->ptr = json_strdup(obj);
+	data->ptr = nrf_cloud_json_str_dup(tok);
 
 	if (data->ptr == NULL) {
 		return -ENOMEM;
@@ -290,22 +308,20 @@ static bool compare(const char *s1, const char *s2)
 	return !strncmp(s1, s2, strlen(s2));
 }
 
-static void nrf_cloud_decode_desired_obj(cJSON *root_obj,
-					 cJSON **desired_obj)
-{
-	cJSON *state_obj;
+/* Size of a buffer that holds the pairing states compared with compare() */
+#define PAIRING_STATE_SIZE MAX(sizeof(DUA_PIN_STR), sizeof(PAIRED_STR))
 
-	if ((root_obj != NULL) && (desired_obj != NULL)) {
-		/* On initial pairing, a shadow delta event is sent */
-		/* which does not include the "desired" JSON key, */
-		/* "state" is used instead */
-		state_obj = json_object_decode(root_obj, JSON_KEY_STATE);
-		if (state_obj == NULL) {
-			*desired_obj = json_object_decode(root_obj, JSON_KEY_DES);
-		} else {
-			*desired_obj = state_obj;
-		}
+static int nrf_cloud_decode_desired_obj(const struct nrf_cloud_json_tok *const root_obj,
+					struct nrf_cloud_json_tok *const desired_obj)
+{
+	/* On initial pairing, a shadow delta event is sent */
+	/* which does not include the "desired" JSON key, */
+	/* "state" is used instead */
+	if (!nrf_cloud_json_tok_find(root_obj, JSON_KEY_STATE, desired_obj)) {
+		return 0;
 	}
+
+	return nrf_cloud_json_tok_find(root_obj, JSON_KEY_DES, desired_obj);
 }
 
 int nrf_cloud_encode_shadow_data(const struct nrf_cloud_sensor_data *sensor,
@@ -344,10 +360,24 @@ int nrf_cloud_encode_shadow_data(const struct nrf_cloud_sensor_data *sensor,
 	return ret;
 }
 
+static int sensor_data_write(struct nrf_cloud_json_writer *const w, const void *const ctx)
+{
+	const struct nrf_cloud_sensor_data *sensor = ctx;
+
+	nrf_cloud_json_obj_start(w, NULL);
+	nrf_cloud_json_str_add(w, NRF_CLOUD_JSON_APPID_KEY, sensor_type_str[sensor->type]);
+	nrf_cloud_json_str_add(w, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
+	nrf_cloud_json_str_add(w, NRF_CLOUD_JSON_MSG_TYPE_KEY, NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+
+	return nrf_cloud_json_obj_end(w);
+}
+
 int nrf_cloud_encode_sensor_data(const struct nrf_cloud_sensor_data *sensor,
 				 struct nrf_cloud_data *output)
 {
 	int ret;
+	char *buffer;
+	size_t len;
 
 	__ASSERT_NO_MSG(sensor != NULL);
 	__ASSERT_NO_MSG(sensor->data.ptr != NULL);
@@ -355,33 +385,13 @@ int nrf_cloud_encode_sensor_data(const struct nrf_cloud_sensor_data *sensor,
 	__ASSERT_NO_MSG(output != NULL);
 	__ASSERT_NO_MSG(sensor->type < SENSOR_TYPE_ARRAY_SIZE);
 
-	cJSON *root_obj = cJSON_CreateObject();
-
-	if (root_obj == NULL) {
-		return -ENOMEM;
-	}
-
-	ret = json_add_str_cs(root_obj, NRF_CLOUD_JSON_APPID_KEY, sensor_type_str[sensor->type]);
-	ret += json_add_str_cs(root_obj, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
-	ret += json_add_str_cs(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
-			       NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
-
-	if (ret != 0) {
-		cJSON_Delete(root_obj);
-		return -ENOMEM;
-	}
-
-	char *buffer;
-
-	buffer = cJSON_PrintUnformatted(root_obj);
-	cJSON_Delete(root_obj);
-
-	if (buffer == NULL) {
-		return -ENOMEM;
+	ret = nrf_cloud_json_encode_alloc(sensor_data_write, sensor, &buffer, &len);
+	if (ret) {
+		return ret;
 	}
 
 	output->ptr = buffer;
-	output->len = strlen(buffer);
+	output->len = len;
 
 	return 0;
 }
@@ -401,15 +411,14 @@ int nrf_cloud_decode_requested_state(const struct nrf_cloud_data *input,
 	__ASSERT_NO_MSG(input->ptr != NULL);
 	__ASSERT_NO_MSG(input->len != 0);
 
-	cJSON *root_obj;
-	cJSON *desired_obj;
-	cJSON *pairing_obj;
-	cJSON *pairing_state_obj;
-	cJSON *topic_prefix_obj;
-
-	root_obj = cJSON_Parse(input->ptr);
-	if (root_obj == NULL) {
-		LOG_ERR("cJSON_Parse failed: %s", (char *)input->ptr);
+	struct nrf_cloud_json_tok root_obj;
+	struct nrf_cloud_json_tok desired_obj;
+	struct nrf_cloud_json_tok tok;
+	char state_str[PAIRING_STATE_SIZE];
+	int err;
+
+	if (nrf_cloud_json_find(input->ptr, strlen(input->ptr), "", &root_obj)) {
+		LOG_ERR("Invalid JSON: %s", (char *)input->ptr);
 		return -ENOENT;
 	}
 
@@ -417,57 +426,60 @@ int nrf_cloud_decode_requested_state(const struct nrf_cloud_data *input,
 	int ret;
 
 	if (gateway_state_handler) {
-		ret = gateway_state_handler(root_obj);
+		cJSON *gw_root_obj = cJSON_Parse(input->ptr);
+
+		if (gw_root_obj == NULL) {
+			LOG_ERR("cJSON_Parse failed: %s", (char *)input->ptr);
+			return -ENOENT;
+		}
+
+		ret = gateway_state_handler(gw_root_obj);
+		cJSON_Delete(gw_root_obj);
 		if (ret != 0) {
 			LOG_ERR("Error from gateway_state_handler: %d", ret);
-			cJSON_Delete(root_obj);
 			return ret;
 		}
 	} else {
 		LOG_ERR("No gateway state handler registered");
-		cJSON_Delete(root_obj);
 		return -EINVAL;
 	}
 #endif /* CONFIG_NRF_CLOUD_GATEWAY */
 
-	nrf_cloud_decode_desired_obj(root_obj, &desired_obj);
+	err = nrf_cloud_decode_desired_obj(&root_obj, &desired_obj);
+
+	if (!err && !nrf_cloud_json_tok_find(&desired_obj, JSON_KEY_TOPIC_PRFX, &tok)) {
+		char topic_prefix[NRF_CLOUD_STAGE_ID_MAX_LEN + NRF_CLOUD_TENANT_ID_MAX_LEN + 2] = "";
 
-	topic_prefix_obj =
-		json_object_decode(desired_obj, JSON_KEY_TOPIC_PRFX);
-	if (topic_prefix_obj != NULL) {
-		nct_set_topic_prefix(topic_prefix_obj->valuestring);
+		/* A truncated prefix is truncated further by the transport anyway */
+		(void)nrf_cloud_json_str_get(&tok, topic_prefix, sizeof(topic_prefix));
+		nct_set_topic_prefix(topic_prefix);
 		(*requested_state) = STATE_UA_PIN_COMPLETE;
-		cJSON_Delete(root_obj);
 		return 0;
 	}
 
-	pairing_obj = json_object_decode(desired_obj, JSON_KEY_PAIRING);
-	pairing_state_obj = json_object_decode(pairing_obj, JSON_KEY_STATE);
-
-	if (!pairing_state_obj || pairing_state_obj->type != cJSON_String) {
+	if (err || nrf_cloud_json_tok_find(&desired_obj, JSON_KEY_PAIRING "." JSON_KEY_STATE,
+					   &tok) ||
+	    tok.type != NRF_CLOUD_JSON_TOK_STR) {
 #ifndef CONFIG_NRF_CLOUD_GATEWAY
-		if (cJSON_HasObjectItem(desired_obj, JSON_KEY_CFG) == false) {
+		if (err || nrf_cloud_json_tok_find(&desired_obj, JSON_KEY_CFG, &tok)) {
 			LOG_WRN("Unhandled data received from nRF Cloud.");
 			LOG_INF("Ensure device firmware is up to date.");
 			LOG_INF("Delete and re-add device to nRF Cloud if problem persists.");
 		}
 #endif
-		cJSON_Delete(root_obj);
 		return -ENOENT;
 	}
 
-	const char *state_str = pairing_state_obj->valuestring;
+	/* Only the beginning of the state is compared */
+	(void)nrf_cloud_json_str_get(&tok, state_str, sizeof(state_str));
 
 	if (compare(state_str, DUA_PIN_STR)) {
 		(*requested_state) = STATE_UA_PIN_WAIT;
 	} else {
 		LOG_ERR("Deprecated state. Delete device from nRF Cloud and update device with JITP certificates.");
-		cJSON_Delete(root_obj);
 		return -ENOTSUP;
 	}
 
-	cJSON_Delete(root_obj);
-
 	return 0;
 }
 
@@ -658,52 +670,46 @@ int nrf_cloud_decode_data_endpoint(const struct nrf_cloud_data *input,
 	__ASSERT_NO_MSG(bulk_endpoint != NULL);
 
 	int err;
-	cJSON *root_obj;
-	cJSON *m_endpoint_obj = NULL;
-	cJSON *desired_obj = NULL;
-
-	root_obj = cJSON_Parse(input->ptr);
-	if (root_obj == NULL) {
-		return -ENOENT;
-	}
-
-	nrf_cloud_decode_desired_obj(root_obj, &desired_obj);
-
-	if (m_endpoint != NULL) {
-		m_endpoint_obj = json_object_decode(
-			desired_obj, "nrfcloud_mqtt_topic_prefix");
-	}
-
-	cJSON *pairing_obj = json_object_decode(desired_obj, JSON_KEY_PAIRING);
-	cJSON *pairing_state_obj = json_object_decode(pairing_obj, JSON_KEY_STATE);
-	cJSON *topic_obj = json_object_decode(pairing_obj, JSON_KEY_TOPICS);
-
-	if ((pairing_state_obj == NULL) || (topic_obj == NULL) ||
-	    (pairing_state_obj->type != cJSON_String)) {
-		cJSON_Delete(root_obj);
+	struct nrf_cloud_json_tok root_obj;
+	struct nrf_cloud_json_tok desired_obj;
+	struct nrf_cloud_json_tok pairing_obj;
+	struct nrf_cloud_json_tok pairing_state_obj;
+	struct nrf_cloud_json_tok topic_obj;
+	struct nrf_cloud_json_tok tok;
+	char state_str[PAIRING_STATE_SIZE];
+
+	if (nrf_cloud_json_find(input->ptr, strlen(input->ptr), "", &root_obj) ||
+	    nrf_cloud_decode_desired_obj(&root_obj, &desired_obj) ||
+	    nrf_cloud_json_tok_find(&desired_obj, JSON_KEY_PAIRING, &pairing_obj) ||
+	    nrf_cloud_json_tok_find(&pairing_obj, JSON_KEY_STATE, &pairing_state_obj) ||
+	    nrf_cloud_json_tok_find(&pairing_obj, JSON_KEY_TOPICS, &topic_obj) ||
+	    (pairing_state_obj.type != NRF_CLOUD_JSON_TOK_STR)) {
 		return -ENOENT;
 	}
 
-	const char *state_str = pairing_state_obj->valuestring;
+	/* Only the beginning of the state is compared */
+	(void)nrf_cloud_json_str_get(&pairing_state_obj, state_str, sizeof(state_str));
 
 	if (!compare(state_str, PAIRED_STR)) {
-		cJSON_Delete(root_obj);
 		return -ENOENT;
 	}
 
-	if (m_endpoint_obj != NULL) {
-		err = json_decode_and_alloc(m_endpoint_obj, m_endpoint);
+	if ((m_endpoint != NULL) &&
+	    !nrf_cloud_json_tok_find(&desired_obj, JSON_KEY_TOPIC_PRFX, &tok)) {
+		err = json_tok_decode_and_alloc(&tok, m_endpoint);
 		if (err) {
-			cJSON_Delete(root_obj);
 			return err;
 		}
 	}
 
-	cJSON *tx_obj = json_object_decode(topic_obj, JSON_KEY_DEVICE_TO_CLOUD);
+	err = nrf_cloud_json_tok_find(&topic_obj, JSON_KEY_DEVICE_TO_CLOUD, &tok);
+	if (!err) {
+		err = json_tok_decode_and_alloc(&tok, tx_endpoint);
+	} else {
+		err = -EINVAL;
+	}
 
-	err = json_decode_and_alloc(tx_obj, tx_endpoint);
 	if (err) {
-		cJSON_Delete(root_obj);
 		LOG_ERR("Could not decode topic for %s", JSON_KEY_DEVICE_TO_CLOUD);
 		return err;
 	}
@@ -715,7 +721,6 @@ int nrf_cloud_decode_data_endpoint(const struct nrf_cloud_data *input,
 
 	bulk_endpoint->ptr = nrf_cloud_calloc(bulk_ep_len_temp, 1);
 	if (bulk_endpoint->ptr == NULL) {
-		cJSON_Delete(root_obj);
 		LOG_ERR("Could not allocate memory for bulk topic");
 		return -ENOMEM;
 	}
@@ -724,17 +729,19 @@ int nrf_cloud_decode_data_endpoint(const struct nrf_cloud_data *input,
 				       (char *)tx_endpoint->ptr,
 				       NRF_CLOUD_BULK_MSG_TOPIC);
 
-	err = json_decode_and_alloc(json_object_decode(topic_obj, JSON_KEY_CLOUD_TO_DEVICE),
-				    rx_endpoint);
+	err = nrf_cloud_json_tok_find(&topic_obj, JSON_KEY_CLOUD_TO_DEVICE, &tok);
+	if (!err) {
+		err = json_tok_decode_and_alloc(&tok, rx_endpoint);
+	} else {
+		err = -EINVAL;
+	}
+
 	if (err) {
-		cJSON_Delete(root_obj);
 		LOG_ERR("Failed to parse \"%s\" from JSON, error: %d",
 			JSON_KEY_CLOUD_TO_DEVICE, err);
 		return err;
 	}
 
-	cJSON_Delete(root_obj);
-
 	return err;
 }
 
@@ -1051,7 +1058,7 @@ static int encode_modem_info_network(struct network_param *network, cJSON *json_
 		return ret;
 	}
 
-	if (cJSON_AddNumberToObjectCS(json_obj, data_name, network->cellid_dec) == NULL) {
+	if (cJSON_AddNumberToObject(json_obj, data_name, network->cellid_dec) == NULL) {
 		return -EINVAL;
 	}
 
@@ -1202,13 +1209,8 @@ static int encode_modem_info_json_object(struct modem_param_info *modem,
 	return 0;
 }
 
-int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mod_inf,
-				     cJSON *const mod_inf_obj)
+static int modem_info_check(const struct nrf_cloud_modem_info *const mod_inf)
 {
-	if (!mod_inf_obj || !mod_inf) {
-		return -EINVAL;
-	}
-
 	if ((!IS_ENABLED(CONFIG_MODEM_INFO_ADD_DEVICE)) &&
 		   (mod_inf->device == NRF_CLOUD_INFO_SET)) {
 		LOG_ERR("CONFIG_MODEM_INFO_ADD_DEVICE is not enabled, unable to add device info");
@@ -1223,7 +1225,46 @@ int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mo
 		return -EACCES;
 	}
 
-	int err = 0;
+	return 0;
+}
+
+static int modem_info_fetch(struct modem_param_info *const mpi)
+{
+	int err = modem_info_init();
+
+	if (err) {
+		LOG_ERR("modem_info_init() failed: %d", err);
+		return err;
+	}
+
+	err = modem_info_params_init(mpi);
+	if (err) {
+		LOG_ERR("modem_info_params_init() failed: %d", err);
+		return err;
+	}
+
+	err = modem_info_params_get(mpi);
+	if (err < 0) {
+		LOG_ERR("modem_info_params_get() failed: %d", err);
+		return err;
+	}
+
+	return 0;
+}
+
+int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mod_inf,
+				     cJSON *const mod_inf_obj)
+{
+	if (!mod_inf_obj || !mod_inf) {
+		return -EINVAL;
+	}
+
+	int err = modem_info_check(mod_inf);
+
+	if (err) {
+		return err;
+	}
+
 	cJSON *tmp = cJSON_CreateObject();
 
 	if (!tmp) {
@@ -1235,21 +1276,8 @@ int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mo
 	struct modem_param_info fetched_mod_inf;
 
 	if (!mpi) {
-		err = modem_info_init();
-		if (err) {
-			LOG_ERR("modem_info_init() failed: %d", err);
-			goto cleanup;
-		}
-
-		err = modem_info_params_init(&fetched_mod_inf);
+		err = modem_info_fetch(&fetched_mod_inf);
 		if (err) {
-			LOG_ERR("modem_info_params_init() failed: %d", err);
-			goto cleanup;
-		}
-
-		err = modem_info_params_get(&fetched_mod_inf);
-		if (err < 0) {
-			LOG_ERR("modem_info_params_get() failed: %d", err);
 			goto cleanup;
 		}
 		mpi = &fetched_mod_inf;
@@ -1276,6 +1304,106 @@ cleanup:
 	cJSON_Delete(tmp);
 	return err;
 }
+
+static int write_modem_info_data(struct nrf_cloud_json_writer *const w,
+				 const struct lte_param *const param)
+{
+	char data_name[MODEM_INFO_MAX_RESPONSE_SIZE] = {0};
+	enum at_param_type data_type;
+	int ret;
+
+	ret = modem_info_name_get(param->type, data_name);
+	if (ret < 0) {
+		LOG_DBG("Data name not obtained: %d", ret);
+		return -EINVAL;
+	}
+
+	data_type = modem_info_type_get(param->type);
+	if (data_type < 0) {
+		return -EINVAL;
+	}
+
+	if (data_type == AT_PARAM_TYPE_STRING &&
+	    param->type != MODEM_INFO_AREA_CODE) {
+		return nrf_cloud_json_str_add(w, data_name, param->value_string);
+	}
+
+	return nrf_cloud_json_num_add(w, data_name, param->value);
+}
+
+static int write_modem_info_network(struct nrf_cloud_json_writer *const w,
+				    const struct modem_param_info *const mpi)
+{
+	const struct network_param *network = &mpi->network;
+	char network_mode[12] = {0};
+	char data_name[MODEM_INFO_MAX_RESPONSE_SIZE] = {0};
+	int ret;
+
+	if (write_modem_info_data(w, &network->current_band) ||
+	    write_modem_info_data(w, &network->sup_band) ||
+	    write_modem_info_data(w, &network->area_code) ||
+	    write_modem_info_data(w, &network->current_operator) ||
+	    write_modem_info_data(w, &network->ip_address) ||
+	    write_modem_info_data(w, &network->ue_mode)) {
+		return -EINVAL;
+	}
+
+	ret = modem_info_name_get(network->cellid_hex.type, data_name);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (network->lte_mode.value == 1) {
+		strcat(network_mode, "LTE-M");
+	} else if (network->nbiot_mode.value == 1) {
+		strcat(network_mode, "NB-IoT");
+	}
+	if (network->gps_mode.value == 1) {
+		strcat(network_mode, " GPS");
+	}
+
+	nrf_cloud_json_num_add(w, data_name, network->cellid_dec);
+
+	return nrf_cloud_json_str_add(w, "networkMode", network_mode);
+}
+
+static int write_modem_info_sim(struct nrf_cloud_json_writer *const w,
+				const struct modem_param_info *const mpi)
+{
+	int ret;
+
+	ret = write_modem_info_data(w, &mpi->sim.uicc);
+	if (ret) {
+		return ret;
+	}
+
+	/* Nothing is written if the data name or type can not be obtained */
+	if (write_modem_info_data(w, &mpi->sim.iccid) && !w->err) {
+		LOG_DBG("sim_param object does not contain an ICCID");
+	}
+
+	if (write_modem_info_data(w, &mpi->sim.imsi) && !w->err) {
+		LOG_DBG("sim_param object does not contain an IMSI");
+	}
+
+	return w->err;
+}
+
+static int write_modem_info_device(struct nrf_cloud_json_writer *const w,
+				   const struct modem_param_info *const mpi)
+{
+	const struct device_param *device = &mpi->device;
+
+	if (write_modem_info_data(w, &device->modem_fw) ||
+	    write_modem_info_data(w, &device->battery) ||
+	    write_modem_info_data(w, &device->imei) ||
+	    nrf_cloud_json_str_add(w, "board", device->board) ||
+	    nrf_cloud_json_str_add(w, "appVersion", device->app_version)) {
+		return -EINVAL;
+	}
+
+	return nrf_cloud_json_str_add(w, "appName", device->app_name);
+}
 #else
 int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mod_inf,
 				     cJSON *const mod_inf_obj)
@@ -1313,72 +1441,224 @@ int nrf_cloud_service_info_json_encode(const struct nrf_cloud_svc_info *const sv
 	return nrf_cloud_encode_service_info_ui(svc_inf->ui, svc_inf_obj);
 }
 
-void nrf_cloud_device_status_free(struct nrf_cloud_data *status)
-{
-	if (status && status->ptr) {
-		cJSON_free((void *)status->ptr);
-		status->ptr = NULL;
-		status->len = 0;
-	}
-}
-
-int nrf_cloud_device_status_encode(const struct nrf_cloud_device_status *const dev_status,
-	struct nrf_cloud_data * const output, const bool include_state)
+static int write_service_info(struct nrf_cloud_json_writer *const w,
+			      const struct nrf_cloud_svc_info *const svc_inf)
 {
-	if (!dev_status || !output) {
-		return -EINVAL;
-	}
+	const struct nrf_cloud_svc_info_fota *fota = svc_inf->fota;
+	const struct nrf_cloud_svc_info_ui *ui = svc_inf->ui;
 
-	int err = 0;
-	cJSON *state_obj = NULL;
-	cJSON *reported_obj = NULL;
-	cJSON *root_obj = cJSON_CreateObject();
+	if (fota == NULL ||
+	    (IS_ENABLED(CONFIG_NRF_CLOUD_MQTT) && !IS_ENABLED(CONFIG_NRF_CLOUD_FOTA))) {
+		if (fota && (fota->application || fota->modem || fota->bootloader)) {
+			LOG_WRN("CONFIG_NRF_CLOUD_FOTA not enabled, setting FOTA array to 'null'");
+		}
 
-	if (include_state) {
-		state_obj = cJSON_AddObjectToObjectCS(root_obj, JSON_KEY_STATE);
-		reported_obj = cJSON_AddObjectToObjectCS(state_obj, JSON_KEY_REP);
+		nrf_cloud_json_null_add(w, JSON_KEY_SRVC_INFO_FOTA);
 	} else {
-		reported_obj = cJSON_AddObjectToObjectCS(root_obj, JSON_KEY_REP);
+		nrf_cloud_json_arr_start(w, JSON_KEY_SRVC_INFO_FOTA);
+		if (fota->bootloader) {
+			nrf_cloud_json_str_add(w, NULL, NRF_CLOUD_FOTA_TYPE_BOOT);
+		}
+		if (fota->modem) {
+			nrf_cloud_json_str_add(w, NULL, NRF_CLOUD_FOTA_TYPE_MODEM_DELTA);
+		}
+		if (fota->application) {
+			nrf_cloud_json_str_add(w, NULL, NRF_CLOUD_FOTA_TYPE_APP);
+		}
+		if (fota->modem_full) {
+			nrf_cloud_json_str_add(w, NULL, NRF_CLOUD_FOTA_TYPE_MODEM_FULL);
+		}
+		nrf_cloud_json_arr_end(w);
 	}
 
-	cJSON *device_obj = cJSON_AddObjectToObjectCS(reported_obj, JSON_KEY_DEVICE);
-	cJSON *svc_inf_obj = cJSON_AddObjectToObjectCS(device_obj, JSON_KEY_SRVC_INFO);
-
-	if (svc_inf_obj == NULL) {
-		err = -ENOMEM;
-		goto cleanup;
+	if (ui == NULL) {
+		return nrf_cloud_json_null_add(w, JSON_KEY_SRVC_INFO_UI);
 	}
 
-	if (dev_status->modem) {
-		err = nrf_cloud_modem_info_json_encode(dev_status->modem, device_obj);
-		if (err) {
-			goto cleanup;
-		}
+	nrf_cloud_json_arr_start(w, JSON_KEY_SRVC_INFO_UI);
+	if (ui->air_pressure) {
+		nrf_cloud_json_str_add(w, NULL, sensor_type_str[NRF_CLOUD_SENSOR_AIR_PRESS]);
 	}
-
-	if (dev_status->svc) {
-		err = nrf_cloud_service_info_json_encode(dev_status->svc, svc_inf_obj);
-		if (err) {
-			goto cleanup;
+	if (ui->gnss) {
+		nrf_cloud_json_str_add(w, NULL, sensor_type_str[NRF_CLOUD_SENSOR_GNSS]);
+	}
+	if (ui->flip) {
+		nrf_cloud_json_str_add(w, NULL, sensor_type_str[NRF_CLOUD_SENSOR_FLIP]);
+	}
+	if (ui->button) {
+		nrf_cloud_json_str_add(w, NULL, sensor_type_str[NRF_CLOUD_SENSOR_BUTTON]);
+	}
+	if (ui->temperature) {
+		nrf_cloud_json_str_add(w, NULL, sensor_type_str[NRF_CLOUD_SENSOR_TEMP]);
+	}
+	if (ui->humidity) {
+		nrf_cloud_json_str_add(w, NULL, sensor_type_str[NRF_CLOUD_SENSOR_HUMID]);
+	}
+	if (ui->light_sensor) {
+		nrf_cloud_json_str_add(w, NULL, sensor_type_str[NRF_CLOUD_SENSOR_LIGHT]);
+	}
+	if (ui->rsrp) {
+		nrf_cloud_json_str_add(w, NULL, sensor_type_str[NRF_CLOUD_LTE_LINK_RSRP]);
+	}
+
+	return nrf_cloud_json_arr_end(w);
+}
+
+typedef int (*modem_info_write_t)(struct nrf_cloud_json_writer *const w,
+				  const struct modem_param_info *const mpi);
+
+static int write_modem_info(struct nrf_cloud_json_writer *const w,
+			    const struct nrf_cloud_modem_info *const mod_inf,
+			    const struct modem_param_info *const mpi)
+{
+	const struct {
+		enum nrf_cloud_shadow_info inf;
+		const char *name;
+		modem_info_write_t write;
+	} items[] = {
+#ifdef CONFIG_MODEM_INFO
+		{ mod_inf->device, NRF_CLOUD_DEVICE_JSON_KEY_DEV_INF, write_modem_info_device },
+		{ mod_inf->network, NRF_CLOUD_DEVICE_JSON_KEY_NET_INF, write_modem_info_network },
+		{ mod_inf->sim, NRF_CLOUD_DEVICE_JSON_KEY_SIM_INF, write_modem_info_sim },
+#else
+		{ mod_inf->device, NRF_CLOUD_DEVICE_JSON_KEY_DEV_INF, NULL },
+		{ mod_inf->network, NRF_CLOUD_DEVICE_JSON_KEY_NET_INF, NULL },
+		{ mod_inf->sim, NRF_CLOUD_DEVICE_JSON_KEY_SIM_INF, NULL },
+#endif
+	};
+	int err;
+
+	for (size_t i = 0; i < ARRAY_SIZE(items); i++) {
+		switch (items[i].inf) {
+		case NRF_CLOUD_INFO_SET:
+			err = -ENOMSG;
+			if (items[i].write && mpi) {
+				nrf_cloud_json_obj_start(w, items[i].name);
+				err = items[i].write(w, mpi);
+				if (!err) {
+					err = nrf_cloud_json_obj_end(w);
+				}
+			}
+
+			if (err) {
+				LOG_ERR("Failed to encode modem info");
+				return w->err ? w->err : -EIO;
+			}
+			break;
+		case NRF_CLOUD_INFO_CLEAR:
+			nrf_cloud_json_null_add(w, items[i].name);
+			break;
+		case NRF_CLOUD_INFO_NO_CHANGE:
+		default:
+			break;
 		}
 	}
 
-	output->ptr = cJSON_PrintUnformatted(root_obj);
-	if (output->ptr) {
-		output->len = strlen(output->ptr);
-	} else {
-		err = -ENOMEM;
+	return w->err;
+}
+
+struct device_status_ctx {
+	const struct nrf_cloud_device_status *dev_status;
+	const struct modem_param_info *mpi;
+	bool include_state;
+};
+
+static int device_status_write(struct nrf_cloud_json_writer *const w, const void *const ctx)
+{
+	const struct device_status_ctx *status = ctx;
+	int err;
+
+	nrf_cloud_json_obj_start(w, NULL);
+	if (status->include_state) {
+		nrf_cloud_json_obj_start(w, JSON_KEY_STATE);
 	}
+	nrf_cloud_json_obj_start(w, JSON_KEY_REP);
+	nrf_cloud_json_obj_start(w, JSON_KEY_DEVICE);
 
-cleanup:
-	cJSON_Delete(root_obj);
+	nrf_cloud_json_obj_start(w, JSON_KEY_SRVC_INFO);
+	if (status->dev_status->svc) {
+		err = write_service_info(w, status->dev_status->svc);
+		if (err) {
+			return err;
+		}
+	}
+	nrf_cloud_json_obj_end(w);
 
+	if (status->dev_status->modem) {
+		err = write_modem_info(w, status->dev_status->modem, status->mpi);
+		if (err) {
+			return err;
+		}
+	}
+
+	/* Close device, reported, and optionally state */
+	nrf_cloud_json_obj_end(w);
+	nrf_cloud_json_obj_end(w);
+	if (status->include_state) {
+		nrf_cloud_json_obj_end(w);
+	}
+
+	return nrf_cloud_json_obj_end(w);
+}
+
+void nrf_cloud_device_status_free(struct nrf_cloud_data *status)
+{
+	if (status && status->ptr) {
+		nrf_cloud_free((void *)status->ptr);
+		status->ptr = NULL;
+		status->len = 0;
+	}
+}
+
+int nrf_cloud_device_status_encode(const struct nrf_cloud_device_status *const dev_status,
+	struct nrf_cloud_data * const output, const bool include_state)
+{
+	if (!dev_status || !output) {
+		return -EINVAL;
+	}
+
+	int err = 0;
+	char *buffer;
+	size_t len;
+	struct device_status_ctx ctx = {
+		.dev_status = dev_status,
+		.include_state = include_state
+	};
+#ifdef CONFIG_MODEM_INFO
+	struct modem_param_info fetched_mod_inf;
+#endif
+
+	output->ptr = NULL;
+	output->len = 0;
+
+#ifdef CONFIG_MODEM_INFO
+	if (dev_status->modem) {
+		err = modem_info_check(dev_status->modem);
+		if (err) {
+			return err;
+		}
+
+		/* Obtain the modem info once, it is used by both encoding passes */
+		ctx.mpi = dev_status->modem->mpi;
+		if (!ctx.mpi) {
+			err = modem_info_fetch(&fetched_mod_inf);
+			if (err) {
+				return err;
+			}
+			ctx.mpi = &fetched_mod_inf;
+		}
+	}
+#endif
+
+	err = nrf_cloud_json_encode_alloc(device_status_write, &ctx, &buffer, &len);
 	if (err) {
-		output->ptr = NULL;
-		output->len = 0;
+		return err;
 	}
 
-	return err;
+	output->ptr = buffer;
+	output->len = len;
+
+	return 0;
 }
 
 void nrf_cloud_fota_job_free(struct nrf_cloud_fota_job_info *const job)
@@ -1411,76 +1691,66 @@ int nrf_cloud_rest_fota_execution_parse(const char *const response,
 	}
 
 	int ret = 0;
-	char *type;
-	cJSON *path_obj;
-	cJSON *host_obj;
-	cJSON *type_obj;
-	cJSON *size_obj;
-
-	cJSON *resp_obj = cJSON_Parse(response);
-	cJSON *job_doc  = cJSON_GetObjectItem(resp_obj, NRF_CLOUD_FOTA_REST_KEY_JOB_DOC);
-	cJSON *id_obj   = cJSON_GetObjectItem(resp_obj, NRF_CLOUD_FOTA_REST_KEY_JOB_ID);
+	struct nrf_cloud_json_tok resp_obj;
+	struct nrf_cloud_json_tok job_doc;
+	struct nrf_cloud_json_tok id_obj;
+	struct nrf_cloud_json_tok path_obj;
+	struct nrf_cloud_json_tok host_obj;
+	struct nrf_cloud_json_tok type_obj;
+	struct nrf_cloud_json_tok size_obj;
 
 	memset(job, 0, sizeof(*job));
 
-	if (!job_doc || !id_obj) {
+	if (nrf_cloud_json_find(response, strlen(response), "", &resp_obj) ||
+	    nrf_cloud_json_tok_find(&resp_obj, NRF_CLOUD_FOTA_REST_KEY_JOB_DOC, &job_doc) ||
+	    nrf_cloud_json_tok_find(&resp_obj, NRF_CLOUD_FOTA_REST_KEY_JOB_ID, &id_obj)) {
 		ret = -EBADMSG;
 		goto err_cleanup;
 	}
 
-	path_obj = cJSON_GetObjectItem(job_doc, NRF_CLOUD_FOTA_REST_KEY_PATH);
-	host_obj = cJSON_GetObjectItem(job_doc, NRF_CLOUD_FOTA_REST_KEY_HOST);
-	type_obj = cJSON_GetObjectItem(job_doc, NRF_CLOUD_FOTA_REST_KEY_TYPE);
-	size_obj = cJSON_GetObjectItem(job_doc, NRF_CLOUD_FOTA_REST_KEY_SIZE);
-
-	if (!id_obj || !path_obj || !host_obj || !type_obj || !size_obj) {
+	if (nrf_cloud_json_tok_find(&job_doc, NRF_CLOUD_FOTA_REST_KEY_PATH, &path_obj) ||
+	    nrf_cloud_json_tok_find(&job_doc, NRF_CLOUD_FOTA_REST_KEY_HOST, &host_obj) ||
+	    nrf_cloud_json_tok_find(&job_doc, NRF_CLOUD_FOTA_REST_KEY_TYPE, &type_obj) ||
+	    nrf_cloud_json_tok_find(&job_doc, NRF_CLOUD_FOTA_REST_KEY_SIZE, &size_obj)) {
 		ret = -EPROTO;
 		goto err_cleanup;
 	}
 
-	if (!cJSON_IsNumber(size_obj)) {
+	if (nrf_cloud_json_int_get(&size_obj, &job->file_size)) {
 		ret = -ENOMSG;
 		goto err_cleanup;
 	}
-	job->file_size	= size_obj->valueint;
 
-	job->id		= json_strdup(id_obj);
-	job->path	= json_strdup(path_obj);
-	job->host	= json_strdup(host_obj);
+	job->id		= nrf_cloud_json_str_dup(&id_obj);
+	job->path	= nrf_cloud_json_str_dup(&path_obj);
+	job->host	= nrf_cloud_json_str_dup(&host_obj);
 
 	if (!job->id || !job->path || !job->host) {
 		ret = -ENOSTR;
 		goto err_cleanup;
 	}
 
-	type = cJSON_GetStringValue(type_obj);
-	if (!type) {
+	if (type_obj.type != NRF_CLOUD_JSON_TOK_STR) {
 		ret = -ENODATA;
 		goto err_cleanup;
 	}
 
-	if (!strcmp(type, NRF_CLOUD_FOTA_TYPE_MODEM_DELTA)) {
+	if (nrf_cloud_json_str_eq(&type_obj, NRF_CLOUD_FOTA_TYPE_MODEM_DELTA, true)) {
 		job->type = NRF_CLOUD_FOTA_MODEM_DELTA;
-	} else if (!strcmp(type, NRF_CLOUD_FOTA_TYPE_MODEM_FULL)) {
+	} else if (nrf_cloud_json_str_eq(&type_obj, NRF_CLOUD_FOTA_TYPE_MODEM_FULL, true)) {
 		job->type = NRF_CLOUD_FOTA_MODEM_FULL;
-	} else if (!strcmp(type, NRF_CLOUD_FOTA_TYPE_BOOT)) {
+	} else if (nrf_cloud_json_str_eq(&type_obj, NRF_CLOUD_FOTA_TYPE_BOOT, true)) {
 		job->type = NRF_CLOUD_FOTA_BOOTLOADER;
-	} else if (!strcmp(type, NRF_CLOUD_FOTA_TYPE_APP)) {
+	} else if (nrf_cloud_json_str_eq(&type_obj, NRF_CLOUD_FOTA_TYPE_APP, true)) {
 		job->type = NRF_CLOUD_FOTA_APPLICATION;
 	} else {
-		LOG_WRN("Unhandled FOTA type: %s", type);
+		LOG_WRN("Unhandled FOTA type: %.*s", (int)type_obj.len, type_obj.ptr);
 		job->type = NRF_CLOUD_FOTA_TYPE__INVALID;
 	}
 
-	cJSON_Delete(resp_obj);
-
 	return 0;
 
 err_cleanup:
-	if (resp_obj) {
-		cJSON_Delete(resp_obj);
-	}
-
 	nrf_cloud_fota_job_free(job);
 	memset(job, 0, sizeof(*job));
 	job->type = NRF_CLOUD_FOTA_TYPE__INVALID;
@@ -1488,6 +1758,132 @@ err_cleanup:
 	return ret;
 }
 
+/* Job format:
+ * [“jobExecutionId”,firmwareType,fileSize,”host”,”path”]
+ * ["BLE ID",“jobExecutionId”,firmwareType,fileSize,”host”,”path”]
+ *
+ * Examples:
+ * [“abcd1234”,0,1234,”nrfcloud.com”,"v1/firmwares/appfw.bin"]
+ * ["12:AB:34:CD:56:EF",“efgh5678”,0,321,”nrfcloud.com”,
+ *  "v1/firmwares/ble.bin"]
+ */
+enum rcv_item_idx {
+	RCV_ITEM_IDX_BLE_ID,
+	RCV_ITEM_IDX_JOB_ID,
+	RCV_ITEM_IDX_FW_TYPE,
+	RCV_ITEM_IDX_FILE_SIZE,
+	RCV_ITEM_IDX_FILE_HOST,
+	RCV_ITEM_IDX_FILE_PATH,
+	RCV_ITEM_IDX__SIZE,
+};
+
+/* Unescape a string token in place, the buffer it references must be writable */
+static char *json_tok_str_in_place(const struct nrf_cloud_json_tok *const tok)
+{
+	char *const str = (char *)tok->ptr;
+
+	if (nrf_cloud_json_str_get(tok, str, tok->len + 1) < 0) {
+		return NULL;
+	}
+
+	return str;
+}
+
+int nrf_cloud_fota_job_decode(struct nrf_cloud_fota_job_info *const job_info,
+			      char **const ble_id, char *const payload)
+{
+	if (!job_info || !payload) {
+		return -EINVAL;
+	}
+
+	struct nrf_cloud_json_tok items[RCV_ITEM_IDX__SIZE] = {0};
+	struct nrf_cloud_json_reader r;
+	struct nrf_cloud_json_tok tok;
+	const size_t offset = !ble_id ? 1 : 0;
+	size_t job_id_len;
+	int err;
+
+	memset(job_info, 0, sizeof(*job_info));
+	if (ble_id) {
+		*ble_id = NULL;
+	}
+
+	/* Collect the items first, unescaping them in place invalidates the JSON */
+	nrf_cloud_json_reader_init(&r, payload, strlen(payload));
+
+	err = nrf_cloud_json_next(&r, &tok);
+	if (!err && (tok.type != NRF_CLOUD_JSON_TOK_ARR)) {
+		err = -EINVAL;
+	}
+
+	for (size_t i = offset; !err; i++) {
+		err = nrf_cloud_json_next(&r, &tok);
+		if (err || (tok.type == NRF_CLOUD_JSON_TOK_ARR_END)) {
+			break;
+		}
+
+		if (i < ARRAY_SIZE(items)) {
+			items[i] = tok;
+		}
+
+		err = nrf_cloud_json_skip(&r, &tok);
+	}
+
+	if (err) {
+		LOG_ERR("Invalid JSON array");
+		job_info->type = NRF_CLOUD_FOTA_TYPE__INVALID;
+		return -EINVAL;
+	}
+
+	/* Get the job ID separately, it may be needed to reject an invalid job */
+	job_info->id = json_tok_str_in_place(&items[RCV_ITEM_IDX_JOB_ID]);
+
+	err = -ENOMSG;
+
+	if (ble_id) {
+		*ble_id = json_tok_str_in_place(&items[RCV_ITEM_IDX_BLE_ID]);
+		if (!*ble_id) {
+			LOG_ERR("Failed to get BLE ID from job");
+			goto cleanup;
+		}
+	}
+
+	job_info->host = json_tok_str_in_place(&items[RCV_ITEM_IDX_FILE_HOST]);
+	job_info->path = json_tok_str_in_place(&items[RCV_ITEM_IDX_FILE_PATH]);
+
+	if (!job_info->id || !job_info->host || !job_info->path ||
+	    nrf_cloud_json_int_get(&items[RCV_ITEM_IDX_FW_TYPE], (int *)&job_info->type) ||
+	    nrf_cloud_json_int_get(&items[RCV_ITEM_IDX_FILE_SIZE], &job_info->file_size)) {
+		LOG_ERR("Error parsing job info");
+		goto cleanup;
+	}
+
+	job_id_len = strlen(job_info->id);
+	if (job_id_len > (NRF_CLOUD_FOTA_JOB_ID_SIZE - 1)) {
+		LOG_ERR("Job ID length: %zu, exceeds allowed length: %d",
+			job_id_len, NRF_CLOUD_FOTA_JOB_ID_SIZE - 1);
+		goto cleanup;
+	}
+
+	if (job_info->type < NRF_CLOUD_FOTA_TYPE__FIRST ||
+	    job_info->type >= NRF_CLOUD_FOTA_TYPE__INVALID) {
+		LOG_ERR("Invalid FOTA type: %d", job_info->type);
+		goto cleanup;
+	}
+
+	return 0;
+
+cleanup:
+	/* If no job ID exists, perform cleanup.
+	 * Otherwise allow the information to persist so the job can be rejected.
+	 */
+	if (job_info->id == NULL) {
+		memset(job_info, 0, sizeof(*job_info));
+	}
+	job_info->type = NRF_CLOUD_FOTA_TYPE__INVALID;
+	return err;
+}
+
 #if defined(CONFIG_NRF_CLOUD_PGPS)
 int nrf_cloud_parse_pgps_response(const char *const response,
 	struct nrf_cloud_pgps_result *const result)
@@ -1498,27 +1894,33 @@ int nrf_cloud_parse_pgps_response(const char *const response,
 		return -EINVAL;
 	}
 
-	char *host_ptr = NULL;
-	char *path_ptr = NULL;
-	int err = 0;
-	cJSON *rsp_obj = cJSON_Parse(response);
+	struct nrf_cloud_json_tok rsp_obj;
+	struct nrf_cloud_json_tok host_obj;
+	struct nrf_cloud_json_tok path_obj;
+	int host_len;
+	int path_len;
+	int err;
 
-	if (!rsp_obj) {
+	if (nrf_cloud_json_find(response, strlen(response), "", &rsp_obj)) {
 		LOG_ERR("P-GPS response does not contain valid JSON");
-		err = -EBADMSG;
-		goto cleanup;
+		return -EBADMSG;
 	}
 
 	/* MQTT response is an array, REST is key/value map */
-	if (cJSON_IsArray(rsp_obj)) {
-		if (get_string_from_array(rsp_obj, NRF_CLOUD_PGPS_RCV_ARRAY_IDX_HOST, &host_ptr) ||
-		    get_string_from_array(rsp_obj, NRF_CLOUD_PGPS_RCV_ARRAY_IDX_PATH, &path_ptr)) {
+	if (rsp_obj.type == NRF_CLOUD_JSON_TOK_ARR) {
+		if (nrf_cloud_json_tok_find(&rsp_obj, STRINGIFY(NRF_CLOUD_PGPS_RCV_ARRAY_IDX_HOST),
+					    &host_obj) ||
+		    nrf_cloud_json_tok_find(&rsp_obj, STRINGIFY(NRF_CLOUD_PGPS_RCV_ARRAY_IDX_PATH),
+					    &path_obj) ||
+		    (host_obj.type != NRF_CLOUD_JSON_TOK_STR) ||
+		    (path_obj.type != NRF_CLOUD_JSON_TOK_STR)) {
 			LOG_ERR("Invalid P-GPS array response format");
-			err = -EPROTO;
-			goto cleanup;
+			return -EPROTO;
 		}
-	} else if (get_string_from_obj(rsp_obj, NRF_CLOUD_PGPS_RCV_REST_HOST, &host_ptr) ||
-		   get_string_from_obj(rsp_obj, NRF_CLOUD_PGPS_RCV_REST_PATH, &path_ptr)) {
+	} else if (nrf_cloud_json_tok_find(&rsp_obj, NRF_CLOUD_PGPS_RCV_REST_HOST, &host_obj) ||
+		   nrf_cloud_json_tok_find(&rsp_obj, NRF_CLOUD_PGPS_RCV_REST_PATH, &path_obj) ||
+		   (host_obj.type != NRF_CLOUD_JSON_TOK_STR) ||
+		   (path_obj.type != NRF_CLOUD_JSON_TOK_STR)) {
 		enum nrf_cloud_error nrf_err;
 
 		/* Check for a potential P-GPS JSON error message from nRF Cloud */
@@ -1526,37 +1928,32 @@ int nrf_cloud_parse_pgps_response(const char *const response,
 						     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA, &nrf_err);
 		if (!err) {
 			LOG_ERR("nRF Cloud returned P-GPS error: %d", nrf_err);
-			err = -EFAULT;
-		} else {
-			LOG_ERR("Invalid P-GPS response format");
-			err = -EPROTO;
+			return -EFAULT;
 		}
 
-		goto cleanup;
+		LOG_ERR("Invalid P-GPS response format");
+		return -EPROTO;
 	}
 
-	if (!host_ptr || !path_ptr) {
-		err = -ENOSTR;
-		goto cleanup;
+	/* Check both lengths so that neither output is modified on failure */
+	host_len = nrf_cloud_json_str_get(&host_obj, NULL, 0);
+	path_len = nrf_cloud_json_str_get(&path_obj, NULL, 0);
+
+	if ((host_len < 0) || (path_len < 0)) {
+		return -ENOSTR;
 	}
 
-	if ((result->host_sz <= strlen(host_ptr)) ||
-	    (result->path_sz <= strlen(path_ptr))) {
-		err = -ENOBUFS;
-		goto cleanup;
+	if ((result->host_sz <= (size_t)host_len) || (result->path_sz <= (size_t)path_len)) {
+		return -ENOBUFS;
 	}
 
-	strncpy(result->host, host_ptr, result->host_sz);
+	(void)nrf_cloud_json_str_get(&host_obj, result->host, result->host_sz);
 	LOG_DBG("host: %s", result->host);
 
-	strncpy(result->path, path_ptr, result->path_sz);
+	(void)nrf_cloud_json_str_get(&path_obj, result->path, result->path_sz);
 	LOG_DBG("path: %s", result->path);
 
-cleanup:
-	if (rsp_obj) {
-		cJSON_Delete(rsp_obj);
-	}
-	return err;
+	return 0;
 }
 #endif /* CONFIG_NRF_CLOUD_PGPS */
 
@@ -1868,39 +2265,233 @@ cleanup:
 	return -ENOMEM;
 }
 
-int nrf_cloud_format_location_req(struct lte_lc_cells_info const *const cell_info,
-	struct wifi_scan_info const *const wifi_info, char **string_out)
+static void write_lte_inf(struct nrf_cloud_json_writer *const w,
+			  struct lte_lc_cell const *const inf, const uint8_t ncells_count,
+			  const struct lte_lc_ncell *const neighbor_cells)
 {
-	if ((!cell_info && !wifi_info) || !string_out) {
+	nrf_cloud_json_obj_start(w, NULL);
+
+	/* Required parameters for the API call */
+	nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_ECI, inf->id);
+	nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_MCC, inf->mcc);
+	nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_MNC, inf->mnc);
+	nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_TAC, inf->tac);
+
+	/* Optional parameters for the API call */
+	if (inf->earfcn != NRF_CLOUD_LOCATION_CELL_OMIT_EARFCN) {
+		nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN, inf->earfcn);
+	}
+
+	if (inf->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) {
+		nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP,
+				       RSRP_IDX_TO_DBM(inf->rsrp));
+	}
+
+	if (inf->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) {
+		nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+				       RSRQ_IDX_TO_DB(inf->rsrq));
+	}
+
+	if (inf->timing_advance != NRF_CLOUD_LOCATION_CELL_OMIT_TIME_ADV) {
+		nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_T_ADV,
+				       MIN(inf->timing_advance,
+					   NRF_CLOUD_LOCATION_CELL_TIME_ADV_MAX));
+	}
+
+	if (ncells_count && neighbor_cells) {
+		nrf_cloud_json_arr_start(w, NRF_CLOUD_CELL_POS_JSON_KEY_NBORS);
+
+		for (uint8_t i = 0; i < ncells_count; ++i) {
+			const struct lte_lc_ncell *ncell = neighbor_cells + i;
+
+			nrf_cloud_json_obj_start(w, NULL);
+
+			/* Required parameters for the API call */
+			nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN,
+					       ncell->earfcn);
+			nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_PCI,
+					       ncell->phys_cell_id);
+
+			/* Optional parameters for the API call */
+			if (ncell->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) {
+				nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP,
+						       RSRP_IDX_TO_DBM(ncell->rsrp));
+			}
+			if (ncell->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) {
+				nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+						       RSRQ_IDX_TO_DB(ncell->rsrq));
+			}
+			if (ncell->time_diff != LTE_LC_CELL_TIME_DIFF_INVALID) {
+				nrf_cloud_json_num_add(w, NRF_CLOUD_CELL_POS_JSON_KEY_TDIFF,
+						       ncell->time_diff);
+			}
+
+			nrf_cloud_json_obj_end(w);
+		}
+
+		nrf_cloud_json_arr_end(w);
+	}
+
+	nrf_cloud_json_obj_end(w);
+}
+
+static int write_cell_pos_req(struct nrf_cloud_json_writer *const w,
+			      struct lte_lc_cells_info const *const inf)
+{
+	nrf_cloud_json_arr_start(w, NRF_CLOUD_CELL_POS_JSON_KEY_LTE);
+
+	/* The current cell, with the neighbor cells if present */
+	write_lte_inf(w, &inf->current_cell, inf->ncells_count, inf->neighbor_cells);
+
+	/* GCI cells if present */
+	if (inf->gci_cells) {
+		for (uint8_t i = 0; i < inf->gci_cells_count; ++i) {
+			write_lte_inf(w, inf->gci_cells + i, 0, NULL);
+		}
+	}
+
+	return nrf_cloud_json_arr_end(w);
+}
+
+static int write_wifi_req(struct nrf_cloud_json_writer *const w,
+			  struct wifi_scan_info const *const wifi)
+{
+	if (!wifi->ap_info || !wifi->cnt) {
 		return -EINVAL;
 	}
 
-	int err = 0;
-	cJSON *req_obj = cJSON_CreateObject();
+	nrf_cloud_json_obj_start(w, NRF_CLOUD_LOCATION_JSON_KEY_WIFI);
+	nrf_cloud_json_arr_start(w, NRF_CLOUD_LOCATION_JSON_KEY_APS);
 
-	if (cell_info) {
-		err = nrf_cloud_format_cell_pos_req_json(cell_info, req_obj);
-		if (err) {
-			goto cleanup;
+	for (uint8_t cnt = 0; cnt < wifi->cnt; ++cnt) {
+		char str_buf[MAX(WIFI_MAC_ADDR_STR_LEN, WIFI_SSID_MAX_LEN) + 1];
+		struct wifi_scan_result const *const ap = (wifi->ap_info + cnt);
+		int ret;
+
+		nrf_cloud_json_obj_start(w, NULL);
+
+		/* MAC address is the only required parameter for the API call */
+		ret = snprintk(str_buf, sizeof(str_buf),
+			       WIFI_MAC_ADDR_TEMPLATE,
+			       ap->mac[0], ap->mac[1], ap->mac[2],
+			       ap->mac[3], ap->mac[4], ap->mac[5]);
+		if (ret != WIFI_MAC_ADDR_STR_LEN) {
+			return -EINVAL;
 		}
+		nrf_cloud_json_str_add(w, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_MAC, str_buf);
+
+		/* Optional parameters for the API call */
+		if ((ap->ssid_length > 0) && (ap->ssid_length <= WIFI_SSID_MAX_LEN) &&
+		    (ap->ssid[0] != '\0')) {
+			memcpy(str_buf, ap->ssid, ap->ssid_length);
+			str_buf[ap->ssid_length] = '\0';
+			nrf_cloud_json_str_add(w, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_SSID, str_buf);
+		}
+
+		if (ap->rssi != NRF_CLOUD_LOCATION_WIFI_OMIT_RSSI) {
+			nrf_cloud_json_num_add(w, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_RSSI, ap->rssi);
+		}
+
+		if (ap->channel != NRF_CLOUD_LOCATION_WIFI_OMIT_CHAN) {
+			nrf_cloud_json_num_add(w, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_CH,
+					       ap->channel);
+		}
+
+		nrf_cloud_json_obj_end(w);
+	}
+
+	nrf_cloud_json_arr_end(w);
+
+	return nrf_cloud_json_obj_end(w);
+}
+
+struct location_req_ctx {
+	struct lte_lc_cells_info const *cell_info;
+	struct wifi_scan_info const *wifi_info;
+	/* Wrap the request in a device message, as sent over MQTT */
+	bool msg;
+	bool request_loc;
+};
+
+static int location_req_write(struct nrf_cloud_json_writer *const w, const void *const ctx)
+{
+	const struct location_req_ctx *req = ctx;
+	int err;
+
+	nrf_cloud_json_obj_start(w, NULL);
+
+	if (req->msg) {
+		nrf_cloud_json_str_add(w, NRF_CLOUD_JSON_APPID_KEY,
+				       NRF_CLOUD_JSON_APPID_VAL_LOCATION);
+		nrf_cloud_json_str_add(w, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				       NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+		nrf_cloud_json_obj_start(w, NRF_CLOUD_JSON_DATA_KEY);
+	}
+
+	if (req->cell_info) {
+		write_cell_pos_req(w, req->cell_info);
 	}
 
-	if (wifi_info) {
-		err = nrf_cloud_format_wifi_req_json(wifi_info, req_obj);
+	if (req->wifi_info) {
+		err = write_wifi_req(w, req->wifi_info);
 		if (err) {
-			goto cleanup;
+			return err;
 		}
 	}
 
-	*string_out = cJSON_PrintUnformatted(req_obj);
-	if (*string_out == NULL) {
-		err = -ENOMEM;
+	if (req->msg) {
+		/* By default, nRF Cloud will send the location to the device */
+		if (!req->request_loc) {
+			nrf_cloud_json_num_add(w, NRF_CLOUD_LOCATION_KEY_DOREPLY, 0);
+		}
+		nrf_cloud_json_obj_end(w);
 	}
 
-cleanup:
-	cJSON_Delete(req_obj);
+	return nrf_cloud_json_obj_end(w);
+}
 
-	return err;
+int nrf_cloud_format_location_req(struct lte_lc_cells_info const *const cell_info,
+	struct wifi_scan_info const *const wifi_info, char **string_out)
+{
+	if ((!cell_info && !wifi_info) || !string_out) {
+		return -EINVAL;
+	}
+
+	const struct location_req_ctx ctx = {
+		.cell_info = cell_info,
+		.wifi_info = wifi_info
+	};
+
+	return nrf_cloud_json_encode_alloc(location_req_write, &ctx, string_out, NULL);
+}
+
+int nrf_cloud_location_req_msg_encode(struct lte_lc_cells_info const *const cell_info,
+	struct wifi_scan_info const *const wifi_info, const bool request_loc,
+	struct nrf_cloud_data *const output)
+{
+	if ((!cell_info && !wifi_info) || !output) {
+		return -EINVAL;
+	}
+
+	const struct location_req_ctx ctx = {
+		.cell_info = cell_info,
+		.wifi_info = wifi_info,
+		.msg = true,
+		.request_loc = request_loc
+	};
+	char *buffer;
+	size_t len;
+	int err;
+
+	err = nrf_cloud_json_encode_alloc(location_req_write, &ctx, &buffer, &len);
+	if (err) {
+		return err;
+	}
+
+	output->ptr = buffer;
+	output->len = len;
+
+	return 0;
 }
 
 static bool json_item_string_exists(const cJSON *const obj, const char *const key,
@@ -1982,36 +2573,31 @@ int nrf_cloud_handle_error_message(const char *const buf,
 	}
 
 	int ret;
-	cJSON *root_obj;
+	struct nrf_cloud_json_tok root_obj;
 
 	*err = NRF_CLOUD_ERROR_NONE;
 
-	root_obj = cJSON_Parse(buf);
-	if (!root_obj) {
+	if (nrf_cloud_json_find(buf, strlen(buf), "", &root_obj)) {
 		/* No JSON found, not an error message */
 		return -ENODATA;
 	}
 
-	ret = get_error_code_value(root_obj, err);
+	ret = json_tok_error_code_get(&root_obj, err);
 	if (ret) {
-		goto clean_up;
+		return ret;
 	}
 
 	/* If provided, check for matching app id and msg type */
 	if (msg_type &&
-	    !json_item_string_exists(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY, msg_type)) {
-		ret = -ENOENT;
-		goto clean_up;
+	    !json_tok_string_exists(&root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY, msg_type)) {
+		return -ENOENT;
 	}
 	if (app_id &&
-	    !json_item_string_exists(root_obj, NRF_CLOUD_JSON_APPID_KEY, app_id)) {
-		ret = -ENOENT;
-		goto clean_up;
+	    !json_tok_string_exists(&root_obj, NRF_CLOUD_JSON_APPID_KEY, app_id)) {
+		return -ENOENT;
 	}
 
-clean_up:
-	cJSON_Delete(root_obj);
-	return ret;
+	return 0;
 }
 
 int nrf_cloud_parse_location_response(const char *const buf,
@@ -2156,21 +2742,18 @@ bool nrf_cloud_detect_disconnection_request(const char *const buf)
 		return false;
 	}
 
-	/* If the quick test passes, use cJSON to get certainty */
-	bool ret = true;
-	cJSON *discon_request_obj = cJSON_Parse(buf);
+	/* If the quick test passes, parse the message to get certainty */
+	struct nrf_cloud_json_tok discon_request_obj;
 
-	/* Check for nRF Cloud disconnection request MQTT message */
-	if (!json_item_string_exists(discon_request_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
-				     NRF_CLOUD_JSON_MSG_TYPE_VAL_DISCONNECT) ||
-	    !json_item_string_exists(discon_request_obj, NRF_CLOUD_JSON_APPID_KEY,
-				     NRF_CLOUD_JSON_APPID_VAL_DEVICE)) {
-		/* Not a disconnection request message */
-		ret = false;
+	if (nrf_cloud_json_find(buf, strlen(buf), "", &discon_request_obj)) {
+		return false;
 	}
 
-	cJSON_Delete(discon_request_obj);
-	return ret;
+	/* Check for nRF Cloud disconnection request MQTT message */
+	return json_tok_string_exists(&discon_request_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				      NRF_CLOUD_JSON_MSG_TYPE_VAL_DISCONNECT) &&
+	       json_tok_string_exists(&discon_request_obj, NRF_CLOUD_JSON_APPID_KEY,
+				      NRF_CLOUD_JSON_APPID_VAL_DEVICE);
 }
 
 #if defined(CONFIG_NRF_MODEM)
@@ -2322,3 +2905,116 @@ cleanup:
 
 	return ret;
 }
+
+static void write_pvt(struct nrf_cloud_json_writer *const w, const char *const key,
+		      const struct nrf_cloud_gnss_pvt *const pvt)
+{
+	nrf_cloud_json_obj_start(w, key);
+	nrf_cloud_json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_LON, pvt->lon);
+	nrf_cloud_json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_LAT, pvt->lat);
+	nrf_cloud_json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_ACCURACY, pvt->accuracy);
+	if (pvt->has_alt) {
+		nrf_cloud_json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_ALTITUDE, pvt->alt);
+	}
+	if (pvt->has_speed) {
+		nrf_cloud_json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_SPEED, pvt->speed);
+	}
+	if (pvt->has_heading) {
+		nrf_cloud_json_num_add(w, NRF_CLOUD_JSON_GNSS_PVT_KEY_HEADING, pvt->heading);
+	}
+	nrf_cloud_json_obj_end(w);
+}
+
+static int gnss_msg_write(struct nrf_cloud_json_writer *const w, const void *const ctx)
+{
+	const struct nrf_cloud_gnss_data *gnss = ctx;
+	const char *nmea = NULL;
+
+	/* Add the app ID, message type, and timestamp */
+	nrf_cloud_json_obj_start(w, NULL);
+	nrf_cloud_json_str_add(w, NRF_CLOUD_JSON_APPID_KEY, NRF_CLOUD_JSON_APPID_VAL_GNSS);
+	nrf_cloud_json_str_add(w, NRF_CLOUD_JSON_MSG_TYPE_KEY, NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (gnss->ts_ms > NRF_CLOUD_NO_TIMESTAMP) {
+		nrf_cloud_json_num_add(w, NRF_CLOUD_MSG_TIMESTAMP_KEY, gnss->ts_ms);
+	}
+
+	/* Add the specified GNSS data type */
+	switch (gnss->type) {
+	case NRF_CLOUD_GNSS_TYPE_PVT:
+		write_pvt(w, NRF_CLOUD_JSON_DATA_KEY, &gnss->pvt);
+		break;
+	case NRF_CLOUD_GNSS_TYPE_MODEM_PVT:
+#if defined(CONFIG_NRF_MODEM)
+		if (!gnss->mdm_pvt) {
+			return -EINVAL;
+		}
+
+		{
+			const struct nrf_cloud_gnss_pvt pvt = {
+				.lon =		gnss->mdm_pvt->longitude,
+				.lat =		gnss->mdm_pvt->latitude,
+				.accuracy =	gnss->mdm_pvt->accuracy,
+				.alt =		gnss->mdm_pvt->altitude,
+				.has_alt =	1,
+				.speed =	gnss->mdm_pvt->speed,
+				.has_speed =	1,
+				.heading =	gnss->mdm_pvt->heading,
+				.has_heading =	1
+			};
+
+			write_pvt(w, NRF_CLOUD_JSON_DATA_KEY, &pvt);
+		}
+		break;
+#else
+		return -ENOSYS;
+#endif
+	case NRF_CLOUD_GNSS_TYPE_MODEM_NMEA:
+	case NRF_CLOUD_GNSS_TYPE_NMEA:
+		if (gnss->type == NRF_CLOUD_GNSS_TYPE_MODEM_NMEA) {
+#if defined(CONFIG_NRF_MODEM)
+			if (gnss->mdm_nmea) {
+				nmea = gnss->mdm_nmea->nmea_str;
+			}
+#endif
+		} else {
+			nmea = gnss->nmea.sentence;
+		}
+
+		if (nmea == NULL) {
+			return -EINVAL;
+		}
+
+		if (memchr(nmea, '\0', NRF_MODEM_GNSS_NMEA_MAX_LEN) == NULL) {
+			return -EFBIG;
+		}
+
+		nrf_cloud_json_str_add(w, NRF_CLOUD_JSON_DATA_KEY, nmea);
+		break;
+	default:
+		return -EPROTO;
+	}
+
+	return nrf_cloud_json_obj_end(w);
+}
+
+int nrf_cloud_gnss_msg_encode(const struct nrf_cloud_gnss_data *const gnss,
+			      struct nrf_cloud_data *const output)
+{
+	if (!gnss || !output) {
+		return -EINVAL;
+	}
+
+	char *buffer;
+	size_t len;
+	int err;
+
+	err = nrf_cloud_json_encode_alloc(gnss_msg_write, gnss, &buffer, &len);
+	if (err) {
+		return err;
+	}
+
+	output->ptr = buffer;
+	output->len = len;
+
+	return 0;
+}
@@ -46,27 +46,9 @@ LOG_MODULE_REGISTER(nrf_cloud_fota, CONFIG_NRF_CLOUD_FOTA_LOG_LEVEL);
 
 #define JOB_REQUEST_LATEST_PAYLOAD "[\"\"]"
 
-/* Job format:
- * [“jobExecutionId”,firmwareType,fileSize,”host”,”path”]
- * ["BLE ID",“jobExecutionId”,firmwareType,fileSize,”host”,”path”]
- *
- * Examples:
- * [“abcd1234”,0,1234,”nrfcloud.com”,"v1/firmwares/appfw.bin"]
- * ["12:AB:34:CD:56:EF",“efgh5678”,0,321,”nrfcloud.com”,
- *  "v1/firmwares/ble.bin"]
- */
-enum rcv_item_idx {
-	RCV_ITEM_IDX_BLE_ID,
-	RCV_ITEM_IDX_JOB_ID,
-	RCV_ITEM_IDX_FW_TYPE,
-	RCV_ITEM_IDX_FILE_SIZE,
-	RCV_ITEM_IDX_FILE_HOST,
-	RCV_ITEM_IDX_FILE_PATH,
-	RCV_ITEM_IDX__SIZE,
-};
-
 struct nrf_cloud_fota_job {
-	cJSON *parsed_payload;
+	/* Received job, the job info points into it */
+	char *payload;
 	enum nrf_cloud_fota_status status;
 	struct nrf_cloud_fota_job_info info;
 	enum nrf_cloud_fota_error error;
@@ -88,8 +70,7 @@ static void send_event(const enum nrf_cloud_fota_evt_id id,
 		       const struct nrf_cloud_fota_job *const job);
 static int parse_job_info(struct nrf_cloud_fota_job_info *const job_info,
 			  bt_addr_t *const ble_id,
-			  char *const payload,
-			  cJSON **array_out);
+			  char *const payload);
 static void cleanup_job(struct nrf_cloud_fota_job *const job);
 static int start_job(struct nrf_cloud_fota_job *const job);
 static int send_job_update(struct nrf_cloud_fota_job *const job);
@@ -623,7 +604,7 @@ int nrf_cloud_fota_unsubscribe(void)
 
 bool nrf_cloud_fota_is_active(void)
 {
-	return current_fota.parsed_payload != NULL;
+	return current_fota.payload != NULL;
 }
 
 static int save_validate_status(const char *const job_id,
@@ -814,97 +795,30 @@ static bool add_number_to_array(cJSON *const array, const int number)
 	return item;
 }
 
-static int get_number_from_array(const cJSON *const array, const int index,
-				  int *number_out)
-{
-	__ASSERT_NO_MSG(number_out != NULL);
-
-	cJSON *item = cJSON_GetArrayItem(array, index);
-
-	if (!cJSON_IsNumber(item)) {
-		return -EINVAL;
-	}
-
-	*number_out = item->valueint;
-
-	return 0;
-}
-
 static int parse_job_info(struct nrf_cloud_fota_job_info *const job_info,
-			  bt_addr_t *const ble_id, char *const payload_in,
-			  cJSON **array_out)
+			  bt_addr_t *const ble_id, char *const payload_in)
 {
-	if (!job_info || !payload_in || !array_out) {
+	if (!job_info || !payload_in) {
 		return -EINVAL;
 	}
 
-	char *temp;
-	int err = -ENOMSG;
-	char *job_id = NULL;
-	size_t job_id_len;
-	int offset = !ble_id ? 1 : 0;
-	cJSON *array = cJSON_Parse(payload_in);
-
-	if (!array || !cJSON_IsArray(array)) {
-		LOG_ERR("Invalid JSON array");
-		err = -EINVAL;
-		goto cleanup;
-	}
-
-	*array_out = array;
+	char *ble_str = NULL;
+	int err;
 
-	temp = cJSON_PrintUnformatted(array);
-	if (temp) {
-		LOG_DBG("JSON array: %s", temp);
-		cJSON_FreeString(temp);
-	}
+	LOG_DBG("JSON array: %s", payload_in);
 
-	/* Get the job ID separately, it may be needed to reject an invalid job */
-	get_string_from_array(array, RCV_ITEM_IDX_JOB_ID - offset, &job_id);
-	job_info->id = job_id;
+	err = nrf_cloud_fota_job_decode(job_info, ble_id ? &ble_str : NULL, payload_in);
 
 #if CONFIG_NRF_CLOUD_FOTA_BLE_DEVICES
-	if (ble_id) {
-		char *ble_str;
-
-		if (get_string_from_array(array, RCV_ITEM_IDX_BLE_ID,
-					  &ble_str)) {
-			LOG_ERR("Failed to get BLE ID from job");
-			goto cleanup;
-		}
-
-		if (bt_addr_from_str(ble_str, ble_id)) {
-			err = -EADDRNOTAVAIL;
-			LOG_ERR("Invalid BLE ID: %s", ble_str);
-			goto cleanup;
-		}
+	if (ble_str && bt_addr_from_str(ble_str, ble_id)) {
+		LOG_ERR("Invalid BLE ID: %s", ble_str);
+		job_info->type = NRF_CLOUD_FOTA_TYPE__INVALID;
+		return -EADDRNOTAVAIL;
 	}
 #endif
 
-	if ((job_id == NULL) ||
-	    get_string_from_array(array, RCV_ITEM_IDX_FILE_HOST - offset,
-				  &job_info->host) ||
-	    get_string_from_array(array, RCV_ITEM_IDX_FILE_PATH - offset,
-				  &job_info->path) ||
-	    get_number_from_array(array, RCV_ITEM_IDX_FW_TYPE - offset,
-				  (int *)&job_info->type) ||
-	    get_number_from_array(array, RCV_ITEM_IDX_FILE_SIZE - offset,
-				  &job_info->file_size)) {
-		LOG_ERR("Error parsing job info");
-		goto cleanup;
-	}
-
-	job_id_len = strlen(job_info->id);
-	if (job_id_len > (NRF_CLOUD_FOTA_JOB_ID_SIZE - 1)) {
-		LOG_ERR("Job ID length: %d, exceeds allowed length: %d",
-			job_id_len, NRF_CLOUD_FOTA_JOB_ID_SIZE - 1);
-		goto cleanup;
-	}
-
-	if (job_info->type < NRF_CLOUD_FOTA_TYPE__FIRST ||
-	    job_info->type >= NRF_CLOUD_FOTA_TYPE__INVALID) {
-		LOG_ERR("Invalid FOTA type: %d", job_info->type);
-		goto cleanup;
+	if (err) {
+		return err;
 	}
 
 	LOG_DBG("Job ID: %s, type: %d, size: %d",
@@ -916,20 +830,6 @@ static int parse_job_info(struct nrf_cloud_fota_job_info *const job_info,
 		job_info->path);
 
 	return 0;
-
-cleanup:
-	/* If no job ID exists, perform cleanup.
-	 * Otherwise allow the information to persist so the job can be rejected.
-	 */
-	if (job_id == NULL) {
-		memset(job_info, 0, sizeof(*job_info));
-		*array_out = NULL;
-		if (array) {
-			cJSON_Delete(array);
-		}
-	}
-	job_info->type = NRF_CLOUD_FOTA_TYPE__INVALID;
-	return err;
 }
 
 static void send_event(const enum nrf_cloud_fota_evt_id id,
@@ -1020,8 +920,8 @@ static void cleanup_job(struct nrf_cloud_fota_job *const job)
 	LOG_DBG("%s() - ID: %s", __func__,
 		job->info.id ? job->info.id : "N/A");
 
-	if (job->parsed_payload) {
-		cJSON_Delete(job->parsed_payload);
+	if (job->payload) {
+		nrf_cloud_free(job->payload);
 	}
 	memset(job, 0, sizeof(*job));
 	job->info.type = NRF_CLOUD_FOTA_TYPE__INVALID;
@@ -1188,7 +1088,6 @@ static int handle_mqtt_evt_publish(const struct mqtt_evt *evt)
 	bool skip = false;
 	bool reject_job = false;
 	bt_addr_t *ble_id = NULL;
-	cJSON *payload_array = NULL;
 	struct nrf_cloud_fota_job_info *job_info = &current_fota.info;
 	const struct mqtt_publish_param *p = &evt->param.publish;
 	struct mqtt_puback_param ack = {
@@ -1219,6 +1118,7 @@ static int handle_mqtt_evt_publish(const struct mqtt_evt *evt)
 	if (!payload) {
 		LOG_ERR("Unable to allocate memory for job");
 		ret = -ENOMEM;
+		skip = true;
 		goto send_ack;
 	}
 
@@ -1227,6 +1127,7 @@ static int handle_mqtt_evt_publish(const struct mqtt_evt *evt)
 					   p->message.payload.len);
 	if (ret) {
 		LOG_ERR("Error reading MQTT payload: %d", ret);
+		skip = true;
 		goto send_ack;
 	}
 
@@ -1236,7 +1137,7 @@ static int handle_mqtt_evt_publish(const struct mqtt_evt *evt)
 		goto send_ack;
 	}
 
-	if (parse_job_info(job_info, ble_id, payload, &payload_array)) {
+	if (parse_job_info(job_info, ble_id, payload)) {
 		/* Error parsing job, if a job ID exists, reject the job */
 		reject_job = (job_info->id != NULL);
 	} else if (strncmp(last_job, job_info->id, sizeof(last_job)) == 0) {
@@ -1246,11 +1147,6 @@ static int handle_mqtt_evt_publish(const struct mqtt_evt *evt)
 	}
 
 send_ack:
-	/* Cleanup the payload buffer which is no longer needed */
-	if (payload) {
-		nrf_cloud_free(payload);
-	}
-
 	/* Send the ACK if required and then continue processing, which may result
 	 * in an additional MQTT transaction
 	 */
@@ -1281,9 +1177,10 @@ send_ack:
 		}
 	}
 
+	/* The payload holds the job info, free it once the job is no longer needed */
 	if (skip || job_info->type == NRF_CLOUD_FOTA_TYPE__INVALID) {
-		if (payload_array) {
-			cJSON_Delete(payload_array);
+		if (payload) {
+			nrf_cloud_free(payload);
 		}
 		return ret;
 	}
@@ -1293,11 +1190,11 @@ send_ack:
 		if (ble_cb) {
 			ble_cb(&ble_job);
 		}
-		cJSON_Delete(payload_array);
+		nrf_cloud_free(payload);
 #endif
 	} else {
-		/* Save JSON to current fota and start update */
-		current_fota.parsed_payload = payload_array;
+		/* Save payload to current fota and start update */
+		current_fota.payload = payload;
 		ret = start_job(&current_fota);
 		(void)send_job_update(&current_fota);
 		if (ret) {
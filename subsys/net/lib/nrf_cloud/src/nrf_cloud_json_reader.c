@@ -0,0 +1,784 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include "nrf_cloud_json_reader.h"
+#include "nrf_cloud_mem.h"
+
+/* Expected next token */
+enum reader_state {
+	STATE_VALUE,
+	STATE_VALUE_OR_END,
+	STATE_KEY,
+	STATE_KEY_OR_END,
+	STATE_NEXT,
+	STATE_DONE,
+};
+
+void nrf_cloud_json_reader_init(struct nrf_cloud_json_reader *const r,
+				const char *const buf, const size_t len)
+{
+	__ASSERT_NO_MSG(r != NULL);
+
+	memset(r, 0, sizeof(*r));
+	r->buf = buf;
+	r->len = buf ? len : 0;
+	r->state = STATE_VALUE;
+}
+
+static int fail(struct nrf_cloud_json_reader *const r, const int err)
+{
+	r->err = err;
+	return err;
+}
+
+static void skip_ws(struct nrf_cloud_json_reader *const r)
+{
+	while (r->pos < r->len) {
+		switch (r->buf[r->pos]) {
+		case ' ':
+		case '\t':
+		case '\n':
+		case '\r':
+			r->pos++;
+			break;
+		default:
+			return;
+		}
+	}
+}
+
+static bool in_array(const struct nrf_cloud_json_reader *const r)
+{
+	return r->arrays & BIT(r->depth - 1);
+}
+
+static void value_done(struct nrf_cloud_json_reader *const r)
+{
+	r->state = r->depth ? STATE_NEXT : STATE_DONE;
+}
+
+static int hex4_get(const char *const s, uint32_t *const val)
+{
+	*val = 0;
+
+	for (int i = 0; i < 4; i++) {
+		char c = s[i];
+
+		*val <<= 4;
+		if (c >= '0' && c <= '9') {
+			*val |= c - '0';
+		} else if (c >= 'a' && c <= 'f') {
+			*val |= c - 'a' + 10;
+		} else if (c >= 'A' && c <= 'F') {
+			*val |= c - 'A' + 10;
+		} else {
+			return -EBADMSG;
+		}
+	}
+
+	return 0;
+}
+
+/* Length of the \u escape sequence at s, 6 or 12 for a surrogate pair,
+ * validated the same way as cJSON does.
+ */
+static size_t unicode_esc_len(const char *const s, const size_t avail)
+{
+	uint32_t first;
+	uint32_t second;
+
+	if (avail < 6 || hex4_get(&s[2], &first)) {
+		return 0;
+	}
+
+	if (first >= 0xDC00 && first <= 0xDFFF) {
+		return 0;
+	}
+
+	if (first < 0xD800 || first > 0xDBFF) {
+		return 6;
+	}
+
+	if (avail < 12 || s[6] != '\\' || s[7] != 'u' || hex4_get(&s[8], &second) ||
+	    second < 0xDC00 || second > 0xDFFF) {
+		return 0;
+	}
+
+	return 12;
+}
+
+static int string_read(struct nrf_cloud_json_reader *const r, struct nrf_cloud_json_tok *const tok,
+		       const enum nrf_cloud_json_type type)
+{
+	size_t i = r->pos + 1;
+
+	while (i < r->len) {
+		const unsigned char c = r->buf[i];
+
+		if (c == '\"') {
+			tok->type = type;
+			tok->ptr = &r->buf[r->pos + 1];
+			tok->len = i - r->pos - 1;
+			r->pos = i + 1;
+			return 0;
+		}
+
+		if (c < 0x20) {
+			break;
+		}
+
+		if (c != '\\') {
+			i++;
+			continue;
+		}
+
+		if (i + 1 >= r->len) {
+			break;
+		}
+
+		switch (r->buf[i + 1]) {
+		case '\"':
+		case '\\':
+		case '/':
+		case 'b':
+		case 'f':
+		case 'n':
+		case 'r':
+		case 't':
+			i += 2;
+			continue;
+		case 'u': {
+			size_t esc_len = unicode_esc_len(&r->buf[i], r->len - i);
+
+			if (!esc_len) {
+				return fail(r, -EBADMSG);
+			}
+			i += esc_len;
+			continue;
+		}
+		default:
+			return fail(r, -EBADMSG);
+		}
+	}
+
+	return fail(r, -EBADMSG);
+}
+
+static size_t digits_skip(const struct nrf_cloud_json_reader *const r, size_t i)
+{
+	while (i < r->len && r->buf[i] >= '0' && r->buf[i] <= '9') {
+		i++;
+	}
+
+	return i;
+}
+
+static int number_read(struct nrf_cloud_json_reader *const r, struct nrf_cloud_json_tok *const tok)
+{
+	size_t i = r->pos;
+	size_t digits;
+
+	if (r->buf[i] == '-') {
+		i++;
+	}
+
+	if (i < r->len && r->buf[i] == '0') {
+		i++;
+	} else {
+		digits = i;
+		i = digits_skip(r, i);
+		if (i == digits) {
+			return fail(r, -EBADMSG);
+		}
+	}
+
+	if (i < r->len && r->buf[i] == '.') {
+		digits = ++i;
+		i = digits_skip(r, i);
+		if (i == digits) {
+			return fail(r, -EBADMSG);
+		}
+	}
+
+	if (i < r->len && (r->buf[i] == 'e' || r->buf[i] == 'E')) {
+		i++;
+		if (i < r->len && (r->buf[i] == '+' || r->buf[i] == '-')) {
+			i++;
+		}
+		digits = i;
+		i = digits_skip(r, i);
+		if (i == digits) {
+			return fail(r, -EBADMSG);
+		}
+	}
+
+	/* cJSON reads all the characters that can be part of a number, so "01"
+	 * or "1.2.3" must not be read as a shorter number followed by garbage.
+	 */
+	if (i < r->len && strchr("0123456789+-.eE", r->buf[i]) && r->buf[i] != '\0') {
+		return fail(r, -EBADMSG);
+	}
+
+	if (i - r->pos > NRF_CLOUD_JSON_NUM_LEN_MAX) {
+		return fail(r, -EBADMSG);
+	}
+
+	tok->type = NRF_CLOUD_JSON_TOK_NUM;
+	tok->ptr = &r->buf[r->pos];
+	tok->len = i - r->pos;
+	r->pos = i;
+
+	return 0;
+}
+
+static int literal_read(struct nrf_cloud_json_reader *const r, struct nrf_cloud_json_tok *const tok,
+			const char *const literal, const enum nrf_cloud_json_type type)
+{
+	const size_t len = strlen(literal);
+
+	if (r->len - r->pos < len || memcmp(&r->buf[r->pos], literal, len)) {
+		return fail(r, -EBADMSG);
+	}
+
+	tok->type = type;
+	tok->ptr = &r->buf[r->pos];
+	tok->len = len;
+	r->pos += len;
+
+	return 0;
+}
+
+static int container_start(struct nrf_cloud_json_reader *const r,
+			   struct nrf_cloud_json_tok *const tok, const bool array)
+{
+	if (r->depth >= NRF_CLOUD_JSON_READER_DEPTH_MAX) {
+		return fail(r, -E2BIG);
+	}
+
+	if (array) {
+		r->arrays |= BIT(r->depth);
+	} else {
+		r->arrays &= ~BIT(r->depth);
+	}
+	r->depth++;
+	r->state = array ? STATE_VALUE_OR_END : STATE_KEY_OR_END;
+
+	tok->type = array ? NRF_CLOUD_JSON_TOK_ARR : NRF_CLOUD_JSON_TOK_OBJ;
+	tok->ptr = &r->buf[r->pos];
+	tok->len = 1;
+	r->pos++;
+
+	return 0;
+}
+
+static int container_end(struct nrf_cloud_json_reader *const r,
+			 struct nrf_cloud_json_tok *const tok)
+{
+	tok->type = in_array(r) ? NRF_CLOUD_JSON_TOK_ARR_END : NRF_CLOUD_JSON_TOK_OBJ_END;
+	tok->ptr = &r->buf[r->pos];
+	tok->len = 1;
+	r->pos++;
+	r->depth--;
+	value_done(r);
+
+	return 0;
+}
+
+static int value_read(struct nrf_cloud_json_reader *const r, struct nrf_cloud_json_tok *const tok)
+{
+	int err;
+
+	switch (r->buf[r->pos]) {
+	case '{':
+		return container_start(r, tok, false);
+	case '[':
+		return container_start(r, tok, true);
+	case '\"':
+		err = string_read(r, tok, NRF_CLOUD_JSON_TOK_STR);
+		break;
+	case 't':
+		err = literal_read(r, tok, "true", NRF_CLOUD_JSON_TOK_TRUE);
+		break;
+	case 'f':
+		err = literal_read(r, tok, "false", NRF_CLOUD_JSON_TOK_FALSE);
+		break;
+	case 'n':
+		err = literal_read(r, tok, "null", NRF_CLOUD_JSON_TOK_NULL);
+		break;
+	default:
+		err = number_read(r, tok);
+		break;
+	}
+
+	if (!err) {
+		value_done(r);
+	}
+
+	return err;
+}
+
+static int key_read(struct nrf_cloud_json_reader *const r, struct nrf_cloud_json_tok *const tok)
+{
+	if (r->buf[r->pos] != '\"' || string_read(r, tok, NRF_CLOUD_JSON_TOK_KEY)) {
+		return fail(r, -EBADMSG);
+	}
+
+	skip_ws(r);
+	if (r->pos >= r->len || r->buf[r->pos] != ':') {
+		return fail(r, -EBADMSG);
+	}
+
+	r->pos++;
+	r->state = STATE_VALUE;
+
+	return 0;
+}
+
+int nrf_cloud_json_next(struct nrf_cloud_json_reader *const r, struct nrf_cloud_json_tok *const tok)
+{
+	__ASSERT_NO_MSG(r != NULL);
+	__ASSERT_NO_MSG(tok != NULL);
+
+	if (r->err) {
+		return r->err;
+	}
+
+	if (r->state == STATE_DONE) {
+		return -ENODATA;
+	}
+
+	skip_ws(r);
+	if (r->pos >= r->len) {
+		return fail(r, -EBADMSG);
+	}
+
+	const char c = r->buf[r->pos];
+
+	switch (r->state) {
+	case STATE_NEXT:
+		if (c == (in_array(r) ? ']' : '}')) {
+			return container_end(r, tok);
+		}
+
+		if (c != ',') {
+			return fail(r, -EBADMSG);
+		}
+
+		r->pos++;
+		skip_ws(r);
+		if (r->pos >= r->len) {
+			return fail(r, -EBADMSG);
+		}
+
+		return in_array(r) ? value_read(r, tok) : key_read(r, tok);
+	case STATE_KEY_OR_END:
+		if (c == '}') {
+			return container_end(r, tok);
+		}
+		return key_read(r, tok);
+	case STATE_KEY:
+		return key_read(r, tok);
+	case STATE_VALUE_OR_END:
+		if (c == ']') {
+			return container_end(r, tok);
+		}
+		return value_read(r, tok);
+	case STATE_VALUE:
+	default:
+		return value_read(r, tok);
+	}
+}
+
+int nrf_cloud_json_skip(struct nrf_cloud_json_reader *const r,
+			const struct nrf_cloud_json_tok *const tok)
+{
+	__ASSERT_NO_MSG(r != NULL);
+	__ASSERT_NO_MSG(tok != NULL);
+
+	struct nrf_cloud_json_tok t;
+	const uint8_t depth = r->depth;
+	int err;
+
+	if (tok->type != NRF_CLOUD_JSON_TOK_OBJ && tok->type != NRF_CLOUD_JSON_TOK_ARR) {
+		return r->err;
+	}
+
+	while (r->depth >= depth) {
+		err = nrf_cloud_json_next(r, &t);
+		if (err) {
+			return (err == -ENODATA) ? fail(r, -EBADMSG) : err;
+		}
+	}
+
+	return 0;
+}
+
+int nrf_cloud_json_validate(const char *const buf, const size_t len)
+{
+	struct nrf_cloud_json_reader r;
+	struct nrf_cloud_json_tok tok;
+	int err;
+
+	nrf_cloud_json_reader_init(&r, buf, len);
+
+	do {
+		err = nrf_cloud_json_next(&r, &tok);
+	} while (!err);
+
+	return (err == -ENODATA) ? 0 : err;
+}
+
+/* Decode the character at *src, escaped or not, and advance *src past it.
+ * The input must have been validated by the reader.
+ */
+static size_t char_decode(const char **const src, char out[4])
+{
+	const char *s = *src;
+	uint32_t cp;
+	uint32_t low;
+	size_t len;
+	uint8_t mark;
+
+	if (s[0] != '\\') {
+		out[0] = s[0];
+		*src = s + 1;
+		return 1;
+	}
+
+	*src = s + 2;
+
+	switch (s[1]) {
+	case 'b':
+		out[0] = '\b';
+		return 1;
+	case 'f':
+		out[0] = '\f';
+		return 1;
+	case 'n':
+		out[0] = '\n';
+		return 1;
+	case 'r':
+		out[0] = '\r';
+		return 1;
+	case 't':
+		out[0] = '\t';
+		return 1;
+	case 'u':
+		break;
+	default:
+		out[0] = s[1];
+		return 1;
+	}
+
+	(void)hex4_get(&s[2], &cp);
+	*src = s + 6;
+
+	if (cp >= 0xD800 && cp <= 0xDBFF) {
+		(void)hex4_get(&s[8], &low);
+		cp = 0x10000 + (((cp & 0x3FF) << 10) | (low & 0x3FF));
+		*src = s + 12;
+	}
+
+	/* Encode as UTF-8 */
+	if (cp < 0x80) {
+		out[0] = cp;
+		return 1;
+	} else if (cp < 0x800) {
+		len = 2;
+		mark = 0xC0;
+	} else if (cp < 0x10000) {
+		len = 3;
+		mark = 0xE0;
+	} else {
+		len = 4;
+		mark = 0xF0;
+	}
+
+	for (size_t i = len - 1; i > 0; i--) {
+		out[i] = (cp & 0x3F) | 0x80;
+		cp >>= 6;
+	}
+	out[0] = cp | mark;
+
+	return len;
+}
+
+static bool is_str(const struct nrf_cloud_json_tok *const tok)
+{
+	return tok && (tok->type == NRF_CLOUD_JSON_TOK_STR || tok->type == NRF_CLOUD_JSON_TOK_KEY);
+}
+
+static char lower(const char c)
+{
+	return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
+static bool str_eq(const struct nrf_cloud_json_tok *const tok, const char *str, size_t len,
+		   const bool case_sensitive)
+{
+	const char *s = tok->ptr;
+	const char *const end = tok->ptr + tok->len;
+	char c[4];
+	size_t c_len;
+
+	while (s < end) {
+		c_len = char_decode(&s, c);
+
+		/* Like cJSON, the string ends at an escaped NULL character */
+		if (c[0] == '\0') {
+			break;
+		}
+
+		if (c_len > len) {
+			return false;
+		}
+
+		for (size_t i = 0; i < c_len; i++, str++) {
+			if (case_sensitive ? (c[i] != *str) : (lower(c[i]) != lower(*str))) {
+				return false;
+			}
+		}
+		len -= c_len;
+	}
+
+	return len == 0;
+}
+
+bool nrf_cloud_json_str_eq(const struct nrf_cloud_json_tok *const tok, const char *const str,
+			   const bool case_sensitive)
+{
+	if (!is_str(tok) || !str) {
+		return false;
+	}
+
+	return str_eq(tok, str, strlen(str), case_sensitive);
+}
+
+int nrf_cloud_json_str_get(const struct nrf_cloud_json_tok *const tok, char *const buf,
+			   const size_t size)
+{
+	if (!is_str(tok) || (buf && !size)) {
+		return -EINVAL;
+	}
+
+	const char *s = tok->ptr;
+	const char *const end = tok->ptr + tok->len;
+	size_t len = 0;
+	size_t c_len;
+	char c[4];
+
+	while (s < end) {
+		c_len = char_decode(&s, c);
+		if (c[0] == '\0') {
+			break;
+		}
+
+		if (buf) {
+			/* Always keep room for the NULL terminator */
+			if (c_len >= size - len) {
+				buf[len] = '\0';
+				return -ENOBUFS;
+			}
+
+			/* Never overtakes the input when unescaping in place */
+			memcpy(&buf[len], c, c_len);
+		}
+		len += c_len;
+	}
+
+	if (buf) {
+		buf[len] = '\0';
+	}
+
+	return (len <= INT_MAX) ? (int)len : -ENOBUFS;
+}
+
+char *nrf_cloud_json_str_dup(const struct nrf_cloud_json_tok *const tok)
+{
+	int len = nrf_cloud_json_str_get(tok, NULL, 0);
+	char *str;
+
+	if (len < 0) {
+		return NULL;
+	}
+
+	str = nrf_cloud_malloc(len + 1);
+	if (str) {
+		(void)nrf_cloud_json_str_get(tok, str, len + 1);
+	}
+
+	return str;
+}
+
+int nrf_cloud_json_num_get(const struct nrf_cloud_json_tok *const tok, double *const val)
+{
+	char num[NRF_CLOUD_JSON_NUM_LEN_MAX + 1];
+
+	if (!tok || !val || tok->type != NRF_CLOUD_JSON_TOK_NUM || tok->len >= sizeof(num)) {
+		return -EINVAL;
+	}
+
+	memcpy(num, tok->ptr, tok->len);
+	num[tok->len] = '\0';
+	*val = strtod(num, NULL);
+
+	return 0;
+}
+
+int nrf_cloud_json_int_get(const struct nrf_cloud_json_tok *const tok, int *const val)
+{
+	double num;
+	int err = nrf_cloud_json_num_get(tok, &num);
+
+	if (err) {
+		return err;
+	}
+
+	if (num >= INT_MAX) {
+		*val = INT_MAX;
+	} else if (num <= (double)INT_MIN) {
+		*val = INT_MIN;
+	} else {
+		*val = (int)num;
+	}
+
+	return 0;
+}
+
+static int member_find(struct nrf_cloud_json_reader *const r, const char *const key,
+		       const size_t key_len, struct nrf_cloud_json_tok *const tok)
+{
+	struct nrf_cloud_json_tok key_tok;
+	bool match;
+	int err;
+
+	while (true) {
+		err = nrf_cloud_json_next(r, &key_tok);
+		if (err) {
+			return err;
+		}
+
+		if (key_tok.type == NRF_CLOUD_JSON_TOK_OBJ_END) {
+			return -ENOENT;
+		}
+
+		match = str_eq(&key_tok, key, key_len, false);
+
+		err = nrf_cloud_json_next(r, tok);
+		if (err || match) {
+			return err;
+		}
+
+		err = nrf_cloud_json_skip(r, tok);
+		if (err) {
+			return err;
+		}
+	}
+}
+
+static int element_find(struct nrf_cloud_json_reader *const r, const char *const idx_str,
+			const size_t idx_len, struct nrf_cloud_json_tok *const tok)
+{
+	size_t idx = 0;
+	int err;
+
+	if (!idx_len) {
+		return -ENOENT;
+	}
+
+	for (size_t i = 0; i < idx_len; i++) {
+		if (idx_str[i] < '0' || idx_str[i] > '9' || idx > (SIZE_MAX / 10) - 1) {
+			return -ENOENT;
+		}
+		idx = (idx * 10) + (idx_str[i] - '0');
+	}
+
+	for (size_t i = 0; ; i++) {
+		err = nrf_cloud_json_next(r, tok);
+		if (err) {
+			return err;
+		}
+
+		if (tok->type == NRF_CLOUD_JSON_TOK_ARR_END) {
+			return -ENOENT;
+		}
+
+		if (i == idx) {
+			return 0;
+		}
+
+		err = nrf_cloud_json_skip(r, tok);
+		if (err) {
+			return err;
+		}
+	}
+}
+
+int nrf_cloud_json_find(const char *const buf, const size_t len, const char *const path,
+			struct nrf_cloud_json_tok *const tok)
+{
+	if (!buf || !path || !tok) {
+		return -EINVAL;
+	}
+
+	struct nrf_cloud_json_reader r;
+	struct nrf_cloud_json_tok t;
+	const char *seg = path;
+	const char *start;
+	size_t seg_len;
+	int err;
+
+	nrf_cloud_json_reader_init(&r, buf, len);
+
+	err = nrf_cloud_json_next(&r, &t);
+	if (err) {
+		return err;
+	}
+
+	while (*seg) {
+		start = strchr(seg, '.');
+		seg_len = start ? (start - seg) : strlen(seg);
+
+		if (t.type == NRF_CLOUD_JSON_TOK_OBJ) {
+			err = member_find(&r, seg, seg_len, &t);
+		} else if (t.type == NRF_CLOUD_JSON_TOK_ARR) {
+			err = element_find(&r, seg, seg_len, &t);
+		} else {
+			err = -ENOENT;
+		}
+
+		if (err) {
+			return err;
+		}
+
+		seg += seg_len;
+		if (*seg) {
+			seg++;
+		}
+	}
+
+	/* Make an object or array token span the whole value */
+	if (t.type == NRF_CLOUD_JSON_TOK_OBJ || t.type == NRF_CLOUD_JSON_TOK_ARR) {
+		start = t.ptr;
+		err = nrf_cloud_json_skip(&r, &t);
+		if (err) {
+			return err;
+		}
+		t.len = &r.buf[r.pos] - start;
+	}
+
+	*tok = t;
+
+	return 0;
+}
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include "nrf_cloud_json_writer.h"
+#include "nrf_cloud_mem.h"
+
+/* Same size as the number buffer used by cJSON */
+#define NUM_STR_SIZE 26
+
+void nrf_cloud_json_writer_init(struct nrf_cloud_json_writer *const w,
+				char *const buf, const size_t size)
+{
+	__ASSERT_NO_MSG(w != NULL);
+
+	memset(w, 0, sizeof(*w));
+	w->buf = buf;
+	w->size = size;
+
+	if (buf && !size) {
+		w->err = -ENOBUFS;
+	}
+}
+
+static void put(struct nrf_cloud_json_writer *const w, const char *const src, const size_t len)
+{
+	if (w->err) {
+		return;
+	}
+
+	if (w->buf) {
+		/* Always keep room for the NULL terminator */
+		if (len >= w->size - w->len) {
+			w->err = -ENOBUFS;
+			return;
+		}
+		memcpy(&w->buf[w->len], src, len);
+	}
+
+	w->len += len;
+}
+
+static void put_str(struct nrf_cloud_json_writer *const w, const char *str)
+{
+	static const char hex[] = "0123456789abcdef";
+	const char *run = str;
+	char esc[6] = { '\\' };
+	size_t esc_len;
+
+	put(w, "\"", 1);
+
+	for (; *str; str++) {
+		unsigned char c = *str;
+
+		if (c >= 0x20 && c != '\"' && c != '\\') {
+			continue;
+		}
+
+		/* Flush the unescaped characters preceding this one */
+		put(w, run, str - run);
+		run = str + 1;
+		esc_len = 2;
+
+		switch (c) {
+		case '\"':
+		case '\\':
+			esc[1] = c;
+			break;
+		case '\b':
+			esc[1] = 'b';
+			break;
+		case '\f':
+			esc[1] = 'f';
+			break;
+		case '\n':
+			esc[1] = 'n';
+			break;
+		case '\r':
+			esc[1] = 'r';
+			break;
+		case '\t':
+			esc[1] = 't';
+			break;
+		default:
+			esc[1] = 'u';
+			esc[2] = '0';
+			esc[3] = '0';
+			esc[4] = hex[c >> 4];
+			esc[5] = hex[c & 0xF];
+			esc_len = 6;
+			break;
+		}
+		put(w, esc, esc_len);
+	}
+
+	put(w, run, str - run);
+
+	put(w, "\"", 1);
+}
+
+static int item_begin(struct nrf_cloud_json_writer *const w, const char *const key)
+{
+	if (w->err) {
+		return w->err;
+	}
+
+	if (w->depth == 0) {
+		/* A single root value without a key */
+		if (key || w->len) {
+			w->err = -EINVAL;
+			return w->err;
+		}
+		return 0;
+	}
+
+	const uint32_t level = BIT(w->depth - 1);
+
+	/* Object members must have a key, array elements must not */
+	if (!key != !!(w->arrays & level)) {
+		w->err = -EINVAL;
+		return w->err;
+	}
+
+	if (w->items & level) {
+		put(w, ",", 1);
+	}
+	w->items |= level;
+
+	if (key) {
+		put_str(w, key);
+		put(w, ":", 1);
+	}
+
+	return w->err;
+}
+
+static int container_start(struct nrf_cloud_json_writer *const w, const char *const key,
+			   const bool array)
+{
+	if (item_begin(w, key)) {
+		return w->err;
+	}
+
+	if (w->depth >= NRF_CLOUD_JSON_WRITER_DEPTH_MAX) {
+		w->err = -EINVAL;
+		return w->err;
+	}
+
+	put(w, array ? "[" : "{", 1);
+
+	const uint32_t level = BIT(w->depth);
+
+	w->items &= ~level;
+	if (array) {
+		w->arrays |= level;
+	} else {
+		w->arrays &= ~level;
+	}
+	w->depth++;
+
+	return w->err;
+}
+
+static int container_end(struct nrf_cloud_json_writer *const w, const bool array)
+{
+	if (w->err) {
+		return w->err;
+	}
+
+	if (!w->depth || (!(w->arrays & BIT(w->depth - 1)) != !array)) {
+		w->err = -EINVAL;
+		return w->err;
+	}
+
+	put(w, array ? "]" : "}", 1);
+	w->depth--;
+
+	return w->err;
+}
+
+int nrf_cloud_json_obj_start(struct nrf_cloud_json_writer *const w, const char *const key)
+{
+	return container_start(w, key, false);
+}
+
+int nrf_cloud_json_obj_end(struct nrf_cloud_json_writer *const w)
+{
+	return container_end(w, false);
+}
+
+int nrf_cloud_json_arr_start(struct nrf_cloud_json_writer *const w, const char *const key)
+{
+	return container_start(w, key, true);
+}
+
+int nrf_cloud_json_arr_end(struct nrf_cloud_json_writer *const w)
+{
+	return container_end(w, true);
+}
+
+int nrf_cloud_json_str_add(struct nrf_cloud_json_writer *const w, const char *const key,
+			   const char *const val)
+{
+	if (!val) {
+		w->err = -EINVAL;
+		return w->err;
+	}
+
+	if (item_begin(w, key)) {
+		return w->err;
+	}
+
+	put_str(w, val);
+
+	return w->err;
+}
+
+static bool num_equal(const double a, const double b)
+{
+	const double max = fabs(a) > fabs(b) ? fabs(a) : fabs(b);
+
+	return fabs(a - b) <= max * DBL_EPSILON;
+}
+
+int nrf_cloud_json_num_add(struct nrf_cloud_json_writer *const w, const char *const key,
+			   const double val)
+{
+	char num[NUM_STR_SIZE];
+	int len;
+
+	if (item_begin(w, key)) {
+		return w->err;
+	}
+
+	/* Same formatting as print_number() of cJSON, which stores
+	 * the value saturated to an int next to the double.
+	 */
+	if (isnan(val) || isinf(val)) {
+		len = snprintf(num, sizeof(num), "null");
+	} else if (val >= INT_MIN && val <= INT_MAX && val == (double)(int)val) {
+		len = snprintf(num, sizeof(num), "%d", (int)val);
+	} else {
+		len = snprintf(num, sizeof(num), "%1.15g", val);
+
+		/* Use more digits if 15 are not enough to restore the value */
+		if (!num_equal(strtod(num, NULL), val)) {
+			len = snprintf(num, sizeof(num), "%1.17g", val);
+		}
+	}
+
+	if ((len < 0) || ((size_t)len >= sizeof(num))) {
+		w->err = -EINVAL;
+		return w->err;
+	}
+
+	put(w, num, len);
+
+	return w->err;
+}
+
+int nrf_cloud_json_null_add(struct nrf_cloud_json_writer *const w, const char *const key)
+{
+	if (item_begin(w, key)) {
+		return w->err;
+	}
+
+	put(w, "null", 4);
+
+	return w->err;
+}
+
+int nrf_cloud_json_writer_finish(struct nrf_cloud_json_writer *const w)
+{
+	if (w->err) {
+		return w->err;
+	}
+
+	if (w->depth || !w->len || w->len > INT_MAX) {
+		return -EINVAL;
+	}
+
+	if (w->buf) {
+		w->buf[w->len] = '\0';
+	}
+
+	return (int)w->len;
+}
+
+int nrf_cloud_json_encode_alloc(nrf_cloud_json_encode_t encode, const void *const ctx,
+				char **string_out, size_t *len_out)
+{
+	if (!encode || !string_out) {
+		return -EINVAL;
+	}
+
+	struct nrf_cloud_json_writer w;
+	char *buf;
+	int len;
+	int err;
+
+	/* Compute the size of the output */
+	nrf_cloud_json_writer_init(&w, NULL, 0);
+	err = encode(&w, ctx);
+	if (err) {
+		return err;
+	}
+
+	len = nrf_cloud_json_writer_finish(&w);
+	if (len < 0) {
+		return len;
+	}
+
+	buf = nrf_cloud_malloc(len + 1);
+	if (!buf) {
+		return -ENOMEM;
+	}
+
+	nrf_cloud_json_writer_init(&w, buf, len + 1);
+	err = encode(&w, ctx);
+	if (!err) {
+		err = nrf_cloud_json_writer_finish(&w);
+		if (err >= 0) {
+			/* The encoding function must be deterministic */
+			err = (err == len) ? 0 : -EIO;
+		}
+	}
+
+	if (err) {
+		nrf_cloud_free(buf);
+		return err;
+	}
+
+	*string_out = buf;
+	if (len_out) {
+		*len_out = len;
+	}
+
+	return 0;
+}
@@ -12,10 +12,23 @@
 
 #include "nrf_cloud_fsm.h"
 #include "nrf_cloud_codec.h"
+#include "nrf_cloud_mem.h"
 #include "nrf_cloud_transport.h"
 
 LOG_MODULE_REGISTER(nrf_cloud_location, CONFIG_NRF_CLOUD_LOG_LEVEL);
 
+static int location_request_check(const struct lte_lc_cells_info *const cells_inf,
+				  const struct wifi_scan_info *const wifi_inf)
+{
+	if (!cells_inf && !wifi_inf) {
+		return -EINVAL;
+	} else if (!cells_inf && (wifi_inf->cnt < NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN)) {
+		return -EDOM;
+	}
+
+	return 0;
+}
+
 int nrf_cloud_location_request(const struct lte_lc_cells_info *const cells_inf,
 			       const struct wifi_scan_info *const wifi_inf,
 			       const bool request_loc, nrf_cloud_location_response_t cb)
@@ -24,20 +37,31 @@ int nrf_cloud_location_request(const struct lte_lc_cells_info *const cells_inf,
 		return -EACCES;
 	}
 
-	int err = 0;
-	cJSON *location_req_obj = NULL;
+	int err = location_request_check(cells_inf, wifi_inf);
+	struct nct_dc_data msg = {0};
 
-	err = nrf_cloud_location_request_json_get(cells_inf, wifi_inf,
-						  request_loc, &location_req_obj);
-	if (!err) {
-		if (request_loc) {
-			nfsm_set_location_response_cb(cb);
-		}
+	if (err) {
+		return err;
+	}
 
-		err = json_send_to_cloud(location_req_obj);
+	err = nrf_cloud_location_req_msg_encode(cells_inf, wifi_inf, request_loc, &msg.data);
+	if (err) {
+		LOG_ERR("Failed to encode location request, error: %d", err);
+		return err;
 	}
 
-	cJSON_Delete(location_req_obj);
+	if (request_loc) {
+		nfsm_set_location_response_cb(cb);
+	}
+
+	LOG_DBG("Created request: %s", (const char *)msg.data.ptr);
+
+	err = nct_dc_send(&msg);
+	if (err) {
+		LOG_ERR("Failed to send request, error: %d", err);
+	}
+
+	nrf_cloud_free((void *)msg.data.ptr);
 	return err;
 }
 
@@ -50,13 +74,16 @@ int nrf_cloud_location_request_json_get(const struct lte_lc_cells_info *const ce
 					const struct wifi_scan_info *const wifi_inf,
 					const bool request_loc, cJSON **req_obj_out)
 {
-	if (!req_obj_out || (!cells_inf && !wifi_inf)) {
+	if (!req_obj_out) {
 		return -EINVAL;
-	} else if (!cells_inf && (wifi_inf->cnt < NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN)) {
-		return -EDOM;
 	}
 
-	int err = 0;
+	int err = location_request_check(cells_inf, wifi_inf);
+
+	if (err) {
+		return err;
+	}
+
 	*req_obj_out = json_create_req_obj(NRF_CLOUD_JSON_APPID_VAL_LOCATION,
 					   NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
 	cJSON *data_obj = cJSON_AddObjectToObject(*req_obj_out, NRF_CLOUD_JSON_DATA_KEY);
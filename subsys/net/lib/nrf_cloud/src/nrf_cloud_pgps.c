@@ -73,6 +73,7 @@ struct pgps_index {
 	uint8_t cur_pnum;
 	bool partial_request;
 	bool stale_server_data;
+	bool restored;
 	uint32_t storage_extent;
 	int store_block;
 
@@ -83,8 +84,31 @@ struct pgps_index {
 	 * a pointer.
 	 */
 	struct nrf_cloud_pgps_prediction *predictions[NUM_PREDICTIONS];
+
+	/* Whether the prediction at the same position in predictions[]
+	 * has been validated, or was stored during this download.
+	 * Predictions restored from the saved block map are validated
+	 * when first used.
+	 */
+	bool validated[NUM_PREDICTIONS];
 };
 
+/* Start of a stored prediction, up to its ephemerides; enough to
+ * catalog and validate it without reading the whole prediction.
+ */
+struct pgps_prediction_head {
+	uint8_t time_type;
+	uint16_t time_count;
+	struct nrf_cloud_pgps_system_time time;
+	uint8_t schema_version;
+	uint8_t ephemeris_type;
+	uint16_t ephemeris_count;
+} __packed;
+
+BUILD_ASSERT(sizeof(struct pgps_prediction_head) ==
+	     offsetof(struct nrf_cloud_pgps_prediction, ephemerii),
+	     "pgps_prediction_head does not match nrf_cloud_pgps_prediction");
+
 static struct pgps_index index;
 
 static struct stream_flash_ctx stream;
@@ -99,8 +123,16 @@ static pgps_event_handler_t evt_handler;
 static uint8_t *write_buf;
 
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-static off_t prediction_cache_flash_offset = UINT32_MAX;
-static uint8_t prediction_cache[PGPS_PREDICTION_STORAGE_SIZE];
+#define PREDICTION_CACHE_SIZE		CONFIG_NRF_CLOUD_PGPS_PREDICTION_CACHE_SIZE
+
+/* Copies of the most recently used predictions in external flash */
+static struct prediction_cache_entry {
+	off_t flash_offset;
+	uint32_t last_used;
+	uint8_t data[PGPS_PREDICTION_STORAGE_SIZE];
+} prediction_cache[PREDICTION_CACHE_SIZE];
+static uint32_t prediction_cache_use_count;
+static uint32_t flash_read_count;
 #endif
 
 static uint8_t prediction_buf[PGPS_PREDICTION_STORAGE_SIZE];
@@ -108,6 +140,8 @@ static atomic_t accept_packets;
 static atomic_t pgps_need_assistance;
 
 static int validate_stored_predictions(uint16_t *bad_day, uint32_t *bad_time);
+static void get_prediction_day_time(int pnum, int64_t *gps_sec, uint16_t *gps_day,
+				    uint32_t *gps_time_of_day);
 static void log_pgps_header(const char *msg, const struct nrf_cloud_pgps_header *header);
 static int consume_pgps_header(const char *buf, size_t buf_len);
 static void cache_pgps_header(const struct nrf_cloud_pgps_header *header);
@@ -127,7 +161,9 @@ K_TIMER_DEFINE(prediction_timer, prediction_timer_handler, NULL);
 static void discard_prediction_buffer(void)
 {
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-	prediction_cache_flash_offset = UINT32_MAX;
+	for (int i = 0; i < PREDICTION_CACHE_SIZE; i++) {
+		prediction_cache[i].flash_offset = UINT32_MAX;
+	}
 #endif
 }
 
@@ -136,6 +172,31 @@ static int get_prediction_block(int pnum)
 	return npgps_pointer_to_block((uint8_t *)index.predictions[pnum]);
 }
 
+#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
+static struct prediction_cache_entry *find_cache_entry(off_t off)
+{
+	struct prediction_cache_entry *lru = &prediction_cache[0];
+
+	/* Return the entry holding the prediction, or else the least recently used one */
+	for (int i = 0; i < PREDICTION_CACHE_SIZE; i++) {
+		if (prediction_cache[i].flash_offset == off) {
+			return &prediction_cache[i];
+		}
+		if (prediction_cache[i].flash_offset == UINT32_MAX) {
+			/* Use an unused entry before evicting one */
+			if (lru->flash_offset != UINT32_MAX) {
+				lru = &prediction_cache[i];
+			}
+		} else if ((lru->flash_offset != UINT32_MAX) &&
+			   (prediction_cache[i].last_used < lru->last_used)) {
+			lru = &prediction_cache[i];
+		}
+	}
+
+	return lru;
+}
+#endif
+
 /**
  * @brief When using external flash, ensure the prediction at the requested flash device offset
  * is available via the prediction cache.  When using internal flash, just the flash device offset
@@ -146,36 +207,81 @@ static int get_prediction_block(int pnum)
  *
  * @return struct nrf_cloud_pgps_prediction* Pointer to a cached copy of the prediction when
  * using external flash, or a direct pointer the prediction when using internal flash.
+ * A cached copy stays valid until CONFIG_NRF_CLOUD_PGPS_PREDICTION_CACHE_SIZE other
+ * predictions have been requested.
  */
 static struct nrf_cloud_pgps_prediction *get_cached_prediction(off_t off)
 {
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
+	struct prediction_cache_entry *entry = find_cache_entry(off);
+
 	/* Check if the cached prediction is the one we want; if not, read it now */
-	if (prediction_cache_flash_offset != off) {
+	if (entry->flash_offset != off) {
 		int err;
 
 		/* Subtract fa_off from off to convert from flash device address space
 		 * to partition address space.
 		 */
+		entry->flash_offset = UINT32_MAX;
 		err = flash_area_read(prediction_flash_area, off - prediction_flash_area->fa_off,
-				      prediction_cache, sizeof(prediction_cache));
+				      entry->data, sizeof(entry->data));
+		flash_read_count++;
 
 		if (err) {
 			LOG_ERR("Error %d reading prediction from flash offset 0x%lx",
 				err, off);
 			return NULL;
 		}
-		prediction_cache_flash_offset = off;
+		entry->flash_offset = off;
 		LOG_DBG("Caching offset 0x%X", (uint32_t)(off - prediction_flash_area->fa_off));
 	}
+	entry->last_used = ++prediction_cache_use_count;
 
-	return (struct nrf_cloud_pgps_prediction *)prediction_cache;
+	return (struct nrf_cloud_pgps_prediction *)entry->data;
 #else
 	/* The parameter off is really the address in built-in flash for the prediction */
 	return (struct nrf_cloud_pgps_prediction *)off;
 #endif
 }
 
+/**
+ * @brief Read the start and the sentinel of the prediction at the requested flash
+ * device offset, without reading its ephemerides from external flash.
+ *
+ * @param off Flash device offset or address of the prediction, as for get_cached_prediction().
+ * @param head Start of the prediction.
+ * @param sentinel Sentinel stored at the end of the prediction.
+ *
+ * @return int 0 on success, otherwise a negative error code.
+ */
+static int read_prediction_head(off_t off, struct pgps_prediction_head *head,
+				uint32_t *sentinel)
+{
+#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
+	int err;
+
+	off -= prediction_flash_area->fa_off;
+	err = flash_area_read(prediction_flash_area, off, head, sizeof(*head));
+	if (!err) {
+		err = flash_area_read(prediction_flash_area,
+				      off + offsetof(struct nrf_cloud_pgps_prediction, sentinel),
+				      sentinel, sizeof(*sentinel));
+	}
+	flash_read_count += 2;
+	if (err) {
+		LOG_ERR("Error %d reading prediction header from flash offset 0x%lx",
+			err, off);
+	}
+	return err;
+#else
+	const struct nrf_cloud_pgps_prediction *p = (const struct nrf_cloud_pgps_prediction *)off;
+
+	memcpy(head, p, sizeof(*head));
+	*sentinel = p->sentinel;
+	return 0;
+#endif
+}
+
 static struct nrf_cloud_pgps_prediction *get_prediction(int pnum)
 {
 	off_t off = (off_t)index.predictions[pnum];
@@ -195,7 +301,7 @@ static struct nrf_cloud_pgps_prediction *get_prediction_slot(int slot, off_t *fl
 }
 
 static int determine_prediction_num(struct nrf_cloud_pgps_header *header,
-				    struct nrf_cloud_pgps_prediction *p)
+				    const struct pgps_prediction_head *p)
 {
 	int64_t start_sec = npgps_gps_day_time_to_sec(header->gps_day,
 						      header->gps_time_of_day);
@@ -243,7 +349,8 @@ static bool validate_pgps_header(const struct nrf_cloud_pgps_header *header)
 	return true;
 }
 
-static int validate_prediction(const struct nrf_cloud_pgps_prediction *p,
+static int validate_prediction(const struct pgps_prediction_head *p,
+			       uint32_t stored_sentinel,
 			       uint16_t gps_day,
 			       uint32_t gps_time_of_day,
 			       uint16_t period_min,
@@ -294,11 +401,9 @@ static int validate_prediction(const struct nrf_cloud_pgps_prediction *p,
 
 	if (exact && !err) {
 		uint32_t expected_sentinel;
-		uint32_t stored_sentinel;
 
 		expected_sentinel = npgps_gps_day_time_to_sec(gps_day,
 							      gps_time_of_day);
-		stored_sentinel = p->sentinel;
 		if (expected_sentinel != stored_sentinel) {
 			LOG_ERR("prediction at:%p has stored_sentinel:0x%08X, "
 				"expected:0x%08X", p, stored_sentinel,
@@ -312,85 +417,156 @@ static int validate_prediction(const struct nrf_cloud_pgps_prediction *p,
 	return err;
 }
 
-static int validate_stored_predictions(uint16_t *first_bad_day,
-				       uint32_t *first_bad_time)
+static void save_block_map(void)
 {
 	int err;
-	int i;
-	int pnum;
+	struct npgps_block_map map = {
+		.gps_day = index.header.gps_day,
+		.gps_time_of_day = index.header.gps_time_of_day,
+		.prediction_count = index.header.prediction_count,
+	};
+
+	for (int pnum = 0; pnum < map.prediction_count; pnum++) {
+		if (index.predictions[pnum] == NULL) {
+			LOG_DBG("Prediction num:%u missing; not saving block map", pnum);
+			return;
+		}
+		map.blocks[pnum] = (uint8_t)get_prediction_block(pnum);
+	}
+
+	err = npgps_save_block_map(&map);
+	if (err) {
+		LOG_WRN("Error saving block map:%d", err);
+	}
+}
+
+static int restore_stored_predictions(void)
+{
+	const struct npgps_block_map *map = npgps_get_saved_block_map();
 	uint16_t count = index.header.prediction_count;
-	uint16_t period_min = index.header.prediction_period_min;
-	uint16_t gps_day = index.header.gps_day;
-	uint32_t gps_time_of_day = index.header.gps_time_of_day;
-	struct nrf_cloud_pgps_prediction *pred;
-	int64_t start_gps_sec = index.start_sec;
-	off_t off;
-	int64_t gps_sec;
+	bool used[NUM_BLOCKS] = {false};
+	int pnum;
+
+	if ((map->prediction_count != count) ||
+	    (map->gps_day != index.header.gps_day) ||
+	    (map->gps_time_of_day != index.header.gps_time_of_day)) {
+		LOG_DBG("No block map saved for stored predictions");
+		return -ENOENT;
+	}
 
-	/* reset catalog of predictions */
-	discard_prediction_buffer();
 	for (pnum = 0; pnum < count; pnum++) {
-		index.predictions[pnum] = NULL;
+		if ((map->blocks[pnum] >= NUM_BLOCKS) || used[map->blocks[pnum]]) {
+			LOG_WRN("Saved block map is bad at prediction num:%u", pnum);
+			return -EINVAL;
+		}
+		used[map->blocks[pnum]] = true;
 	}
 
-	npgps_reset_block_pool();
+	for (pnum = 0; pnum < count; pnum++) {
+		index.predictions[pnum] = npgps_block_to_pointer(map->blocks[pnum]);
+	}
+
+	return 0;
+}
 
-	/* build catalog of predictions by block */
+static void scan_stored_predictions(void)
+{
+	int err;
+	int i;
+	int pnum;
+	uint16_t count = index.header.prediction_count;
+	uint16_t period_min = index.header.prediction_period_min;
+	uint16_t gps_day;
+	uint32_t gps_time_of_day;
+	struct pgps_prediction_head head;
+	uint32_t sentinel;
+	off_t off;
+
+	/* build catalog of predictions by block, and validate each one as it is found;
+	 * only the start and the sentinel of each prediction are read, not its ephemerides
+	 */
 	for (i = 0; i < count; i++) {
-		pred = (struct nrf_cloud_pgps_prediction *)get_prediction_slot(i, &off);
-		if (pred == NULL) {
+		off = storage_addr + i * PGPS_PREDICTION_STORAGE_SIZE;
+		err = read_prediction_head(off, &head, &sentinel);
+		if (err) {
 			LOG_ERR("Prediction at idx:%d not accessible", i);
 			continue;
 		}
 
-		pnum = determine_prediction_num(&index.header, pred);
+		pnum = determine_prediction_num(&index.header, &head);
 		if (pnum < 0) {
-			LOG_ERR("prediction idx:%u, ofs:%p, out of expected time range;"
-				" day:%u, time:%u", i, (void *)pred, pred->time.date_day,
-				pred->time.time_full_s);
+			LOG_ERR("prediction idx:%u, ofs:0x%lX, out of expected time range;"
+				" day:%u, time:%u", i, (unsigned long)off, head.time.date_day,
+				head.time.time_full_s);
 		} else if (index.predictions[pnum] == NULL) {
 			index.predictions[pnum] = (struct nrf_cloud_pgps_prediction *)off;
 			LOG_DBG("Prediction num:%u stored at idx:%d, off:0x%lX",
 				pnum, i, (unsigned long) off);
+
+			/* calculate expected time signature */
+			get_prediction_day_time(pnum, NULL, &gps_day, &gps_time_of_day);
+			err = validate_prediction(&head, sentinel, gps_day, gps_time_of_day,
+						  period_min, true, false);
+			if (err) {
+				LOG_ERR("Prediction num:%u, gps_day:%u, "
+					"gps_time_of_day:%u is bad:%d; off:0x%lX",
+					pnum, gps_day, gps_time_of_day, err, (unsigned long)off);
+			}
+			index.validated[pnum] = !err;
 		} else {
 			LOG_WRN("Prediction num:%u stored more than once!", pnum);
 		}
 	}
+}
 
-	/* validate predictions in time order, independent of storage order */
-	i = -1;
+static int validate_stored_predictions(uint16_t *first_bad_day,
+				       uint32_t *first_bad_time)
+{
+	int i;
+	int pnum;
+	uint16_t count = index.header.prediction_count;
+
+	/* reset catalog of predictions */
+	discard_prediction_buffer();
 	for (pnum = 0; pnum < count; pnum++) {
-		/* calculate expected time signature */
-		gps_sec = start_gps_sec + pnum * period_min * SEC_PER_MIN;
-		npgps_gps_sec_to_day_time(gps_sec, &gps_day, &gps_time_of_day);
+		index.predictions[pnum] = NULL;
+		index.validated[pnum] = false;
+	}
 
-		pred = get_prediction(pnum);
-		if (pred == NULL) {
-			LOG_WRN("Prediction num:%u missing", pnum);
-			/* request partial data; download interrupted? */
-			*first_bad_day = gps_day;
-			*first_bad_time = gps_time_of_day;
-			break;
-		}
+	npgps_reset_block_pool();
 
-		err = validate_prediction(pred, gps_day, gps_time_of_day,
-					  period_min, true, false);
-		if (err) {
-			LOG_ERR("Prediction num:%u, gps_day:%u, "
-				"gps_time_of_day:%u is bad:%d; loc:%p",
-				pnum, gps_day, gps_time_of_day, err, pred);
+	/* the block map saved after the last download avoids reading every
+	 * stored prediction from flash; without it, walk all of them
+	 */
+	index.restored = (restore_stored_predictions() == 0);
+	if (!index.restored) {
+		scan_stored_predictions();
+	}
+
+	/* find first missing or bad prediction in time order, independent of storage order */
+	i = -1;
+	for (pnum = 0; pnum < count; pnum++) {
+		if ((index.predictions[pnum] == NULL) ||
+		    (!index.restored && !index.validated[pnum])) {
+			if (index.predictions[pnum] == NULL) {
+				LOG_WRN("Prediction num:%u missing", pnum);
+			}
 			/* request partial data; download interrupted? */
-			*first_bad_day = gps_day;
-			*first_bad_time = gps_time_of_day;
+			get_prediction_day_time(pnum, NULL, first_bad_day, first_bad_time);
 			break;
 		}
 
 		i = get_prediction_block(pnum);
-		LOG_DBG("Prediction num:%u, loc:%p, blk:%d", pnum, pred, i);
-		__ASSERT(i != NO_BLOCK, "unexpected pointer value %p", pred);
+		LOG_DBG("Prediction num:%u, loc:%p, blk:%d", pnum, index.predictions[pnum], i);
+		__ASSERT(i != NO_BLOCK, "unexpected pointer value %p", index.predictions[pnum]);
 		npgps_mark_block_used(i, true);
 	}
 
+#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
+	LOG_DBG("%s %d predictions with %u flash reads",
+		index.restored ? "Restored" : "Validated", pnum, flash_read_count);
+#endif
+
 	/* find first free block in flash, if any, after chronologicaly
 	 * last good prediction, if any; this is where any new downloads
 	 * should begin, to maintain a circularly arranged flash
@@ -405,10 +581,39 @@ static int validate_stored_predictions(uint16_t *first_bad_day,
 		}
 	}
 
+	/* all good, so the next boot does not have to walk them again */
+	if (!index.restored && (pnum == count)) {
+		save_block_map();
+	}
+
 	npgps_print_blocks();
 	return pnum;
 }
 
+/* Validate a prediction restored from the block map when it is first used */
+static int validate_restored_prediction(int pnum, const struct nrf_cloud_pgps_prediction *p)
+{
+	int err;
+	uint16_t gps_day;
+	uint32_t gps_time_of_day;
+
+	if (index.validated[pnum]) {
+		return 0;
+	}
+
+	get_prediction_day_time(pnum, NULL, &gps_day, &gps_time_of_day);
+	err = validate_prediction((const struct pgps_prediction_head *)p, p->sentinel,
+				  gps_day, gps_time_of_day,
+				  index.header.prediction_period_min, true, false);
+	if (err) {
+		LOG_ERR("Prediction num:%u does not match block map:%d", pnum, err);
+		/* walk all stored predictions next time */
+		(void)npgps_delete_block_map();
+	}
+	index.validated[pnum] = !err;
+	return err;
+}
+
 static void get_prediction_day_time(int pnum, int64_t *gps_sec, uint16_t *gps_day,
 				    uint32_t *gps_time_of_day)
 {
@@ -449,6 +654,7 @@ static void discard_oldest_predictions(int num)
 	for (i = last; i < index.header.prediction_count; i++) {
 		pnum = i - last;
 		index.predictions[pnum] = index.predictions[i];
+		index.validated[pnum] = index.validated[i];
 	}
 
 	/* set prediction pointers for 'last' in the newly empty
@@ -457,6 +663,7 @@ static void discard_oldest_predictions(int num)
 	for (pnum = index.header.prediction_count - last; pnum <
 	      index.header.prediction_count; pnum++) {
 		index.predictions[pnum] = NULL;
+		index.validated[pnum] = false;
 	}
 	npgps_print_blocks();
 
@@ -675,9 +882,12 @@ int nrf_cloud_pgps_find_prediction(struct nrf_cloud_pgps_prediction **prediction
 	index.cur_pnum = pnum;
 	*prediction = get_prediction(pnum);
 	if (*prediction) {
-		err = validate_prediction(*prediction,
-					  cur_gps_day, cur_gps_time_of_day,
-					  period_min, false, margin);
+		err = validate_restored_prediction(pnum, *prediction);
+		if (!err) {
+			err = validate_prediction((const struct pgps_prediction_head *)*prediction,
+						  (*prediction)->sentinel, cur_gps_day,
+						  cur_gps_time_of_day, period_min, false, margin);
+		}
 		if (!err) {
 			start_expiration_timer(pnum, cur_gps_sec);
 			return pnum;
@@ -1525,6 +1735,10 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 			store_prediction(prediction_ptr, buf_len, (uint32_t)gps_sec,
 					 finished || (index.storage_extent == 1));
 			index.predictions[pnum] = npgps_block_to_pointer(index.store_block);
+			index.validated[pnum] = true;
+			if (finished) {
+				save_block_map();
+			}
 
 			if (!finished) {
 				if (pgps_need_assistance && (index.loading_count > 1)) {
@@ -1607,6 +1821,9 @@ int nrf_cloud_pgps_begin_update(void)
 	/* assume cache is no longer valid */
 	discard_prediction_buffer();
 
+	/* flash no longer matches the saved block map */
+	(void)npgps_delete_block_map();
+
 	state = PGPS_LOADING;
 	if (!index.partial_request) {
 		index.header.prediction_count = NUM_PREDICTIONS;
@@ -1614,10 +1831,12 @@ int nrf_cloud_pgps_begin_update(void)
 		index.period_sec =
 			index.header.prediction_period_min * SEC_PER_MIN;
 		memset(index.predictions, 0, sizeof(index.predictions));
+		memset(index.validated, 0, sizeof(index.validated));
 	} else {
 		for (uint8_t pnum = index.pnum_offset;
 		     pnum < index.expected_count + index.pnum_offset; pnum++) {
 			index.predictions[pnum] = NULL;
+			index.validated[pnum] = false;
 		}
 	}
 	index.loading_count = 0;
@@ -1781,6 +2000,13 @@ int nrf_cloud_pgps_init(struct nrf_cloud_pgps_init_param *param)
 	if (num_valid) {
 		LOG_INF("Checking if P-GPS data is expired...");
 		err = nrf_cloud_pgps_find_prediction(&found_prediction);
+		if ((err == -EINVAL) && index.restored) {
+			LOG_WRN("Stored predictions do not match block map; checking all");
+			num_valid = validate_stored_predictions(&gps_day, &gps_time_of_day);
+			if (num_valid) {
+				err = nrf_cloud_pgps_find_prediction(&found_prediction);
+			}
+		}
 		if (err == -ETIMEDOUT) {
 			LOG_WRN("Predictions expired. Requesting predictions...");
 			num_valid = 0;
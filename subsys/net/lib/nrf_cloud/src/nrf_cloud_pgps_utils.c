@@ -28,6 +28,8 @@ LOG_MODULE_DECLARE(nrf_cloud_pgps, CONFIG_NRF_CLOUD_GPS_LOG_LEVEL);
 #define SETTINGS_FULL_LOCATION			SETTINGS_NAME "/" SETTINGS_KEY_LOCATION
 #define SETTINGS_KEY_LEAP_SEC			"g2u_leap_sec"
 #define SETTINGS_FULL_LEAP_SEC			SETTINGS_NAME "/" SETTINGS_KEY_LEAP_SEC
+#define SETTINGS_KEY_BLOCK_MAP			"block_map"
+#define SETTINGS_FULL_BLOCK_MAP			SETTINGS_NAME "/" SETTINGS_KEY_BLOCK_MAP
 
 struct block_pool {
 	int first_free;
@@ -43,6 +45,7 @@ static int num_blocks;
 static int gps_leap_seconds = GPS_TO_UTC_LEAP_SECONDS;
 static struct gps_location saved_location;
 static struct nrf_cloud_pgps_header saved_header;
+static struct npgps_block_map saved_block_map;
 
 static K_SEM_DEFINE(dl_active, 1, 1);
 
@@ -96,6 +99,16 @@ static int settings_set(const char *key, size_t len_rd,
 			return 0;
 		}
 	}
+	if (!strncmp(key, SETTINGS_KEY_BLOCK_MAP,
+		     strlen(SETTINGS_KEY_BLOCK_MAP)) &&
+	    (len_rd == sizeof(saved_block_map))) {
+		if (read_cb(cb_arg, (void *)&saved_block_map, len_rd) == len_rd) {
+			LOG_DBG("Read block map: count:%u, day:%u, time:%u",
+				saved_block_map.prediction_count, saved_block_map.gps_day,
+				saved_block_map.gps_time_of_day);
+			return 0;
+		}
+	}
 	return -ENOTSUP;
 }
 
@@ -131,6 +144,35 @@ const struct nrf_cloud_pgps_header *npgps_get_saved_header(void)
 	return &saved_header;
 }
 
+int npgps_save_block_map(const struct npgps_block_map *map)
+{
+	int ret = 0;
+
+	LOG_DBG("Saving block map");
+	memcpy(&saved_block_map, map, sizeof(saved_block_map));
+	ret = settings_save_one(SETTINGS_FULL_BLOCK_MAP, map, sizeof(*map));
+	return ret;
+}
+
+int npgps_delete_block_map(void)
+{
+	int ret = 0;
+
+	if (saved_block_map.prediction_count == 0) {
+		return 0;
+	}
+
+	LOG_DBG("Deleting block map");
+	memset(&saved_block_map, 0, sizeof(saved_block_map));
+	ret = settings_delete(SETTINGS_FULL_BLOCK_MAP);
+	return ret;
+}
+
+const struct npgps_block_map *npgps_get_saved_block_map(void)
+{
+	return &saved_block_map;
+}
+
 /* @TODO: consider rate-limiting these updates to reduce Flash wear */
 static int save_location(void)
 {
@@ -661,7 +661,7 @@ clean_up:
 		nrf_cloud_free(auth_hdr);
 	}
 	if (payload) {
-		cJSON_free(payload);
+		nrf_cloud_free(payload);
 	}
 
 	if (result) {
@@ -1291,31 +1291,18 @@ int nrf_cloud_rest_send_location(struct nrf_cloud_rest_context *const rest_ctx,
 	__ASSERT_NO_MSG(device_id != NULL);
 	__ASSERT_NO_MSG(gnss != NULL);
 
-	int err = -ENOMEM;
-	char *json_msg = NULL;
-	cJSON *msg_obj = NULL;
-
-	(void)nrf_cloud_codec_init(NULL);
+	int err;
+	struct nrf_cloud_data json_msg;
 
-	msg_obj = cJSON_CreateObject();
-	err = nrf_cloud_gnss_msg_json_encode(gnss, msg_obj);
+	err = nrf_cloud_gnss_msg_encode(gnss, &json_msg);
 	if (err) {
-		goto clean_up;
+		LOG_ERR("Failed to encode GNSS message, error: %d", err);
+		return err;
 	}
 
-	json_msg = cJSON_PrintUnformatted(msg_obj);
-	if (!json_msg) {
-		LOG_ERR("Failed to print JSON");
-		goto clean_up;
-	}
-
-	err = nrf_cloud_rest_send_device_message(rest_ctx, device_id, json_msg, false, NULL);
+	err = nrf_cloud_rest_send_device_message(rest_ctx, device_id, json_msg.ptr, false, NULL);
 
-clean_up:
-	cJSON_Delete(msg_obj);
-	if (json_msg) {
-		cJSON_free((void *)json_msg);
-	}
+	nrf_cloud_free((void *)json_msg.ptr);
 
 	return err;
 }
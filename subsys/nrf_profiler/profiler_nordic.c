@@ -28,7 +28,45 @@ struct nrf_profiler_event_enabled_bm _nrf_profiler_event_enabled_bm;
 static K_SEM_DEFINE(nrf_profiler_sem, 0, 1);
 static atomic_t nrf_profiler_state;
 static uint16_t fatal_error_event_id;
-static struct k_spinlock lock;
+
+#ifdef CONFIG_NRF_PROFILER_NORDIC_BATCHING
+/* Batch frame header: event type ID, frame length, base timestamp and drop count.
+ * The frame length is the number of bytes that follow the length field.
+ */
+#define BATCH_HEADER_SIZE	(sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint32_t) + \
+				 sizeof(uint16_t))
+/* Maximum size of a zigzag encoded 32-bit timestamp delta. */
+#define BATCH_VARINT_MAX_SIZE	5
+/* Event type ID, timestamp delta and payload. */
+#define BATCH_RECORD_MAX_SIZE	(sizeof(uint8_t) + BATCH_VARINT_MAX_SIZE + \
+				 CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN)
+#define BATCH_FLUSH_RETRY_MAX	10
+
+BUILD_ASSERT(CONFIG_NRF_PROFILER_NORDIC_BATCH_BUFFER_SIZE >= BATCH_RECORD_MAX_SIZE,
+	     "Staging buffer cannot hold the biggest event");
+
+struct batch_buf {
+	uint8_t data[CONFIG_NRF_PROFILER_NORDIC_BATCH_BUFFER_SIZE];
+	uint16_t len;
+	uint16_t event_cnt;
+	uint32_t base_timestamp;
+};
+
+/* Events are added to the active buffer, while the other one is sent by the nRF Profiler
+ * thread. The lock is only contended when the buffers are swapped.
+ */
+struct batch_staging {
+	struct k_spinlock lock;
+	struct batch_buf buf[2];
+	uint8_t active;
+	uint32_t prev_timestamp;
+	uint32_t dropped;
+};
+
+static struct batch_staging batch_staging[CONFIG_MP_NUM_CPUS];
+static K_SEM_DEFINE(batch_flush_sem, 0, 1);
+static uint16_t batch_event_id;
+#endif /* CONFIG_NRF_PROFILER_NORDIC_BATCHING */
 
 enum nordic_command {
 	NORDIC_COMMAND_START	= 1,
@@ -114,6 +152,132 @@ static void send_system_description(void)
 	}
 }
 
+#ifdef CONFIG_NRF_PROFILER_NORDIC_BATCHING
+static bool batch_send(const uint8_t *header, const struct batch_buf *bb)
+{
+	size_t frame_len = BATCH_HEADER_SIZE + bb->len;
+
+	/* Header and events must be written together, or not at all. */
+	for (size_t i = 0; i < BATCH_FLUSH_RETRY_MAX; i++) {
+		if (SEGGER_RTT_GetAvailWriteSpace(CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA) >=
+		    frame_len) {
+			SEGGER_RTT_WriteNoLock(CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
+					       header, BATCH_HEADER_SIZE);
+			SEGGER_RTT_WriteNoLock(CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
+					       bb->data, bb->len);
+			return true;
+		}
+
+		/* Give host time to read the data. */
+		k_sleep(K_MSEC(1));
+	}
+
+	return false;
+}
+
+static void batch_flush_cpu(struct batch_staging *bs)
+{
+	uint8_t header[BATCH_HEADER_SIZE];
+	struct batch_buf *bb;
+	uint32_t dropped;
+	k_spinlock_key_t key = k_spin_lock(&bs->lock);
+
+	bb = &bs->buf[bs->active];
+	if ((bb->event_cnt == 0) && (bs->dropped == 0)) {
+		k_spin_unlock(&bs->lock, key);
+		return;
+	}
+
+	if (bb->event_cnt == 0) {
+		bb->base_timestamp = k_cycle_get_32();
+	}
+
+	dropped = MIN(bs->dropped, UINT16_MAX);
+	bs->dropped -= dropped;
+	bs->active ^= 1;
+	k_spin_unlock(&bs->lock, key);
+
+	header[0] = (uint8_t)batch_event_id;
+	sys_put_le16(BATCH_HEADER_SIZE - sizeof(uint8_t) - sizeof(uint16_t) + bb->len,
+		     &header[1]);
+	sys_put_le32(bb->base_timestamp, &header[3]);
+	sys_put_le16(dropped, &header[7]);
+
+	if (!batch_send(header, bb)) {
+		/* Host does not read the data fast enough. */
+		key = k_spin_lock(&bs->lock);
+		bs->dropped += dropped + bb->event_cnt;
+		k_spin_unlock(&bs->lock, key);
+	}
+
+	/* The buffer becomes active again only after the next swap done by this thread. */
+	bb->len = 0;
+	bb->event_cnt = 0;
+}
+
+static void batch_flush(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(batch_staging); i++) {
+		batch_flush_cpu(&batch_staging[i]);
+	}
+}
+
+static size_t varint_put(uint32_t value, uint8_t *buf)
+{
+	size_t len = 0;
+
+	while (value >= 0x80) {
+		buf[len++] = (value & 0x7F) | 0x80;
+		value >>= 7;
+	}
+	buf[len++] = value;
+
+	return len;
+}
+
+static void batch_put(struct log_event_buf *buf, uint8_t type_id)
+{
+	/* nrf_profiler_log_start places the timestamp right after the event type ID. */
+	const uint8_t *payload = buf->payload_start + sizeof(uint8_t) + sizeof(uint32_t);
+	size_t payload_len = buf->payload - payload;
+	uint32_t timestamp = sys_get_le32(buf->payload_start + sizeof(uint8_t));
+	bool flush_needed = false;
+	unsigned int irq_key = arch_irq_lock();
+	struct batch_staging *bs = &batch_staging[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&bs->lock);
+	struct batch_buf *bb = &bs->buf[bs->active];
+
+	if (bb->len + sizeof(uint8_t) + BATCH_VARINT_MAX_SIZE + payload_len > sizeof(bb->data)) {
+		bs->dropped++;
+		flush_needed = true;
+	} else {
+		/* Timestamps of events logged from preempting contexts can go backwards. */
+		int32_t delta = (bb->event_cnt == 0) ? 0 : (int32_t)(timestamp - bs->prev_timestamp);
+
+		if (bb->event_cnt == 0) {
+			bb->base_timestamp = timestamp;
+		}
+
+		bb->data[bb->len++] = type_id;
+		bb->len += varint_put(((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31),
+				      &bb->data[bb->len]);
+		memcpy(&bb->data[bb->len], payload, payload_len);
+		bb->len += payload_len;
+		bb->event_cnt++;
+		bs->prev_timestamp = timestamp;
+
+		flush_needed = (bb->len >= sizeof(bb->data) / 2);
+	}
+
+	k_spin_unlock(&bs->lock, key);
+	arch_irq_unlock(irq_key);
+
+	if (flush_needed) {
+		k_sem_give(&batch_flush_sem);
+	}
+}
+#endif /* CONFIG_NRF_PROFILER_NORDIC_BATCHING */
+
 static void nrf_profiler_nordic_thread_fn(void)
 {
 	while (atomic_get(&nrf_profiler_state) != STATE_TERMINATED) {
@@ -139,7 +303,14 @@ static void nrf_profiler_nordic_thread_fn(void)
 				break;
 			}
 		}
+
+#ifdef CONFIG_NRF_PROFILER_NORDIC_BATCHING
+		(void)k_sem_take(&batch_flush_sem,
+				 K_MSEC(CONFIG_NRF_PROFILER_NORDIC_BATCH_FLUSH_INTERVAL_MS));
+		batch_flush();
+#else
 		k_sleep(K_MSEC(500));
+#endif
 	}
 	k_sem_give(&nrf_profiler_sem);
 }
@@ -201,6 +372,11 @@ int nrf_profiler_init(void)
 	fatal_error_event_id = nrf_profiler_register_event_type("_nrf_profiler_fatal_error_event_",
 							    NULL, NULL, 0);
 
+#ifdef CONFIG_NRF_PROFILER_NORDIC_BATCHING
+	/* Registering batch event. Its description tells the host that events are batched. */
+	batch_event_id = nrf_profiler_register_event_type("_nrf_profiler_batch_", NULL, NULL, 0);
+#endif
+
 	k_sched_unlock();
 	return 0;
 }
@@ -213,6 +389,9 @@ void nrf_profiler_term(void)
 	}
 
 	k_wakeup(protocol_thread_id);
+#ifdef CONFIG_NRF_PROFILER_NORDIC_BATCHING
+	k_sem_give(&batch_flush_sem);
+#endif
 	k_sem_take(&nrf_profiler_sem, K_FOREVER);
 }
 
@@ -340,6 +519,9 @@ void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
 	nrf_profiler_log_encode_uint32(buf, (uint32_t)mem_address);
 }
 
+#ifndef CONFIG_NRF_PROFILER_NORDIC_BATCHING
+static struct k_spinlock lock;
+
 static bool nrf_profiler_RTT_send(struct log_event_buf *buf, uint8_t type_id)
 {
 	buf->payload_start[0] = type_id;
@@ -364,6 +546,7 @@ static void nrf_profiler_fatal_error(void)
 	}
 	k_oops();
 }
+#endif /* CONFIG_NRF_PROFILER_NORDIC_BATCHING */
 
 void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 {
@@ -372,11 +555,15 @@ void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 	if (atomic_get(&nrf_profiler_state) == STATE_ACTIVE) {
 		uint8_t type_id = event_type_id & UINT8_MAX;
 
+#ifdef CONFIG_NRF_PROFILER_NORDIC_BATCHING
+		batch_put(buf, type_id);
+#else
 		k_spinlock_key_t key = k_spin_lock(&lock);
 
 		if (!nrf_profiler_RTT_send(buf, type_id)) {
 			nrf_profiler_fatal_error();
 		}
 		k_spin_unlock(&lock, key);
+#endif
 	}
 }
@@ -36,12 +36,48 @@ struct nrf_rpc_os_msg {
 	size_t len;
 };
 
+struct nrf_rpc_group;
+struct nrf_rpc_tr;
+
 typedef void (*nrf_rpc_os_work_t)(const uint8_t *data, size_t len);
 
 int nrf_rpc_os_init(nrf_rpc_os_work_t callback);
 
 void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len);
 
+/** @brief Set the priority of the commands and events of a group.
+ *
+ * Packets of the group are taken from the thread pool inbox before packets
+ * of groups with lower priority, and the thread pool thread handling them
+ * runs with the given thread priority. Groups use
+ * CONFIG_NRF_RPC_THREAD_PRIORITY by default.
+ *
+ * The group is recognized by its transport, so groups sharing a transport
+ * share the priority.
+ *
+ * @param group Group defined with NRF_RPC_GROUP_DEFINE.
+ * @param prio  Thread priority.
+ *
+ * @retval 0            On success.
+ * @retval -NRF_EINVAL  Invalid group.
+ * @retval -NRF_ENOMEM  More than CONFIG_NRF_RPC_THREAD_POOL_GROUPS groups have a priority set.
+ */
+int nrf_rpc_os_group_priority_set(const struct nrf_rpc_group *group, int prio);
+
+/** @brief Mark the start of the delivery of a received packet.
+ *
+ * Called by the transport in the receiving thread before passing a packet
+ * to nRF RPC, so that the packets passed to the thread pool get the
+ * priority of the group of @p transport.
+ *
+ * @param transport Transport that received the packet.
+ */
+void nrf_rpc_os_rx_begin(const struct nrf_rpc_tr *transport);
+
+/** @brief Mark the end of the delivery of a received packet.
+ */
+void nrf_rpc_os_rx_end(void);
+
 static inline int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event)
 {
 	return k_sem_init(&event->sem, 0, 1);
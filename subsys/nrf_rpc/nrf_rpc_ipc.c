@@ -8,6 +8,7 @@
 #include <nrf_rpc_tr.h>
 #include <nrf_rpc_errno.h>
 #include <nrf_rpc/nrf_rpc_ipc.h>
+#include <nrf_rpc_os.h>
 
 #include <openamp/rpmsg.h>
 #include <zephyr/ipc/ipc_service.h>
@@ -84,7 +85,9 @@ static void ept_received(const void *data, size_t len, void *priv)
 
 	DUMP_LIMITED_DBG(data, len, "Received");
 
+	nrf_rpc_os_rx_begin(transport);
 	ipc_config->receive_cb(transport, data, len, ipc_config->context);
+	nrf_rpc_os_rx_end();
 }
 
 static void ept_error(const char *message, void *priv)
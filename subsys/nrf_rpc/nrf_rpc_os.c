@@ -7,6 +7,11 @@
 #define NRF_RPC_LOG_MODULE NRF_RPC_OS
 #include <nrf_rpc_log.h>
 
+#include <string.h>
+#include <zephyr/shell/shell.h>
+
+#include <nrf_rpc.h>
+
 #include "nrf_rpc_os.h"
 
 /* Maximum number of remote thread that this implementation allows. */
@@ -19,15 +24,68 @@
 	(~(((atomic_val_t)1 << (8 * sizeof(atomic_val_t) -		       \
 				CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE)) - 1))
 
+/* Maximum number of threads receiving packets at the same time, that is,
+ * one for each transport instance delivering packets from its own thread.
+ */
+#define RX_THREADS_MAX 4
+
 struct pool_start_msg {
 	const uint8_t *data;
 	size_t len;
+	int prio;
+	uint32_t timestamp;
+};
+
+struct group_prio {
+	const struct nrf_rpc_tr *transport;
+	int prio;
+};
+
+struct rx_thread {
+	k_tid_t thread;
+	const struct nrf_rpc_tr *transport;
 };
 
+#if defined(CONFIG_NRF_RPC_OS_STATS)
+/* Fields of the nRF RPC packet header used only to label the statistics:
+ * [2] command or event ID, [4] group ID.
+ */
+#define PACKET_HEADER_SIZE 5
+#define PACKET_ID_OFFSET 2
+#define PACKET_GROUP_ID_OFFSET 4
+
+struct cmd_stats {
+	bool used;
+	uint8_t group_id;
+	uint8_t id;
+	uint32_t cnt;
+	uint64_t queue_time_sum;
+	uint32_t queue_time_max;
+	uint64_t handler_time_sum;
+	uint32_t handler_time_max;
+};
+
+static struct cmd_stats cmd_stats[CONFIG_NRF_RPC_OS_STATS_CMD_MAX];
+static uint32_t inbox_len_max;
+static uint32_t inbox_full_cnt;
+static struct k_spinlock stats_lock;
+#endif /* defined(CONFIG_NRF_RPC_OS_STATS) */
+
 static nrf_rpc_os_work_t thread_pool_callback;
 
-static struct pool_start_msg pool_start_msg_buf[2];
-static struct k_msgq pool_start_msg;
+/* Inbox of the thread pool, ordered by priority and then by arrival. */
+static struct pool_start_msg inbox[CONFIG_NRF_RPC_THREAD_POOL_INBOX_SIZE];
+static size_t inbox_len;
+static struct k_spinlock inbox_lock;
+static struct k_sem inbox_free;
+static struct k_sem inbox_used;
+
+static struct group_prio group_prio[CONFIG_NRF_RPC_THREAD_POOL_GROUPS];
+static size_t group_prio_cnt;
+static struct k_spinlock group_prio_lock;
+
+static struct rx_thread rx_threads[RX_THREADS_MAX];
+static struct k_spinlock rx_threads_lock;
 
 static struct k_sem context_reserved;
 static atomic_t context_mask;
@@ -45,13 +103,186 @@ BUILD_ASSERT(CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE <= 8 * sizeof(atomic_val_t),
 BUILD_ASSERT(sizeof(uint32_t) == sizeof(atomic_val_t),
 	     "Only atomic_val_t is implemented that is the same as uint32_t");
 
+static const struct nrf_rpc_tr *rx_transport_get(void)
+{
+	const struct nrf_rpc_tr *transport = NULL;
+	k_tid_t thread = k_current_get();
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&rx_threads_lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(rx_threads); i++) {
+		if (rx_threads[i].thread == thread) {
+			transport = rx_threads[i].transport;
+			break;
+		}
+	}
+
+	k_spin_unlock(&rx_threads_lock, key);
+
+	return transport;
+}
+
+static int packet_prio_get(void)
+{
+	const struct nrf_rpc_tr *transport = rx_transport_get();
+	int prio = CONFIG_NRF_RPC_THREAD_PRIORITY;
+	k_spinlock_key_t key;
+
+	if (!transport) {
+		return prio;
+	}
+
+	key = k_spin_lock(&group_prio_lock);
+
+	for (size_t i = 0; i < group_prio_cnt; i++) {
+		if (group_prio[i].transport == transport) {
+			prio = group_prio[i].prio;
+			break;
+		}
+	}
+
+	k_spin_unlock(&group_prio_lock, key);
+
+	return prio;
+}
+
+#if defined(CONFIG_NRF_RPC_OS_STATS)
+static void packet_ids_get(const uint8_t *data, size_t len, uint8_t *group_id, uint8_t *id)
+{
+	if (len < PACKET_HEADER_SIZE) {
+		*group_id = 0xFF;
+		*id = 0xFF;
+		return;
+	}
+
+	*group_id = data[PACKET_GROUP_ID_OFFSET];
+	*id = data[PACKET_ID_OFFSET];
+}
+
+static struct cmd_stats *cmd_stats_get(uint8_t group_id, uint8_t id)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cmd_stats); i++) {
+		if (!cmd_stats[i].used) {
+			cmd_stats[i].used = true;
+			cmd_stats[i].group_id = group_id;
+			cmd_stats[i].id = id;
+			return &cmd_stats[i];
+		}
+
+		if ((cmd_stats[i].group_id == group_id) && (cmd_stats[i].id == id)) {
+			return &cmd_stats[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void cmd_stats_record(uint8_t group_id, uint8_t id, uint32_t timestamp, uint32_t start)
+{
+	uint32_t now = k_cycle_get_32();
+	uint32_t queue_time = k_cyc_to_us_floor32(start - timestamp);
+	uint32_t handler_time = k_cyc_to_us_floor32(now - start);
+	struct cmd_stats *stats;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&stats_lock);
+
+	stats = cmd_stats_get(group_id, id);
+	if (stats) {
+		stats->cnt++;
+		stats->queue_time_sum += queue_time;
+		stats->queue_time_max = MAX(stats->queue_time_max, queue_time);
+		stats->handler_time_sum += handler_time;
+		stats->handler_time_max = MAX(stats->handler_time_max, handler_time);
+	}
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+static void inbox_stats_record(size_t len, bool full)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	inbox_len_max = MAX(inbox_len_max, len);
+	if (full) {
+		inbox_full_cnt++;
+	}
+
+	k_spin_unlock(&stats_lock, key);
+}
+#else
+static void packet_ids_get(const uint8_t *data, size_t len, uint8_t *group_id, uint8_t *id)
+{
+	*group_id = 0;
+	*id = 0;
+}
+
+static void cmd_stats_record(uint8_t group_id, uint8_t id, uint32_t timestamp, uint32_t start) {}
+
+static void inbox_stats_record(size_t len, bool full) {}
+#endif /* defined(CONFIG_NRF_RPC_OS_STATS) */
+
+static void inbox_put(const struct pool_start_msg *msg)
+{
+	k_spinlock_key_t key = k_spin_lock(&inbox_lock);
+	size_t pos = inbox_len;
+	size_t len;
+
+	/* Higher priority (lower value) messages are placed before lower priority ones,
+	 * messages of equal priority are kept in the order of arrival.
+	 */
+	while ((pos > 0) && (inbox[pos - 1].prio > msg->prio)) {
+		inbox[pos] = inbox[pos - 1];
+		pos--;
+	}
+
+	inbox[pos] = *msg;
+	len = ++inbox_len;
+
+	k_spin_unlock(&inbox_lock, key);
+
+	inbox_stats_record(len, false);
+}
+
+static void inbox_get(struct pool_start_msg *msg)
+{
+	k_spinlock_key_t key = k_spin_lock(&inbox_lock);
+
+	__ASSERT_NO_MSG(inbox_len > 0);
+
+	*msg = inbox[0];
+	inbox_len--;
+	memmove(&inbox[0], &inbox[1], inbox_len * sizeof(inbox[0]));
+
+	k_spin_unlock(&inbox_lock, key);
+}
+
 static void thread_pool_entry(void *p1, void *p2, void *p3)
 {
 	struct pool_start_msg msg;
+	int prio = CONFIG_NRF_RPC_THREAD_PRIORITY;
+	uint32_t start;
+	uint8_t group_id;
+	uint8_t id;
 
 	do {
-		k_msgq_get(&pool_start_msg, &msg, K_FOREVER);
+		k_sem_take(&inbox_used, K_FOREVER);
+		inbox_get(&msg);
+		k_sem_give(&inbox_free);
+
+		/* Run the handler with the priority of its group. */
+		if (msg.prio != prio) {
+			prio = msg.prio;
+			k_thread_priority_set(k_current_get(), prio);
+		}
+
+		/* The handler releases the packet, read its IDs before. */
+		packet_ids_get(msg.data, msg.len, &group_id, &id);
+
+		start = k_cycle_get_32();
 		thread_pool_callback(msg.data, msg.len);
+		cmd_stats_record(group_id, id, msg.timestamp, start);
 	} while (1);
 }
 
@@ -72,9 +303,8 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
 
 	atomic_set(&context_mask, CONTEXT_MASK_INIT_VALUE);
 
-	k_msgq_init(&pool_start_msg, (char *)pool_start_msg_buf,
-		    sizeof(struct pool_start_msg),
-		    ARRAY_SIZE(pool_start_msg_buf));
+	k_sem_init(&inbox_free, ARRAY_SIZE(inbox), ARRAY_SIZE(inbox));
+	k_sem_init(&inbox_used, 0, ARRAY_SIZE(inbox));
 
 	for (i = 0; i < CONFIG_NRF_RPC_THREAD_POOL_SIZE; i++) {
 		k_thread_create(&pool_threads[i], pool_stacks[i],
@@ -93,7 +323,91 @@ void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
 
 	msg.data = data;
 	msg.len = len;
-	k_msgq_put(&pool_start_msg, &msg, K_FOREVER);
+	msg.prio = packet_prio_get();
+	msg.timestamp = k_cycle_get_32();
+
+	/* Only wait for a free slot if the inbox is full, the receive
+	 * callback does not have to wait for an idle thread.
+	 */
+	if (k_sem_take(&inbox_free, K_NO_WAIT) != 0) {
+		inbox_stats_record(0, true);
+		k_sem_take(&inbox_free, K_FOREVER);
+	}
+
+	inbox_put(&msg);
+	k_sem_give(&inbox_used);
+}
+
+int nrf_rpc_os_group_priority_set(const struct nrf_rpc_group *group, int prio)
+{
+	k_spinlock_key_t key;
+	size_t i;
+	int err = 0;
+
+	if (!group || !group->transport) {
+		return -NRF_EINVAL;
+	}
+
+	key = k_spin_lock(&group_prio_lock);
+
+	for (i = 0; i < group_prio_cnt; i++) {
+		if (group_prio[i].transport == group->transport) {
+			break;
+		}
+	}
+
+	if (i < ARRAY_SIZE(group_prio)) {
+		group_prio[i].transport = group->transport;
+		group_prio[i].prio = prio;
+		group_prio_cnt = MAX(group_prio_cnt, i + 1);
+	} else {
+		err = -NRF_ENOMEM;
+	}
+
+	k_spin_unlock(&group_prio_lock, key);
+
+	return err;
+}
+
+void nrf_rpc_os_rx_begin(const struct nrf_rpc_tr *transport)
+{
+	k_tid_t thread = k_current_get();
+	k_spinlock_key_t key;
+	size_t i;
+
+	key = k_spin_lock(&rx_threads_lock);
+
+	for (i = 0; i < ARRAY_SIZE(rx_threads); i++) {
+		if (!rx_threads[i].thread || (rx_threads[i].thread == thread)) {
+			rx_threads[i].thread = thread;
+			rx_threads[i].transport = transport;
+			break;
+		}
+	}
+
+	k_spin_unlock(&rx_threads_lock, key);
+
+	/* Packets received in this thread are handled with the default priority. */
+	if (i == ARRAY_SIZE(rx_threads)) {
+		NRF_RPC_WRN("Too many receiving threads, group priority not applied");
+	}
+}
+
+void nrf_rpc_os_rx_end(void)
+{
+	k_tid_t thread = k_current_get();
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&rx_threads_lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(rx_threads); i++) {
+		if (rx_threads[i].thread == thread) {
+			rx_threads[i].transport = NULL;
+			break;
+		}
+	}
+
+	k_spin_unlock(&rx_threads_lock, key);
 }
 
 void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
@@ -140,3 +454,42 @@ void nrf_rpc_os_ctx_pool_release(uint32_t number)
 	atomic_or(&context_mask, 0x80000000u >> number);
 	k_sem_give(&context_reserved);
 }
+
+#if defined(CONFIG_NRF_RPC_OS_STATS) && defined(CONFIG_SHELL)
+static int cmd_stats_print(const struct shell *shell, size_t argc, char **argv)
+{
+	struct cmd_stats stats;
+	uint32_t len_max;
+	uint32_t full_cnt;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&stats_lock);
+	len_max = inbox_len_max;
+	full_cnt = inbox_full_cnt;
+	k_spin_unlock(&stats_lock, key);
+
+	shell_print(shell, "Inbox: max %u of %u, full %u times", len_max,
+		    CONFIG_NRF_RPC_THREAD_POOL_INBOX_SIZE, full_cnt);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cmd_stats); i++) {
+		key = k_spin_lock(&stats_lock);
+		stats = cmd_stats[i];
+		k_spin_unlock(&stats_lock, key);
+
+		if (!stats.used) {
+			break;
+		}
+
+		shell_print(shell,
+			    "Group %u, ID %u: %u calls, queue avg %u us max %u us, "
+			    "handler avg %u us max %u us",
+			    stats.group_id, stats.id, stats.cnt,
+			    (uint32_t)(stats.queue_time_sum / stats.cnt), stats.queue_time_max,
+			    (uint32_t)(stats.handler_time_sum / stats.cnt), stats.handler_time_max);
+	}
+
+	return 0;
+}
+
+SHELL_CMD_REGISTER(nrf_rpc_stats, NULL, "Print nRF RPC thread pool statistics", cmd_stats_print);
+#endif /* defined(CONFIG_NRF_RPC_OS_STATS) && defined(CONFIG_SHELL) */
@@ -0,0 +1,476 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "list.h"
+#include "queue.h"
+#include "osal_api.h"
+#include "hal_api.h"
+#include "fmac_tx.h"
+#include "fmac_peer.h"
+#include "fmac_util.h"
+
+#define TOKENS_PER_AC	2
+#define TOKENS_SPARE	2
+#define TOKENS		((TOKENS_PER_AC * WIFI_NRF_FMAC_AC_MAX) + TOKENS_SPARE)
+#define FIRST_SPARE	(TOKENS_PER_AC * WIFI_NRF_FMAC_AC_MAX)
+
+#define PEER_ID		0
+
+/* Lists and queues of the driver, faked by arrays. */
+#define FAKE_LIST_LEN	8
+#define FAKE_LIST_COUNT	((MAX_SW_PEERS * WIFI_NRF_FMAC_AC_MAX) + TOKENS + 1)
+
+struct fake_list {
+	void *data[FAKE_LIST_LEN];
+	unsigned int len;
+	bool used;
+};
+
+static struct fake_list fake_lists[FAKE_LIST_COUNT];
+static unsigned long fake_time_us;
+static int lock;
+
+static struct wifi_nrf_fmac_priv fpriv;
+static struct wifi_nrf_fmac_dev_ctx dev_ctx;
+static struct wifi_nrf_fmac_vif_ctx vif_ctx;
+static unsigned char frame;
+
+void *wifi_nrf_utils_list_alloc(struct wifi_nrf_osal_priv *opriv)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(fake_lists); i++) {
+		if (!fake_lists[i].used) {
+			memset(&fake_lists[i], 0, sizeof(fake_lists[i]));
+			fake_lists[i].used = true;
+			return &fake_lists[i];
+		}
+	}
+
+	return NULL;
+}
+
+void wifi_nrf_utils_list_free(struct wifi_nrf_osal_priv *opriv, void *list)
+{
+	((struct fake_list *)list)->used = false;
+}
+
+enum wifi_nrf_status wifi_nrf_utils_list_add_tail(struct wifi_nrf_osal_priv *opriv,
+						  void *list, void *data)
+{
+	struct fake_list *l = list;
+
+	zassert_true(l->len < FAKE_LIST_LEN, "Fake list full");
+	l->data[l->len++] = data;
+
+	return WIFI_NRF_STATUS_SUCCESS;
+}
+
+void wifi_nrf_utils_list_del_node(struct wifi_nrf_osal_priv *opriv, void *list, void *data)
+{
+	struct fake_list *l = list;
+
+	for (unsigned int i = 0; i < l->len; i++) {
+		if (l->data[i] == data) {
+			memmove(&l->data[i], &l->data[i + 1], (l->len - i - 1) * sizeof(void *));
+			l->len--;
+			return;
+		}
+	}
+}
+
+void *wifi_nrf_utils_list_peek(struct wifi_nrf_osal_priv *opriv, void *list)
+{
+	struct fake_list *l = list;
+
+	return l->len ? l->data[0] : NULL;
+}
+
+unsigned int wifi_nrf_utils_list_len(struct wifi_nrf_osal_priv *opriv, void *list)
+{
+	return ((struct fake_list *)list)->len;
+}
+
+enum wifi_nrf_status
+wifi_nrf_utils_list_traverse(struct wifi_nrf_osal_priv *opriv,
+			     void *list,
+			     void *callbk_data,
+			     enum wifi_nrf_status (*callbk_func)(void *callbk_data,
+								 void *data))
+{
+	struct fake_list *l = list;
+
+	for (unsigned int i = 0; i < l->len; i++) {
+		if (callbk_func(callbk_data, l->data[i]) != WIFI_NRF_STATUS_SUCCESS) {
+			return WIFI_NRF_STATUS_FAIL;
+		}
+	}
+
+	return WIFI_NRF_STATUS_SUCCESS;
+}
+
+void *wifi_nrf_utils_q_alloc(struct wifi_nrf_osal_priv *opriv)
+{
+	return wifi_nrf_utils_list_alloc(opriv);
+}
+
+void wifi_nrf_utils_q_free(struct wifi_nrf_osal_priv *opriv, void *q)
+{
+	wifi_nrf_utils_list_free(opriv, q);
+}
+
+enum wifi_nrf_status wifi_nrf_utils_q_enqueue(struct wifi_nrf_osal_priv *opriv,
+					      void *q, void *q_node)
+{
+	return wifi_nrf_utils_list_add_tail(opriv, q, q_node);
+}
+
+void *wifi_nrf_utils_q_dequeue(struct wifi_nrf_osal_priv *opriv, void *q)
+{
+	void *data = wifi_nrf_utils_list_peek(opriv, q);
+
+	if (data) {
+		wifi_nrf_utils_list_del_node(opriv, q, data);
+	}
+
+	return data;
+}
+
+void *wifi_nrf_utils_q_peek(struct wifi_nrf_osal_priv *opriv, void *q)
+{
+	return wifi_nrf_utils_list_peek(opriv, q);
+}
+
+unsigned int wifi_nrf_utils_q_len(struct wifi_nrf_osal_priv *opriv, void *q)
+{
+	return wifi_nrf_utils_list_len(opriv, q);
+}
+
+/* The wakeup client queue is only used in AP mode. */
+void *wifi_nrf_osal_llist_get_node_head(struct wifi_nrf_osal_priv *opriv, void *llist)
+{
+	return NULL;
+}
+
+void *wifi_nrf_osal_llist_get_node_nxt(struct wifi_nrf_osal_priv *opriv, void *llist,
+				       void *llist_node)
+{
+	return NULL;
+}
+
+void *wifi_nrf_osal_llist_node_data_get(struct wifi_nrf_osal_priv *opriv, void *node)
+{
+	return NULL;
+}
+
+int wifi_nrf_osal_log_err(struct wifi_nrf_osal_priv *opriv, const char *fmt, ...)
+{
+	return 0;
+}
+
+void *wifi_nrf_osal_mem_zalloc(struct wifi_nrf_osal_priv *opriv, size_t size)
+{
+	return k_calloc(1, size);
+}
+
+void wifi_nrf_osal_mem_free(struct wifi_nrf_osal_priv *opriv, void *buf)
+{
+	k_free(buf);
+}
+
+void *wifi_nrf_osal_mem_cpy(struct wifi_nrf_osal_priv *opriv, void *dest, const void *src,
+			    size_t count)
+{
+	return memcpy(dest, src, count);
+}
+
+void *wifi_nrf_osal_mem_set(struct wifi_nrf_osal_priv *opriv, void *start, int val, size_t size)
+{
+	return memset(start, val, size);
+}
+
+void *wifi_nrf_osal_spinlock_alloc(struct wifi_nrf_osal_priv *opriv)
+{
+	return &lock;
+}
+
+void wifi_nrf_osal_spinlock_free(struct wifi_nrf_osal_priv *opriv, void *lock)
+{
+}
+
+void wifi_nrf_osal_spinlock_init(struct wifi_nrf_osal_priv *opriv, void *lock)
+{
+}
+
+void wifi_nrf_osal_spinlock_take(struct wifi_nrf_osal_priv *opriv, void *lock)
+{
+}
+
+void wifi_nrf_osal_spinlock_rel(struct wifi_nrf_osal_priv *opriv, void *lock)
+{
+}
+
+unsigned long wifi_nrf_osal_time_get_curr_us(struct wifi_nrf_osal_priv *opriv)
+{
+	return fake_time_us;
+}
+
+unsigned int wifi_nrf_osal_time_elapsed_us(struct wifi_nrf_osal_priv *opriv,
+					   unsigned long start_time_us)
+{
+	return fake_time_us - start_time_us;
+}
+
+/* Frames are not sent to the RPU by the test. */
+void *wifi_nrf_osal_nbuf_data_get(struct wifi_nrf_osal_priv *opriv, void *nbuf)
+{
+	return nbuf;
+}
+
+unsigned int wifi_nrf_osal_nbuf_data_size(struct wifi_nrf_osal_priv *opriv, void *nbuf)
+{
+	return 0;
+}
+
+void wifi_nrf_osal_nbuf_free(struct wifi_nrf_osal_priv *opriv, void *nbuf)
+{
+}
+
+enum wifi_nrf_status hal_rpu_mem_write(struct wifi_nrf_hal_dev_ctx *hal_ctx,
+				       unsigned int rpu_mem_addr, void *host_addr,
+				       unsigned int len)
+{
+	return WIFI_NRF_STATUS_SUCCESS;
+}
+
+struct host_rpu_msg *umac_cmd_alloc(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx, int type,
+				    int size)
+{
+	return NULL;
+}
+
+unsigned long wifi_nrf_hal_buf_map_tx(struct wifi_nrf_hal_dev_ctx *hal_ctx, unsigned long buf,
+				      unsigned int buf_len, unsigned int desc_id)
+{
+	return 0;
+}
+
+unsigned long wifi_nrf_hal_buf_unmap_tx(struct wifi_nrf_hal_dev_ctx *hal_ctx,
+					unsigned int desc_id)
+{
+	return 0;
+}
+
+enum wifi_nrf_status wifi_nrf_hal_data_cmd_send(struct wifi_nrf_hal_dev_ctx *hal_ctx,
+						enum WIFI_NRF_HAL_MSG_TYPE cmd_type,
+						void *data_cmd, unsigned int data_cmd_size,
+						unsigned int desc_id, unsigned int pool_id)
+{
+	return WIFI_NRF_STATUS_FAIL;
+}
+
+int wifi_nrf_fmac_peer_get_id(struct wifi_nrf_fmac_dev_ctx *fmac_ctx,
+			      const unsigned char *mac_addr)
+{
+	return PEER_ID;
+}
+
+/* All the frames of the test have the same addresses, so they are aggregated. */
+bool wifi_nrf_util_ether_addr_equal(const unsigned char *addr_1, const unsigned char *addr_2)
+{
+	return true;
+}
+
+bool wifi_nrf_util_is_multicast_addr(const unsigned char *addr)
+{
+	return false;
+}
+
+unsigned char *wifi_nrf_util_get_dest(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx, void *nwb)
+{
+	return NULL;
+}
+
+unsigned char *wifi_nrf_util_get_src(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx, void *nwb)
+{
+	return NULL;
+}
+
+unsigned char *wifi_nrf_util_get_ra(struct wifi_nrf_fmac_vif_ctx *vif, void *nwb)
+{
+	return NULL;
+}
+
+int wifi_nrf_util_get_tid(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx, void *nwb)
+{
+	return 0;
+}
+
+unsigned short wifi_nrf_util_tx_get_eth_type(struct wifi_nrf_fmac_dev_ctx *fmac_dev_ctx,
+					     void *nwb)
+{
+	return 0;
+}
+
+static void setup(void)
+{
+	memset(&dev_ctx, 0, sizeof(dev_ctx));
+	memset(fake_lists, 0, sizeof(fake_lists));
+	/* Odd, the driver sets bit 0 of the time a wait starts at. */
+	fake_time_us = 1001;
+
+	fpriv.num_tx_tokens = TOKENS;
+	fpriv.num_tx_tokens_per_ac = TOKENS_PER_AC;
+	fpriv.num_tx_tokens_spare = TOKENS_SPARE;
+	fpriv.data_config.max_tx_aggregation = 1;
+
+	vif_ctx.if_type = NRF_WIFI_IFTYPE_STATION;
+
+	dev_ctx.fpriv = &fpriv;
+	dev_ctx.vif_ctx[0] = &vif_ctx;
+
+	zassert_equal(tx_init(&dev_ctx), WIFI_NRF_STATUS_SUCCESS, "TX init failed");
+}
+
+static void teardown(void)
+{
+	tx_deinit(&dev_ctx);
+}
+
+static void reserved_descs_take(int ac)
+{
+	for (unsigned int i = 0; i < TOKENS_PER_AC; i++) {
+		zassert_equal(tx_desc_get(&dev_ctx, ac), ac + (WIFI_NRF_FMAC_AC_MAX * i),
+			      "Wrong reserved desc for AC %d", ac);
+	}
+}
+
+/* TX done of a descriptor with no frames pending, the descriptor is freed. */
+static void tx_done(unsigned int desc)
+{
+	unsigned char ac = 0xff;
+
+	zassert_equal(tx_buff_req_free(&dev_ctx, desc, &ac), 0, "Frames sent");
+}
+
+static void frame_pend(int ac)
+{
+	void *pend_q = dev_ctx.tx_config.data_pending_txq[PEER_ID][ac];
+
+	wifi_nrf_utils_q_enqueue(fpriv.opriv, pend_q, &frame);
+}
+
+static void test_reserved_then_spare(void)
+{
+	unsigned int *outstanding = dev_ctx.tx_config.outstanding_descs;
+
+	reserved_descs_take(WIFI_NRF_FMAC_AC_BE);
+
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_BE), FIRST_SPARE, "No spare desc");
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_BE), FIRST_SPARE + 1,
+		      "No spare desc");
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_BE], TOKENS_PER_AC + TOKENS_SPARE, NULL);
+
+	/* No descriptor left for BE, other access categories keep their own. */
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_BE), TOKENS, "Desc over limit");
+	zassert_equal(dev_ctx.host_stats.tx_desc_waits[WIFI_NRF_FMAC_AC_BE], 1, NULL);
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_BK), WIFI_NRF_FMAC_AC_BK,
+		      "Reserved desc of other AC taken");
+
+	/* The lowest free descriptor is handed out first. */
+	fake_time_us += 100;
+	tx_done(WIFI_NRF_FMAC_AC_BE + WIFI_NRF_FMAC_AC_MAX);
+	tx_done(FIRST_SPARE);
+
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_BE),
+		      WIFI_NRF_FMAC_AC_BE + WIFI_NRF_FMAC_AC_MAX, "Reserved desc not first");
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_BE), FIRST_SPARE,
+		      "Spare desc not reused");
+	zassert_equal(dev_ctx.host_stats.tx_desc_wait_us[WIFI_NRF_FMAC_AC_BE], 100, NULL);
+}
+
+/* The spare descriptors of VI and VO are returned to the access category that
+ * took them.
+ */
+static void test_spare_vi_vo(void)
+{
+	unsigned int *outstanding = dev_ctx.tx_config.outstanding_descs;
+
+	reserved_descs_take(WIFI_NRF_FMAC_AC_VI);
+	reserved_descs_take(WIFI_NRF_FMAC_AC_VO);
+
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_VI), FIRST_SPARE, NULL);
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_VO), FIRST_SPARE + 1, NULL);
+	zassert_equal(dev_ctx.tx_config.spare_desc_ac[0], WIFI_NRF_FMAC_AC_VI, NULL);
+	zassert_equal(dev_ctx.tx_config.spare_desc_ac[1], WIFI_NRF_FMAC_AC_VO, NULL);
+
+	tx_done(FIRST_SPARE + 1);
+
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_VO], TOKENS_PER_AC, "VO spare not freed");
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_VI], TOKENS_PER_AC + 1,
+		      "VO spare freed as VI");
+
+	tx_done(FIRST_SPARE);
+
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_VI], TOKENS_PER_AC, "VI spare not freed");
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_VO], TOKENS_PER_AC,
+		      "VI spare freed as VO");
+
+	/* Both spare descriptors are free again. */
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_VO), FIRST_SPARE, NULL);
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_VO), FIRST_SPARE + 1, NULL);
+}
+
+/* A spare descriptor is handed over on TX done to the highest access category
+ * with pending frames, and later freed for that access category.
+ */
+static void test_spare_handover(void)
+{
+	unsigned int *outstanding = dev_ctx.tx_config.outstanding_descs;
+	unsigned char ac = 0xff;
+
+	reserved_descs_take(WIFI_NRF_FMAC_AC_VI);
+	zassert_equal(tx_desc_get(&dev_ctx, WIFI_NRF_FMAC_AC_VI), FIRST_SPARE, NULL);
+
+	reserved_descs_take(WIFI_NRF_FMAC_AC_VO);
+	frame_pend(WIFI_NRF_FMAC_AC_BE);
+	frame_pend(WIFI_NRF_FMAC_AC_VO);
+
+	zassert_equal(tx_buff_req_free(&dev_ctx, FIRST_SPARE, &ac), 1, "Pending frame not sent");
+	zassert_equal(ac, WIFI_NRF_FMAC_AC_VO, "Spare desc not handed to VO");
+	zassert_equal(dev_ctx.tx_config.spare_desc_ac[0], WIFI_NRF_FMAC_AC_VO, NULL);
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_VI], TOKENS_PER_AC, NULL);
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_VO], TOKENS_PER_AC + 1, NULL);
+
+	/* The frame was sent, it is released by the TX done processing. */
+	wifi_nrf_utils_q_dequeue(fpriv.opriv, dev_ctx.tx_config.pkt_info_p[FIRST_SPARE].pkt);
+
+	zassert_equal(tx_buff_req_free(&dev_ctx, FIRST_SPARE, &ac), 1, "Pending frame not sent");
+	zassert_equal(ac, WIFI_NRF_FMAC_AC_BE, "Spare desc not handed to BE");
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_VO], TOKENS_PER_AC, NULL);
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_BE], 1, NULL);
+
+	wifi_nrf_utils_q_dequeue(fpriv.opriv, dev_ctx.tx_config.pkt_info_p[FIRST_SPARE].pkt);
+
+	tx_done(FIRST_SPARE);
+
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_BE], 0, "Spare not freed for BE");
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_VI], TOKENS_PER_AC, NULL);
+	zassert_equal(outstanding[WIFI_NRF_FMAC_AC_VO], TOKENS_PER_AC, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(nrf700x_tx_desc_test,
+		ztest_unit_test_setup_teardown(test_reserved_then_spare, setup, teardown),
+		ztest_unit_test_setup_teardown(test_spare_vi_vo, setup, teardown),
+		ztest_unit_test_setup_teardown(test_spare_handover, setup, teardown)
+	);
+
+	ztest_run_test_suite(nrf700x_tx_desc_test);
+}
@@ -60,6 +60,18 @@ const char *certificate = "%CMNG: 12345678, 0, \"978C...02C4\","
 static struct at_param_list test_list;
 static struct at_param_list test_list2;
 
+/* k_malloc is wrapped by the linker to count the allocations made while parsing. */
+static uint32_t alloc_cnt;
+
+void *__real_k_malloc(size_t size);
+
+void *__wrap_k_malloc(size_t size)
+{
+	alloc_cnt++;
+
+	return __real_k_malloc(size);
+}
+
 static void test_params_fail_on_invalid_input_setup(void)
 {
 	at_params_list_init(&test_list, TEST_PARAMS);
@@ -780,6 +792,176 @@ static void test_at_cmd_test_teardown(void)
 	at_params_list_free(&test_list2);
 }
 
+static void test_tokens_match_params(void)
+{
+	const char *const *strings[] = { singleline, multiline, pduline, singleparamline,
+					 emptyparamline };
+	const size_t counts[] = { ARRAY_SIZE(singleline), ARRAY_SIZE(multiline),
+				  ARRAY_SIZE(pduline), ARRAY_SIZE(singleparamline),
+				  ARRAY_SIZE(emptyparamline) };
+	struct at_token tokens[TEST_PARAMS2];
+	struct at_parser parser;
+	int ret;
+
+	ret = at_parser_init(&parser, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, 0, "at_parser_init should return 0");
+
+	for (size_t n = 0; n < ARRAY_SIZE(strings); n++) {
+		for (size_t i = 0; i < counts[n]; i++) {
+			const char *str = strings[n][i];
+			char *next_list;
+			char *next_tokens;
+			int ret_list;
+
+			ret_list = at_parser_params_from_str(str, &next_list, &test_list2);
+			ret = at_parser_tokens_from_str(&parser, str, &next_tokens);
+			zassert_equal(ret, ret_list, "Return values differ");
+			zassert_equal(next_tokens, next_list, "Remainders differ");
+
+			for (size_t j = 0; j < TEST_PARAMS2; j++) {
+				enum at_param_type type = at_params_type_get(&test_list2, j);
+				int64_t int_list, int_tokens;
+				char str_list[128], str_tokens[128];
+				size_t len_list = sizeof(str_list);
+				size_t len_tokens = sizeof(str_tokens);
+
+				zassert_equal(at_parser_token_type_get(&parser, j), type,
+					      "Parameter types differ");
+
+				if (type == AT_PARAM_TYPE_NUM_INT) {
+					at_params_int64_get(&test_list2, j, &int_list);
+					ret = at_parser_token_int64_get(&parser, j, &int_tokens);
+					zassert_equal(ret, 0, "Get number should not fail");
+					zassert_equal(int_tokens, int_list, "Numbers differ");
+				} else if (type == AT_PARAM_TYPE_STRING) {
+					at_params_string_get(&test_list2, j, str_list, &len_list);
+					ret = at_parser_token_string_get(&parser, j, str_tokens,
+									 &len_tokens);
+					zassert_equal(ret, 0, "Get string should not fail");
+					zassert_equal(len_tokens, len_list, "String lengths differ");
+					zassert_equal(0, memcmp(str_tokens, str_list, len_list),
+						      "Strings differ");
+				}
+			}
+		}
+	}
+}
+
+static void test_tokens_no_copy(void)
+{
+	static const char str[] = "%CESQ: 2,\"test\",(1,2,3),,-5\r\nOK\r\n";
+	struct at_token tokens[6];
+	struct at_parser parser;
+	const char *ptr;
+	uint32_t array[4];
+	size_t len;
+	int64_t val;
+	int ret;
+
+	at_parser_init(&parser, tokens, ARRAY_SIZE(tokens));
+
+	alloc_cnt = 0;
+	ret = at_parser_tokens_from_str(&parser, str, NULL);
+	zassert_equal(ret, 0, "at_parser_tokens_from_str should return 0");
+	zassert_equal(alloc_cnt, 0, "Parsing should not allocate");
+	zassert_equal(parser.count, 6, "Wrong number of tokens");
+
+	ret = at_parser_token_string_ptr_get(&parser, 2, &ptr, &len);
+	zassert_equal(ret, 0, "Get string pointer should not fail");
+	zassert_equal(ptr, &str[10], "String should point into the parsed string");
+	zassert_equal(len, 4, "Wrong string length");
+
+	len = sizeof(array);
+	ret = at_parser_token_array_get(&parser, 3, array, &len);
+	zassert_equal(ret, 0, "Get array should not fail");
+	zassert_equal(len, 3 * sizeof(uint32_t), "Wrong array length");
+	zassert_equal(array[2], 3, "Wrong array value");
+
+	zassert_equal(at_parser_token_type_get(&parser, 4), AT_PARAM_TYPE_EMPTY,
+		      "Param type at index 4 should be empty");
+
+	ret = at_parser_token_int64_get(&parser, 5, &val);
+	zassert_equal(ret, 0, "Get number should not fail");
+	zassert_equal(val, -5, "Wrong number");
+
+	ret = at_parser_token_int64_get(&parser, 2, &val);
+	zassert_equal(ret, -EINVAL, "Get number of a string should fail");
+	zassert_equal(at_parser_token_type_get(&parser, 6), AT_PARAM_TYPE_INVALID,
+		      "Param type at index 6 should be invalid");
+}
+
+#define BENCHMARK_ITERATIONS 100
+#define BENCHMARK_PARAMS     100
+
+static const char ncellmeas[] =
+	"%NCELLMEAS: 0,\"0199F10A\",\"24405\",\"0C9F\",65535,6400,167,32,63,1524,"
+	"6400,51,39,30,0,6400,194,37,21,0,6400,110,35,18,0,6400,12,33,17,0,"
+	"6400,301,31,14,0,6400,97,30,12,0,6400,402,29,11,0,6400,5,27,9,0,"
+	"1300,45,26,8,0,1300,46,25,7,0,1300,47,24,6,0,1300,48,23,5,0,"
+	"1300,49,22,4,0,300,250,21,3,0,300,251,20,2,0,300,252,19,1,0,"
+	"300,253,18,0,0,1524\r\n";
+static const char xmonitor[] =
+	"%XMONITOR: 1,\"Operator\",\"OP\",\"24405\",\"0C9F\",7,20,\"0199F10A\",167,6400,"
+	"63,32,\"\",\"11100000\",\"00100110\",\"01011111\"\r\nOK\r\n";
+static const char cgev[] = "+CGEV: ME PDN ACT 0\r\n";
+
+static void benchmark_run(const char *name, const char *str)
+{
+	struct at_token tokens[BENCHMARK_PARAMS];
+	struct at_parser parser;
+	uint32_t list_allocs, tokens_allocs;
+	uint32_t list_cycles, tokens_cycles;
+	uint32_t start;
+	int ret;
+
+	at_parser_init(&parser, tokens, ARRAY_SIZE(tokens));
+
+	alloc_cnt = 0;
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+		ret = at_parser_params_from_str(str, NULL, &test_list);
+		zassert_equal(ret, 0, "at_parser_params_from_str should return 0");
+	}
+	list_cycles = k_cycle_get_32() - start;
+	list_allocs = alloc_cnt;
+
+	alloc_cnt = 0;
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+		ret = at_parser_tokens_from_str(&parser, str, NULL);
+		zassert_equal(ret, 0, "at_parser_tokens_from_str should return 0");
+	}
+	tokens_cycles = k_cycle_get_32() - start;
+	tokens_allocs = alloc_cnt;
+
+	zassert_equal(parser.count, at_params_valid_count_get(&test_list),
+		      "Parameter counts differ");
+	zassert_equal(tokens_allocs, 0, "Token parsing should not allocate");
+
+	printk("%s (%zu params): list %u allocs, %u ns; tokens %u allocs, %u ns per parse\n",
+	       name, parser.count, list_allocs / BENCHMARK_ITERATIONS,
+	       (uint32_t)k_cyc_to_ns_floor64(list_cycles / BENCHMARK_ITERATIONS),
+	       tokens_allocs / BENCHMARK_ITERATIONS,
+	       (uint32_t)k_cyc_to_ns_floor64(tokens_cycles / BENCHMARK_ITERATIONS));
+}
+
+static void test_benchmark_setup(void)
+{
+	at_params_list_init(&test_list, BENCHMARK_PARAMS);
+}
+
+static void test_benchmark(void)
+{
+	benchmark_run("%NCELLMEAS", ncellmeas);
+	benchmark_run("%XMONITOR", xmonitor);
+	benchmark_run("+CGEV", cgev);
+}
+
+static void test_benchmark_teardown(void)
+{
+	at_params_list_free(&test_list);
+}
+
 void test_main(void)
 {
 	ztest_test_suite(at_cmd_parser,
@@ -810,7 +992,16 @@ void test_main(void)
 			 ztest_unit_test_setup_teardown(
 				test_at_cmd_test,
 				test_at_cmd_test_setup,
-				test_at_cmd_test_teardown)
+				test_at_cmd_test_teardown),
+			 ztest_unit_test_setup_teardown(
+				test_tokens_match_params,
+				test_testcases_setup,
+				test_testcases_teardown),
+			 ztest_unit_test(test_tokens_no_copy),
+			 ztest_unit_test_setup_teardown(
+				test_benchmark,
+				test_benchmark_setup,
+				test_benchmark_teardown)
 			);
 
 	ztest_run_test_suite(at_cmd_parser);
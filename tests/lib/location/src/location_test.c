@@ -31,6 +31,9 @@ static struct rest_client_req_context rest_req_ctx = { 0 };
 static struct rest_client_resp_context rest_resp_ctx = { 0 };
 static bool location_callback_called_occurred;
 static bool location_callback_called_expected;
+/* Uptime and method of the latest location_event_handler call for measuring time to fix */
+static int64_t test_location_event_uptime;
+static enum location_method test_location_event_method;
 
 K_SEM_DEFINE(event_handler_called_sem, 0, 1);
 
@@ -163,6 +166,8 @@ static void location_event_handler(const struct location_event_data *event_data)
 		TEST_ASSERT_EQUAL(test_location_event_data.location.datetime.ms,
 			event_data->location.datetime.ms);
 	}
+	test_location_event_uptime = k_uptime_get();
+	test_location_event_method = event_data->method;
 	k_sem_give(&event_handler_called_sem);
 }
 
@@ -707,6 +712,428 @@ void test_location_request_timeout_cellular_gnss_mode_all(void)
 	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
 }
 
+/********* TESTS WITH CONCURRENT MODE ***********************/
+
+static void helper_location_cellular_event_data_set(void)
+{
+	test_location_event_data.id = LOCATION_EVT_LOCATION;
+	test_location_event_data.location.latitude = 61.50375;
+	test_location_event_data.location.longitude = 23.896979;
+	test_location_event_data.location.accuracy = 750.0;
+	test_location_event_data.location.datetime.valid = false;
+
+	/* Select cellular service to be used */
+	rest_req_ctx.url = "here.api"; /* Needs a fix once rest_req_ctx is verified */
+	rest_req_ctx.sec_tag = CONFIG_LOCATION_SERVICE_HERE_TLS_SEC_TAG;
+	rest_req_ctx.port = HTTPS_PORT;
+	rest_req_ctx.host = CONFIG_LOCATION_SERVICE_HERE_HOSTNAME;
+}
+
+static void helper_location_gnss_event_data_set(void)
+{
+	test_location_event_data.id = LOCATION_EVT_LOCATION;
+	test_location_event_data.location.latitude = 61.005;
+	test_location_event_data.location.longitude = -45.997;
+	test_location_event_data.location.accuracy = 15.83;
+	test_location_event_data.location.datetime.valid = true;
+	test_location_event_data.location.datetime.year = 2021;
+	test_location_event_data.location.datetime.month = 8;
+	test_location_event_data.location.datetime.day = 13;
+	test_location_event_data.location.datetime.hour = 12;
+	test_location_event_data.location.datetime.minute = 34;
+	test_location_event_data.location.datetime.second = 56;
+	test_location_event_data.location.datetime.ms = 789;
+
+	test_pvt_data.flags = NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID;
+	test_pvt_data.latitude = 61.005;
+	test_pvt_data.longitude = -45.997;
+	test_pvt_data.accuracy = 15.83;
+	test_pvt_data.datetime.year = 2021;
+	test_pvt_data.datetime.month = 8;
+	test_pvt_data.datetime.day = 13;
+	test_pvt_data.datetime.hour = 12;
+	test_pvt_data.datetime.minute = 34;
+	test_pvt_data.datetime.seconds = 56;
+	test_pvt_data.datetime.ms = 789;
+}
+
+static void helper_location_gnss_start_expect(void)
+{
+	__cmock_nrf_modem_gnss_fix_interval_set_ExpectAndReturn(1, 0);
+	__cmock_nrf_modem_gnss_use_case_set_ExpectAndReturn(
+		NRF_MODEM_GNSS_USE_CASE_MULTIPLE_HOT_START, 0);
+	__cmock_nrf_modem_gnss_start_ExpectAndReturn(0);
+
+	/* TODO: Cannot determine the used system mode but it's set as zero by default in lte_lc */
+	__mock_nrf_modem_at_scanf_ExpectAndReturn(
+		"AT%XSYSTEMMODE?", "%%XSYSTEMMODE: %d,%d,%d,%d", 4);
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* LTE-M support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* NB-IoT support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* GNSS support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(0); /* LTE preference */
+}
+
+/* Indicates that LTE is idle so that GNSS starts searching. */
+static void helper_location_gnss_lte_idle_trigger(void)
+{
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT%%XMONITOR", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(
+		(char *)xmonitor_resp, sizeof(xmonitor_resp));
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+}
+
+static void helper_location_gnss_fix_trigger(void)
+{
+	helper_location_gnss_lte_idle_trigger();
+
+	__cmock_nrf_modem_gnss_read_ExpectAndReturn(
+		NULL, sizeof(test_pvt_data), NRF_MODEM_GNSS_DATA_PVT, 0);
+	__cmock_nrf_modem_gnss_read_IgnoreArg_buf();
+	__cmock_nrf_modem_gnss_read_ReturnMemThruPtr_buf(&test_pvt_data, sizeof(test_pvt_data));
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+	method_gnss_event_handler(NRF_MODEM_GNSS_EVT_PVT);
+}
+
+/* Waits for location_event_handler call and returns the time to fix from the given uptime. */
+static int helper_location_time_to_fix_get(int64_t request_uptime)
+{
+	int time_to_fix;
+
+	/* Wait for location_event_handler call for 3 seconds.
+	 * If it doesn't happen, next assert will fail the test.
+	 */
+	k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(location_callback_called_expected, location_callback_called_occurred);
+	location_callback_called_occurred = false;
+	k_sem_reset(&event_handler_called_sem);
+
+	time_to_fix = (int)(test_location_event_uptime - request_uptime);
+	printk("Time to first acceptable fix: %d ms\n", time_to_fix);
+
+	return time_to_fix;
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT where cellular location is accepted:
+ * - GNSS and cellular positioning are started at the same time
+ * - GNSS is cancelled once the location from cellular positioning is given
+ * - Location is given before the GNSS timeout, which wouldn't be possible if cellular
+ *   positioning was run only after GNSS
+ */
+void test_location_request_mode_concurrent_cellular_accepted(void)
+{
+	int err;
+	int time_to_fix;
+	int64_t request_uptime;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_CELLULAR};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.accuracy_threshold = 1000;
+	config.methods[0].gnss.timeout = 2 * MSEC_PER_SEC;
+
+	helper_location_cellular_event_data_set();
+
+	location_callback_called_expected = true;
+
+	__cmock_nrf_modem_at_printf_ExpectAndReturn("AT%%NCELLMEAS", 0);
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+	helper_location_gnss_start_expect();
+
+	cellular_rest_req_resp_handle();
+
+	request_uptime = k_uptime_get();
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* Wait a bit so that NCELLMEAS is sent before we send response */
+	k_sleep(K_MSEC(100));
+
+	/* GNSS is cancelled once cellular location is given */
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+
+	/* Trigger NCELLMEAS response which further triggers the rest of the location calculation */
+	at_monitor_dispatch(ncellmeas_resp);
+
+	time_to_fix = helper_location_time_to_fix_get(request_uptime);
+	TEST_ASSERT_EQUAL(LOCATION_METHOD_CELLULAR, test_location_event_method);
+	TEST_ASSERT_LESS_THAN(config.methods[0].gnss.timeout, time_to_fix);
+
+	location_callback_called_expected = false;
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT where cellular location doesn't meet the accuracy
+ * threshold and the location is given when GNSS gets a fix. With LOCATION_REQ_MODE_FALLBACK,
+ * the cellular location would be given instead.
+ */
+void test_location_request_mode_concurrent_gnss_accepted(void)
+{
+	int err;
+	int64_t request_uptime;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_CELLULAR, LOCATION_METHOD_GNSS};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.accuracy_threshold = 50;
+
+	/* Cellular location is not given because it's not accurate enough */
+	helper_location_cellular_event_data_set();
+	cellular_rest_req_resp_handle();
+
+	helper_location_gnss_event_data_set();
+
+	location_callback_called_expected = true;
+
+	__cmock_nrf_modem_at_printf_ExpectAndReturn("AT%%NCELLMEAS", 0);
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+	helper_location_gnss_start_expect();
+
+	request_uptime = k_uptime_get();
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* Wait a bit so that NCELLMEAS is sent before we send response */
+	k_sleep(K_MSEC(100));
+
+	/* Trigger NCELLMEAS response which further triggers the rest of the location calculation */
+	at_monitor_dispatch(ncellmeas_resp);
+	k_sleep(K_MSEC(100));
+
+	helper_location_gnss_fix_trigger();
+
+	(void)helper_location_time_to_fix_get(request_uptime);
+	TEST_ASSERT_EQUAL(LOCATION_METHOD_GNSS, test_location_event_method);
+
+	location_callback_called_expected = false;
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT where GNSS gets a fix while cellular positioning is still
+ * waiting for NCELLMEAS response. The location is given before the cellular timeout, which
+ * wouldn't be possible if GNSS was run only after cellular positioning.
+ */
+void test_location_request_mode_concurrent_gnss_during_ncellmeas(void)
+{
+	int err;
+	int time_to_fix;
+	int64_t request_uptime;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_CELLULAR, LOCATION_METHOD_GNSS};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.methods[0].cellular.timeout = 2 * MSEC_PER_SEC;
+	config.methods[1].gnss.timeout = 120 * MSEC_PER_SEC;
+
+	helper_location_gnss_event_data_set();
+
+	location_callback_called_expected = true;
+
+	__cmock_nrf_modem_at_printf_ExpectAndReturn("AT%%NCELLMEAS", 0);
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+	helper_location_gnss_start_expect();
+
+	request_uptime = k_uptime_get();
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* No NCELLMEAS response so cellular positioning keeps waiting for it */
+	k_sleep(K_MSEC(100));
+
+	/* Cellular positioning is cancelled once GNSS location is given */
+	__cmock_nrf_modem_at_printf_ExpectAndReturn("AT%%NCELLMEASSTOP", 0);
+
+	helper_location_gnss_fix_trigger();
+
+	time_to_fix = helper_location_time_to_fix_get(request_uptime);
+	TEST_ASSERT_EQUAL(LOCATION_METHOD_GNSS, test_location_event_method);
+	TEST_ASSERT_LESS_THAN(config.methods[0].cellular.timeout, time_to_fix);
+
+	location_callback_called_expected = false;
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT with refining:
+ * - Cellular location is given first as it meets the accuracy threshold
+ * - GNSS continues and its more accurate location is given next
+ * - Both locations are given before the GNSS timeout, which wouldn't be possible if cellular
+ *   positioning was run only after GNSS
+ */
+void test_location_request_mode_concurrent_refine(void)
+{
+	int err;
+	int time_to_fix;
+	int64_t request_uptime;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_CELLULAR};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.accuracy_threshold = 1000;
+	config.refine = true;
+	config.methods[0].gnss.timeout = 2 * MSEC_PER_SEC;
+
+	helper_location_cellular_event_data_set();
+
+	location_callback_called_expected = true;
+
+	__cmock_nrf_modem_at_printf_ExpectAndReturn("AT%%NCELLMEAS", 0);
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+	helper_location_gnss_start_expect();
+
+	cellular_rest_req_resp_handle();
+
+	request_uptime = k_uptime_get();
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* Wait a bit so that NCELLMEAS is sent before we send response */
+	k_sleep(K_MSEC(100));
+
+	/* Trigger NCELLMEAS response which further triggers the rest of the location calculation */
+	at_monitor_dispatch(ncellmeas_resp);
+
+	time_to_fix = helper_location_time_to_fix_get(request_uptime);
+	TEST_ASSERT_EQUAL(LOCATION_METHOD_CELLULAR, test_location_event_method);
+	TEST_ASSERT_LESS_THAN(config.methods[0].gnss.timeout, time_to_fix);
+
+	/***** Then refined location from GNSS *****/
+	helper_location_data_clear();
+	helper_location_gnss_event_data_set();
+
+	helper_location_gnss_fix_trigger();
+
+	time_to_fix = helper_location_time_to_fix_get(request_uptime);
+	TEST_ASSERT_EQUAL(LOCATION_METHOD_GNSS, test_location_event_method);
+	TEST_ASSERT_LESS_THAN(config.methods[0].gnss.timeout, time_to_fix);
+
+	/* Request is complete once all methods are done so no more events are expected */
+	location_callback_called_expected = false;
+	k_sleep(K_MSEC(100));
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT where no method reaches the accuracy threshold:
+ * - GNSS gets a fix while cellular positioning is still waiting for NCELLMEAS response
+ * - GNSS location is not given because it's not accurate enough
+ * - Less accurate cellular location is ignored and the GNSS location is given as the most
+ *   accurate one once both methods are done
+ */
+void test_location_request_mode_concurrent_best_location(void)
+{
+	int err;
+	int time_to_fix;
+	int cellular_done_time;
+	int64_t request_uptime;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_CELLULAR};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.accuracy_threshold = 10;
+
+	helper_location_cellular_event_data_set();
+	cellular_rest_req_resp_handle();
+
+	helper_location_gnss_event_data_set();
+
+	location_callback_called_expected = true;
+
+	__cmock_nrf_modem_at_printf_ExpectAndReturn("AT%%NCELLMEAS", 0);
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+	helper_location_gnss_start_expect();
+
+	request_uptime = k_uptime_get();
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* No NCELLMEAS response yet so cellular positioning keeps waiting for it */
+	k_sleep(K_MSEC(100));
+
+	helper_location_gnss_fix_trigger();
+	k_sleep(K_MSEC(100));
+
+	/* Location is not given while cellular positioning is still running */
+	TEST_ASSERT_FALSE(location_callback_called_occurred);
+
+	/* Trigger NCELLMEAS response which further triggers the rest of the location calculation */
+	cellular_done_time = (int)(k_uptime_get() - request_uptime);
+	at_monitor_dispatch(ncellmeas_resp);
+
+	time_to_fix = helper_location_time_to_fix_get(request_uptime);
+	TEST_ASSERT_EQUAL(LOCATION_METHOD_GNSS, test_location_event_method);
+	TEST_ASSERT_GREATER_OR_EQUAL(cellular_done_time, time_to_fix);
+
+	/* Request is complete so no more events are expected */
+	location_callback_called_expected = false;
+	k_sleep(K_MSEC(100));
+}
+
+/* Test LOCATION_REQ_MODE_CONCURRENT where the entire location request times out:
+ * - Neither method gets a location before the request timeout
+ * - Both methods are cancelled and the timeout event is given for the first method in the
+ *   list, before the method timeouts
+ */
+void test_location_request_mode_concurrent_timeout(void)
+{
+	int err;
+	int time_to_fix;
+	int64_t request_uptime;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_CELLULAR, LOCATION_METHOD_GNSS};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.timeout = 500;
+	config.methods[0].cellular.timeout = 2 * MSEC_PER_SEC;
+	config.methods[1].gnss.timeout = 2 * MSEC_PER_SEC;
+
+	test_location_event_data.id = LOCATION_EVT_TIMEOUT;
+
+	location_callback_called_expected = true;
+
+	__cmock_nrf_modem_at_printf_ExpectAndReturn("AT%%NCELLMEAS", 0);
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+	helper_location_gnss_start_expect();
+
+	request_uptime = k_uptime_get();
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* No NCELLMEAS response so cellular positioning keeps waiting for it */
+	k_sleep(K_MSEC(100));
+
+	/* GNSS starts searching but doesn't get a fix */
+	helper_location_gnss_lte_idle_trigger();
+
+	/* Both methods are cancelled when the request times out */
+	__cmock_nrf_modem_at_printf_ExpectAndReturn("AT%%NCELLMEASSTOP", 0);
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+
+	time_to_fix = helper_location_time_to_fix_get(request_uptime);
+	TEST_ASSERT_EQUAL(LOCATION_METHOD_CELLULAR, test_location_event_method);
+	TEST_ASSERT_GREATER_OR_EQUAL(config.timeout, time_to_fix);
+	TEST_ASSERT_LESS_THAN(config.methods[0].cellular.timeout, time_to_fix);
+
+	location_callback_called_expected = false;
+	k_sleep(K_MSEC(100));
+}
+
+/* Test that a method can be given only once in LOCATION_REQ_MODE_CONCURRENT. */
+void test_error_concurrent_duplicate_method(void)
+{
+	int err;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_CELLULAR, LOCATION_METHOD_CELLULAR};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(-EINVAL, err);
+}
+
 /********* TESTS PERIODIC POSITIONING REQUESTS ***********************/
 
 /* Test periodic location request and cancel it once some iterations are done. */
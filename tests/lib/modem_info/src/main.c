@@ -16,6 +16,7 @@
 #include <zephyr/fff.h>
 
 #include <nrf_modem_at.h>
+#include <modem/at_monitor.h>
 
 DEFINE_FFF_GLOBALS;
 
@@ -33,6 +34,28 @@ FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_scanf, const char *, const char *, ...)
 #define EXAMPLE_RSRP_INVALID 255
 #define EXAMPLE_RSRP_VALID 160
 #define RSRP_OFFSET 140
+#define EXAMPLE_OPERATOR "26295"
+#define EXAMPLE_MCC 262
+#define EXAMPLE_MNC 95
+#define EXAMPLE_AREA_CODE "00B7"
+#define EXAMPLE_BAND 20
+#define EXAMPLE_CELLID "00011B07"
+#define EXAMPLE_APN "internet.example"
+#define EXAMPLE_IP_ADDRESS "10.0.0.1"
+#define SNAPSHOT_NETWORK_FIELDS (BIT(MODEM_INFO_RSRP) | BIT(MODEM_INFO_CUR_BAND) | \
+				 BIT(MODEM_INFO_AREA_CODE) | BIT(MODEM_INFO_OPERATOR) | \
+				 BIT(MODEM_INFO_MCC) | BIT(MODEM_INFO_MNC) | \
+				 BIT(MODEM_INFO_CELLID))
+#define SNAPSHOT_PDN_FIELDS (BIT(MODEM_INFO_IP_ADDRESS) | BIT(MODEM_INFO_APN))
+#define EXAMPLE_CEREG_NOTIF "+CEREG: 1,\"00B7\",\"00011B07\",7\r\n"
+#define EXAMPLE_CESQ_NOTIF "%CESQ: 54,2,16,2\r\n"
+#define EXAMPLE_CGEV_NOTIF "+CGEV: ME PDN ACT 0\r\n"
+#define NOTIF_DISPATCH_TIME_MS 10
+
+/* at_monitor_dispatch() is implemented in at_monitor library and
+ * it's called from nrf_modem when a notification is received.
+ */
+extern void at_monitor_dispatch(const char *at_notif);
 
 struct at_param at_params[10] = {};
 static struct at_param_list m_param_list = {
@@ -129,12 +152,60 @@ static int nrf_modem_at_scanf_custom_cesq_invalid(const char *cmd, const char *f
 	return 1;
 }
 
+/* Responds to the snapshot commands, each call is one AT round-trip. */
+static int nrf_modem_at_scanf_custom_snapshot(const char *cmd, const char *fmt, va_list args)
+{
+	if (strcmp(cmd, "AT%XMONITOR") == 0) {
+		*va_arg(args, uint8_t *) = 1;
+		strcpy(va_arg(args, char *), EXAMPLE_OPERATOR);
+		strcpy(va_arg(args, char *), EXAMPLE_AREA_CODE);
+		*va_arg(args, uint16_t *) = EXAMPLE_BAND;
+		strcpy(va_arg(args, char *), EXAMPLE_CELLID);
+		*va_arg(args, uint16_t *) = EXAMPLE_RSRP_VALID;
+
+		return 6;
+	}
+
+	if (strcmp(cmd, "AT+CGDCONT?") == 0) {
+		strcpy(va_arg(args, char *), EXAMPLE_APN);
+		strcpy(va_arg(args, char *), EXAMPLE_IP_ADDRESS);
+
+		return 2;
+	}
+
+	TEST_FAIL_MESSAGE("Unexpected AT command");
+
+	return 0;
+}
+
+/* A notification is received while AT%XMONITOR is in progress. */
+static int nrf_modem_at_scanf_custom_snapshot_notif(const char *cmd, const char *fmt,
+						    va_list args)
+{
+	if (strcmp(cmd, "AT%XMONITOR") == 0) {
+		at_monitor_dispatch(EXAMPLE_CEREG_NOTIF);
+		k_sleep(K_MSEC(NOTIF_DISPATCH_TIME_MS));
+	}
+
+	return nrf_modem_at_scanf_custom_snapshot(cmd, fmt, args);
+}
+
+static int nrf_modem_at_scanf_custom_snapshot_not_registered(const char *cmd, const char *fmt,
+							    va_list args)
+{
+	TEST_ASSERT_EQUAL_STRING("AT%XMONITOR", cmd);
+
+	*va_arg(args, uint8_t *) = 2;
+
+	return 1;
+}
 
 void setUp(void)
 {
 	RESET_FAKE(nrf_modem_at_notif_handler_set);
 	RESET_FAKE(at_params_list_init);
 	RESET_FAKE(nrf_modem_at_scanf);
+	modem_info_snapshot_invalidate();
 }
 
 void tearDown(void)
@@ -406,6 +477,198 @@ void test_modem_info_get_rsrp_success(void)
 	TEST_ASSERT_EQUAL(1, nrf_modem_at_scanf_fake.call_count);
 }
 
+void test_modem_info_snapshot_null(void)
+{
+	int ret;
+
+	ret = modem_info_snapshot_get(NULL, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+	TEST_ASSERT_EQUAL(0, nrf_modem_at_scanf_fake.call_count);
+}
+
+void test_modem_info_snapshot_unsupported_field(void)
+{
+	int ret;
+	struct modem_info_snapshot snapshot;
+
+	ret = modem_info_snapshot_get(&snapshot, BIT(MODEM_INFO_IMEI));
+	TEST_ASSERT_EQUAL(-ENOTSUP, ret);
+	TEST_ASSERT_EQUAL(0, nrf_modem_at_scanf_fake.call_count);
+}
+
+void test_modem_info_snapshot_network(void)
+{
+	int ret;
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom_snapshot;
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_scanf_fake.call_count);
+	TEST_ASSERT_EQUAL(SNAPSHOT_NETWORK_FIELDS, snapshot.fields);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_OPERATOR, snapshot.operator);
+	TEST_ASSERT_EQUAL(EXAMPLE_MCC, snapshot.mcc);
+	TEST_ASSERT_EQUAL(EXAMPLE_MNC, snapshot.mnc);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_AREA_CODE, snapshot.area_code);
+	TEST_ASSERT_EQUAL(0xB7, snapshot.area_code_value);
+	TEST_ASSERT_EQUAL(EXAMPLE_BAND, snapshot.band);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_CELLID, snapshot.cellid_hex);
+	TEST_ASSERT_EQUAL(0x11B07, snapshot.cellid);
+	TEST_ASSERT_EQUAL(EXAMPLE_RSRP_VALID, snapshot.rsrp);
+}
+
+void test_modem_info_snapshot_all(void)
+{
+	int ret;
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom_snapshot;
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS | SNAPSHOT_PDN_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_scanf_fake.call_count);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_APN, snapshot.apn);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_IP_ADDRESS, snapshot.ip_address);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_CELLID, snapshot.cellid_hex);
+}
+
+void test_modem_info_snapshot_cached(void)
+{
+	int ret;
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom_snapshot;
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_scanf_fake.call_count);
+
+	/* Cached fields are not read again, only the missing ones. */
+	ret = modem_info_snapshot_get(&snapshot, BIT(MODEM_INFO_CELLID));
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_scanf_fake.call_count);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_CELLID, snapshot.cellid_hex);
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS | SNAPSHOT_PDN_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_scanf_fake.call_count);
+
+	/* Invalidated fields are read again. */
+	modem_info_snapshot_invalidate();
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_PDN_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(3, nrf_modem_at_scanf_fake.call_count);
+}
+
+void test_modem_info_snapshot_expired(void)
+{
+	int ret;
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom_snapshot;
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_scanf_fake.call_count);
+
+	k_sleep(K_MSEC(CONFIG_MODEM_INFO_SNAPSHOT_TTL_MS));
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_scanf_fake.call_count);
+}
+
+void test_modem_info_snapshot_not_registered(void)
+{
+	int ret;
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom_snapshot_not_registered;
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(-ENOENT, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_scanf_fake.call_count);
+
+	/* Failed reads are not cached. */
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(-ENOENT, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_scanf_fake.call_count);
+}
+
+/* Notifications are handled in the system workqueue. */
+static void notif_receive(const char *notif)
+{
+	at_monitor_dispatch(notif);
+	k_sleep(K_MSEC(NOTIF_DISPATCH_TIME_MS));
+}
+
+static void snapshot_notif_invalidates(const char *notif, uint32_t invalidated_fields,
+				       uint32_t cached_fields)
+{
+	int ret;
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom_snapshot;
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS | SNAPSHOT_PDN_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_scanf_fake.call_count);
+
+	notif_receive(notif);
+
+	/* Only the invalidated fields are read again. */
+	ret = modem_info_snapshot_get(&snapshot, cached_fields);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_scanf_fake.call_count);
+
+	ret = modem_info_snapshot_get(&snapshot, invalidated_fields);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(3, nrf_modem_at_scanf_fake.call_count);
+}
+
+void test_modem_info_snapshot_cereg_invalidates(void)
+{
+	snapshot_notif_invalidates(EXAMPLE_CEREG_NOTIF, SNAPSHOT_NETWORK_FIELDS,
+				   SNAPSHOT_PDN_FIELDS);
+}
+
+void test_modem_info_snapshot_cesq_invalidates(void)
+{
+	snapshot_notif_invalidates(EXAMPLE_CESQ_NOTIF, SNAPSHOT_NETWORK_FIELDS,
+				   SNAPSHOT_PDN_FIELDS);
+}
+
+void test_modem_info_snapshot_cgev_invalidates(void)
+{
+	snapshot_notif_invalidates(EXAMPLE_CGEV_NOTIF, SNAPSHOT_PDN_FIELDS,
+				   SNAPSHOT_NETWORK_FIELDS);
+}
+
+void test_modem_info_snapshot_notif_while_reading(void)
+{
+	int ret;
+	struct modem_info_snapshot snapshot;
+
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom_snapshot_notif;
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_scanf_fake.call_count);
+
+	/* The result may be older than the notification, so it is not cached. */
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom_snapshot;
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_scanf_fake.call_count);
+
+	ret = modem_info_snapshot_get(&snapshot, SNAPSHOT_NETWORK_FIELDS);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_scanf_fake.call_count);
+}
+
 extern int unity_main(void);
 
 void main(void)
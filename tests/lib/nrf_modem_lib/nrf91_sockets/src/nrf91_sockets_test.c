@@ -12,6 +12,8 @@
 #include <zephyr/net/socket.h>
 
 #include <nrf_gai_errors.h>
+#include <nrf_modem_limits.h>
+#include <modem/nrf_modem_lib.h>
 
 #include "cmock_nrf_socket.h"
 #include "cmock_nrf_modem_os.h"
@@ -20,6 +22,10 @@
 #define PORT 8080
 #define WRONG_VALUE 4242
 
+#define SENDMSG_THREAD_COUNT NRF_MODEM_MAX_SOCKET_COUNT
+#define SENDMSG_THREAD_STACK_SIZE 1024
+#define SENDMSG_ROUNDS 200
+
 void setUp(void)
 {
 }
@@ -51,6 +57,13 @@ static struct test_state_nrf_poll {
 	int ret;
 } test_state_nrf_poll;
 
+static struct test_state_nrf_sendto {
+	atomic_t calls;
+	atomic_t bytes;
+	size_t msg_len;
+	atomic_t split;
+} test_state_nrf_sendto;
+
 static int nrf_getaddrinfo_stub(const char *p_node, const char *p_service,
 				const struct nrf_addrinfo *p_hints,
 				struct nrf_addrinfo **pp_res,
@@ -94,6 +107,22 @@ static ssize_t nrf_recvfrom_stub(int socket, void *buffer, size_t length,
 }
 
 
+static ssize_t nrf_sendto_stub(int socket, const void *message, size_t length,
+			       int flags, const struct nrf_sockaddr *dest_addr,
+			       nrf_socklen_t dest_len, int cmock_num_calls)
+{
+	atomic_inc(&test_state_nrf_sendto.calls);
+	atomic_add(&test_state_nrf_sendto.bytes, length);
+	if (length != test_state_nrf_sendto.msg_len) {
+		atomic_inc(&test_state_nrf_sendto.split);
+	}
+
+	/* Let the other senders run while this one is "transmitting". */
+	k_yield();
+
+	return length;
+}
+
 static int nrf_poll_stub(struct nrf_pollfd *p_fds, uint32_t nfds,
 			 int timeout, int cmock_num_calls)
 {
@@ -1649,6 +1678,243 @@ void test_nrf91_socket_offload_sendmsg_not_fits_buf(void)
 	TEST_ASSERT_EQUAL(ret, 0);
 }
 
+void test_nrf91_socket_offload_sendmsg_single_part_direct(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int flags = MSG_DONTWAIT;
+	struct msghdr msg = { 0 };
+	struct iovec chunks[2] = { 0 };
+	int chunk_1 = 42;
+	struct nrf_modem_lib_socket_tx_stats stats;
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_STREAM,
+					  NRF_IPPROTO_TCP, nrf_fd);
+
+	fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	/* An empty part is skipped, the other one is sent without repacking */
+	chunks[0].iov_base = NULL;
+	chunks[0].iov_len = 0;
+	chunks[1].iov_base = &chunk_1;
+	chunks[1].iov_len = sizeof(int);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 2;
+
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, &chunk_1, sizeof(int),
+					  NRF_MSG_DONTWAIT,
+					  NULL, 0, sizeof(int));
+
+	ret = sendmsg(fd, &msg, flags);
+
+	TEST_ASSERT_EQUAL(ret, sizeof(int));
+
+	ret = nrf_modem_lib_socket_tx_stats_get(fd, &stats);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+	TEST_ASSERT_EQUAL(stats.sendmsg, 1);
+	TEST_ASSERT_EQUAL(stats.sendto, 1);
+	TEST_ASSERT_EQUAL(stats.bytes, sizeof(int));
+	TEST_ASSERT_EQUAL(stats.copied, 0);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf91_socket_offload_sendmsg_repack_small_parts(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = 2;
+	int flags = MSG_DONTWAIT;
+	struct msghdr msg = { 0 };
+	struct iovec chunks[4] = { 0 };
+	uint8_t small_1 = 1;
+	uint8_t small_2 = 2;
+	uint8_t large[8] = { 3 };
+	uint16_t small_3 = 4;
+	struct nrf_modem_lib_socket_tx_stats stats;
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_STREAM,
+					  NRF_IPPROTO_TCP, nrf_fd);
+
+	fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	chunks[0].iov_base = &small_1;
+	chunks[0].iov_len = sizeof(small_1);
+	chunks[1].iov_base = &small_2;
+	chunks[1].iov_len = sizeof(small_2);
+	chunks[2].iov_base = large;
+	chunks[2].iov_len = sizeof(large);
+	chunks[3].iov_base = &small_3;
+	chunks[3].iov_len = sizeof(small_3);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 4;
+
+	/* The first two parts are repacked and sent together */
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, NULL, 2, NRF_MSG_DONTWAIT,
+					  NULL, 0, 2);
+	__cmock_nrf_sendto_IgnoreArg_message();
+	/* The large part is sent directly */
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, large, sizeof(large), NRF_MSG_DONTWAIT,
+					  NULL, 0, sizeof(large));
+	/* The last part is repacked */
+	__cmock_nrf_sendto_ExpectAndReturn(nrf_fd, NULL, sizeof(small_3), NRF_MSG_DONTWAIT,
+					  NULL, 0, sizeof(small_3));
+	__cmock_nrf_sendto_IgnoreArg_message();
+
+	ret = sendmsg(fd, &msg, flags);
+
+	TEST_ASSERT_EQUAL(ret, 2 + sizeof(large) + sizeof(small_3));
+
+	ret = nrf_modem_lib_socket_tx_stats_get(fd, &stats);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+	TEST_ASSERT_EQUAL(stats.sendmsg, 1);
+	TEST_ASSERT_EQUAL(stats.sendto, 3);
+	TEST_ASSERT_EQUAL(stats.bytes, 2 + sizeof(large) + sizeof(small_3));
+	TEST_ASSERT_EQUAL(stats.copied, 2 + sizeof(small_3));
+	TEST_ASSERT_EQUAL(stats.buf_busy, 0);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+K_THREAD_STACK_ARRAY_DEFINE(sendmsg_stacks, SENDMSG_THREAD_COUNT,
+			    SENDMSG_THREAD_STACK_SIZE);
+static struct k_thread sendmsg_threads[SENDMSG_THREAD_COUNT];
+static atomic_t sendmsg_errors;
+
+static void sendmsg_thread(void *p1, void *p2, void *p3)
+{
+	int fd = POINTER_TO_INT(p1);
+	uint8_t header[2] = { 0xAA, 0xBB };
+	uint8_t payload[3] = { 1, 2, 3 };
+	uint8_t trailer[1] = { 0xCC };
+	struct iovec chunks[] = {
+		{ .iov_base = header, .iov_len = sizeof(header) },
+		{ .iov_base = payload, .iov_len = sizeof(payload) },
+		{ .iov_base = trailer, .iov_len = sizeof(trailer) },
+	};
+	struct msghdr msg = {
+		.msg_iov = chunks,
+		.msg_iovlen = ARRAY_SIZE(chunks),
+	};
+
+	for (int i = 0; i < SENDMSG_ROUNDS; i++) {
+		if (sendmsg(fd, &msg, 0) != 6) {
+			atomic_inc(&sendmsg_errors);
+		}
+	}
+}
+
+void test_nrf91_socket_offload_sendmsg_concurrent_udp(void)
+{
+	int ret;
+	int fd[SENDMSG_THREAD_COUNT];
+	struct nrf_modem_lib_socket_tx_stats stats;
+	uint32_t buf_busy = 0;
+	uint32_t copied = 0;
+	int64_t start;
+	int64_t elapsed;
+
+	atomic_clear(&test_state_nrf_sendto.calls);
+	atomic_clear(&test_state_nrf_sendto.bytes);
+	atomic_clear(&test_state_nrf_sendto.split);
+	test_state_nrf_sendto.msg_len = 6;
+	atomic_clear(&sendmsg_errors);
+
+	/* There are more sockets than sendmsg buffers, so that senders contend
+	 * for the buffers.
+	 */
+	for (int i = 0; i < SENDMSG_THREAD_COUNT; i++) {
+		__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_DGRAM,
+						  NRF_IPPROTO_UDP, i + 2);
+
+		fd[i] = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+		TEST_ASSERT_GREATER_OR_EQUAL(0, fd[i]);
+	}
+
+	__cmock_nrf_sendto_Stub(nrf_sendto_stub);
+
+	start = k_uptime_get();
+
+	for (int i = 0; i < SENDMSG_THREAD_COUNT; i++) {
+		k_thread_create(&sendmsg_threads[i], sendmsg_stacks[i],
+				K_THREAD_STACK_SIZEOF(sendmsg_stacks[i]),
+				sendmsg_thread, INT_TO_POINTER(fd[i]), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < SENDMSG_THREAD_COUNT; i++) {
+		k_thread_join(&sendmsg_threads[i], K_FOREVER);
+	}
+
+	elapsed = MAX(k_uptime_get() - start, 1);
+
+	TEST_ASSERT_EQUAL(atomic_get(&sendmsg_errors), 0);
+	TEST_ASSERT_EQUAL(atomic_get(&test_state_nrf_sendto.bytes),
+			  SENDMSG_THREAD_COUNT * SENDMSG_ROUNDS * 6);
+	/* Every datagram is sent whole, with a single call. */
+	TEST_ASSERT_EQUAL(atomic_get(&test_state_nrf_sendto.split), 0);
+	TEST_ASSERT_EQUAL(atomic_get(&test_state_nrf_sendto.calls),
+			  SENDMSG_THREAD_COUNT * SENDMSG_ROUNDS);
+
+	for (int i = 0; i < SENDMSG_THREAD_COUNT; i++) {
+		ret = nrf_modem_lib_socket_tx_stats_get(fd[i], &stats);
+
+		TEST_ASSERT_EQUAL(ret, 0);
+		TEST_ASSERT_EQUAL(stats.sendmsg, SENDMSG_ROUNDS);
+		TEST_ASSERT_EQUAL(stats.bytes, SENDMSG_ROUNDS * 6);
+		/* Messages that found no free buffer waited for one. */
+		TEST_ASSERT_EQUAL(stats.sendto, SENDMSG_ROUNDS);
+		TEST_ASSERT_EQUAL(stats.copied, SENDMSG_ROUNDS * 6);
+
+		buf_busy += stats.buf_busy;
+		copied += stats.copied;
+	}
+
+	printk("sendmsg on %d sockets: %d messages, %d sendto calls, "
+	       "%u bytes repacked, %u times waited for a buffer, %lld ms, %lld bytes/s\n",
+	       SENDMSG_THREAD_COUNT, SENDMSG_THREAD_COUNT * SENDMSG_ROUNDS,
+	       (int)atomic_get(&test_state_nrf_sendto.calls), copied, buf_busy,
+	       elapsed, (int64_t)SENDMSG_THREAD_COUNT * SENDMSG_ROUNDS * 6 * 1000 / elapsed);
+
+	for (int i = 0; i < SENDMSG_THREAD_COUNT; i++) {
+		__cmock_nrf_close_ExpectAndReturn(i + 2, 0);
+
+		ret = close(fd[i]);
+
+		TEST_ASSERT_EQUAL(ret, 0);
+	}
+}
+
+void test_nrf91_socket_offload_socket_tx_stats_get_errors(void)
+{
+	int ret;
+	struct nrf_modem_lib_socket_tx_stats stats;
+
+	ret = nrf_modem_lib_socket_tx_stats_get(0, NULL);
+
+	TEST_ASSERT_EQUAL(ret, -EINVAL);
+
+	ret = nrf_modem_lib_socket_tx_stats_get(-1, &stats);
+
+	TEST_ASSERT_EQUAL(ret, -EBADF);
+}
+
 void test_nrf91_socket_offload_ioctl_poll_prepare(void)
 {
 	int ret;
@@ -6,6 +6,7 @@
 
 #include <zephyr/ztest.h>
 #include <errno.h>
+#include <string.h>
 #include "pcm_mix.h"
 
 #define ZEQ(a, b) zassert_equal(a, b, "fail")
@@ -127,6 +128,222 @@ void test_mono_into_stereo_r(void)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+/* 10 ms of 48 kHz audio */
+#define FRAME_SAMPLES_MONO 480
+#define FRAME_SAMPLES_STEREO (2 * FRAME_SAMPLES_MONO)
+#define BENCHMARK_ITERATIONS 100
+
+static int32_t ref_a[FRAME_SAMPLES_STEREO + 1];
+static int32_t ref_b[FRAME_SAMPLES_STEREO + 1];
+static int32_t test_a[FRAME_SAMPLES_STEREO + 1];
+static int32_t test_b[FRAME_SAMPLES_STEREO + 1];
+
+static uint32_t rand_state = 0x12345678;
+
+static uint32_t rand_get(void)
+{
+	/* xorshift32, to get deterministic test vectors */
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static int32_t rand_sample_get(uint8_t bit_depth)
+{
+	int32_t max = (bit_depth == 32) ? INT32_MAX : (BIT(bit_depth - 1) - 1);
+	uint32_t r = rand_get();
+
+	/* Use full scale values often to exercise saturation. */
+	switch (r & 0x7) {
+	case 0:
+		return max;
+	case 1:
+		return -max - 1;
+	default:
+		return (int32_t)(rand_get() >> (33 - bit_depth)) * ((r & 0x8) ? -1 : 1);
+	}
+}
+
+static void buf_fill(void *buf, size_t samples, uint8_t bit_depth)
+{
+	for (size_t i = 0; i < samples; i++) {
+		if (bit_depth == 16) {
+			((int16_t *)buf)[i] = (int16_t)rand_sample_get(bit_depth);
+		} else {
+			((int32_t *)buf)[i] = rand_sample_get(bit_depth);
+		}
+	}
+}
+
+/* Scalar reference implementation of the mixer, one sample at a time. */
+static void ref_mix(void *pcm_a, uint16_t gain_a, const void *pcm_b, size_t samples_b,
+		    uint16_t gain_b, enum pcm_mix_mode mode, uint8_t bit_depth)
+{
+	int64_t max = (bit_depth == 32) ? INT32_MAX : (BIT(bit_depth - 1) - 1);
+	int64_t min = -max - 1;
+
+	for (size_t i = 0; i < samples_b; i++) {
+		size_t idx[2];
+		size_t idx_cnt = 1;
+
+		switch (mode) {
+		case B_MONO_INTO_A_STEREO_LR:
+			idx[0] = 2 * i;
+			idx[1] = 2 * i + 1;
+			idx_cnt = 2;
+			break;
+		case B_MONO_INTO_A_STEREO_L:
+			idx[0] = 2 * i;
+			break;
+		case B_MONO_INTO_A_STEREO_R:
+			idx[0] = 2 * i + 1;
+			break;
+		default:
+			idx[0] = i;
+			break;
+		}
+
+		for (size_t j = 0; j < idx_cnt; j++) {
+			int64_t a = (bit_depth == 16) ? ((int16_t *)pcm_a)[idx[j]] :
+							((int32_t *)pcm_a)[idx[j]];
+			int64_t b = (bit_depth == 16) ? ((const int16_t *)pcm_b)[i] :
+							((const int32_t *)pcm_b)[i];
+			int64_t res = (a * gain_a + b * gain_b) / PCM_MIX_GAIN_UNITY;
+
+			/* Division rounds towards zero, the mixer rounds towards minus infinity. */
+			if (((a * gain_a + b * gain_b) < 0) &&
+			    ((a * gain_a + b * gain_b) % PCM_MIX_GAIN_UNITY)) {
+				res--;
+			}
+
+			if (res > max) {
+				res = max;
+			} else if (res < min) {
+				res = min;
+			}
+
+			if (bit_depth == 16) {
+				((int16_t *)pcm_a)[idx[j]] = (int16_t)res;
+			} else {
+				((int32_t *)pcm_a)[idx[j]] = (int32_t)res;
+			}
+		}
+	}
+}
+
+static void bit_exact_check(enum pcm_mix_mode mode, uint8_t bit_depth, uint16_t gain_a,
+			    uint16_t gain_b, size_t samples_b, bool misaligned)
+{
+	size_t sample_size = (bit_depth == 16) ? sizeof(int16_t) : sizeof(int32_t);
+	bool b_mono_a_stereo = (mode != B_STEREO_INTO_A_STEREO) && (mode != B_MONO_INTO_A_MONO);
+	size_t samples_a = b_mono_a_stereo ? (2 * samples_b) : samples_b;
+	/* Offset the 16-bit buffers by one sample to check unaligned access. */
+	size_t offset = (misaligned && (bit_depth == 16)) ? sizeof(int16_t) : 0;
+	uint8_t *a = (uint8_t *)test_a + offset;
+	uint8_t *b = (uint8_t *)test_b + offset;
+	int ret;
+
+	buf_fill(a, samples_a, bit_depth);
+	buf_fill(b, samples_b, bit_depth);
+	memcpy(ref_a, a, samples_a * sample_size);
+	memcpy(ref_b, b, samples_b * sample_size);
+
+	ref_mix(ref_a, gain_a, ref_b, samples_b, gain_b, mode, bit_depth);
+	ret = pcm_mix_gain(a, samples_a * sample_size, gain_a, b, samples_b * sample_size,
+			   gain_b, mode, bit_depth);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(a, ref_a, samples_a * sample_size,
+			  "Mismatch: mode %d, bit depth %d, gains %d/%d, %zu samples", mode,
+			  bit_depth, gain_a, gain_b, samples_b);
+}
+
+void test_bit_exact(void)
+{
+	static const enum pcm_mix_mode modes[] = {
+		B_STEREO_INTO_A_STEREO, B_MONO_INTO_A_MONO, B_MONO_INTO_A_STEREO_LR,
+		B_MONO_INTO_A_STEREO_L, B_MONO_INTO_A_STEREO_R,
+	};
+	static const uint8_t bit_depths[] = { 16, 24, 32 };
+	static const uint16_t gains[][2] = {
+		{ PCM_MIX_GAIN_UNITY, PCM_MIX_GAIN_UNITY },
+		{ PCM_MIX_GAIN_UNITY / 2, PCM_MIX_GAIN_UNITY / 2 },
+		{ PCM_MIX_GAIN_UNITY, PCM_MIX_GAIN_UNITY / 4 },
+		{ 3 * PCM_MIX_GAIN_UNITY, 12345 },
+		{ 0, PCM_MIX_GAIN_UNITY },
+	};
+	/* Both even and odd numbers of samples. */
+	static const size_t sample_cnts[] = { 1, 2, 3, 7, FRAME_SAMPLES_MONO };
+
+	for (size_t m = 0; m < ARRAY_SIZE(modes); m++) {
+		for (size_t d = 0; d < ARRAY_SIZE(bit_depths); d++) {
+			for (size_t g = 0; g < ARRAY_SIZE(gains); g++) {
+				for (size_t n = 0; n < ARRAY_SIZE(sample_cnts); n++) {
+					bit_exact_check(modes[m], bit_depths[d], gains[g][0],
+							gains[g][1], sample_cnts[n], false);
+					bit_exact_check(modes[m], bit_depths[d], gains[g][0],
+							gains[g][1], sample_cnts[n], true);
+				}
+			}
+		}
+	}
+}
+
+void test_illegal_bit_depth(void)
+{
+	int ret;
+	int16_t sample_a[] = { 0, 1, 2 };
+
+	ret = pcm_mix_gain(sample_a, sizeof(sample_a), PCM_MIX_GAIN_UNITY, sample_a,
+			   sizeof(sample_a), PCM_MIX_GAIN_UNITY, B_MONO_INTO_A_MONO, 8);
+	ZEQ(ret, -EINVAL);
+}
+
+static uint32_t benchmark_run(bool reference, enum pcm_mix_mode mode, size_t samples_b)
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (size_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+		if (reference) {
+			ref_mix(test_a, PCM_MIX_GAIN_UNITY, test_b, samples_b, PCM_MIX_GAIN_UNITY,
+				mode, 16);
+		} else {
+			(void)pcm_mix(test_a, sizeof(test_a), test_b, samples_b * sizeof(int16_t),
+				      mode);
+		}
+	}
+
+	return (k_cycle_get_32() - start) / BENCHMARK_ITERATIONS;
+}
+
+void test_benchmark(void)
+{
+	static const struct {
+		enum pcm_mix_mode mode;
+		size_t samples_b;
+		const char *name;
+	} cases[] = {
+		{ B_STEREO_INTO_A_STEREO, FRAME_SAMPLES_STEREO, "stereo into stereo" },
+		{ B_MONO_INTO_A_STEREO_LR, FRAME_SAMPLES_MONO, "mono into stereo LR" },
+		{ B_MONO_INTO_A_STEREO_L, FRAME_SAMPLES_MONO, "mono into stereo L" },
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(cases); i++) {
+		uint32_t ref_cycles;
+		uint32_t cycles;
+
+		buf_fill(test_a, FRAME_SAMPLES_STEREO, 16);
+		buf_fill(test_b, FRAME_SAMPLES_STEREO, 16);
+		ref_cycles = benchmark_run(true, cases[i].mode, cases[i].samples_b);
+		cycles = benchmark_run(false, cases[i].mode, cases[i].samples_b);
+
+		printk("10 ms frame, %s: %u cycles (scalar reference %u cycles)\n",
+		       cases[i].name, cycles, ref_cycles);
+	}
+}
+
 void test_main(void)
 {
 	ztest_test_suite(test_suite_pcm_mix,
@@ -137,7 +354,10 @@ void test_main(void)
 		ztest_unit_test(test_high_values),
 		ztest_unit_test(test_mono_into_stereo_lr),
 		ztest_unit_test(test_mono_into_stereo_l),
-		ztest_unit_test(test_mono_into_stereo_r)
+		ztest_unit_test(test_mono_into_stereo_r),
+		ztest_unit_test(test_bit_exact),
+		ztest_unit_test(test_illegal_bit_depth),
+		ztest_unit_test(test_benchmark)
 	);
 
 	ztest_run_test_suite(test_suite_pcm_mix);
@@ -189,13 +189,178 @@ void test_data_fifo_data_put_size_zero(void)
 	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
 }
 
+void test_data_fifo_spsc_put_get_wrap(void)
+{
+#define SPSC_BLOCKS_NUM 4
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, 128);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "_last_filled_get did not return -ENOMSG");
+
+	/* Go around the ring several times */
+	for (uint32_t i = 0; i < 3 * SPSC_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		data_ptr[0] = i;
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, i + 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		internal_test_remaining_elements(&data_fifo, 1, 1, __LINE__);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(((uint8_t *)data_ptr_read)[0], i, "data contents are not identical");
+		zassert_equal(data_size, i + 1, "data size incorrect");
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		data_fifo_block_free(&data_fifo, &data_ptr_read);
+
+		internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+	}
+
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	}
+
+	/* Add one too many elements */
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_MSEC(1));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not return -EAGAIN");
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+
+	ret = data_fifo_empty(&data_fifo);
+	zassert_equal(ret, 0, "data_fifo_empty did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
+/* Two-thread benchmark: a producer thread passes timestamped blocks to a consumer thread. */
+#define BENCH_BLOCKS_NUM 16
+#define BENCH_BLOCK_SIZE 192
+#define BENCH_ITERATIONS 10000
+#define BENCH_STACK_SIZE 1024
+#define BENCH_PRIORITY K_PRIO_PREEMPT(1)
+
+static K_THREAD_STACK_DEFINE(producer_stack, BENCH_STACK_SIZE);
+static K_THREAD_STACK_DEFINE(consumer_stack, BENCH_STACK_SIZE);
+static struct k_thread producer_thread;
+static struct k_thread consumer_thread;
+
+struct bench_result {
+	uint32_t latency_sum;
+	uint32_t latency_max;
+	uint32_t errors;
+};
+
+static void producer_fn(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *data_fifo = p1;
+	struct bench_result *res = p2;
+	void *data;
+
+	for (uint32_t i = 0; i < BENCH_ITERATIONS; i++) {
+		if (data_fifo_pointer_first_vacant_get(data_fifo, &data, K_FOREVER)) {
+			res->errors++;
+			return;
+		}
+
+		*(uint32_t *)data = k_cycle_get_32();
+
+		if (data_fifo_block_lock(data_fifo, &data, BENCH_BLOCK_SIZE)) {
+			res->errors++;
+			return;
+		}
+	}
+}
+
+static void consumer_fn(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *data_fifo = p1;
+	struct bench_result *res = p2;
+	void *data;
+	size_t size;
+
+	for (uint32_t i = 0; i < BENCH_ITERATIONS; i++) {
+		if (data_fifo_pointer_last_filled_get(data_fifo, &data, &size, K_FOREVER)) {
+			res->errors++;
+			return;
+		}
+
+		uint32_t latency = k_cycle_get_32() - *(uint32_t *)data;
+
+		res->latency_sum += latency;
+		res->latency_max = MAX(res->latency_max, latency);
+
+		data_fifo_block_free(data_fifo, &data);
+	}
+}
+
+static void data_fifo_benchmark_run(struct data_fifo *data_fifo, const char *name)
+{
+	struct bench_result res = { 0 };
+	uint32_t start;
+	uint32_t duration_us;
+	int ret;
+
+	ret = data_fifo_init(data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	start = k_cycle_get_32();
+
+	k_thread_create(&consumer_thread, consumer_stack, K_THREAD_STACK_SIZEOF(consumer_stack),
+			consumer_fn, data_fifo, &res, NULL, BENCH_PRIORITY, 0, K_NO_WAIT);
+	k_thread_create(&producer_thread, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			producer_fn, data_fifo, &res, NULL, BENCH_PRIORITY, 0, K_NO_WAIT);
+
+	ret = k_thread_join(&producer_thread, K_SECONDS(30));
+	zassert_equal(ret, 0, "producer did not finish");
+	ret = k_thread_join(&consumer_thread, K_SECONDS(30));
+	zassert_equal(ret, 0, "consumer did not finish");
+
+	duration_us = MAX(k_cyc_to_us_floor32(k_cycle_get_32() - start), 1);
+
+	zassert_equal(res.errors, 0, "errors during benchmark");
+	internal_test_remaining_elements(data_fifo, 0, 0, __LINE__);
+
+	printk("%s: %u blocks in %u us (%u blocks/s), latency avg %u us, max %u us\n", name,
+	       BENCH_ITERATIONS, duration_us,
+	       (uint32_t)((uint64_t)BENCH_ITERATIONS * USEC_PER_SEC / duration_us),
+	       k_cyc_to_us_floor32(res.latency_sum / BENCH_ITERATIONS),
+	       k_cyc_to_us_floor32(res.latency_max));
+}
+
+void test_data_fifo_benchmark(void)
+{
+	DATA_FIFO_DEFINE(data_fifo_slab, BENCH_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+	DATA_FIFO_SPSC_DEFINE(data_fifo_spsc, BENCH_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+
+	data_fifo_benchmark_run(&data_fifo_slab, "slab/msgq");
+	data_fifo_benchmark_run(&data_fifo_spsc, "SPSC ring");
+}
+
 void test_main(void)
 {
 	ztest_test_suite(test_suite_data_fifo, ztest_unit_test(test_data_fifo_init_ok),
 			 ztest_unit_test(test_data_fifo_data_put_get_ok),
 			 ztest_unit_test(test_data_fifo_data_put_too_many),
 			 ztest_unit_test(test_data_fifo_data_put_too_much_data),
-			 ztest_unit_test(test_data_fifo_data_put_size_zero));
+			 ztest_unit_test(test_data_fifo_data_put_size_zero),
+			 ztest_unit_test(test_data_fifo_spsc_put_get_wrap),
+			 ztest_unit_test(test_data_fifo_benchmark));
 
 	ztest_run_test_suite(test_suite_data_fifo);
 }
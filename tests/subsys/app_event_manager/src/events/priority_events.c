@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "priority_events.h"
+
+APP_EVENT_TYPE_DEFINE(prio_high_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_PRIORITY_HIGH));
+
+APP_EVENT_TYPE_DEFINE(prio_low_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_PRIORITY_LOW));
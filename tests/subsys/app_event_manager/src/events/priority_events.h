@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PRIORITY_EVENTS_H_
+#define _PRIORITY_EVENTS_H_
+
+/**
+ * @brief Priority Events
+ * @defgroup priority_events Priority Events
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct prio_high_event {
+	struct app_event_header header;
+
+	uint32_t submit_cycle;
+};
+
+APP_EVENT_TYPE_DECLARE(prio_high_event);
+
+struct prio_low_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(prio_low_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _PRIORITY_EVENTS_H_ */
@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "slab_event.h"
+
+APP_EVENT_TYPE_DEFINE(slab_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+
+APP_EVENT_TYPE_SLAB_DEFINE(slab_event, SLAB_EVENT_BLOCK_CNT);
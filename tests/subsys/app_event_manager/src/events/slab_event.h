@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SLAB_EVENT_H_
+#define _SLAB_EVENT_H_
+
+/**
+ * @brief Slab Event
+ * @defgroup slab_event Slab Event
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of events that can be allocated from the event type memory slab. */
+#define SLAB_EVENT_BLOCK_CNT 8
+
+struct slab_event {
+	struct app_event_header header;
+
+	uint32_t val[4];
+};
+
+APP_EVENT_TYPE_DECLARE(slab_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _SLAB_EVENT_H_ */
@@ -4,12 +4,16 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/ztest.h>
 #include <app_event_manager.h>
 
 #include "sized_events.h"
+#include "slab_event.h"
 #include "test_events.h"
 
+#define ALLOC_BENCHMARK_ITERATIONS 500
+
 static enum test_id cur_test_id;
 static K_SEM_DEFINE(test_end_sem, 0, 1);
 static bool expect_assert;
@@ -77,6 +81,11 @@ static void test_multicontext(void)
 	test_start(TEST_MULTICONTEXT);
 }
 
+static void test_priority(void)
+{
+	test_start(TEST_PRIORITY);
+}
+
 static void test_event_size_static(void)
 {
 	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROVIDE_EVENT_SIZE)) {
@@ -178,6 +187,113 @@ static void test_event_size_disabled(void)
 	app_event_manager_free(ev_s1);
 }
 
+static const struct app_event_slab *slab_event_slab_get(void)
+{
+	STRUCT_SECTION_FOREACH(app_event_slab, es) {
+		if (es->type == &__event_type_slab_event) {
+			return es;
+		}
+	}
+
+	return NULL;
+}
+
+struct alloc_benchmark_result {
+	uint32_t total_cycles;
+	uint32_t max_alloc_cycles;
+	uint32_t max_free_cycles;
+};
+
+static void alloc_benchmark_run(bool use_slab, struct alloc_benchmark_result *res)
+{
+	struct slab_event *events[SLAB_EVENT_BLOCK_CNT];
+	uint32_t start = k_cycle_get_32();
+
+	memset(res, 0, sizeof(*res));
+
+	for (size_t i = 0; i < ALLOC_BENCHMARK_ITERATIONS; i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(events); j++) {
+			uint32_t t = k_cycle_get_32();
+
+			events[j] = use_slab ? new_slab_event() :
+					       app_event_manager_alloc(sizeof(struct slab_event));
+			res->max_alloc_cycles = MAX(res->max_alloc_cycles, k_cycle_get_32() - t);
+			zassert_not_null(events[j], "Event allocation failed");
+			events[j]->header.type_id = &__event_type_slab_event;
+		}
+
+		for (size_t j = 0; j < ARRAY_SIZE(events); j++) {
+			uint32_t t = k_cycle_get_32();
+
+			app_event_manager_free(events[j]);
+			res->max_free_cycles = MAX(res->max_free_cycles, k_cycle_get_32() - t);
+		}
+	}
+
+	res->total_cycles = k_cycle_get_32() - start;
+
+	printk("%s: %d alloc/free pairs in %u us, worst alloc %u us, worst free %u us\n",
+	       use_slab ? "Slab" : "Heap",
+	       ALLOC_BENCHMARK_ITERATIONS * SLAB_EVENT_BLOCK_CNT,
+	       k_cyc_to_us_floor32(res->total_cycles),
+	       k_cyc_to_us_floor32(res->max_alloc_cycles),
+	       k_cyc_to_us_floor32(res->max_free_cycles));
+}
+
+static void test_event_slab_alloc(void)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	const struct app_event_slab *es = slab_event_slab_get();
+	struct slab_event *events[SLAB_EVENT_BLOCK_CNT + 1];
+
+	zassert_not_null(es, "Memory slab not defined");
+
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		events[i] = new_slab_event();
+		zassert_not_null(events[i], "Event allocation failed");
+	}
+
+	zassert_equal(k_mem_slab_num_used_get(es->slab), SLAB_EVENT_BLOCK_CNT,
+		      "Memory slab not fully used");
+	zassert_equal(atomic_get(&es->stats->max_used), SLAB_EVENT_BLOCK_CNT,
+		      "Invalid max used blocks");
+	zassert_equal(atomic_get(&es->stats->fallbacks), 1, "Invalid fallback count");
+	zassert_equal(atomic_get(&es->stats->failures), 0, "Invalid failure count");
+
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		app_event_manager_free(events[i]);
+	}
+
+	zassert_equal(k_mem_slab_num_used_get(es->slab), 0, "Memory slab blocks leaked");
+
+	/* Freeing NULL is a no-op, as with k_free(). */
+	zassert_false(app_event_manager_slab_free(NULL), "NULL freed from a slab");
+	app_event_manager_free(NULL);
+}
+
+static void test_event_slab_benchmark(void)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	const struct app_event_slab *es = slab_event_slab_get();
+	struct alloc_benchmark_result heap_res;
+	struct alloc_benchmark_result slab_res;
+	atomic_val_t fallbacks = atomic_get(&es->stats->fallbacks);
+
+	alloc_benchmark_run(false, &heap_res);
+	alloc_benchmark_run(true, &slab_res);
+
+	zassert_equal(atomic_get(&es->stats->fallbacks), fallbacks,
+		      "Unexpected fallback to heap");
+}
+
 void test_main(void)
 {
 	ztest_test_suite(app_event_manager_tests,
@@ -188,10 +304,13 @@ void test_main(void)
 			 ztest_unit_test(test_subs_order),
 			 ztest_unit_test(test_oom),
 			 ztest_unit_test(test_multicontext),
+			 ztest_unit_test(test_priority),
 			 ztest_unit_test(test_event_size_static),
 			 ztest_unit_test(test_event_size_dynamic),
 			 ztest_unit_test(test_event_size_dynamic_with_data),
-			 ztest_unit_test(test_event_size_disabled)
+			 ztest_unit_test(test_event_size_disabled),
+			 ztest_unit_test(test_event_slab_alloc),
+			 ztest_unit_test(test_event_slab_benchmark)
 			 );
 
 	ztest_run_test_suite(app_event_manager_tests);
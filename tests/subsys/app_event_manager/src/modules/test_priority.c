@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "priority_events.h"
+
+#define MODULE test_priority
+
+/* Flood of low priority events submitted before the high priority event. */
+#define LOW_EVENT_CNT			20
+#define LOW_EVENT_PROC_TIME_US		500
+/* The high priority event is submitted while the flood is being processed. */
+#define HIGH_EVENT_SUBMIT_DELAY_MS	2
+/* With per-priority queues, the high priority event waits at most for the
+ * low priority event that is currently being processed.
+ */
+#define HIGH_EVENT_MAX_LATENCY_US	(2 * LOW_EVENT_PROC_TIME_US)
+
+static atomic_t low_event_cnt;
+static atomic_t high_event_received;
+static atomic_t results_reported;
+static uint32_t high_event_latency_us;
+
+
+static void end_test(void)
+{
+	struct test_end_event *et = new_test_end_event();
+
+	et->test_id = TEST_PRIORITY;
+	APP_EVENT_SUBMIT(et);
+}
+
+static void report_results(void)
+{
+	/* Listeners of the high priority event may run in a dedicated work queue. */
+	if (!atomic_cas(&results_reported, false, true)) {
+		return;
+	}
+
+	printk("Submit-to-listener latency of high priority event: %" PRIu32 " us "
+	       "(%d low priority events, %d us each, priority queues %s)\n",
+	       high_event_latency_us, LOW_EVENT_CNT, LOW_EVENT_PROC_TIME_US,
+	       IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES) ? "enabled" : "disabled");
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_QUEUES)) {
+		zassert_true(high_event_latency_us <= HIGH_EVENT_MAX_LATENCY_US,
+			     "High priority event latency too big");
+	}
+
+	end_test();
+}
+
+static void timer_handler(struct k_timer *timer_id)
+{
+	struct prio_high_event *event = new_prio_high_event();
+
+	event->submit_cycle = k_cycle_get_32();
+	APP_EVENT_SUBMIT(event);
+}
+
+static K_TIMER_DEFINE(test_timer, timer_handler, NULL);
+
+static void priority_test_start(void)
+{
+	atomic_set(&low_event_cnt, 0);
+	atomic_set(&high_event_received, false);
+	atomic_set(&results_reported, false);
+
+	for (size_t i = 0; i < LOW_EVENT_CNT; i++) {
+		struct prio_low_event *event = new_prio_low_event();
+
+		event->val = i;
+		APP_EVENT_SUBMIT(event);
+	}
+
+	k_timer_start(&test_timer, K_MSEC(HIGH_EVENT_SUBMIT_DELAY_MS), K_NO_WAIT);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		switch (st->test_id) {
+		case TEST_PRIORITY:
+			priority_test_start();
+			break;
+
+		default:
+			/* Ignore other test cases, check if proper test_id. */
+			zassert_true(st->test_id < TEST_CNT,
+				     "test_id out of range");
+			break;
+		}
+
+		return false;
+	}
+
+	if (is_prio_high_event(aeh)) {
+		struct prio_high_event *event = cast_prio_high_event(aeh);
+
+		high_event_latency_us = k_cyc_to_us_floor32(k_cycle_get_32() -
+							    event->submit_cycle);
+		atomic_set(&high_event_received, true);
+
+		if (atomic_get(&low_event_cnt) == LOW_EVENT_CNT) {
+			report_results();
+		}
+
+		return false;
+	}
+
+	if (is_prio_low_event(aeh)) {
+		struct prio_low_event *event = cast_prio_low_event(aeh);
+
+		zassert_equal(event->val, atomic_get(&low_event_cnt), "Incorrect event order");
+
+		/* Simulate time consuming processing. */
+		k_busy_wait(LOW_EVENT_PROC_TIME_US);
+
+		if ((atomic_inc(&low_event_cnt) + 1 == LOW_EVENT_CNT) &&
+		    atomic_get(&high_event_received)) {
+			report_results();
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, prio_high_event);
+APP_EVENT_SUBSCRIBE(MODULE, prio_low_event);
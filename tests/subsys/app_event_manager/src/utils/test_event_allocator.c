@@ -7,6 +7,8 @@
 #include <zephyr/ztest.h>
 #include <zephyr/kernel.h>
 
+#include <app_event_manager.h>
+
 #include "test_event_allocator.h"
 
 static bool oom_expected;
@@ -30,5 +32,9 @@ void *app_event_manager_alloc(size_t size)
 
 void app_event_manager_free(void *addr)
 {
+	if (app_event_manager_slab_free(addr)) {
+		return;
+	}
+
 	k_free(addr);
 }
@@ -19,15 +19,38 @@ static struct bt_discover_mock {
 	struct bt_conn *conn;
 	struct bt_gatt_discover_params *params;
 	struct k_work_delayable work;
+	size_t cnt;
 } discover_mock_data;
 
+/* Settings of the read mock */
+static struct bt_read_mock {
+	const uint8_t *db_hash;
+	struct bt_conn *conn;
+	struct bt_gatt_read_params *params;
+	struct k_work_delayable work;
+} read_mock_data;
+
 static void bt_gatt_discover_work(struct k_work *work);
+static void bt_gatt_read_work(struct k_work *work);
 
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len)
 {
 	k_work_init_delayable(&discover_mock_data.work, bt_gatt_discover_work);
 	discover_mock_data.attr = attr;
 	discover_mock_data.len  = len;
+	discover_mock_data.cnt  = 0;
+
+	k_work_init_delayable(&read_mock_data.work, bt_gatt_read_work);
+}
+
+size_t bt_gatt_discover_mock_cnt_get(void)
+{
+	return discover_mock_data.cnt;
+}
+
+void bt_gatt_read_mock_db_hash_set(const uint8_t *db_hash)
+{
+	read_mock_data.db_hash = db_hash;
 }
 
 static bool bt_gatt_primary_check(const struct bt_gatt_attr *attr_cur,
@@ -128,7 +151,38 @@ int bt_gatt_discover(struct bt_conn *conn,
 	printk("Running %s mock\n", __func__);
 	discover_mock_data.conn = conn;
 	discover_mock_data.params = params;
+	discover_mock_data.cnt++;
 
 	k_work_schedule(&discover_mock_data.work, K_MSEC(5));
 	return 0;
 }
+
+static void bt_gatt_read_work(struct k_work *work)
+{
+	struct bt_gatt_read_params *params = read_mock_data.params;
+
+	zassert_equal(0, params->handle_count, "Only read by UUID is supported");
+	zassert_true(!bt_uuid_cmp(BT_UUID_GATT_DB_HASH, params->by_uuid.uuid),
+		     "Unexpected UUID read");
+
+	if (read_mock_data.db_hash) {
+		if (BT_GATT_ITER_STOP == params->func(read_mock_data.conn, 0, params,
+						      read_mock_data.db_hash, 16)) {
+			return;
+		}
+	}
+	/* Send NULL to mark processing end */
+	(void)params->func(read_mock_data.conn, 0, params, NULL, 0);
+}
+
+/* Mocked version of the bt_gatt_read */
+/* Only the Database Hash read by UUID is supported */
+int bt_gatt_read(struct bt_conn *conn, struct bt_gatt_read_params *params)
+{
+	printk("Running %s mock\n", __func__);
+	read_mock_data.conn = conn;
+	read_mock_data.params = params;
+
+	k_work_schedule(&read_mock_data.work, K_MSEC(5));
+	return 0;
+}
@@ -90,5 +90,20 @@
  */
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len);
 
+/**
+ * @brief Get the number of discovery requests
+ *
+ * @return The number of @ref bt_gatt_discover calls since the mock setup.
+ */
+size_t bt_gatt_discover_mock_cnt_get(void);
+
+/**
+ * @brief Set the Database Hash returned by the bt_gatt_read mock
+ *
+ * @param db_hash The Database Hash or NULL if the peer has no Database Hash
+ *                characteristic.
+ */
+void bt_gatt_read_mock_db_hash_set(const uint8_t *db_hash);
+
 /** @} */
 #endif /* #define BT_GATT_DISCOVERY_MOCK_H_ */
@@ -8,6 +8,8 @@
 #include <stddef.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/bluetooth/uuid.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/settings/settings.h>
 #include <bluetooth/gatt_dm.h>
 #include "../mock/gatt_discover_mock.h"
 
@@ -469,8 +471,155 @@ void test_gatt_many_serv_by_uuid(void)
 		      bt_gatt_dm_attr_cnt(dm));
 }
 
+#if CONFIG_BT_GATT_DM_CACHE
+static const bt_addr_le_t peer_addr = {
+	.type = BT_ADDR_LE_RANDOM,
+	.a.val = {0x01, 0x02, 0x03, 0x04, 0x05, 0xc6}
+};
+
+static const uint8_t db_hash[16] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+
+static const uint8_t db_hash_changed[16] = {
+	0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+
+static struct bt_conn_auth_info_cb *auth_info_cb;
+
+/* The connection object is a dummy, the connection API is wrapped. */
+int __wrap_bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
+{
+	memset(info, 0, sizeof(*info));
+	info->type = BT_CONN_TYPE_LE;
+	info->id = BT_ID_DEFAULT;
+	info->le.dst = &peer_addr;
+
+	return 0;
+}
+
+bool __wrap_bt_addr_le_is_bonded(uint8_t id, const bt_addr_le_t *addr)
+{
+	return true;
+}
+
+int __wrap_bt_conn_auth_info_cb_register(struct bt_conn_auth_info_cb *cb)
+{
+	auth_info_cb = cb;
+
+	return 0;
+}
+
+struct attr_desc {
+	uint16_t handle;
+	uint16_t uuid;
+};
+
+static size_t attrs_get(const struct bt_gatt_dm *dm, struct attr_desc *attrs, size_t size)
+{
+	const struct bt_gatt_dm_attr *attr = NULL;
+	size_t cnt = 0;
+
+	while ((attr = bt_gatt_dm_attr_next(dm, attr)) != NULL) {
+		zassert_true(cnt < size, "Too many attributes");
+		attrs[cnt].handle = attr->handle;
+		attrs[cnt].uuid = BT_UUID_16(attr->uuid)->val;
+		cnt++;
+	}
+
+	return cnt;
+}
+
+static struct bt_gatt_dm *run_dm_timed(const struct bt_uuid *svc_uuid, int64_t *time)
+{
+	int64_t start = k_uptime_get();
+	struct bt_gatt_dm *dm = run_dm(svc_uuid);
+
+	*time = k_uptime_delta(&start);
+
+	return dm;
+}
+
+void test_gatt_cache(void)
+{
+	struct attr_desc uncached[CONFIG_BT_GATT_DM_MAX_ATTRS];
+	struct attr_desc cached[CONFIG_BT_GATT_DM_MAX_ATTRS];
+	size_t uncached_cnt, cached_cnt;
+	size_t discover_cnt;
+	int64_t uncached_time, cached_time;
+	const struct bt_gatt_dm_attr *attr;
+	struct bt_gatt_dm *dm;
+
+	bt_gatt_read_mock_db_hash_set(db_hash);
+
+	/* Cache must be registered for bond removal. */
+	dm = run_dm(BT_UUID_DIS);
+	zassert_not_null(dm, "Device Manager pointer not set");
+	bt_gatt_dm_data_release(dm);
+	zassert_not_null(auth_info_cb, "Bond callbacks not registered");
+
+	/* Remove the data cached by a previous run. */
+	auth_info_cb->bond_deleted(BT_ID_DEFAULT, &peer_addr);
+
+	/* Full discovery, the results are stored. */
+	discover_cnt = bt_gatt_discover_mock_cnt_get();
+	dm = run_dm_timed(BT_UUID_HIDS, &uncached_time);
+	zassert_not_null(dm, "Device Manager pointer not set");
+	zassert_true(bt_gatt_discover_mock_cnt_get() > discover_cnt, "No discovery run");
+	discover_cnt = bt_gatt_discover_mock_cnt_get() - discover_cnt;
+	uncached_cnt = attrs_get(dm, uncached, ARRAY_SIZE(uncached));
+	bt_gatt_dm_data_release(dm);
+
+	/* Database Hash not changed, the stored results are used. */
+	dm = run_dm_timed(BT_UUID_HIDS, &cached_time);
+	zassert_not_null(dm, "Device Manager pointer not set");
+	cached_cnt = attrs_get(dm, cached, ARRAY_SIZE(cached));
+
+	printk("HIDS discovery: %lld ms (%zu requests), from cache: %lld ms\n",
+	       uncached_time, discover_cnt, cached_time);
+
+	zassert_equal(uncached_cnt, cached_cnt, "Unexpected number of cached attributes");
+	zassert_mem_equal(uncached, cached, uncached_cnt * sizeof(uncached[0]),
+			  "Cached attributes differ");
+	zassert_true(cached_time < uncached_time, "Cached discovery not faster");
+
+	attr = bt_gatt_dm_char_by_uuid(dm, BT_UUID_HIDS_REPORT);
+	zassert_not_null(attr, "Cached characteristic not found");
+	zassert_equal(BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY,
+		      bt_gatt_dm_attr_chrc_val(attr)->properties,
+		      "Invalid cached characteristic properties");
+	zassert_not_null(bt_gatt_dm_desc_by_uuid(dm, attr, BT_UUID_GATT_CCC),
+			 "Cached descriptor not found");
+	bt_gatt_dm_data_release(dm);
+
+	/* Database Hash changed, the service is discovered again. */
+	bt_gatt_read_mock_db_hash_set(db_hash_changed);
+	discover_cnt = bt_gatt_discover_mock_cnt_get();
+	dm = run_dm(BT_UUID_HIDS);
+	zassert_not_null(dm, "Device Manager pointer not set");
+	zassert_true(bt_gatt_discover_mock_cnt_get() > discover_cnt,
+		     "Discovery not run for changed database");
+	bt_gatt_dm_data_release(dm);
+
+	auth_info_cb->bond_deleted(BT_ID_DEFAULT, &peer_addr);
+	bt_gatt_read_mock_db_hash_set(NULL);
+}
+#else
+void test_gatt_cache(void)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 void test_main(void)
 {
+	if (IS_ENABLED(CONFIG_BT_GATT_DM_CACHE)) {
+		/* The cache test fails if the settings are not available. */
+		(void)settings_subsys_init();
+	}
+
 	ztest_test_suite(
 		test_gatt,
 		ztest_unit_test_setup_teardown(test_gatt_none_serv, test_setup, unit_test_noop),
@@ -486,6 +635,7 @@ void test_main(void)
 					       unit_test_noop),
 		ztest_unit_test_setup_teardown(test_gatt_HIDS_chrc_by_uuid, test_setup,
 					       unit_test_noop),
+		ztest_unit_test_setup_teardown(test_gatt_cache, test_setup, unit_test_noop),
 		ztest_unit_test_setup_teardown(test_gatt_generic_serv, test_setup, unit_test_noop),
 		ztest_unit_test_setup_teardown(test_gatt_many_serv_by_uuid, test_setup,
 					       unit_test_noop)
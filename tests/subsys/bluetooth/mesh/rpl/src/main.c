@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/random/rand32.h>
+#include <zephyr/bluetooth/mesh.h>
+#include <mesh/net.h>
+#include <mesh/rpl.h>
+
+#define SRC_FIRST 0x0001
+#define BENCH_ROUNDS 32
+
+static bool rpl_check(uint16_t src, uint32_t seq, bool old_iv)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = src,
+		.seq = seq,
+		.old_iv = old_iv,
+		.net_if = BT_MESH_NET_IF_ADV,
+		.local_match = 1,
+	};
+
+	return bt_mesh_rpl_check(&rx, NULL);
+}
+
+static void fill(void)
+{
+	for (uint16_t i = 0; i < CONFIG_BT_MESH_CRPL; i++) {
+		zassert_false(rpl_check(SRC_FIRST + i, 1, false), "Source %u rejected", i);
+	}
+}
+
+static void setup(void)
+{
+	bt_mesh_rpl_clear();
+}
+
+static void teardown(void)
+{
+}
+
+static void test_replay(void)
+{
+	zassert_false(rpl_check(SRC_FIRST, 10, false), "New source rejected");
+	zassert_true(rpl_check(SRC_FIRST, 10, false), "Replay accepted");
+	zassert_true(rpl_check(SRC_FIRST, 9, false), "Older sequence accepted");
+	zassert_false(rpl_check(SRC_FIRST, 11, false), "Newer sequence rejected");
+	zassert_false(rpl_check(SRC_FIRST + 1, 1, false), "Other source rejected");
+}
+
+static void test_local(void)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = SRC_FIRST,
+		.seq = 1,
+		.net_if = BT_MESH_NET_IF_LOCAL,
+		.local_match = 1,
+	};
+
+	zassert_false(bt_mesh_rpl_check(&rx, NULL), "Local message rejected");
+	zassert_false(bt_mesh_rpl_check(&rx, NULL), "Local message rejected");
+
+	rx.net_if = BT_MESH_NET_IF_ADV;
+	rx.local_match = 0;
+
+	zassert_false(bt_mesh_rpl_check(&rx, NULL), "Relayed message rejected");
+	zassert_false(bt_mesh_rpl_check(&rx, NULL), "Relayed message rejected");
+}
+
+static void test_match(void)
+{
+	struct bt_mesh_net_rx rx = {
+		.ctx.addr = SRC_FIRST,
+		.seq = 5,
+		.net_if = BT_MESH_NET_IF_ADV,
+		.local_match = 1,
+	};
+	struct bt_mesh_rpl *rpl = NULL;
+
+	zassert_false(bt_mesh_rpl_check(&rx, &rpl), "New source rejected");
+	zassert_not_null(rpl, "No match");
+
+	/* Slot is not updated until requested. */
+	zassert_false(rpl_check(SRC_FIRST, 5, false), "Source rejected before update");
+	zassert_true(rpl_check(SRC_FIRST, 5, false), "Replay accepted");
+
+	rx.seq = 6;
+	rpl = NULL;
+	zassert_false(bt_mesh_rpl_check(&rx, &rpl), "Newer sequence rejected");
+	zassert_not_null(rpl, "No match");
+	bt_mesh_rpl_update(rpl, &rx);
+	zassert_true(rpl_check(SRC_FIRST, 6, false), "Replay accepted");
+}
+
+static void test_full(void)
+{
+	fill();
+
+	for (uint16_t i = 0; i < CONFIG_BT_MESH_CRPL; i++) {
+		zassert_true(rpl_check(SRC_FIRST + i, 1, false), "Replay of %u accepted", i);
+	}
+
+#if defined(CONFIG_BT_MESH_RPL_FULL_EVICT_LRU)
+	/* Make the first source the most recently used one. */
+	zassert_false(rpl_check(SRC_FIRST, 2, false), "Newer sequence rejected");
+	zassert_false(rpl_check(SRC_FIRST + CONFIG_BT_MESH_CRPL, 1, false),
+		      "New source rejected");
+
+	/* The second source was evicted, the others are kept. */
+	zassert_false(rpl_check(SRC_FIRST + 1, 1, false), "Evicted source rejected");
+	zassert_true(rpl_check(SRC_FIRST, 2, false), "Replay accepted");
+	zassert_true(rpl_check(SRC_FIRST + CONFIG_BT_MESH_CRPL, 1, false), "Replay accepted");
+
+	for (uint16_t i = 3; i < CONFIG_BT_MESH_CRPL; i++) {
+		zassert_true(rpl_check(SRC_FIRST + i, 1, false), "Replay of %u accepted", i);
+	}
+#else
+	zassert_true(rpl_check(SRC_FIRST + CONFIG_BT_MESH_CRPL, 1, false),
+		     "New source accepted in full RPL");
+#endif
+}
+
+static void test_reset(void)
+{
+	fill();
+
+	/* Refresh every other source on the new IV index. */
+	bt_mesh_rpl_reset();
+
+	for (uint16_t i = 0; i < CONFIG_BT_MESH_CRPL; i += 2) {
+		zassert_false(rpl_check(SRC_FIRST + i, 1, false), "New IV index rejected");
+	}
+
+	/* Sources not heard since the previous reset are removed. */
+	bt_mesh_rpl_reset();
+
+	for (uint16_t i = 0; i < CONFIG_BT_MESH_CRPL; i++) {
+		if (i % 2) {
+			zassert_false(rpl_check(SRC_FIRST + i, 1, false), "Removed source rejected");
+		} else {
+			zassert_true(rpl_check(SRC_FIRST + i, 1, true), "Replay accepted");
+		}
+	}
+}
+
+static void test_benchmark(void)
+{
+	static uint16_t srcs[CONFIG_BT_MESH_CRPL];
+	uint32_t seq = 1;
+	uint64_t cycles = 0;
+	uint32_t max = 0;
+	uint32_t cnt = 0;
+
+	for (uint16_t i = 0; i < ARRAY_SIZE(srcs); i++) {
+		srcs[i] = SRC_FIRST + i;
+	}
+
+	for (int round = 0; round < BENCH_ROUNDS; round++, seq++) {
+		/* Shuffle the order in which the sources are heard. */
+		for (size_t i = ARRAY_SIZE(srcs) - 1; i > 0; i--) {
+			size_t j = sys_rand32_get() % (i + 1);
+			uint16_t tmp = srcs[i];
+
+			srcs[i] = srcs[j];
+			srcs[j] = tmp;
+		}
+
+		for (size_t i = 0; i < ARRAY_SIZE(srcs); i++) {
+			uint32_t start = k_cycle_get_32();
+			bool replay = rpl_check(srcs[i], seq, false);
+			uint32_t time = k_cycle_get_32() - start;
+
+			zassert_false(replay, "Source 0x%04x rejected", srcs[i]);
+			cycles += time;
+			max = MAX(max, time);
+			cnt++;
+		}
+	}
+
+	TC_PRINT("RPL check of %u sources: %u checks, avg %u cycles, max %u cycles\n",
+		 CONFIG_BT_MESH_CRPL, cnt, (uint32_t)(cycles / cnt), max);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(rpl_test,
+		ztest_unit_test_setup_teardown(test_replay, setup, teardown),
+		ztest_unit_test_setup_teardown(test_local, setup, teardown),
+		ztest_unit_test_setup_teardown(test_match, setup, teardown),
+		ztest_unit_test_setup_teardown(test_full, setup, teardown),
+		ztest_unit_test_setup_teardown(test_reset, setup, teardown),
+		ztest_unit_test_setup_teardown(test_benchmark, setup, teardown)
+		);
+
+	ztest_run_test_suite(rpl_test);
+}
@@ -2437,9 +2437,129 @@ static void test_present_rel_output_ripple_voltage(void)
 	percentage8_check(sensor_type);
 }
 
+/* Sensor type lookup */
+
+/* Type defined outside of the sensor module, sorted in between the module's
+ * own types.
+ */
+BT_MESH_SENSOR_TYPE_DEFINE(test_custom, 0x0006) = {
+	.id = 0x0006,
+	.channel_count = 1,
+	.channels = (const struct bt_mesh_sensor_channel[]){
+		{ .format = &bt_mesh_sensor_format_percentage_8 },
+	},
+};
+
+#define SERIES_COLUMNS 64
+#define BENCH_ROUNDS 16
+
+static const struct bt_mesh_sensor_type *linear_type_get(uint16_t id)
+{
+	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+		if (type->id == id) {
+			return type;
+		}
+	}
+
+	return NULL;
+}
+
+static void test_type_lookup(void)
+{
+	uint16_t prev_id = 0;
+	int cnt = 0;
+
+	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+		zassert_true(cnt == 0 || type->id > prev_id,
+			     "Type 0x%04x not sorted after 0x%04x", type->id, prev_id);
+		zassert_equal_ptr(bt_mesh_sensor_type_get(type->id), type,
+				  "Type 0x%04x not found", type->id);
+		prev_id = type->id;
+		cnt++;
+	}
+
+	zassert_true(cnt > 0, "No sensor types");
+	zassert_equal_ptr(bt_mesh_sensor_type_get(0x0006), &bt_mesh_sensor_test_custom,
+			  "Custom type not found");
+	zassert_is_null(bt_mesh_sensor_type_get(0x0000), "Prohibited ID found");
+	zassert_is_null(bt_mesh_sensor_type_get(0xffff), "Prohibited ID found");
+}
+
+static uint32_t series_bench(const struct bt_mesh_sensor_type *(*type_get)(uint16_t id))
+{
+	NET_BUF_SIMPLE_DEFINE(buf, 2 + SERIES_COLUMNS * 8);
+	const struct bt_mesh_sensor_type *type;
+	const struct bt_mesh_sensor_format *col_format;
+	struct bt_mesh_sensor_column col;
+	struct sensor_value value[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+	uint32_t start = k_cycle_get_32();
+	uint16_t id;
+	int err;
+
+	/* Encode a Sensor Series Status message, looking up the type per column
+	 * the way the Sensor Server does.
+	 */
+	net_buf_simple_add_le16(&buf, BT_MESH_PROP_ID_REL_RUNTIME_IN_A_DEV_OP_TEMP_RANGE);
+
+	for (int i = 0; i < SERIES_COLUMNS; i++) {
+		struct sensor_value col_start = { .val1 = i };
+		struct sensor_value width = { .val1 = 1 };
+
+		type = type_get(BT_MESH_PROP_ID_REL_RUNTIME_IN_A_DEV_OP_TEMP_RANGE);
+		zassert_not_null(type, "Type not found");
+		col_format = bt_mesh_sensor_column_format_get(type);
+
+		value[0] = (struct sensor_value){ .val1 = i % 100 };
+		value[1] = (struct sensor_value){ .val1 = i };
+		value[2] = (struct sensor_value){ .val1 = i + 1 };
+
+		err = sensor_ch_encode(&buf, col_format, &col_start);
+		zassert_ok(err, "Encoding column start failed (err: %d)", err);
+		err = sensor_ch_encode(&buf, col_format, &width);
+		zassert_ok(err, "Encoding column width failed (err: %d)", err);
+		err = sensor_value_encode(&buf, type, value);
+		zassert_ok(err, "Encoding column value failed (err: %d)", err);
+	}
+
+	/* Decode it the way the Sensor Client does. */
+	id = net_buf_simple_pull_le16(&buf);
+
+	for (int i = 0; i < SERIES_COLUMNS; i++) {
+		type = type_get(id);
+		zassert_not_null(type, "Type not found");
+
+		err = sensor_column_decode(&buf, type, &col, value);
+		zassert_ok(err, "Decoding column failed (err: %d)", err);
+		zassert_equal(col.start.val1, i, "Invalid column start");
+		zassert_equal(value[0].val1, i % 100, "Invalid column value");
+	}
+
+	zassert_equal(buf.len, 0, "Unexpected data left");
+
+	return k_cycle_get_32() - start;
+}
+
+static void test_series_benchmark(void)
+{
+	uint32_t linear = 0;
+	uint32_t indexed = 0;
+
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		linear += series_bench(linear_type_get);
+		indexed += series_bench(bt_mesh_sensor_type_get);
+	}
+
+	TC_PRINT("Series Status with %u columns: linear lookup %u cycles, "
+		 "indexed lookup %u cycles\n",
+		 SERIES_COLUMNS, linear / BENCH_ROUNDS, indexed / BENCH_ROUNDS);
+}
+
 void test_main(void)
 {
 	ztest_test_suite(sensor_types_test,
+			/* Sensor type lookup */
+			ztest_unit_test(test_type_lookup),
+			ztest_unit_test(test_series_benchmark),
 			/* Occupancy sensors */
 			ztest_unit_test(test_motion_sensor),
 			ztest_unit_test(test_motion_threshold),
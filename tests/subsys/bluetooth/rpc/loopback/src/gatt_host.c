@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Host serializer of the GATT API, built in the same image as the client
+ * serializer. The host uses its own nRF RPC group, on the transport connected
+ * to the one of the client group. The functions that both serializers define
+ * are renamed, and the Bluetooth stack calls of the tested commands go to the
+ * fake stack of the test. Other stack calls resolve to the client serializer
+ * and are not used by the test.
+ */
+
+#define bt_rpc_grp bt_rpc_host_grp
+
+#define bt_rpc_encode_gatt_attr host_bt_rpc_encode_gatt_attr
+#define bt_rpc_decode_gatt_attr host_bt_rpc_decode_gatt_attr
+#define bt_rpc_gatt_subscribe_flag_set host_bt_rpc_gatt_subscribe_flag_set
+#define bt_rpc_gatt_subscribe_flag_clear host_bt_rpc_gatt_subscribe_flag_clear
+#define bt_rpc_gatt_subscribe_flag_get host_bt_rpc_gatt_subscribe_flag_get
+
+#define bt_gatt_subscribe stack_bt_gatt_subscribe
+#define bt_gatt_get_mtu stack_bt_gatt_get_mtu
+
+#include <bt_rpc_gatt_host.c>
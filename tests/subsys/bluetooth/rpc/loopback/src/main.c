@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/logging/log.h>
+
+#include <nrf_rpc.h>
+#include <nrf_rpc_tr.h>
+#include <nrf_rpc_os.h>
+#include <nrf_rpc_cbor.h>
+
+#include "bt_rpc_common.h"
+#include "serialize.h"
+#include "bt_rpc_stats.h"
+
+LOG_MODULE_REGISTER(BT_RPC, CONFIG_BT_RPC_LOG_LEVEL);
+
+/* Command of the test, handled by the same image that sends it. */
+#define TEST_ADV_DATA_RPC_CMD 0x01
+
+#define TEST_DATA_LEN      200
+#define TEST_TIMEOUT       K_SECONDS(5)
+#define TEST_BUF_SIZE      (TEST_DATA_LEN + 32)
+#define TEST_MTU           247
+#define TEST_VALUE_HANDLE  0x0010
+#define TEST_CCC_HANDLE    0x0011
+
+/* Loopback transport: every packet sent is received from the peer transport,
+ * by a receive thread like the one of the IPC transport.
+ */
+struct loopback_packet {
+	void *fifo_reserved;
+	size_t len;
+	uint8_t data[];
+};
+
+struct loopback {
+	const struct nrf_rpc_tr *transport;
+	const struct nrf_rpc_tr *peer;
+	struct k_fifo *fifo;
+	nrf_rpc_tr_receive_handler_t receive_cb;
+	void *context;
+
+	/* Packet being received, the in-place decoded data must point into it. */
+	const uint8_t *rx_packet;
+	size_t rx_packet_len;
+};
+
+static int loopback_init(const struct nrf_rpc_tr *transport,
+			 nrf_rpc_tr_receive_handler_t receive_cb, void *context)
+{
+	struct loopback *loopback = transport->ctx;
+
+	loopback->receive_cb = receive_cb;
+	loopback->context = context;
+
+	return 0;
+}
+
+static int loopback_send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
+{
+	struct loopback *peer = ((struct loopback *)transport->ctx)->peer->ctx;
+	struct loopback_packet *packet = CONTAINER_OF(data, struct loopback_packet, data);
+
+	packet->len = length;
+	k_fifo_put(peer->fifo, packet);
+
+	return 0;
+}
+
+static void *loopback_tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
+{
+	struct loopback_packet *packet = k_malloc(sizeof(*packet) + *size);
+
+	zassert_not_null(packet, "Out of memory");
+
+	return packet->data;
+}
+
+static void loopback_tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
+{
+	k_free(CONTAINER_OF(buf, struct loopback_packet, data));
+}
+
+static const struct nrf_rpc_tr_api loopback_api = {
+	.init = loopback_init,
+	.send = loopback_send,
+	.tx_buf_alloc = loopback_tx_buf_alloc,
+	.tx_buf_free = loopback_tx_buf_free,
+};
+
+static void loopback_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct loopback *loopback = arg1;
+	struct loopback_packet *packet;
+
+	while (true) {
+		packet = k_fifo_get(loopback->fifo, K_FOREVER);
+
+		loopback->rx_packet = packet->data;
+		loopback->rx_packet_len = packet->len;
+
+		nrf_rpc_os_rx_begin(loopback->transport);
+		loopback->receive_cb(loopback->transport, packet->data, packet->len,
+				     loopback->context);
+		nrf_rpc_os_rx_end();
+
+		loopback->rx_packet = NULL;
+		k_free(packet);
+	}
+}
+
+#define LOOPBACK_DEFINE(_name, _peer)							\
+	static const struct nrf_rpc_tr _name;						\
+	static K_FIFO_DEFINE(_name##_fifo);						\
+	static struct loopback _name##_loopback = {					\
+		.transport = &_name,							\
+		.peer = &_peer,								\
+		.fifo = &_name##_fifo,							\
+	};										\
+	static const struct nrf_rpc_tr _name = {					\
+		.api = &loopback_api,							\
+		.ctx = &_name##_loopback,						\
+	};										\
+	K_THREAD_DEFINE(_name##_thread, 2048, loopback_thread_fn, &_name##_loopback,	\
+			NULL, NULL, K_PRIO_COOP(CONFIG_NUM_COOP_PRIORITIES - 1), 0, 0)
+
+/* Transport of the test group, connected to itself. */
+LOOPBACK_DEFINE(test_tr, test_tr);
+
+/* Transports of the client and host groups of the GATT serializers, connected
+ * to each other.
+ */
+static const struct nrf_rpc_tr host_tr;
+LOOPBACK_DEFINE(cli_tr, host_tr);
+LOOPBACK_DEFINE(host_tr, cli_tr);
+
+NRF_RPC_GROUP_DEFINE(test_grp, "bt_rpc_test", &test_tr, NULL, NULL, NULL);
+NRF_RPC_GROUP_DEFINE(bt_rpc_grp, "bt_rpc", &cli_tr, NULL, NULL, NULL);
+NRF_RPC_GROUP_DEFINE(bt_rpc_host_grp, "bt_rpc", &host_tr, NULL, NULL, NULL);
+
+/* Callback proxies are not used by the test. */
+void *cbkproxy_out_get(int index, void *handler)
+{
+	return NULL;
+}
+
+int cbkproxy_in_set(void *callback)
+{
+	return -1;
+}
+
+void *cbkproxy_in_get(int index)
+{
+	return NULL;
+}
+
+/* The test has a single connection, encoded by its index like by the
+ * connection serializers. Other indexes are decoded as NULL.
+ */
+static uint8_t test_conn_obj;
+#define TEST_CONN ((struct bt_conn *)&test_conn_obj)
+
+void bt_rpc_encode_bt_conn(struct nrf_rpc_cbor_ctx *encoder, const struct bt_conn *conn)
+{
+	ser_encode_uint(encoder, (conn == TEST_CONN) ? 0 : 1);
+}
+
+struct bt_conn *bt_rpc_decode_bt_conn(struct nrf_rpc_cbor_ctx *ctx)
+{
+	return (ser_decode_uint(ctx) == 0) ? TEST_CONN : NULL;
+}
+
+/* Bluetooth stack on the host, called by the host serializer. */
+static struct bt_gatt_subscribe_params *stack_subscribe_params;
+
+int stack_bt_gatt_subscribe(struct bt_conn *conn, struct bt_gatt_subscribe_params *params)
+{
+	stack_subscribe_params = params;
+
+	return 0;
+}
+
+uint16_t stack_bt_gatt_get_mtu(struct bt_conn *conn)
+{
+	return (conn == TEST_CONN) ? TEST_MTU : 0;
+}
+
+static uint8_t test_data[TEST_DATA_LEN];
+static const uint8_t *decoded_data;
+static bool decoded_in_packet;
+static bool decoded_equal;
+static struct bt_conn *notify_conn;
+static uint16_t notify_mtu;
+static uint8_t notify_result;
+static K_SEM_DEFINE(notify_done, 0, 1);
+
+static void data_cmd_send(uint8_t cmd)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	int result = -1;
+
+	NRF_RPC_CBOR_ALLOC(&test_grp, ctx, TEST_BUF_SIZE);
+
+	ser_encode_uint(&ctx, SCRATCHPAD_ALIGN(sizeof(test_data)));
+	ser_encode_buffer(&ctx, test_data, sizeof(test_data));
+
+	nrf_rpc_cbor_cmd_no_err(&test_grp, cmd, &ctx, ser_rsp_decode_i32, &result);
+
+	zassert_equal(result, 0, "Command %u failed", cmd);
+}
+
+static void decoded_data_check(const struct loopback *loopback, const uint8_t *data, size_t len)
+{
+	const uint8_t *packet = loopback->rx_packet;
+
+	decoded_data = data;
+	decoded_in_packet = (packet != NULL) && (data >= packet) &&
+			    (data + len <= packet + loopback->rx_packet_len);
+	decoded_equal = (len == sizeof(test_data)) && (memcmp(data, test_data, len) == 0);
+}
+
+static void buffers_check(const struct bt_rpc_stats_buffers *before, uint32_t copied,
+			  uint32_t in_place)
+{
+	struct bt_rpc_stats_buffers after;
+
+	bt_rpc_stats_buffers_get(&after);
+
+	zassert_equal(after.copied_bytes - before->copied_bytes, copied,
+		      "Copied %u bytes, expected %u", after.copied_bytes - before->copied_bytes,
+		      copied);
+	zassert_equal(after.copied_cnt - before->copied_cnt, copied ? 1 : 0,
+		      "Wrong number of copied buffers");
+	zassert_equal(after.in_place_bytes - before->in_place_bytes, in_place,
+		      "Referenced %u bytes in place, expected %u",
+		      after.in_place_bytes - before->in_place_bytes, in_place);
+	zassert_equal(after.in_place_cnt - before->in_place_cnt, in_place ? 1 : 0,
+		      "Wrong number of buffers referenced in place");
+}
+
+/* Like the advertising data handlers on the host: the data is only passed to a
+ * call that does not wait for other commands.
+ */
+static void test_adv_data_rpc_handler(const struct nrf_rpc_group *group,
+				      struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct ser_scratchpad scratchpad;
+	uint8_t *data;
+	size_t len;
+
+	SER_SCRATCHPAD_DECLARE(&scratchpad, ctx);
+
+	data = ser_decode_buffer_in_place(&scratchpad, &len);
+
+	if (!ser_decoding_done_and_keep(group, ctx)) {
+		ser_rsp_send_int(group, -EBADMSG);
+		return;
+	}
+
+	decoded_data_check(&test_tr_loopback, data, len);
+
+	ser_decoding_release(group, ctx);
+	ser_rsp_send_int(group, 0);
+}
+
+BT_RPC_CMD_DECODER(test_grp, test_adv_data, TEST_ADV_DATA_RPC_CMD,
+		   test_adv_data_rpc_handler, NULL);
+
+/* Notification callback of the application on the client. It calls the API
+ * again, which is handled by the host while the notification is in progress.
+ */
+static uint8_t notify_func(struct bt_conn *conn, struct bt_gatt_subscribe_params *params,
+			   const void *data, uint16_t length)
+{
+	decoded_data_check(&cli_tr_loopback, data, length);
+
+	notify_conn = conn;
+	notify_mtu = bt_gatt_get_mtu(conn);
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+static struct bt_gatt_subscribe_params subscribe_params;
+
+/* Notification received by the Bluetooth stack on the host. */
+static void notify_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	notify_result = stack_subscribe_params->notify(TEST_CONN, stack_subscribe_params,
+						       test_data, sizeof(test_data));
+	k_sem_give(&notify_done);
+}
+
+K_THREAD_STACK_DEFINE(notify_thread_stack, 2048);
+static struct k_thread notify_thread;
+
+static void *suite_setup(void)
+{
+	for (size_t i = 0; i < sizeof(test_data); i++) {
+		test_data[i] = i;
+	}
+
+	zassert_ok(nrf_rpc_init(NULL), "nRF RPC init failed");
+
+	return NULL;
+}
+
+static void before_each(void *fixture)
+{
+	decoded_data = NULL;
+	decoded_in_packet = false;
+	decoded_equal = false;
+	notify_conn = NULL;
+	notify_mtu = 0;
+	notify_result = BT_GATT_ITER_STOP;
+}
+
+ZTEST(bt_rpc_loopback, test_adv_data_in_place)
+{
+	struct bt_rpc_stats_buffers before;
+	bool in_place = IS_ENABLED(CONFIG_BT_RPC_ADV_DATA_IN_PLACE);
+
+	bt_rpc_stats_buffers_get(&before);
+
+	data_cmd_send(TEST_ADV_DATA_RPC_CMD);
+
+	zassert_not_null(decoded_data, "Handler not called");
+	zassert_true(decoded_equal, "Wrong data");
+	zassert_equal(decoded_in_packet, in_place,
+		      "Data %s the received packet", decoded_in_packet ? "in" : "not in");
+
+	buffers_check(&before, in_place ? 0 : TEST_DATA_LEN, in_place ? TEST_DATA_LEN : 0);
+}
+
+/* A GATT notification goes through the host and the client serializers. Its
+ * data is copied whether or not the advertising data is decoded in place, so
+ * that the notification callback can call the API.
+ */
+ZTEST(bt_rpc_loopback, test_gatt_notification)
+{
+	struct bt_rpc_stats_buffers before;
+
+	subscribe_params.notify = notify_func;
+	subscribe_params.value_handle = TEST_VALUE_HANDLE;
+	subscribe_params.ccc_handle = TEST_CCC_HANDLE;
+	subscribe_params.value = BT_GATT_CCC_NOTIFY;
+
+	zassert_ok(bt_gatt_subscribe(TEST_CONN, &subscribe_params), "Subscribe failed");
+	zassert_not_null(stack_subscribe_params, "Host did not subscribe");
+	zassert_not_null(stack_subscribe_params->notify, "No notify callback on host");
+	zassert_equal(stack_subscribe_params->value_handle, TEST_VALUE_HANDLE,
+		      "Wrong value handle");
+
+	bt_rpc_stats_buffers_get(&before);
+
+	k_thread_create(&notify_thread, notify_thread_stack,
+			K_THREAD_STACK_SIZEOF(notify_thread_stack), notify_thread_fn,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	zassert_ok(k_sem_take(&notify_done, TEST_TIMEOUT), "Notification deadlocked");
+	k_thread_join(&notify_thread, K_FOREVER);
+
+	zassert_equal(notify_result, BT_GATT_ITER_CONTINUE, "Wrong callback result");
+	zassert_equal(notify_conn, TEST_CONN, "Wrong connection");
+	zassert_true(decoded_equal, "Wrong data");
+	zassert_false(decoded_in_packet, "Callback called with data in the received packet");
+	zassert_equal(notify_mtu, TEST_MTU, "API call from the callback failed");
+
+	buffers_check(&before, TEST_DATA_LEN, 0);
+}
+
+ZTEST_SUITE(bt_rpc_loopback, NULL, suite_setup, before_each, NULL, NULL);
@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <stdio.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <bluetooth/scan.h>
+
+/* Number of advertising reports replayed in the benchmark. */
+#define REPLAY_REPORT_CNT 20000
+
+/* Every n-th replayed report comes from an address on the allow list. */
+#define REPLAY_ALLOWED_ADDR_PERIOD 8
+
+/* Filters that match none of the replayed reports are named like this. */
+#define FILTER_NAME_FMT "Sensor-%04u"
+
+static struct bt_le_scan_cb *lib_scan_cb;
+
+static struct {
+	size_t match_cnt;
+	size_t no_match_cnt;
+	struct bt_scan_filter_match status;
+} result;
+
+void __real_bt_le_scan_cb_register(struct bt_le_scan_cb *cb);
+
+void __wrap_bt_le_scan_cb_register(struct bt_le_scan_cb *cb)
+{
+	lib_scan_cb = cb;
+	__real_bt_le_scan_cb_register(cb);
+}
+
+static void scan_filter_match(struct bt_scan_device_info *device_info,
+			      struct bt_scan_filter_match *filter_match,
+			      bool connectable)
+{
+	result.match_cnt++;
+	result.status = *filter_match;
+}
+
+static void scan_filter_no_match(struct bt_scan_device_info *device_info,
+				 bool connectable)
+{
+	result.no_match_cnt++;
+}
+
+BT_SCAN_CB_INIT(scan_cb, scan_filter_match, scan_filter_no_match, NULL, NULL);
+
+/* Advertising payloads recorded in a crowded environment. */
+static const uint8_t adv_ibeacon[] = {
+	0x02, BT_DATA_FLAGS, 0x06,
+	0x1a, BT_DATA_MANUFACTURER_DATA, 0x4c, 0x00, 0x02, 0x15,
+	0xf7, 0x82, 0x6d, 0xa6, 0x4f, 0xa2, 0x4e, 0x98,
+	0x80, 0x24, 0xbc, 0x5b, 0x71, 0xe0, 0x89, 0x3e,
+	0x00, 0x01, 0x00, 0x02, 0xc5,
+};
+
+static const uint8_t adv_exposure_notification[] = {
+	0x02, BT_DATA_FLAGS, 0x1a,
+	0x03, BT_DATA_UUID16_ALL, 0x6f, 0xfd,
+	0x17, BT_DATA_SVC_DATA16, 0x6f, 0xfd,
+	0x3e, 0x1a, 0x95, 0x27, 0x4a, 0x55, 0x09, 0xa2,
+	0x6c, 0x3d, 0x63, 0x2a, 0x7b, 0x2c, 0xe8, 0x41,
+	0x40, 0x6e, 0x51, 0x2f,
+};
+
+static const uint8_t adv_keyboard[] = {
+	0x02, BT_DATA_FLAGS, 0x05,
+	0x03, BT_DATA_GAP_APPEARANCE, 0xc1, 0x03,
+	0x05, BT_DATA_UUID16_ALL, 0x12, 0x18, 0x0f, 0x18,
+	0x0e, BT_DATA_NAME_COMPLETE, 'K', 'e', 'y', 'b', 'o', 'a', 'r', 'd',
+	' ', 'K', '3', '8', '0',
+};
+
+static const uint8_t adv_mouse[] = {
+	0x02, BT_DATA_FLAGS, 0x06,
+	0x03, BT_DATA_GAP_APPEARANCE, 0xc2, 0x03,
+	0x03, BT_DATA_UUID16_ALL, 0x12, 0x18,
+	0x0a, BT_DATA_NAME_SHORTENED, 'n', 'R', 'F', ' ', 'D', 'e', 's', 'k', 't',
+};
+
+static const uint8_t adv_lbs[] = {
+	0x02, BT_DATA_FLAGS, 0x06,
+	0x11, BT_DATA_UUID128_ALL,
+	BT_UUID_128_ENCODE(0x00001523, 0x1212, 0xefde, 0x1523, 0x785feabcd123),
+	0x0b, BT_DATA_NAME_COMPLETE, 'N', 'o', 'r', 'd', 'i', 'c', '_', 'L',
+	'B', 'S',
+};
+
+static const uint8_t adv_swift_pair[] = {
+	0x02, BT_DATA_FLAGS, 0x06,
+	0x0a, BT_DATA_MANUFACTURER_DATA, 0x06, 0x00, 0x03, 0x00, 0x80, 'M', 'X',
+	' ', '3',
+};
+
+static const uint8_t adv_empty[] = {0};
+
+struct adv_report {
+	const uint8_t *data;
+	size_t len;
+	/* Report matches one of the filters set by the benchmark. */
+	bool match;
+};
+
+static const struct adv_report adv_reports[] = {
+	{ adv_ibeacon, sizeof(adv_ibeacon), false },
+	{ adv_exposure_notification, sizeof(adv_exposure_notification), false },
+	{ adv_keyboard, sizeof(adv_keyboard), false },
+	{ adv_mouse, sizeof(adv_mouse), true },
+	{ adv_lbs, sizeof(adv_lbs), true },
+	{ adv_swift_pair, sizeof(adv_swift_pair), false },
+	{ adv_empty, 0, false },
+};
+
+static void test_addr(bt_addr_le_t *addr, uint32_t id, uint8_t type)
+{
+	addr->type = type;
+	sys_put_le32(id, &addr->a.val[0]);
+	sys_put_le16(0xc0de, &addr->a.val[4]);
+}
+
+static void report(const bt_addr_le_t *addr, const uint8_t *data, size_t len)
+{
+	struct bt_le_scan_recv_info info = {
+		.addr = addr,
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+	};
+	struct net_buf_simple ad;
+
+	net_buf_simple_init_with_data(&ad, (void *)data, len);
+
+	memset(&result, 0, sizeof(result));
+	lib_scan_cb->recv(&info, &ad);
+	zassert_equal(result.match_cnt + result.no_match_cnt, 1,
+		      "Single event expected for a report");
+}
+
+static void report_addr(uint32_t id, const uint8_t *data, size_t len)
+{
+	bt_addr_le_t addr;
+
+	test_addr(&addr, id, BT_ADDR_LE_RANDOM);
+	report(&addr, data, len);
+}
+
+static void filters_reset(void)
+{
+	bt_scan_filter_remove_all();
+	bt_scan_filter_disable();
+}
+
+static void test_filter_addr(void)
+{
+	const size_t cnt = CONFIG_BT_SCAN_ADDRESS_CNT;
+	bt_addr_le_t addr;
+	struct bt_filter_status status;
+	int err;
+
+	for (uint32_t i = 0; i < cnt; i++) {
+		test_addr(&addr, i * 3, BT_ADDR_LE_RANDOM);
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr);
+		zassert_equal(err, 0, "Cannot add address filter (err %d)", err);
+
+		/* Duplicates are not stored. */
+		if (i < cnt - 1) {
+			err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr);
+			zassert_equal(err, 0, "Duplicated filter not accepted (err %d)", err);
+		}
+	}
+
+	test_addr(&addr, 1, BT_ADDR_LE_RANDOM);
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr);
+	zassert_equal(err, -ENOMEM, "Filter added over the limit");
+
+	err = bt_scan_filter_status_get(&status);
+	zassert_equal(err, 0, "Cannot get filter status (err %d)", err);
+	zassert_equal(status.addr.cnt, cnt, "Invalid filter count");
+
+	err = bt_scan_filter_enable(BT_SCAN_ADDR_FILTER, false);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	for (uint32_t i = 0; i < 3 * cnt; i++) {
+		test_addr(&addr, i, BT_ADDR_LE_RANDOM);
+		report(&addr, adv_empty, 0);
+
+		if ((i % 3) == 0) {
+			zassert_equal(result.match_cnt, 1, "Address %u not matched", i);
+			zassert_true(result.status.addr.match, "No address match");
+			zassert_equal(bt_addr_le_cmp(result.status.addr.addr, &addr), 0,
+				      "Invalid matched address");
+		} else {
+			zassert_equal(result.no_match_cnt, 1, "Address %u matched", i);
+		}
+	}
+
+	/* Address type is a part of the address. */
+	test_addr(&addr, 0, BT_ADDR_LE_PUBLIC);
+	report(&addr, adv_empty, 0);
+	zassert_equal(result.no_match_cnt, 1, "Address of other type matched");
+}
+
+static void test_filter_name(void)
+{
+	static const uint8_t adv_name_prefix[] = {
+		0x04, BT_DATA_NAME_COMPLETE, 'N', 'o', 'r',
+	};
+	static const uint8_t adv_name_longer[] = {
+		0x0d, BT_DATA_NAME_COMPLETE, 'N', 'o', 'r', 'd', 'i', 'c', '_', 'L',
+		'B', 'S', '_', '2',
+	};
+	static const uint8_t adv_name_other[] = {
+		0x0b, BT_DATA_NAME_COMPLETE, 'S', 'e', 'n', 's', 'o', 'r', '-', '9',
+		'9', '9',
+	};
+	char name[CONFIG_BT_SCAN_NAME_MAX_LEN];
+	int err;
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_LBS");
+	zassert_equal(err, 0, "Cannot add name filter (err %d)", err);
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_LBS");
+	zassert_equal(err, 0, "Duplicated filter not accepted (err %d)", err);
+
+	for (unsigned int i = 0; i < CONFIG_BT_SCAN_NAME_CNT - 1; i++) {
+		snprintf(name, sizeof(name), FILTER_NAME_FMT, 1000 + i);
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, name);
+		zassert_equal(err, 0, "Cannot add name filter (err %d)", err);
+	}
+
+	err = bt_scan_filter_enable(BT_SCAN_NAME_FILTER, false);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	report_addr(0, adv_lbs, sizeof(adv_lbs));
+	zassert_equal(result.match_cnt, 1, "Name not matched");
+	zassert_true(result.status.name.match, "No name match");
+	zassert_equal(strncmp(result.status.name.name, "Nordic_LBS",
+			      CONFIG_BT_SCAN_NAME_MAX_LEN), 0, "Invalid matched name");
+
+	/* The advertised name can be a prefix of the filter name. */
+	report_addr(0, adv_name_prefix, sizeof(adv_name_prefix));
+	zassert_equal(result.match_cnt, 1, "Name prefix not matched");
+	zassert_equal(result.status.name.len, 3, "Invalid matched name length");
+
+	report_addr(0, adv_name_longer, sizeof(adv_name_longer));
+	zassert_equal(result.no_match_cnt, 1, "Longer name matched");
+
+	report_addr(0, adv_name_other, sizeof(adv_name_other));
+	zassert_equal(result.no_match_cnt, 1, "Other name matched");
+
+	for (unsigned int i = 0; i < CONFIG_BT_SCAN_NAME_CNT - 1; i++) {
+		uint8_t adv[2 + CONFIG_BT_SCAN_NAME_MAX_LEN];
+		int len = snprintf(name, sizeof(name), FILTER_NAME_FMT, 1000 + i);
+
+		adv[0] = len + 1;
+		adv[1] = BT_DATA_NAME_COMPLETE;
+		memcpy(&adv[2], name, len);
+
+		report_addr(0, adv, len + 2);
+		zassert_equal(result.match_cnt, 1, "Name %s not matched", name);
+		zassert_equal(strncmp(result.status.name.name, name, len), 0,
+			      "Invalid matched name");
+	}
+}
+
+static void test_filter_short_name(void)
+{
+	static const uint8_t adv_short_name_too_short[] = {
+		0x04, BT_DATA_NAME_SHORTENED, 'n', 'R', 'F',
+	};
+	struct bt_scan_short_name short_name = {
+		.name = "nRF Desktop Mouse",
+		.min_len = 5,
+	};
+	int err;
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_SHORT_NAME, &short_name);
+	zassert_equal(err, 0, "Cannot add short name filter (err %d)", err);
+
+	/* Filter that shares the prefix, but requires a longer name. */
+	short_name.name = "nRF Desktop Dongle";
+	short_name.min_len = 16;
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_SHORT_NAME, &short_name);
+	zassert_equal(err, 0, "Cannot add short name filter (err %d)", err);
+
+	err = bt_scan_filter_enable(BT_SCAN_SHORT_NAME_FILTER, false);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	report_addr(0, adv_mouse, sizeof(adv_mouse));
+	zassert_equal(result.match_cnt, 1, "Short name not matched");
+	zassert_true(result.status.short_name.match, "No short name match");
+	zassert_equal(strcmp(result.status.short_name.name, "nRF Desktop Mouse"), 0,
+		      "Invalid matched short name");
+
+	report_addr(0, adv_short_name_too_short, sizeof(adv_short_name_too_short));
+	zassert_equal(result.no_match_cnt, 1, "Too short name matched");
+}
+
+static void test_filter_uuid(void)
+{
+	/* 16-bit UUID advertised in its 128-bit form. */
+	static const uint8_t adv_hids_128[] = {
+		0x11, BT_DATA_UUID128_ALL,
+		BT_UUID_128_ENCODE(0x00001812, 0x0000, 0x1000, 0x8000, 0x00805f9b34fb),
+	};
+	static const uint8_t adv_uuid_repeated[] = {
+		0x07, BT_DATA_UUID16_SOME, 0x12, 0x18, 0x12, 0x18, 0x0f, 0x18,
+	};
+	struct bt_uuid_16 uuid = BT_UUID_INIT_16(0);
+	int err;
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_UUID_CNT - 2; i++) {
+		uuid.val = 0x2000 + i;
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, &uuid);
+		zassert_equal(err, 0, "Cannot add UUID filter (err %d)", err);
+	}
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_HIDS);
+	zassert_equal(err, 0, "Cannot add UUID filter (err %d)", err);
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID,
+				 BT_UUID_DECLARE_128(BT_UUID_128_ENCODE(0x00001523, 0x1212,
+									0xefde, 0x1523,
+									0x785feabcd123)));
+	zassert_equal(err, 0, "Cannot add UUID filter (err %d)", err);
+
+	err = bt_scan_filter_enable(BT_SCAN_UUID_FILTER, false);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	report_addr(0, adv_mouse, sizeof(adv_mouse));
+	zassert_equal(result.match_cnt, 1, "16-bit UUID not matched");
+	zassert_equal(result.status.uuid.count, 1, "Invalid matched UUID count");
+	zassert_equal(bt_uuid_cmp(result.status.uuid.uuid[0], BT_UUID_HIDS), 0,
+		      "Invalid matched UUID");
+
+	report_addr(0, adv_lbs, sizeof(adv_lbs));
+	zassert_equal(result.match_cnt, 1, "128-bit UUID not matched");
+
+	report_addr(0, adv_hids_128, sizeof(adv_hids_128));
+	zassert_equal(result.match_cnt, 1, "UUID of other type not matched");
+
+	report_addr(0, adv_exposure_notification, sizeof(adv_exposure_notification));
+	zassert_equal(result.no_match_cnt, 1, "Other UUID matched");
+
+	/* In the multifilter mode, all UUIDs must be advertised. */
+	filters_reset();
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_HIDS);
+	zassert_equal(err, 0, "Cannot add UUID filter (err %d)", err);
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_BAS);
+	zassert_equal(err, 0, "Cannot add UUID filter (err %d)", err);
+
+	err = bt_scan_filter_enable(BT_SCAN_UUID_FILTER, true);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	report_addr(0, adv_keyboard, sizeof(adv_keyboard));
+	zassert_equal(result.match_cnt, 1, "All UUIDs not matched");
+	zassert_equal(result.status.uuid.count, 2, "Invalid matched UUID count");
+
+	report_addr(0, adv_uuid_repeated, sizeof(adv_uuid_repeated));
+	zassert_equal(result.match_cnt, 1, "Repeated UUIDs not matched");
+	zassert_equal(result.status.uuid.count, 2, "Invalid matched UUID count");
+
+	report_addr(0, adv_mouse, sizeof(adv_mouse));
+	zassert_equal(result.no_match_cnt, 1, "Matched with a missing UUID");
+}
+
+static void test_filter_appearance(void)
+{
+	int err;
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_APPEARANCE_CNT; i++) {
+		/* Keyboard appearance is not on the list. */
+		uint16_t appearance = 0x0400 + i;
+
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_APPEARANCE, &appearance);
+		zassert_equal(err, 0, "Cannot add appearance filter (err %d)", err);
+	}
+
+	err = bt_scan_filter_enable(BT_SCAN_APPEARANCE_FILTER, false);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	report_addr(0, adv_keyboard, sizeof(adv_keyboard));
+	zassert_equal(result.no_match_cnt, 1, "Appearance matched");
+
+	filters_reset();
+
+	uint16_t appearance = sys_get_be16(&adv_mouse[5]);
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_APPEARANCE, &appearance);
+	zassert_equal(err, 0, "Cannot add appearance filter (err %d)", err);
+
+	err = bt_scan_filter_enable(BT_SCAN_APPEARANCE_FILTER, false);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	report_addr(0, adv_mouse, sizeof(adv_mouse));
+	zassert_equal(result.match_cnt, 1, "Appearance not matched");
+	zassert_equal(*result.status.appearance.appearance, appearance,
+		      "Invalid matched appearance");
+}
+
+static void test_filter_manufacturer_data(void)
+{
+	uint8_t ibeacon_prefix[] = {0x4c, 0x00, 0x02, 0x15};
+	uint8_t apple[] = {0x4c, 0x00};
+	uint8_t data[CONFIG_BT_SCAN_MANUFACTURER_DATA_MAX_LEN];
+	struct bt_scan_manufacturer_data md = {
+		.data = data,
+	};
+	int err;
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT - 1; i++) {
+		/* Company ID 0x0059 with various lengths of the data. */
+		md.data_len = 3 + (i % (sizeof(data) - 2));
+		memset(data, 0, sizeof(data));
+		sys_put_le16(0x0059, data);
+		sys_put_be16(i, &data[md.data_len - 2]);
+
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, &md);
+		zassert_equal(err, 0, "Cannot add manufacturer data filter (err %d)", err);
+	}
+
+	md.data = ibeacon_prefix;
+	md.data_len = sizeof(ibeacon_prefix);
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, &md);
+	zassert_equal(err, 0, "Cannot add manufacturer data filter (err %d)", err);
+
+	err = bt_scan_filter_enable(BT_SCAN_MANUFACTURER_DATA_FILTER, false);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	/* Filter data is a prefix of the advertised data. */
+	report_addr(0, adv_ibeacon, sizeof(adv_ibeacon));
+	zassert_equal(result.match_cnt, 1, "Manufacturer data not matched");
+	zassert_equal(result.status.manufacturer_data.len, sizeof(ibeacon_prefix),
+		      "Invalid matched data length");
+	zassert_mem_equal(result.status.manufacturer_data.data, ibeacon_prefix,
+			  sizeof(ibeacon_prefix), "Invalid matched data");
+
+	report_addr(0, adv_swift_pair, sizeof(adv_swift_pair));
+	zassert_equal(result.no_match_cnt, 1, "Manufacturer data matched");
+
+	/* Data starting with one of the filters is a duplicate. */
+	filters_reset();
+
+	md.data = apple;
+	md.data_len = sizeof(apple);
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, &md);
+	zassert_equal(err, 0, "Cannot add manufacturer data filter (err %d)", err);
+
+	md.data = ibeacon_prefix;
+	md.data_len = sizeof(ibeacon_prefix);
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, &md);
+	zassert_equal(err, 0, "Duplicated filter not accepted (err %d)", err);
+
+	struct bt_filter_status status;
+
+	err = bt_scan_filter_status_get(&status);
+	zassert_equal(err, 0, "Cannot get filter status (err %d)", err);
+	zassert_equal(status.manufacturer_data.cnt, 1, "Duplicated filter stored");
+}
+
+static void test_filter_remove_all(void)
+{
+	bt_addr_le_t addr;
+	int err;
+
+	test_addr(&addr, 0, BT_ADDR_LE_RANDOM);
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr);
+	zassert_equal(err, 0, "Cannot add address filter (err %d)", err);
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_LBS_2");
+	zassert_equal(err, 0, "Cannot add name filter (err %d)", err);
+
+	err = bt_scan_filter_enable(BT_SCAN_ADDR_FILTER | BT_SCAN_NAME_FILTER, false);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	bt_scan_filter_remove_all();
+
+	report(&addr, adv_empty, 0);
+	zassert_equal(result.no_match_cnt, 1, "Removed address matched");
+
+	/* Shorter name reuses the storage of the removed one. */
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic");
+	zassert_equal(err, 0, "Cannot add name filter (err %d)", err);
+
+	report_addr(0, adv_lbs, sizeof(adv_lbs));
+	zassert_equal(result.no_match_cnt, 1, "Removed name matched");
+}
+
+static void test_replay_benchmark(void)
+{
+	struct bt_scan_short_name short_name = {
+		.name = "nRF Desktop Mouse",
+		.min_len = 5,
+	};
+	uint8_t md_data[CONFIG_BT_SCAN_MANUFACTURER_DATA_MAX_LEN];
+	struct bt_scan_manufacturer_data md = {
+		.data = md_data,
+		.data_len = sizeof(md_data),
+	};
+	char name[CONFIG_BT_SCAN_NAME_MAX_LEN];
+	struct bt_uuid_16 uuid = BT_UUID_INIT_16(0);
+	size_t expected_match_cnt = 0;
+	size_t match_cnt = 0;
+	uint32_t duration = 0;
+	bt_addr_le_t addr;
+	int err;
+
+	/* Fill all filter types to their limits. */
+	for (uint32_t i = 0; i < CONFIG_BT_SCAN_ADDRESS_CNT; i++) {
+		test_addr(&addr, i * REPLAY_ALLOWED_ADDR_PERIOD, BT_ADDR_LE_RANDOM);
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr);
+		zassert_equal(err, 0, "Cannot add address filter (err %d)", err);
+	}
+
+	for (unsigned int i = 0; i < CONFIG_BT_SCAN_NAME_CNT - 1; i++) {
+		snprintf(name, sizeof(name), FILTER_NAME_FMT, i);
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, name);
+		zassert_equal(err, 0, "Cannot add name filter (err %d)", err);
+	}
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Nordic_LBS");
+	zassert_equal(err, 0, "Cannot add name filter (err %d)", err);
+
+	err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_SHORT_NAME, &short_name);
+	zassert_equal(err, 0, "Cannot add short name filter (err %d)", err);
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_UUID_CNT; i++) {
+		uuid.val = 0x2000 + i;
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, &uuid);
+		zassert_equal(err, 0, "Cannot add UUID filter (err %d)", err);
+	}
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_APPEARANCE_CNT; i++) {
+		uint16_t appearance = 0x0400 + i;
+
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_APPEARANCE, &appearance);
+		zassert_equal(err, 0, "Cannot add appearance filter (err %d)", err);
+	}
+
+	for (uint16_t i = 0; i < CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT; i++) {
+		memset(md_data, 0, sizeof(md_data));
+		sys_put_le16(0x0059, md_data);
+		sys_put_be16(i, &md_data[sizeof(md_data) - 2]);
+		err = bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, &md);
+		zassert_equal(err, 0, "Cannot add manufacturer data filter (err %d)", err);
+	}
+
+	err = bt_scan_filter_enable(BT_SCAN_ALL_FILTER, false);
+	zassert_equal(err, 0, "Cannot enable filters (err %d)", err);
+
+	for (uint32_t i = 0; i < REPLAY_REPORT_CNT; i++) {
+		const struct adv_report *adv = &adv_reports[i % ARRAY_SIZE(adv_reports)];
+		uint32_t start;
+
+		/* Addresses on the allow list are spread over all the reports. */
+		test_addr(&addr, (i * 13) % (REPLAY_ALLOWED_ADDR_PERIOD *
+					     CONFIG_BT_SCAN_ADDRESS_CNT),
+			  BT_ADDR_LE_RANDOM);
+
+		if (adv->match || ((i * 13) % REPLAY_ALLOWED_ADDR_PERIOD) == 0) {
+			expected_match_cnt++;
+		}
+
+		start = k_cycle_get_32();
+		report(&addr, adv->data, adv->len);
+		duration += k_cycle_get_32() - start;
+
+		match_cnt += result.match_cnt;
+	}
+
+	zassert_equal(match_cnt, expected_match_cnt, "Invalid number of matches");
+
+	printk("Filter index %s: %u reports against %u filters, %u matches, "
+	       "%u ns per report\n",
+	       IS_ENABLED(CONFIG_BT_SCAN_FILTER_INDEX) ? "enabled" : "disabled",
+	       REPLAY_REPORT_CNT,
+	       CONFIG_BT_SCAN_ADDRESS_CNT + CONFIG_BT_SCAN_NAME_CNT + 1 +
+	       CONFIG_BT_SCAN_UUID_CNT + CONFIG_BT_SCAN_APPEARANCE_CNT +
+	       CONFIG_BT_SCAN_MANUFACTURER_DATA_CNT,
+	       (uint32_t)match_cnt,
+	       (uint32_t)(k_cyc_to_ns_floor64(duration) / REPLAY_REPORT_CNT));
+}
+
+void test_main(void)
+{
+	bt_scan_init(NULL);
+	bt_scan_cb_register(&scan_cb);
+
+	ztest_test_suite(bt_scan_filter_tests,
+			 ztest_unit_test_setup_teardown(test_filter_addr,
+							filters_reset, filters_reset),
+			 ztest_unit_test_setup_teardown(test_filter_name,
+							filters_reset, filters_reset),
+			 ztest_unit_test_setup_teardown(test_filter_short_name,
+							filters_reset, filters_reset),
+			 ztest_unit_test_setup_teardown(test_filter_uuid,
+							filters_reset, filters_reset),
+			 ztest_unit_test_setup_teardown(test_filter_appearance,
+							filters_reset, filters_reset),
+			 ztest_unit_test_setup_teardown(test_filter_manufacturer_data,
+							filters_reset, filters_reset),
+			 ztest_unit_test_setup_teardown(test_filter_remove_all,
+							filters_reset, filters_reset),
+			 ztest_unit_test_setup_teardown(test_replay_benchmark,
+							filters_reset, filters_reset)
+			 );
+
+	ztest_run_test_suite(bt_scan_filter_tests);
+}
@@ -7,6 +7,7 @@
 #define TEST_CONFIG_SIMPLE_BURST_SIZE 10000
 #define TEST_CONFIG_DATA_BURST_SIZE 10000
 #define TEST_CONFIG_DATA_BIG_BURST_SIZE 1000
+#define TEST_CONFIG_COALESCE_BURST_SIZE 1000
 
 /* Test related timeouts. */
 #define TEST_TIMEOUT_BASE_S 1
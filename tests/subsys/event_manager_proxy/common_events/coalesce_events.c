@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "coalesce_events.h"
+
+
+APP_EVENT_TYPE_DEFINE(coalesce_value_event,
+	NULL,
+	NULL,
+	APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_LATEST_VALUE));
+
+APP_EVENT_TYPE_DEFINE(coalesce_seq_event,
+	NULL,
+	NULL,
+	APP_EVENT_FLAGS_CREATE());
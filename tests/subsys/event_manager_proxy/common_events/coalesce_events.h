@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _COALESCE_EVENTS_H_
+#define _COALESCE_EVENTS_H_
+
+/**
+ * @brief Coalesce Events
+ * @defgroup coalesce_events Coalesce Events
+ * @{
+ */
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Event of which only the latest value matters
+ *
+ * The event type has the APP_EVENT_TYPE_FLAGS_LATEST_VALUE flag,
+ * so the proxy may drop the event if a newer one follows it.
+ * The event is intended to be sent from the host to the remote.
+ */
+struct coalesce_value_event {
+	struct app_event_header header;
+
+	/** Position of the event in the sequence of the submitted events. */
+	uint32_t seq;
+};
+APP_EVENT_TYPE_DECLARE(coalesce_value_event);
+
+/**
+ * @brief Event that is never dropped
+ *
+ * The event is intended to be sent from the host to the remote,
+ * interleaved with @ref coalesce_value_event.
+ */
+struct coalesce_seq_event {
+	struct app_event_header header;
+
+	/** Position of the event in the sequence of the submitted events. */
+	uint32_t seq;
+	/** Number of events of this type submitted before this one. */
+	uint32_t cnt;
+	/** The last event of the sequence. */
+	bool end;
+};
+APP_EVENT_TYPE_DECLARE(coalesce_seq_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _COALESCE_EVENTS_H_ */
@@ -29,6 +29,7 @@ enum test_id {
 	TEST_DATA_BURST_FROM_REMOTE,
 	TEST_DATA_BIG_BURST,
 	TEST_DATA_BIG_BURST_FROM_REMOTE,
+	TEST_COALESCE,
 
 	TEST_END,
 	TEST_CNT
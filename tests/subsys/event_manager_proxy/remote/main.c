@@ -9,6 +9,7 @@
 
 #include "test_config.h"
 #include "common_utils.h"
+#include "coalesce_events.h"
 #include "data_events.h"
 #include "simple_events.h"
 #include "test_events.h"
@@ -22,6 +23,12 @@ LOG_MODULE_REGISTER(MODULE);
 static enum test_id cur_test_id;
 static unsigned int cur_test_pos;
 
+/* State of the coalesce test */
+static uint32_t coalesce_next_seq;
+static uint32_t coalesce_last_value_seq;
+static uint32_t coalesce_seq_cnt;
+static int coalesce_err;
+
 
 void main(void)
 {
@@ -53,6 +60,8 @@ void main(void)
 	REMOTE_EVENT_SUBSCRIBE(ipc_instance, data_big_event);
 	REMOTE_EVENT_SUBSCRIBE(ipc_instance, test_start_event);
 	REMOTE_EVENT_SUBSCRIBE(ipc_instance, test_end_event);
+	REMOTE_EVENT_SUBSCRIBE(ipc_instance, coalesce_value_event);
+	REMOTE_EVENT_SUBSCRIBE(ipc_instance, coalesce_seq_event);
 
 	ret = event_manager_proxy_start();
 	if (ret) {
@@ -90,6 +99,35 @@ static void proxy_direct_submit_start_ack_event(void)
 	app_event_manager_free(event);
 }
 
+static void coalesce_check_seq(uint32_t seq)
+{
+	if (seq < coalesce_next_seq) {
+		LOG_ERR("Event %u received after event %u", seq, coalesce_next_seq - 1);
+		coalesce_err = -EBADMSG;
+	}
+	coalesce_next_seq = seq + 1;
+}
+
+static void coalesce_seq_event_handle(const struct coalesce_seq_event *event)
+{
+	coalesce_check_seq(event->seq);
+
+	if (event->cnt != coalesce_seq_cnt) {
+		LOG_ERR("Sequence event %u lost", coalesce_seq_cnt);
+		coalesce_err = -EBADMSG;
+	}
+	coalesce_seq_cnt = event->cnt + 1;
+
+	if (event->end) {
+		if (!coalesce_err && (coalesce_last_value_seq + 1 != event->seq)) {
+			LOG_ERR("Latest value event %u lost", event->seq - 1);
+			coalesce_err = -ENODATA;
+		}
+		submit_test_end_remote_event(TEST_COALESCE,
+					     coalesce_err ? coalesce_err : cur_test_pos);
+	}
+}
+
 static bool event_handler(const struct app_event_header *eh)
 {
 	int ret;
@@ -137,6 +175,14 @@ static bool event_handler(const struct app_event_header *eh)
 			ret = proxy_burst_data_big_response_events();
 			submit_test_end_remote_event(TEST_DATA_BIG_BURST_FROM_REMOTE, ret);
 			break;
+		case TEST_COALESCE:
+			LOG_INF("Starting coalesce test");
+			coalesce_next_seq = 0;
+			coalesce_last_value_seq = UINT32_MAX;
+			coalesce_seq_cnt = 0;
+			coalesce_err = 0;
+			proxy_direct_submit_start_ack_event();
+			break;
 		default:
 			/* Ignore */
 			break;
@@ -188,6 +234,18 @@ static bool event_handler(const struct app_event_header *eh)
 			LOG_INF("Sending data big response");
 			APP_EVENT_SUBMIT(event);
 		}
+	} else if (is_coalesce_value_event(eh)) {
+		if (cur_test_id == TEST_COALESCE) {
+			struct coalesce_value_event *event = cast_coalesce_value_event(eh);
+
+			coalesce_check_seq(event->seq);
+			coalesce_last_value_seq = event->seq;
+			cur_test_pos++;
+		}
+	} else if (is_coalesce_seq_event(eh)) {
+		if (cur_test_id == TEST_COALESCE) {
+			coalesce_seq_event_handle(cast_coalesce_seq_event(eh));
+		}
 	}
 	return false;
 }
@@ -200,3 +258,5 @@ APP_EVENT_SUBSCRIBE(MODULE, simple_event);
 APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
 APP_EVENT_SUBSCRIBE(MODULE, test_end_event);
 APP_EVENT_SUBSCRIBE(MODULE, test_end_remote_event);
+APP_EVENT_SUBSCRIBE(MODULE, coalesce_value_event);
+APP_EVENT_SUBSCRIBE(MODULE, coalesce_seq_event);
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+
+#include <app_event_manager.h>
+#include <event_manager_proxy.h>
+
+#include "test_config.h"
+#include "common_utils.h"
+#include "test_utils.h"
+#include "coalesce_events.h"
+
+
+/*
+ * The remote ends the test when it receives the last sequence event.
+ * The result is the number of value events received, or an error code
+ * if the events were received out of order or the latest value was lost.
+ */
+static int coalesce_end_wait(struct coalesce_seq_event *event, uint32_t seq, uint32_t cnt)
+{
+	event->seq = seq;
+	event->cnt = cnt;
+	event->end = true;
+	proxy_direct_submit_event(&event->header);
+
+	test_end_wait(TEST_COALESCE);
+
+	return test_remote_result();
+}
+
+static void test_coalesce_burst(void)
+{
+	struct coalesce_value_event *value = new_coalesce_value_event();
+	struct coalesce_seq_event *event = new_coalesce_seq_event();
+	uint32_t seq;
+	int res;
+
+	test_start(TEST_COALESCE);
+	test_start_ack_wait();
+
+	for (seq = 0; seq < TEST_CONFIG_COALESCE_BURST_SIZE; ++seq) {
+		value->seq = seq;
+		proxy_direct_submit_event(&value->header);
+	}
+
+	res = coalesce_end_wait(event, seq, 0);
+
+	app_event_manager_free(value);
+	app_event_manager_free(event);
+
+	printk(" Received %d of %d value events\n", res, TEST_CONFIG_COALESCE_BURST_SIZE);
+
+	zassert_true(res > 0, "Wrong events received by remote (%d)", res);
+	if (IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)) {
+		zassert_true(res < TEST_CONFIG_COALESCE_BURST_SIZE, "No value events coalesced");
+	} else {
+		zassert_equal(res, TEST_CONFIG_COALESCE_BURST_SIZE, "Value events dropped");
+	}
+}
+
+static void test_coalesce_order(void)
+{
+	struct coalesce_value_event *value = new_coalesce_value_event();
+	struct coalesce_seq_event *event = new_coalesce_seq_event();
+	uint32_t seq = 0;
+	uint32_t cnt;
+	int res;
+
+	test_start(TEST_COALESCE);
+	test_start_ack_wait();
+
+	/* Value events must not overtake the sequence events submitted before them. */
+	for (cnt = 0; cnt < TEST_CONFIG_COALESCE_BURST_SIZE; ++cnt) {
+		value->seq = seq++;
+		proxy_direct_submit_event(&value->header);
+
+		event->seq = seq++;
+		event->cnt = cnt;
+		event->end = false;
+		proxy_direct_submit_event(&event->header);
+	}
+
+	value->seq = seq++;
+	proxy_direct_submit_event(&value->header);
+
+	res = coalesce_end_wait(event, seq, cnt);
+
+	app_event_manager_free(value);
+	app_event_manager_free(event);
+
+	printk(" Received %d of %d value events\n", res, TEST_CONFIG_COALESCE_BURST_SIZE + 1);
+
+	zassert_true(res > 0, "Wrong events received by remote (%d)", res);
+}
+
+void coalesce_run(void)
+{
+	ztest_test_suite(coalesce_tests,
+			 ztest_unit_test(test_coalesce_burst),
+			 ztest_unit_test(test_coalesce_order)
+			 );
+
+	ztest_run_test_suite(coalesce_tests);
+}
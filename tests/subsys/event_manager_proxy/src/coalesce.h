@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _COALESCE_H_
+#define _COALESCE_H_
+
+void coalesce_run(void);
+
+#endif /* _COALESCE_H_ */
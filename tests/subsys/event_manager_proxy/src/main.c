@@ -12,6 +12,7 @@
 #include "common_utils.h"
 #include "simple.h"
 #include "data.h"
+#include "coalesce.h"
 #include "test_events.h"
 
 void test_initialization(void)
@@ -49,4 +50,5 @@ void test_main(void)
 
 	simple_run();
 	data_run();
+	coalesce_run();
 }
@@ -12,8 +12,14 @@
 
 #include "mock/socket.h"
 #include "mock/dl_coap.h"
+#include "mock/http_server.h"
+
+#define HTTP_FRAG_SIZE 256
 
 static enum download_client_evt_id last_event = -1;
+static size_t fragment_offset;
+static size_t fragment_errors;
+static int64_t done_time;
 
 static int download_client_callback(const struct download_client_evt *event)
 {
@@ -23,9 +29,18 @@ static int download_client_callback(const struct download_client_evt *event)
 
 	switch (event->id) {
 	case DOWNLOAD_CLIENT_EVT_FRAGMENT:
+		if (http_server_active()) {
+			/* Fragments must be handed over in order */
+			if (!http_server_data_check(fragment_offset, event->fragment.buf,
+						    event->fragment.len)) {
+				fragment_errors++;
+			}
+			fragment_offset += event->fragment.len;
+		}
 		last_event = DOWNLOAD_CLIENT_EVT_FRAGMENT;
 		break;
 	case DOWNLOAD_CLIENT_EVT_DONE:
+		done_time = k_uptime_get();
 		last_event = DOWNLOAD_CLIENT_EVT_DONE;
 		break;
 	case DOWNLOAD_CLIENT_EVT_ERROR:
@@ -204,6 +219,116 @@ static void test_download_abort_on_invalid_block(void)
 	de_init(&client);
 }
 
+#if defined(TEST_HTTP_PIPELINE)
+/* Too large for the test thread stack */
+static struct download_client http_client;
+
+static void dl_http_start(uint8_t pipeline_depth)
+{
+	static const char host[] = "http://10.1.0.10";
+	static bool initialized;
+	struct download_client_cfg http_config = {
+		.sec_tag = -1,
+		.frag_size_override = HTTP_FRAG_SIZE,
+		.pipeline_depth = pipeline_depth,
+	};
+	int err;
+
+	if (!initialized) {
+		err = download_client_init(&http_client, download_client_callback);
+		zassert_ok(err, NULL);
+		initialized = true;
+	}
+
+	fragment_offset = 0;
+	fragment_errors = 0;
+
+	err = download_client_connect(&http_client, host, &http_config);
+	zassert_ok(err, NULL);
+
+	err = download_client_start(&http_client, "file.bin", 0);
+	zassert_ok(err, NULL);
+}
+
+static void dl_http_check(size_t file_size)
+{
+	zassert_ok(wait_for_event(DOWNLOAD_CLIENT_EVT_DONE, 10), "Download must have finished");
+	zassert_equal(fragment_offset, file_size, "Whole file must have been received");
+	zassert_equal(fragment_errors, 0, "Fragments must be received in order");
+
+	de_init(&http_client);
+}
+
+static void http_server_teardown(void)
+{
+	http_server_stop();
+}
+
+static void test_download_http_pipelined(void)
+{
+	const size_t file_size = 4000;
+	const struct http_server_stats *stats = http_server_stats_get();
+
+	http_server_init(file_size, 20);
+
+	dl_http_start(4);
+	dl_http_check(file_size);
+
+	zassert_equal(stats->requests, DIV_ROUND_UP(file_size, HTTP_FRAG_SIZE),
+		      "Each fragment must be requested once");
+	zassert_equal(stats->in_flight_max, 4, "Requests must be pipelined");
+}
+
+static void test_download_http_resume_after_drop(void)
+{
+	const size_t file_size = 4096;
+	const struct http_server_stats *stats = http_server_stats_get();
+
+	http_server_init(file_size, 20);
+	http_server_drop_after(5);
+
+	dl_http_start(4);
+	dl_http_check(file_size);
+
+	zassert_equal(stats->resumed_from, 5 * HTTP_FRAG_SIZE,
+		      "Download must resume after the last received fragment");
+	zassert_equal(stats->body_bytes, file_size, "No byte must be downloaded twice");
+}
+
+static int64_t http_download_time(size_t file_size, uint32_t latency_ms,
+				  uint8_t pipeline_depth)
+{
+	int64_t start;
+
+	http_server_init(file_size, latency_ms);
+
+	start = k_uptime_get();
+	dl_http_start(pipeline_depth);
+	dl_http_check(file_size);
+
+	TC_PRINT("Pipeline depth %u: %zu bytes in %u ms (%u B/s)\n", pipeline_depth,
+		 file_size, (uint32_t)(done_time - start),
+		 (uint32_t)(file_size * MSEC_PER_SEC / (done_time - start)));
+
+	return done_time - start;
+}
+
+static void test_download_http_throughput(void)
+{
+	const size_t file_size = 32 * HTTP_FRAG_SIZE;
+	const uint32_t latency_ms = 100;
+	int64_t sequential;
+	int64_t pipelined;
+
+	sequential = http_download_time(file_size, latency_ms, 1);
+	pipelined = http_download_time(file_size, latency_ms, 4);
+
+	zassert_true(sequential >= 32 * latency_ms, "Each fragment costs a round trip");
+	zassert_true(pipelined * 3 < sequential,
+		     "Pipelining must hide most of the latency");
+}
+#endif /* TEST_HTTP_PIPELINE */
+
 void test_main(void)
 {
 	ztest_test_suite(lib_fota_download_test, ztest_unit_test(test_download_simple),
@@ -213,6 +338,18 @@ void test_main(void)
 			 ztest_unit_test(test_download_abort_on_invalid_block));
 
 	ztest_run_test_suite(lib_fota_download_test);
+
+#if defined(TEST_HTTP_PIPELINE)
+	ztest_test_suite(lib_download_client_http_test,
+			 ztest_unit_test_setup_teardown(test_download_http_pipelined,
+							unit_test_noop, http_server_teardown),
+			 ztest_unit_test_setup_teardown(test_download_http_resume_after_drop,
+							unit_test_noop, http_server_teardown),
+			 ztest_unit_test_setup_teardown(test_download_http_throughput,
+							unit_test_noop, http_server_teardown));
+
+	ztest_run_test_suite(lib_download_client_http_test);
+#endif
 }
 
 #define TEST_SOCKET_PRIO 40
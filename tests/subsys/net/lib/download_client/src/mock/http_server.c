@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+
+#include "mock/http_server.h"
+
+/* Stand-in for an HTTP server answering range requests on the mock socket.
+ * Every response becomes available a fixed latency after its request has
+ * been sent, and the responses are sent back in the order of the requests,
+ * like on a pipelined HTTP/1.1 connection.
+ */
+
+#define REQUESTS_MAX 8
+
+struct response {
+	size_t start;
+	size_t end;
+	int64_t ready;
+};
+
+static struct {
+	bool active;
+	bool closed;
+	bool reopened;
+	size_t file_size;
+	uint32_t latency_ms;
+	size_t drop_after;
+
+	struct response queue[REQUESTS_MAX];
+	size_t head;
+	size_t count;
+
+	char header[128];
+	size_t header_len;
+	/* Bytes of the first response in the queue sent so far */
+	size_t sent;
+
+	struct http_server_stats stats;
+} server;
+
+static uint8_t file_data(size_t offset)
+{
+	return (uint8_t)(offset * 31 + (offset >> 8));
+}
+
+void http_server_init(size_t file_size, uint32_t latency_ms)
+{
+	memset(&server, 0, sizeof(server));
+	server.active = true;
+	server.file_size = file_size;
+	server.latency_ms = latency_ms;
+	server.stats.resumed_from = SIZE_MAX;
+}
+
+void http_server_stop(void)
+{
+	server.active = false;
+}
+
+bool http_server_active(void)
+{
+	return server.active;
+}
+
+void http_server_drop_after(size_t responses)
+{
+	server.drop_after = responses;
+}
+
+const struct http_server_stats *http_server_stats_get(void)
+{
+	return &server.stats;
+}
+
+bool http_server_data_check(size_t offset, const void *buf, size_t len)
+{
+	const uint8_t *data = buf;
+
+	for (size_t i = 0; i < len; i++) {
+		if (data[i] != file_data(offset + i)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+ssize_t http_server_request(const void *buf, size_t len)
+{
+	static const char range[] = "Range: bytes=";
+	char req[160];
+	struct response *resp;
+	char *p;
+
+	if (server.closed) {
+		/* Lost with the connection */
+		return len;
+	}
+
+	if (server.count == REQUESTS_MAX) {
+		errno = ENOBUFS;
+		return -1;
+	}
+
+	memcpy(req, buf, MIN(len, sizeof(req) - 1));
+	req[MIN(len, sizeof(req) - 1)] = '\0';
+
+	p = strstr(req, range);
+	if (!p) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	resp = &server.queue[(server.head + server.count) % REQUESTS_MAX];
+	resp->start = strtoul(p + strlen(range), &p, 10);
+	resp->end = MIN(strtoul(p + 1, NULL, 10), server.file_size - 1);
+	resp->ready = k_uptime_get() + server.latency_ms;
+
+	if (server.reopened) {
+		server.reopened = false;
+		server.stats.resumed_from = resp->start;
+	}
+
+	server.count++;
+	server.stats.requests++;
+	server.stats.in_flight_max = MAX(server.stats.in_flight_max, server.count);
+
+	return len;
+}
+
+ssize_t http_server_response(void *buf, size_t len)
+{
+	uint8_t *out = buf;
+	size_t copied = 0;
+	int64_t wait;
+
+	if (server.closed) {
+		/* Report the closure, then accept a new connection */
+		server.closed = false;
+		server.reopened = true;
+		return 0;
+	}
+
+	if (server.count == 0) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	wait = server.queue[server.head].ready - k_uptime_get();
+	if (wait > 0) {
+		k_sleep(K_MSEC(wait));
+	}
+
+	while (copied < len && server.count > 0 &&
+	       server.queue[server.head].ready <= k_uptime_get()) {
+		struct response *resp = &server.queue[server.head];
+		size_t body_len = resp->end - resp->start + 1;
+		size_t n;
+
+		if (server.sent == 0) {
+			server.header_len = snprintf(server.header, sizeof(server.header),
+						     "HTTP/1.1 206 Partial Content\r\n"
+						     "Content-Range: bytes %zu-%zu/%zu\r\n"
+						     "Content-Length: %zu\r\n"
+						     "\r\n",
+						     resp->start, resp->end, server.file_size,
+						     body_len);
+		}
+
+		while (copied < len && server.sent < server.header_len) {
+			out[copied++] = server.header[server.sent++];
+		}
+
+		n = MIN(len - copied, server.header_len + body_len - server.sent);
+		for (size_t i = 0; i < n; i++) {
+			out[copied + i] =
+				file_data(resp->start + server.sent - server.header_len + i);
+		}
+		copied += n;
+		server.sent += n;
+		server.stats.body_bytes += n;
+
+		if (server.sent < server.header_len + body_len) {
+			break;
+		}
+
+		/* Response complete */
+		server.head = (server.head + 1) % REQUESTS_MAX;
+		server.count--;
+		server.sent = 0;
+
+		if (server.drop_after && --server.drop_after == 0) {
+			/* Drop the connection with the requests in flight */
+			server.head = 0;
+			server.count = 0;
+			server.closed = true;
+			break;
+		}
+	}
+
+	return copied;
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#ifndef _HTTP_SERVER_H_
+#define _HTTP_SERVER_H_
+
+#include <zephyr/kernel.h>
+
+struct http_server_stats {
+	/** Number of range requests answered or being answered. */
+	size_t requests;
+	/** Largest number of requests waiting for a response. */
+	size_t in_flight_max;
+	/** Number of file bytes sent. */
+	size_t body_bytes;
+	/** First byte requested after the connection was dropped. */
+	size_t resumed_from;
+};
+
+void http_server_init(size_t file_size, uint32_t latency_ms);
+void http_server_stop(void);
+bool http_server_active(void);
+void http_server_drop_after(size_t responses);
+const struct http_server_stats *http_server_stats_get(void);
+bool http_server_data_check(size_t offset, const void *buf, size_t len);
+
+ssize_t http_server_request(const void *buf, size_t len);
+ssize_t http_server_response(void *buf, size_t len);
+
+#endif /* _HTTP_SERVER_H_ */
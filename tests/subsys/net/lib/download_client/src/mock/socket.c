@@ -8,6 +8,7 @@
 #include <zephyr/ztest.h>
 
 #include "mock/socket.h"
+#include "mock/http_server.h"
 
 void mock_socket_iface_init(struct net_if *iface);
 
@@ -27,6 +28,10 @@ struct net_if_api mock_if_api = {
 static ssize_t mock_socket_offload_recvfrom(void *obj, void *buf, size_t len, int flags,
 					    struct sockaddr *from, socklen_t *fromlen)
 {
+	if (http_server_active()) {
+		return http_server_response(buf, len);
+	}
+
 	k_sleep(K_MSEC(50));
 	return ztest_get_return_value();
 }
@@ -39,6 +44,10 @@ static ssize_t mock_socket_offload_read(void *obj, void *buffer, size_t count)
 static ssize_t mock_socket_offload_sendto(void *obj, const void *buf, size_t len, int flags,
 					  const struct sockaddr *to, socklen_t tolen)
 {
+	if (http_server_active()) {
+		return http_server_request(buf, len);
+	}
+
 	k_sleep(K_MSEC(50));
 	return ztest_get_return_value();
 }
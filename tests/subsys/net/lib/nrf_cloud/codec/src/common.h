@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_CODEC_TEST_COMMON_H__
+#define NRF_CLOUD_CODEC_TEST_COMMON_H__
+
+#include <stddef.h>
+
+#define TOPIC_PREFIX_SIZE 64
+
+/* Memory currently allocated and peak allocation through the nRF Cloud memory hooks */
+extern size_t heap_used;
+extern size_t heap_peak;
+
+/* Last topic prefix set by the codec */
+extern char topic_prefix_set[TOPIC_PREFIX_SIZE];
+
+/* Set the peak allocation to the memory currently allocated */
+void heap_peak_reset(void);
+
+/* Suite setup installing the memory hooks */
+void *codec_test_setup(void);
+
+/* Suite after hook checking for memory leaks */
+void codec_test_after(void *fixture);
+
+#endif /* NRF_CLOUD_CODEC_TEST_COMMON_H__ */
@@ -0,0 +1,1062 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <limits.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_pgps.h>
+
+#include "nrf_cloud_codec.h"
+#include "nrf_cloud_json_reader.h"
+#include "nrf_cloud_mem.h"
+#include "nrf_cloud_fsm.h"
+#include "common.h"
+
+/* Number of decodings timed for every message type */
+#define PERF_ITERATIONS 200
+
+/* Number of mutated messages decoded for every captured message */
+#define FUZZ_ITERATIONS 400
+
+#define FUZZ_BUF_SIZE 1024
+#define PATH_SIZE 256
+
+#define TENANT "a5592ec1-18ae-4d9d-bc44-1d9bd927bbe9"
+#define DEVICE "nrf-352656100123456"
+#define PREFIX "prod/" TENANT "/"
+#define D2C PREFIX "m/d/" DEVICE "/d2c"
+#define C2D PREFIX "m/d/" DEVICE "/+/r"
+
+/* Messages as received from nRF Cloud */
+static const char shadow_delta_pin[] =
+	"{\"version\":3,\"timestamp\":1658848800,\"state\":{\"pairing\":"
+	"{\"state\":\"not_associated\",\"topics\":{\"d2c\":null,\"c2d\":null}},"
+	"\"pairingStatus\":\"initiate\"},\"metadata\":{\"pairing\":{\"state\":"
+	"{\"timestamp\":1658848800},\"topics\":{\"d2c\":{\"timestamp\":1658848800},"
+	"\"c2d\":{\"timestamp\":1658848800}}},\"pairingStatus\":{\"timestamp\":1658848800}}}";
+
+static const char shadow_delta_paired[] =
+	"{\"version\":5,\"timestamp\":1658848812,\"state\":{"
+	"\"nrfcloud_mqtt_topic_prefix\":\"" PREFIX "\",\"pairing\":{\"state\":\"paired\","
+	"\"topics\":{\"d2c\":\"" D2C "\",\"c2d\":\"" C2D "\"}}},"
+	"\"metadata\":{\"nrfcloud_mqtt_topic_prefix\":{\"timestamp\":1658848812},"
+	"\"pairing\":{\"state\":{\"timestamp\":1658848812},\"topics\":{\"d2c\":"
+	"{\"timestamp\":1658848812},\"c2d\":{\"timestamp\":1658848812}}}}}";
+
+static const char shadow_desired_paired[] =
+	"{\"desired\":{\"pairing\":{\"state\":\"paired\",\"topics\":{"
+	"\"d2c\":\"" PREFIX "m\\/d\\/" DEVICE "\\/d2c\",\"c2d\":\"" C2D "\"}}},"
+	"\"reported\":{\"connection\":{\"status\":\"connected\",\"keepalive\":1200}}}";
+
+static const char shadow_delta_config[] =
+	"{\"version\":42,\"timestamp\":1658935200,\"state\":{\"config\":{\"GNSS\":"
+	"{\"enable\":true,\"interval\":120,\"timeout\":60},\"sampleRate\":60,"
+	"\"sensors\":[\"TEMP\",\"HUMID\",\"AIR_PRESS\"],\"thresholds\":{\"TEMP\":"
+	"{\"min\":-10.5,\"max\":35.25},\"HUMID\":{\"min\":20,\"max\":80}}},"
+	"\"device\":{\"serviceInfo\":{\"ui\":[\"GNSS\",\"TEMP\",\"RSRP\",\"FLIP\"],"
+	"\"fota_v2\":[\"APP\",\"MODEM\",\"BOOT\"]},\"deviceInfo\":{\"appVersion\":"
+	"\"1.1.0\",\"modemFirmware\":\"mfw_nrf9160_1.3.2\",\"imei\":\"352656100123456\","
+	"\"board\":\"nrf9160dk_nrf9160\",\"appName\":\"asset_tracker_v2\"}}},"
+	"\"metadata\":{\"config\":{\"GNSS\":{\"enable\":{\"timestamp\":1658935200},"
+	"\"interval\":{\"timestamp\":1658935200},\"timeout\":{\"timestamp\":1658935200}},"
+	"\"sampleRate\":{\"timestamp\":1658935200}}}}";
+
+static const char rest_fota_job[] =
+	"{\"jobId\":\"7a4f7d3e-7b1c-4e8a-9e7f-2c1d7c7b3e11\",\"jobDocument\":"
+	"{\"host\":\"firmware.nrfcloud.com\",\"path\":\"" TENANT
+	"/APP*1e29dfa3*v1.1.0/app_update.bin\",\"firmwareType\":\"APP\","
+	"\"fileSize\":184852,\"version\":\"v1.1.0\"},\"status\":\"QUEUED\","
+	"\"statusDetail\":\"\",\"createdAt\":\"2022-07-26T12:00:00.000Z\","
+	"\"lastUpdatedAt\":\"2022-07-26T12:00:00.000Z\"}";
+
+static const char fota_job[] =
+	"[\"7a4f7d3e-7b1c-4e8a-9e7f-2c1d7c7b3e11\",0,184852,\"firmware.nrfcloud.com\","
+	"\"" TENANT "\\/APP*1e29dfa3*v1.1.0\\/app_update.bin\"]";
+
+static const char fota_job_ble[] =
+	"[\"12:AB:34:CD:56:EF\",\"efgh5678\",0,321,\"firmware.nrfcloud.com\","
+	"\"v1\\/firmwares\\/ble.bin\"]";
+
+static const char pgps_array[] =
+	"[\"pgps.nrfcloud.com\",\"public/15131-0_15135-72000.bin\"]";
+
+static const char pgps_obj[] =
+	"{\"host\":\"pgps.nrfcloud.com\",\"path\":\"public/15131-0_15135-72000.bin\"}";
+
+static const char pgps_error[] =
+	"{\"appId\":\"PGPS\",\"messageType\":\"DATA\",\"err\":40499}";
+
+static const char agps_error[] =
+	"{\"appId\":\"AGPS\",\"messageType\":\"DATA\",\"err\":40410}";
+
+static const char disconnect[] =
+	"{\"appId\":\"DEVICE\",\"messageType\":\"DISCON\"}";
+
+static const char *const captured[] = {
+	shadow_delta_pin, shadow_delta_paired, shadow_desired_paired, shadow_delta_config,
+	rest_fota_job, fota_job, fota_job_ble, pgps_array, pgps_obj, pgps_error,
+	agps_error, disconnect,
+};
+
+/* Reference decoders, using cJSON the same way as the codec did before */
+enum ref_job_idx {
+	REF_JOB_IDX_BLE_ID,
+	REF_JOB_IDX_JOB_ID,
+	REF_JOB_IDX_FW_TYPE,
+	REF_JOB_IDX_FILE_SIZE,
+	REF_JOB_IDX_FILE_HOST,
+	REF_JOB_IDX_FILE_PATH,
+};
+
+static int ref_number_get(const cJSON *const array, const int index, int *number_out)
+{
+	cJSON *item = cJSON_GetArrayItem(array, index);
+
+	if (!cJSON_IsNumber(item)) {
+		return -EINVAL;
+	}
+
+	*number_out = item->valueint;
+
+	return 0;
+}
+
+static int ref_fota_job_decode(struct nrf_cloud_fota_job_info *const job_info,
+			       char **const ble_id, const char *const payload,
+			       cJSON **array_out)
+{
+	int err = -ENOMSG;
+	char *job_id = NULL;
+	const int offset = !ble_id ? 1 : 0;
+	cJSON *array = cJSON_Parse(payload);
+
+	memset(job_info, 0, sizeof(*job_info));
+	*array_out = array;
+
+	if (!array || !cJSON_IsArray(array)) {
+		job_info->type = NRF_CLOUD_FOTA_TYPE__INVALID;
+		return -EINVAL;
+	}
+
+	get_string_from_array(array, REF_JOB_IDX_JOB_ID - offset, &job_id);
+	job_info->id = job_id;
+
+	if (ble_id && get_string_from_array(array, REF_JOB_IDX_BLE_ID, ble_id)) {
+		goto cleanup;
+	}
+
+	if ((job_id == NULL) ||
+	    get_string_from_array(array, REF_JOB_IDX_FILE_HOST - offset, &job_info->host) ||
+	    get_string_from_array(array, REF_JOB_IDX_FILE_PATH - offset, &job_info->path) ||
+	    ref_number_get(array, REF_JOB_IDX_FW_TYPE - offset, (int *)&job_info->type) ||
+	    ref_number_get(array, REF_JOB_IDX_FILE_SIZE - offset, &job_info->file_size)) {
+		goto cleanup;
+	}
+
+	if (strlen(job_info->id) > (NRF_CLOUD_FOTA_JOB_ID_SIZE - 1)) {
+		goto cleanup;
+	}
+
+	if (job_info->type < NRF_CLOUD_FOTA_TYPE__FIRST ||
+	    job_info->type >= NRF_CLOUD_FOTA_TYPE__INVALID) {
+		goto cleanup;
+	}
+
+	return 0;
+
+cleanup:
+	if (job_id == NULL) {
+		memset(job_info, 0, sizeof(*job_info));
+	}
+	job_info->type = NRF_CLOUD_FOTA_TYPE__INVALID;
+	return err;
+}
+
+static char *ref_strdup(cJSON *const string_obj)
+{
+	char *dest;
+	char *src = cJSON_GetStringValue(string_obj);
+
+	if (!src) {
+		return NULL;
+	}
+
+	dest = nrf_cloud_calloc(strlen(src) + 1, 1);
+	if (dest) {
+		strcpy(dest, src);
+	}
+
+	return dest;
+}
+
+static int ref_rest_fota_parse(const char *const response, struct nrf_cloud_fota_job_info *const job)
+{
+	int ret = 0;
+	char *type;
+	cJSON *path_obj;
+	cJSON *host_obj;
+	cJSON *type_obj;
+	cJSON *size_obj;
+	cJSON *resp_obj = cJSON_Parse(response);
+	cJSON *job_doc  = cJSON_GetObjectItem(resp_obj, NRF_CLOUD_FOTA_REST_KEY_JOB_DOC);
+	cJSON *id_obj   = cJSON_GetObjectItem(resp_obj, NRF_CLOUD_FOTA_REST_KEY_JOB_ID);
+
+	memset(job, 0, sizeof(*job));
+
+	if (!job_doc || !id_obj) {
+		ret = -EBADMSG;
+		goto err_cleanup;
+	}
+
+	path_obj = cJSON_GetObjectItem(job_doc, NRF_CLOUD_FOTA_REST_KEY_PATH);
+	host_obj = cJSON_GetObjectItem(job_doc, NRF_CLOUD_FOTA_REST_KEY_HOST);
+	type_obj = cJSON_GetObjectItem(job_doc, NRF_CLOUD_FOTA_REST_KEY_TYPE);
+	size_obj = cJSON_GetObjectItem(job_doc, NRF_CLOUD_FOTA_REST_KEY_SIZE);
+
+	if (!path_obj || !host_obj || !type_obj || !size_obj) {
+		ret = -EPROTO;
+		goto err_cleanup;
+	}
+
+	if (!cJSON_IsNumber(size_obj)) {
+		ret = -ENOMSG;
+		goto err_cleanup;
+	}
+	job->file_size = size_obj->valueint;
+
+	job->id = ref_strdup(id_obj);
+	job->path = ref_strdup(path_obj);
+	job->host = ref_strdup(host_obj);
+
+	if (!job->id || !job->path || !job->host) {
+		ret = -ENOSTR;
+		goto err_cleanup;
+	}
+
+	type = cJSON_GetStringValue(type_obj);
+	if (!type) {
+		ret = -ENODATA;
+		goto err_cleanup;
+	}
+
+	if (!strcmp(type, NRF_CLOUD_FOTA_TYPE_MODEM_DELTA)) {
+		job->type = NRF_CLOUD_FOTA_MODEM_DELTA;
+	} else if (!strcmp(type, NRF_CLOUD_FOTA_TYPE_MODEM_FULL)) {
+		job->type = NRF_CLOUD_FOTA_MODEM_FULL;
+	} else if (!strcmp(type, NRF_CLOUD_FOTA_TYPE_BOOT)) {
+		job->type = NRF_CLOUD_FOTA_BOOTLOADER;
+	} else if (!strcmp(type, NRF_CLOUD_FOTA_TYPE_APP)) {
+		job->type = NRF_CLOUD_FOTA_APPLICATION;
+	} else {
+		job->type = NRF_CLOUD_FOTA_TYPE__INVALID;
+	}
+
+	cJSON_Delete(resp_obj);
+
+	return 0;
+
+err_cleanup:
+	cJSON_Delete(resp_obj);
+	nrf_cloud_fota_job_free(job);
+	memset(job, 0, sizeof(*job));
+	job->type = NRF_CLOUD_FOTA_TYPE__INVALID;
+
+	return ret;
+}
+
+static bool ref_string_exists(const cJSON *const obj, const char *const key,
+			      const char *const val)
+{
+	cJSON *item = cJSON_GetObjectItem(obj, key);
+	char *str_val;
+
+	if (!item) {
+		return false;
+	}
+
+	if (!val) {
+		return cJSON_IsNull(item);
+	}
+
+	str_val = cJSON_GetStringValue(item);
+
+	return str_val && (strcmp(str_val, val) == 0);
+}
+
+static int ref_handle_error_message(const char *const buf, const char *const app_id,
+				    const char *const msg_type, enum nrf_cloud_error *const err)
+{
+	int ret = 0;
+	cJSON *err_obj;
+	cJSON *root_obj = cJSON_Parse(buf);
+
+	*err = NRF_CLOUD_ERROR_NONE;
+
+	if (!root_obj) {
+		return -ENODATA;
+	}
+
+	err_obj = cJSON_GetObjectItem(root_obj, NRF_CLOUD_JSON_ERR_KEY);
+	if (!err_obj) {
+		ret = -ENOMSG;
+	} else if (!cJSON_IsNumber(err_obj)) {
+		ret = -EBADMSG;
+	} else {
+		*err = (enum nrf_cloud_error)cJSON_GetNumberValue(err_obj);
+
+		if ((msg_type &&
+		     !ref_string_exists(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY, msg_type)) ||
+		    (app_id && !ref_string_exists(root_obj, NRF_CLOUD_JSON_APPID_KEY, app_id))) {
+			ret = -ENOENT;
+		}
+	}
+
+	cJSON_Delete(root_obj);
+
+	return ret;
+}
+
+static char *ref_shadow_topic_get(const char *const shadow)
+{
+	cJSON *root_obj = cJSON_Parse(shadow);
+	cJSON *state_obj = cJSON_GetObjectItem(root_obj, "state");
+	cJSON *pairing_obj = cJSON_GetObjectItem(state_obj, "pairing");
+	cJSON *topics_obj = cJSON_GetObjectItem(pairing_obj, "topics");
+	char *topic = ref_strdup(cJSON_GetObjectItem(topics_obj, "d2c"));
+
+	cJSON_Delete(root_obj);
+
+	return topic;
+}
+
+static char *shadow_topic_get(const char *const shadow)
+{
+	struct nrf_cloud_json_tok root_obj;
+	struct nrf_cloud_json_tok tok;
+
+	if (nrf_cloud_json_find(shadow, strlen(shadow), "", &root_obj) ||
+	    nrf_cloud_json_tok_find(&root_obj, "state.pairing.topics.d2c", &tok)) {
+		return NULL;
+	}
+
+	return nrf_cloud_json_str_dup(&tok);
+}
+
+static void check_str_equal(const char *const out, const char *const ref)
+{
+	if (!out || !ref) {
+		zassert_equal(out, ref, "Only one string decoded");
+		return;
+	}
+
+	zassert_equal(strcmp(out, ref), 0, "Output differs from cJSON: %s, %s", out, ref);
+}
+
+static void check_job_equal(const struct nrf_cloud_fota_job_info *const job,
+			    const struct nrf_cloud_fota_job_info *const ref, const bool all)
+{
+	zassert_equal(job->type, ref->type, NULL);
+	check_str_equal(job->id, ref->id);
+
+	/* On failure, the remaining items may have been decoded in a different order */
+	if (all) {
+		check_str_equal(job->host, ref->host);
+		check_str_equal(job->path, ref->path);
+		zassert_equal(job->file_size, ref->file_size, NULL);
+	}
+}
+
+ZTEST_SUITE(nrf_cloud_decode_test, NULL, codec_test_setup, NULL, codec_test_after, NULL);
+
+ZTEST(nrf_cloud_decode_test, test_reader_tokens)
+{
+	static const char doc[] =
+		" {\"a\" : [1, -2.5e3, \"s\\\"t\"], \"b\":{}, \"c\":[true,false,null]} trailing";
+	static const struct {
+		enum nrf_cloud_json_type type;
+		const char *str;
+	} expected[] = {
+		{ NRF_CLOUD_JSON_TOK_OBJ, "{" },
+		{ NRF_CLOUD_JSON_TOK_KEY, "a" },
+		{ NRF_CLOUD_JSON_TOK_ARR, "[" },
+		{ NRF_CLOUD_JSON_TOK_NUM, "1" },
+		{ NRF_CLOUD_JSON_TOK_NUM, "-2.5e3" },
+		{ NRF_CLOUD_JSON_TOK_STR, "s\\\"t" },
+		{ NRF_CLOUD_JSON_TOK_ARR_END, "]" },
+		{ NRF_CLOUD_JSON_TOK_KEY, "b" },
+		{ NRF_CLOUD_JSON_TOK_OBJ, "{" },
+		{ NRF_CLOUD_JSON_TOK_OBJ_END, "}" },
+		{ NRF_CLOUD_JSON_TOK_KEY, "c" },
+		{ NRF_CLOUD_JSON_TOK_ARR, "[" },
+		{ NRF_CLOUD_JSON_TOK_TRUE, "true" },
+		{ NRF_CLOUD_JSON_TOK_FALSE, "false" },
+		{ NRF_CLOUD_JSON_TOK_NULL, "null" },
+		{ NRF_CLOUD_JSON_TOK_ARR_END, "]" },
+		{ NRF_CLOUD_JSON_TOK_OBJ_END, "}" },
+	};
+	struct nrf_cloud_json_reader r;
+	struct nrf_cloud_json_tok tok;
+
+	nrf_cloud_json_reader_init(&r, doc, strlen(doc));
+
+	for (size_t i = 0; i < ARRAY_SIZE(expected); i++) {
+		zassert_ok(nrf_cloud_json_next(&r, &tok), "Token %zu", i);
+		zassert_equal(tok.type, expected[i].type, "Token %zu", i);
+		zassert_equal(tok.len, strlen(expected[i].str), "Token %zu", i);
+		zassert_mem_equal(tok.ptr, expected[i].str, tok.len, "Token %zu", i);
+	}
+
+	/* Only the root value is read */
+	zassert_equal(nrf_cloud_json_next(&r, &tok), -ENODATA, NULL);
+
+	/* Skip a whole container */
+	nrf_cloud_json_reader_init(&r, doc, strlen(doc));
+	zassert_ok(nrf_cloud_json_next(&r, &tok), NULL);
+	zassert_ok(nrf_cloud_json_next(&r, &tok), NULL);
+	zassert_ok(nrf_cloud_json_next(&r, &tok), NULL);
+	zassert_ok(nrf_cloud_json_skip(&r, &tok), NULL);
+	zassert_ok(nrf_cloud_json_next(&r, &tok), NULL);
+	zassert_true(nrf_cloud_json_str_eq(&tok, "b", true), NULL);
+}
+
+ZTEST(nrf_cloud_decode_test, test_reader_invalid)
+{
+	static const char *const invalid[] = {
+		"", " ", "{", "}", "[", "[1,]", "[,1]", "{\"a\"}", "{\"a\":}", "{\"a\":1,}",
+		"{a:1}", "{\"a\" 1}", "[1 2]", "\"abc", "\"\\x\"", "\"\\u12g4\"", "\"\\udc00\"",
+		"\"\\ud800\"", "\"\\ud800\\u0041\"", "\"a\tb\"", "01", "1.", ".5", "-", "1e",
+		"+1", "tru", "nul", "[1}", "{\"a\":1]", "\f1",
+		"1234567890123456789012345678901234567890123456789012345678901234",
+	};
+	static const char *const valid[] = {
+		"0", "-0.5E-3", "\"\\ud83d\\ude00\"", "\"\\u0000\"", "[]", "{}", "null 1",
+		"\"\\/\\b\\f\\n\\r\\t\"", "123456789012345678901234567890123456789012345678901234567890123",
+	};
+	char deep[2 * (NRF_CLOUD_JSON_READER_DEPTH_MAX + 1) + 1];
+
+	for (size_t i = 0; i < ARRAY_SIZE(invalid); i++) {
+		zassert_equal(nrf_cloud_json_validate(invalid[i], strlen(invalid[i])), -EBADMSG,
+			      "Accepted %s", invalid[i]);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(valid); i++) {
+		zassert_ok(nrf_cloud_json_validate(valid[i], strlen(valid[i])),
+			   "Rejected %s", valid[i]);
+	}
+
+	/* Nesting deeper than the maximum depth */
+	memset(deep, '[', NRF_CLOUD_JSON_READER_DEPTH_MAX + 1);
+	memset(&deep[NRF_CLOUD_JSON_READER_DEPTH_MAX + 1], ']', NRF_CLOUD_JSON_READER_DEPTH_MAX + 1);
+	deep[sizeof(deep) - 1] = '\0';
+	zassert_equal(nrf_cloud_json_validate(deep, strlen(deep)), -E2BIG, NULL);
+	zassert_ok(nrf_cloud_json_validate(&deep[1], strlen(deep) - 2), NULL);
+}
+
+ZTEST(nrf_cloud_decode_test, test_reader_find)
+{
+#define FIRST_STATE "{\"a\":1,\"list\":[10,[20,21],{\"x\":\"y\"}]}"
+	static const char doc[] =
+		"{\"State\":" FIRST_STATE ",\"state\":{\"a\":2},\"str\":\"{}\"}";
+	struct nrf_cloud_json_tok tok;
+	struct nrf_cloud_json_tok obj;
+	int val;
+
+	/* Keys are not case sensitive, the first match is used */
+	zassert_ok(nrf_cloud_json_find(doc, strlen(doc), "state.a", &tok), NULL);
+	zassert_ok(nrf_cloud_json_int_get(&tok, &val), NULL);
+	zassert_equal(val, 1, NULL);
+
+	zassert_ok(nrf_cloud_json_find(doc, strlen(doc), "STATE", &obj), NULL);
+	zassert_equal(obj.type, NRF_CLOUD_JSON_TOK_OBJ, NULL);
+	zassert_equal(obj.len, strlen(FIRST_STATE), NULL);
+	zassert_mem_equal(obj.ptr, FIRST_STATE, obj.len, NULL);
+
+	zassert_ok(nrf_cloud_json_find(doc, strlen(doc), "", &obj), NULL);
+	zassert_equal(obj.len, strlen(doc), NULL);
+
+	zassert_ok(nrf_cloud_json_tok_find(&obj, "state.list.1.0", &tok), NULL);
+	zassert_ok(nrf_cloud_json_int_get(&tok, &val), NULL);
+	zassert_equal(val, 20, NULL);
+
+	zassert_ok(nrf_cloud_json_tok_find(&obj, "state.list.2.x", &tok), NULL);
+	zassert_true(nrf_cloud_json_str_eq(&tok, "y", true), NULL);
+
+	zassert_equal(nrf_cloud_json_tok_find(&obj, "state.list.3", &tok), -ENOENT, NULL);
+	zassert_equal(nrf_cloud_json_tok_find(&obj, "state.list.x", &tok), -ENOENT, NULL);
+	zassert_equal(nrf_cloud_json_tok_find(&obj, "state.a.b", &tok), -ENOENT, NULL);
+	zassert_equal(nrf_cloud_json_tok_find(&obj, "missing", &tok), -ENOENT, NULL);
+
+	/* A string is not searched, even if its content looks like JSON */
+	zassert_ok(nrf_cloud_json_tok_find(&obj, "str", &tok), NULL);
+	zassert_equal(nrf_cloud_json_tok_find(&tok, "", &obj), -ENOENT, NULL);
+
+	zassert_equal(nrf_cloud_json_find("{\"a\":[1,}", 9, "b", &tok), -EBADMSG, NULL);
+}
+
+ZTEST(nrf_cloud_decode_test, test_reader_values)
+{
+	static const char doc[] =
+		"[\"A\\u00e9\\ud83d\\ude00\\\"\\n\",\"a\\u0000b\",3000000000,-3000000000,-1.5]";
+	struct nrf_cloud_json_tok tok;
+	char buf[16];
+	char small[4];
+	char *dup;
+	double num;
+	int val;
+
+	zassert_ok(nrf_cloud_json_find(doc, strlen(doc), "0", &tok), NULL);
+	zassert_equal(nrf_cloud_json_str_get(&tok, NULL, 0), 9, NULL);
+	zassert_equal(nrf_cloud_json_str_get(&tok, buf, sizeof(buf)), 9, NULL);
+	zassert_equal(strcmp(buf, "A\xc3\xa9\xf0\x9f\x98\x80\"\n"), 0, NULL);
+	zassert_true(nrf_cloud_json_str_eq(&tok, "A\xc3\xa9\xf0\x9f\x98\x80\"\n", true), NULL);
+	zassert_false(nrf_cloud_json_str_eq(&tok, "a\xc3\xa9\xf0\x9f\x98\x80\"\n", true), NULL);
+	zassert_true(nrf_cloud_json_str_eq(&tok, "a\xc3\xa9\xf0\x9f\x98\x80\"\n", false), NULL);
+
+	/* Truncated, but still NULL terminated */
+	zassert_equal(nrf_cloud_json_str_get(&tok, small, sizeof(small)), -ENOBUFS, NULL);
+	zassert_equal(strlen(small), sizeof(small) - 1, NULL);
+
+	dup = nrf_cloud_json_str_dup(&tok);
+	zassert_not_null(dup, NULL);
+	zassert_equal(strcmp(dup, buf), 0, NULL);
+	nrf_cloud_free(dup);
+
+	/* The string ends at an escaped NULL character, as with cJSON */
+	zassert_ok(nrf_cloud_json_find(doc, strlen(doc), "1", &tok), NULL);
+	zassert_equal(nrf_cloud_json_str_get(&tok, buf, sizeof(buf)), 1, NULL);
+	zassert_true(nrf_cloud_json_str_eq(&tok, "a", true), NULL);
+	zassert_equal(nrf_cloud_json_num_get(&tok, &num), -EINVAL, NULL);
+
+	/* Integers saturate as with cJSON */
+	zassert_ok(nrf_cloud_json_find(doc, strlen(doc), "2", &tok), NULL);
+	zassert_ok(nrf_cloud_json_int_get(&tok, &val), NULL);
+	zassert_equal(val, INT_MAX, NULL);
+	zassert_ok(nrf_cloud_json_find(doc, strlen(doc), "3", &tok), NULL);
+	zassert_ok(nrf_cloud_json_int_get(&tok, &val), NULL);
+	zassert_equal(val, INT_MIN, NULL);
+	zassert_ok(nrf_cloud_json_find(doc, strlen(doc), "4", &tok), NULL);
+	zassert_ok(nrf_cloud_json_num_get(&tok, &num), NULL);
+	zassert_equal(num, -1.5, NULL);
+	zassert_ok(nrf_cloud_json_int_get(&tok, &val), NULL);
+	zassert_equal(val, -1, NULL);
+	zassert_equal(nrf_cloud_json_str_get(&tok, buf, sizeof(buf)), -EINVAL, NULL);
+}
+
+ZTEST(nrf_cloud_decode_test, test_requested_state)
+{
+	enum nfsm_state state = STATE_IDLE;
+	struct nrf_cloud_data input = { .ptr = shadow_delta_pin, .len = sizeof(shadow_delta_pin) };
+
+	zassert_ok(nrf_cloud_decode_requested_state(&input, &state), NULL);
+	zassert_equal(state, STATE_UA_PIN_WAIT, NULL);
+
+	memset(topic_prefix_set, 0, sizeof(topic_prefix_set));
+	input.ptr = shadow_delta_paired;
+	input.len = sizeof(shadow_delta_paired);
+	zassert_ok(nrf_cloud_decode_requested_state(&input, &state), NULL);
+	zassert_equal(state, STATE_UA_PIN_COMPLETE, NULL);
+	zassert_equal(strcmp(topic_prefix_set, PREFIX), 0, NULL);
+
+	/* The deprecated pairing states are not supported */
+	input.ptr = shadow_desired_paired;
+	input.len = sizeof(shadow_desired_paired);
+	zassert_equal(nrf_cloud_decode_requested_state(&input, &state), -ENOTSUP, NULL);
+
+	input.ptr = shadow_delta_config;
+	input.len = sizeof(shadow_delta_config);
+	zassert_equal(nrf_cloud_decode_requested_state(&input, &state), -ENOENT, NULL);
+
+	input.ptr = "{\"state\":";
+	input.len = strlen(input.ptr);
+	zassert_equal(nrf_cloud_decode_requested_state(&input, &state), -ENOENT, NULL);
+}
+
+ZTEST(nrf_cloud_decode_test, test_data_endpoint)
+{
+	struct nrf_cloud_data input = {
+		.ptr = shadow_delta_paired,
+		.len = sizeof(shadow_delta_paired)
+	};
+	struct nrf_cloud_data tx = { 0 };
+	struct nrf_cloud_data rx = { 0 };
+	struct nrf_cloud_data bulk = { 0 };
+	struct nrf_cloud_data m = { 0 };
+
+	zassert_ok(nrf_cloud_decode_data_endpoint(&input, &tx, &rx, &bulk, &m), NULL);
+	zassert_equal(strcmp(tx.ptr, D2C), 0, NULL);
+	zassert_equal(tx.len, strlen(D2C), NULL);
+	zassert_equal(strcmp(rx.ptr, C2D), 0, NULL);
+	zassert_equal(strcmp(bulk.ptr, D2C NRF_CLOUD_BULK_MSG_TOPIC), 0, NULL);
+	zassert_equal(strcmp(m.ptr, PREFIX), 0, NULL);
+	nrf_cloud_free((void *)tx.ptr);
+	nrf_cloud_free((void *)rx.ptr);
+	nrf_cloud_free((void *)bulk.ptr);
+	nrf_cloud_free((void *)m.ptr);
+
+	/* Escaped topic in the desired state, without a topic prefix */
+	input.ptr = shadow_desired_paired;
+	input.len = sizeof(shadow_desired_paired);
+	memset(&m, 0, sizeof(m));
+	zassert_ok(nrf_cloud_decode_data_endpoint(&input, &tx, &rx, &bulk, &m), NULL);
+	zassert_equal(strcmp(tx.ptr, D2C), 0, NULL);
+	zassert_is_null(m.ptr, NULL);
+	nrf_cloud_free((void *)tx.ptr);
+	nrf_cloud_free((void *)rx.ptr);
+	nrf_cloud_free((void *)bulk.ptr);
+
+	/* Not paired yet */
+	input.ptr = shadow_delta_pin;
+	input.len = sizeof(shadow_delta_pin);
+	zassert_equal(nrf_cloud_decode_data_endpoint(&input, &tx, &rx, &bulk, NULL), -ENOENT,
+		      NULL);
+}
+
+ZTEST(nrf_cloud_decode_test, test_rest_fota_job)
+{
+	struct nrf_cloud_fota_job_info job;
+	struct nrf_cloud_fota_job_info ref;
+	char doc[sizeof(rest_fota_job)];
+
+	zassert_ok(nrf_cloud_rest_fota_execution_parse(rest_fota_job, &job), NULL);
+	zassert_ok(ref_rest_fota_parse(rest_fota_job, &ref), NULL);
+	zassert_equal(job.type, NRF_CLOUD_FOTA_APPLICATION, NULL);
+	zassert_equal(job.file_size, 184852, NULL);
+	check_job_equal(&job, &ref, true);
+	nrf_cloud_fota_job_free(&job);
+	nrf_cloud_fota_job_free(&ref);
+
+	/* Unknown firmware type */
+	strcpy(doc, rest_fota_job);
+	memcpy(strstr(doc, "\"APP\""), "\"XYZ\"", 5);
+	zassert_ok(nrf_cloud_rest_fota_execution_parse(doc, &job), NULL);
+	zassert_equal(job.type, NRF_CLOUD_FOTA_TYPE__INVALID, NULL);
+	nrf_cloud_fota_job_free(&job);
+
+	/* File size is not a number */
+	strcpy(doc, rest_fota_job);
+	memcpy(strstr(doc, "184852"), "\"1848\"", 6);
+	zassert_equal(nrf_cloud_rest_fota_execution_parse(doc, &job), -ENOMSG, NULL);
+	zassert_is_null(job.id, NULL);
+
+	zassert_equal(nrf_cloud_rest_fota_execution_parse("{\"jobId\":\"1\"}", &job), -EBADMSG,
+		      NULL);
+	zassert_equal(nrf_cloud_rest_fota_execution_parse(
+		"{\"jobId\":\"1\",\"jobDocument\":{\"host\":\"a\"}}", &job), -EPROTO, NULL);
+}
+
+ZTEST(nrf_cloud_decode_test, test_fota_job)
+{
+	struct nrf_cloud_fota_job_info job;
+	char *ble_id;
+	char doc[MAX(sizeof(fota_job), sizeof(fota_job_ble))];
+
+	strcpy(doc, fota_job);
+	zassert_ok(nrf_cloud_fota_job_decode(&job, NULL, doc), NULL);
+	zassert_equal(strcmp(job.id, "7a4f7d3e-7b1c-4e8a-9e7f-2c1d7c7b3e11"), 0, NULL);
+	zassert_equal(job.type, NRF_CLOUD_FOTA_APPLICATION, NULL);
+	zassert_equal(job.file_size, 184852, NULL);
+	zassert_equal(strcmp(job.host, "firmware.nrfcloud.com"), 0, NULL);
+	zassert_equal(strcmp(job.path, TENANT "/APP*1e29dfa3*v1.1.0/app_update.bin"), 0, NULL);
+
+	strcpy(doc, fota_job_ble);
+	zassert_ok(nrf_cloud_fota_job_decode(&job, &ble_id, doc), NULL);
+	zassert_equal(strcmp(ble_id, "12:AB:34:CD:56:EF"), 0, NULL);
+	zassert_equal(strcmp(job.id, "efgh5678"), 0, NULL);
+	zassert_equal(job.file_size, 321, NULL);
+	zassert_equal(strcmp(job.path, "v1/firmwares/ble.bin"), 0, NULL);
+
+	/* The job ID is kept, so that the job can be rejected */
+	strcpy(doc, "[\"abcd1234\",9,1234,\"nrfcloud.com\",\"appfw.bin\"]");
+	zassert_equal(nrf_cloud_fota_job_decode(&job, NULL, doc), -ENOMSG, NULL);
+	zassert_equal(strcmp(job.id, "abcd1234"), 0, NULL);
+	zassert_equal(job.type, NRF_CLOUD_FOTA_TYPE__INVALID, NULL);
+
+	strcpy(doc, "[\"abcd1234\",0,1234,\"nrfcloud.com\"]");
+	zassert_equal(nrf_cloud_fota_job_decode(&job, NULL, doc), -ENOMSG, NULL);
+	zassert_not_null(job.id, NULL);
+
+	strcpy(doc, "[1,0,1234,\"nrfcloud.com\",\"appfw.bin\"]");
+	zassert_equal(nrf_cloud_fota_job_decode(&job, NULL, doc), -ENOMSG, NULL);
+	zassert_is_null(job.id, NULL);
+	zassert_is_null(job.host, NULL);
+
+	strcpy(doc, "{\"id\":\"abcd1234\"}");
+	zassert_equal(nrf_cloud_fota_job_decode(&job, NULL, doc), -EINVAL, NULL);
+	zassert_equal(job.type, NRF_CLOUD_FOTA_TYPE__INVALID, NULL);
+}
+
+ZTEST(nrf_cloud_decode_test, test_pgps_response)
+{
+	char host[32];
+	char path[48];
+	struct nrf_cloud_pgps_result result = {
+		.host = host,
+		.host_sz = sizeof(host),
+		.path = path,
+		.path_sz = sizeof(path)
+	};
+
+	zassert_ok(nrf_cloud_parse_pgps_response(pgps_array, &result), NULL);
+	zassert_equal(strcmp(host, "pgps.nrfcloud.com"), 0, NULL);
+	zassert_equal(strcmp(path, "public/15131-0_15135-72000.bin"), 0, NULL);
+
+	memset(host, 0, sizeof(host));
+	memset(path, 0, sizeof(path));
+	zassert_ok(nrf_cloud_parse_pgps_response(pgps_obj, &result), NULL);
+	zassert_equal(strcmp(host, "pgps.nrfcloud.com"), 0, NULL);
+	zassert_equal(strcmp(path, "public/15131-0_15135-72000.bin"), 0, NULL);
+
+	zassert_equal(nrf_cloud_parse_pgps_response(pgps_error, &result), -EFAULT, NULL);
+	zassert_equal(nrf_cloud_parse_pgps_response(agps_error, &result), -EPROTO, NULL);
+	zassert_equal(nrf_cloud_parse_pgps_response("[\"host\",1]", &result), -EPROTO, NULL);
+	zassert_equal(nrf_cloud_parse_pgps_response("[\"host\"", &result), -EBADMSG, NULL);
+
+	/* Neither output is modified if one does not fit */
+	memset(host, 0, sizeof(host));
+	result.path_sz = strlen("public/15131-0_15135-72000.bin");
+	zassert_equal(nrf_cloud_parse_pgps_response(pgps_obj, &result), -ENOBUFS, NULL);
+	zassert_equal(host[0], '\0', NULL);
+}
+
+ZTEST(nrf_cloud_decode_test, test_error_message)
+{
+	enum nrf_cloud_error err;
+
+	zassert_ok(nrf_cloud_handle_error_message(pgps_error, NRF_CLOUD_JSON_APPID_VAL_PGPS,
+						  NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA, &err), NULL);
+	zassert_equal(err, 40499, NULL);
+
+	zassert_equal(nrf_cloud_handle_error_message(agps_error, NRF_CLOUD_JSON_APPID_VAL_PGPS,
+						     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA, &err),
+		      -ENOENT, NULL);
+	zassert_ok(nrf_cloud_handle_error_message(agps_error, NULL, NULL, &err), NULL);
+	zassert_equal(err, 40410, NULL);
+
+	zassert_equal(nrf_cloud_handle_error_message(pgps_obj, NULL, NULL, &err), -ENOMSG, NULL);
+	zassert_equal(nrf_cloud_handle_error_message("{\"err\":\"1\"}", NULL, NULL, &err),
+		      -EBADMSG, NULL);
+	zassert_equal(nrf_cloud_handle_error_message("not json", NULL, NULL, &err), -ENODATA,
+		      NULL);
+
+	zassert_true(nrf_cloud_detect_disconnection_request(disconnect), NULL);
+	zassert_false(nrf_cloud_detect_disconnection_request(pgps_error), NULL);
+	zassert_false(nrf_cloud_detect_disconnection_request(
+		"{\"appId\":\"DEVICE\",\"messageType\":\"DISCONNECTED\"}"), NULL);
+	zassert_false(nrf_cloud_detect_disconnection_request(
+		"{\"appId\":\"DEVICE\",\"messageType\":\"DISCON\""), NULL);
+}
+
+static uint32_t rand_state = 0x2545F491;
+
+/* Xorshift, the sequence is the same on every platform */
+static uint32_t rand_get(void)
+{
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static size_t mutate(char *const buf, size_t len, const size_t size)
+{
+	static const char alphabet[] = "{}[]\":,\\ /u0123456789abcdefABCDEF.eE+-tfnlrsx";
+	char c = alphabet[rand_get() % (sizeof(alphabet) - 1)];
+	size_t pos;
+
+	/* Sometimes use any other character */
+	if (!(rand_get() % 8)) {
+		c = 1 + (rand_get() % 255);
+	}
+
+	if (!len) {
+		buf[len++] = c;
+		buf[len] = '\0';
+		return len;
+	}
+
+	pos = rand_get() % len;
+
+	switch (rand_get() % 4) {
+	case 0:
+		buf[pos] = c;
+		break;
+	case 1:
+		memmove(&buf[pos], &buf[pos + 1], len - pos);
+		len--;
+		break;
+	case 2:
+		if (len + 1 < size) {
+			memmove(&buf[pos + 1], &buf[pos], len - pos + 1);
+			buf[pos] = c;
+			len++;
+		}
+		break;
+	default:
+		len = pos;
+		break;
+	}
+
+	buf[len] = '\0';
+
+	return len;
+}
+
+/* Check that every value cJSON parsed is found with the same value */
+static void tree_compare(const char *const doc, const cJSON *const item, char *const path)
+{
+	const size_t path_len = strlen(path);
+	struct nrf_cloud_json_tok tok;
+	const cJSON *child;
+	double num;
+	char *str;
+	int val;
+	int i = 0;
+
+	zassert_ok(nrf_cloud_json_find(doc, strlen(doc), path, &tok), "%s: %s", doc, path);
+
+	switch (item->type & 0xFF) {
+	case cJSON_False:
+		zassert_equal(tok.type, NRF_CLOUD_JSON_TOK_FALSE, "%s: %s", doc, path);
+		break;
+	case cJSON_True:
+		zassert_equal(tok.type, NRF_CLOUD_JSON_TOK_TRUE, "%s: %s", doc, path);
+		break;
+	case cJSON_NULL:
+		zassert_equal(tok.type, NRF_CLOUD_JSON_TOK_NULL, "%s: %s", doc, path);
+		break;
+	case cJSON_Number:
+		zassert_ok(nrf_cloud_json_num_get(&tok, &num), "%s: %s", doc, path);
+		zassert_ok(nrf_cloud_json_int_get(&tok, &val), "%s: %s", doc, path);
+		zassert_equal(num, item->valuedouble, "%s: %s", doc, path);
+		zassert_equal(val, item->valueint, "%s: %s", doc, path);
+		break;
+	case cJSON_String:
+		str = nrf_cloud_json_str_dup(&tok);
+		zassert_not_null(str, "%s: %s", doc, path);
+		zassert_equal(strcmp(str, item->valuestring), 0, "%s: %s", doc, path);
+		zassert_true(nrf_cloud_json_str_eq(&tok, item->valuestring, true), NULL);
+		nrf_cloud_free(str);
+		break;
+	case cJSON_Array:
+		zassert_equal(tok.type, NRF_CLOUD_JSON_TOK_ARR, "%s: %s", doc, path);
+		cJSON_ArrayForEach(child, item) {
+			if (snprintk(&path[path_len], PATH_SIZE - path_len, "%s%d",
+				     path_len ? "." : "", i++) < PATH_SIZE - path_len) {
+				tree_compare(doc, child, path);
+			}
+			path[path_len] = '\0';
+		}
+		break;
+	case cJSON_Object:
+		zassert_equal(tok.type, NRF_CLOUD_JSON_TOK_OBJ, "%s: %s", doc, path);
+		cJSON_ArrayForEach(child, item) {
+			/* Keys that can not be part of a path, and members hidden by
+			 * a previous member with the same key, are not compared.
+			 */
+			if (!child->string[0] || strchr(child->string, '.') ||
+			    (cJSON_GetObjectItem(item, child->string) != child)) {
+				continue;
+			}
+
+			if (snprintk(&path[path_len], PATH_SIZE - path_len, "%s%s",
+				     path_len ? "." : "", child->string) < PATH_SIZE - path_len) {
+				tree_compare(doc, child, path);
+			}
+			path[path_len] = '\0';
+		}
+		break;
+	default:
+		zassert_unreachable("Unexpected cJSON type %d", item->type);
+	}
+}
+
+static void fuzz_compare(char *const doc)
+{
+	char copy[FUZZ_BUF_SIZE];
+	char path[PATH_SIZE] = "";
+	struct nrf_cloud_fota_job_info job;
+	struct nrf_cloud_fota_job_info ref;
+	enum nrf_cloud_error err;
+	enum nrf_cloud_error ref_err;
+	enum nfsm_state state;
+	char *ble_id;
+	char *ref_ble_id;
+	cJSON *ref_array;
+	cJSON *root;
+	int ret;
+	int ref_ret;
+
+	if (nrf_cloud_json_validate(doc, strlen(doc))) {
+		/* Anything else is only checked not to crash nor leak */
+		(void)nrf_cloud_rest_fota_execution_parse(doc, &job);
+		(void)nrf_cloud_handle_error_message(doc, NULL, NULL, &err);
+		strcpy(copy, doc);
+		(void)nrf_cloud_fota_job_decode(&job, NULL, copy);
+		return;
+	}
+
+	/* The reader is stricter than cJSON */
+	root = cJSON_Parse(doc);
+	zassert_not_null(root, "Not accepted by cJSON: %s", doc);
+	tree_compare(doc, root, path);
+	cJSON_Delete(root);
+
+	ret = nrf_cloud_rest_fota_execution_parse(doc, &job);
+	ref_ret = ref_rest_fota_parse(doc, &ref);
+	zassert_equal(ret, ref_ret, "%s", doc);
+	check_job_equal(&job, &ref, true);
+	nrf_cloud_fota_job_free(&job);
+	nrf_cloud_fota_job_free(&ref);
+
+	ret = nrf_cloud_handle_error_message(doc, NRF_CLOUD_JSON_APPID_VAL_PGPS,
+					     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA, &err);
+	ref_ret = ref_handle_error_message(doc, NRF_CLOUD_JSON_APPID_VAL_PGPS,
+					   NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA, &ref_err);
+	zassert_equal(ret, ref_ret, "%s", doc);
+	zassert_equal(err, ref_err, "%s", doc);
+
+	for (int ble = 0; ble < 2; ble++) {
+		strcpy(copy, doc);
+		ret = nrf_cloud_fota_job_decode(&job, ble ? &ble_id : NULL, copy);
+		ref_ret = ref_fota_job_decode(&ref, ble ? &ref_ble_id : NULL, doc, &ref_array);
+		zassert_equal(ret, ref_ret, "%s", doc);
+		check_job_equal(&job, &ref, !ret);
+		if (ble && !ret) {
+			check_str_equal(ble_id, ref_ble_id);
+		}
+		cJSON_Delete(ref_array);
+	}
+
+	/* The shadow decoding has no reference, check that it does not crash nor leak */
+	struct nrf_cloud_data input = { .ptr = doc, .len = strlen(doc) + 1 };
+	struct nrf_cloud_data endpoints[4] = { 0 };
+
+	(void)nrf_cloud_decode_requested_state(&input, &state);
+	(void)nrf_cloud_decode_data_endpoint(&input, &endpoints[0], &endpoints[1],
+					     &endpoints[2], &endpoints[3]);
+	for (size_t i = 0; i < ARRAY_SIZE(endpoints); i++) {
+		nrf_cloud_free((void *)endpoints[i].ptr);
+	}
+}
+
+ZTEST(nrf_cloud_decode_test, test_decode_fuzz)
+{
+	static char doc[FUZZ_BUF_SIZE];
+	size_t len;
+
+	for (size_t i = 0; i < ARRAY_SIZE(captured); i++) {
+		strcpy(doc, captured[i]);
+		fuzz_compare(doc);
+
+		for (int j = 0; j < FUZZ_ITERATIONS; j++) {
+			strcpy(doc, captured[i]);
+			len = strlen(doc);
+
+			for (int k = 1 + (rand_get() % 3); k > 0; k--) {
+				len = mutate(doc, len, sizeof(doc));
+			}
+
+			fuzz_compare(doc);
+		}
+	}
+}
+
+enum decode_type {
+	DECODE_SHADOW,
+	DECODE_REST_FOTA_JOB,
+	DECODE_FOTA_JOB,
+	DECODE_ERROR_MSG,
+	DECODE_TYPE_COUNT
+};
+
+static const char *const decode_type_str[] = {
+	[DECODE_SHADOW] = "shadow",
+	[DECODE_REST_FOTA_JOB] = "REST FOTA job",
+	[DECODE_FOTA_JOB] = "FOTA job",
+	[DECODE_ERROR_MSG] = "error message",
+};
+
+static void decode(const enum decode_type type, const bool ref)
+{
+	struct nrf_cloud_fota_job_info job;
+	enum nrf_cloud_error err;
+	char doc[sizeof(fota_job)];
+	cJSON *array;
+	char *topic;
+
+	switch (type) {
+	case DECODE_SHADOW:
+		topic = ref ? ref_shadow_topic_get(shadow_delta_paired) :
+			      shadow_topic_get(shadow_delta_paired);
+		zassert_not_null(topic, NULL);
+		nrf_cloud_free(topic);
+		break;
+	case DECODE_REST_FOTA_JOB:
+		zassert_ok(ref ? ref_rest_fota_parse(rest_fota_job, &job) :
+				 nrf_cloud_rest_fota_execution_parse(rest_fota_job, &job), NULL);
+		nrf_cloud_fota_job_free(&job);
+		break;
+	case DECODE_FOTA_JOB:
+		/* The payload buffer is allocated by the FOTA library in both cases */
+		strcpy(doc, fota_job);
+		if (ref) {
+			zassert_ok(ref_fota_job_decode(&job, NULL, doc, &array), NULL);
+			cJSON_Delete(array);
+		} else {
+			zassert_ok(nrf_cloud_fota_job_decode(&job, NULL, doc), NULL);
+		}
+		break;
+	case DECODE_ERROR_MSG:
+		zassert_ok(ref ? ref_handle_error_message(pgps_error, NRF_CLOUD_JSON_APPID_VAL_PGPS,
+							  NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA, &err) :
+				 nrf_cloud_handle_error_message(pgps_error,
+								NRF_CLOUD_JSON_APPID_VAL_PGPS,
+								NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA,
+								&err), NULL);
+		break;
+	default:
+		zassert_unreachable(NULL);
+	}
+}
+
+ZTEST(nrf_cloud_decode_test, test_decode_performance)
+{
+	TC_PRINT("%-16s %12s %12s %12s %12s\n", "message",
+		 "heap (B)", "cJSON heap", "time (us)", "cJSON time");
+
+	for (enum decode_type type = 0; type < DECODE_TYPE_COUNT; type++) {
+		size_t peak = 0;
+		size_t ref_peak = 0;
+		uint32_t start;
+		uint64_t cycles = 0;
+		uint64_t ref_cycles = 0;
+
+		for (int i = 0; i < PERF_ITERATIONS; i++) {
+			heap_peak_reset();
+			start = k_cycle_get_32();
+			decode(type, false);
+			cycles += k_cycle_get_32() - start;
+			peak = heap_peak - heap_used;
+
+			heap_peak_reset();
+			start = k_cycle_get_32();
+			decode(type, true);
+			ref_cycles += k_cycle_get_32() - start;
+			ref_peak = heap_peak - heap_used;
+		}
+
+		TC_PRINT("%-16s %12zu %12zu %12llu %12llu\n", decode_type_str[type],
+			 peak, ref_peak,
+			 k_cyc_to_us_floor64(cycles / PERF_ITERATIONS),
+			 k_cyc_to_us_floor64(ref_cycles / PERF_ITERATIONS));
+
+		/* Only the decoded strings are allocated */
+		zassert_true(peak < ref_peak, NULL);
+	}
+}
@@ -0,0 +1,719 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <net/nrf_cloud.h>
+#include <modem/modem_info.h>
+
+#include "nrf_cloud_codec.h"
+#include "nrf_cloud_json_writer.h"
+#include "nrf_cloud_mem.h"
+#include "nrf_cloud_transport.h"
+#include "nrf_cloud_fsm.h"
+#include "common.h"
+
+/* Number of encodings timed for every message type */
+#define PERF_ITERATIONS 200
+
+/* Size of the header used to track the size of the allocated blocks */
+#define ALLOC_HDR_SIZE 8
+
+size_t heap_used;
+size_t heap_peak;
+char topic_prefix_set[TOPIC_PREFIX_SIZE];
+
+static void *test_malloc(size_t size)
+{
+	uint8_t *ptr = k_malloc(size + ALLOC_HDR_SIZE);
+
+	if (!ptr) {
+		return NULL;
+	}
+
+	*(size_t *)ptr = size;
+	heap_used += size;
+	heap_peak = MAX(heap_peak, heap_used);
+
+	return ptr + ALLOC_HDR_SIZE;
+}
+
+static void *test_calloc(size_t count, size_t size)
+{
+	void *ptr = test_malloc(count * size);
+
+	if (ptr) {
+		memset(ptr, 0, count * size);
+	}
+
+	return ptr;
+}
+
+static void test_free(void *ptr)
+{
+	if (!ptr) {
+		return;
+	}
+
+	uint8_t *block = (uint8_t *)ptr - ALLOC_HDR_SIZE;
+
+	heap_used -= *(size_t *)block;
+	k_free(block);
+}
+
+void heap_peak_reset(void)
+{
+	heap_peak = heap_used;
+}
+
+/* Stubs of the transport, used by the MQTT part of the codec */
+enum nfsm_state nfsm_get_current_state(void)
+{
+	return STATE_DC_CONNECTED;
+}
+
+int nct_dc_send(const struct nct_dc_data *dc)
+{
+	return 0;
+}
+
+void nct_dc_endpoint_get(struct nrf_cloud_data *tx_endpoint,
+			 struct nrf_cloud_data *rx_endpoint,
+			 struct nrf_cloud_data *bulk_endpoint,
+			 struct nrf_cloud_data *m_endpoint)
+{
+}
+
+void nct_set_topic_prefix(const char *topic_prefix)
+{
+	strncpy(topic_prefix_set, topic_prefix, sizeof(topic_prefix_set) - 1);
+}
+
+/* Stubs of the modem info library, returning fixed values */
+static const struct {
+	const char *name;
+	enum at_param_type type;
+} modem_info_desc[MODEM_INFO_COUNT] = {
+	[MODEM_INFO_RSRP] =		{ "rsrp", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_CUR_BAND] =		{ "currentBand", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_SUP_BAND] =		{ "supportedBands", AT_PARAM_TYPE_STRING },
+	[MODEM_INFO_AREA_CODE] =	{ "areaCode", AT_PARAM_TYPE_STRING },
+	[MODEM_INFO_UE_MODE] =		{ "ueMode", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_OPERATOR] =		{ "mccmnc", AT_PARAM_TYPE_STRING },
+	[MODEM_INFO_MCC] =		{ "mcc", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_MNC] =		{ "mnc", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_CELLID] =		{ "cellID", AT_PARAM_TYPE_STRING },
+	[MODEM_INFO_IP_ADDRESS] =	{ "ipAddress", AT_PARAM_TYPE_STRING },
+	[MODEM_INFO_UICC] =		{ "uiccMode", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_BATTERY] =		{ "batteryVoltage", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_FW_VERSION] =	{ "modemFirmware", AT_PARAM_TYPE_STRING },
+	[MODEM_INFO_ICCID] =		{ "iccid", AT_PARAM_TYPE_STRING },
+	[MODEM_INFO_LTE_MODE] =		{ "lteMode", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_NBIOT_MODE] =	{ "nbiotMode", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_GPS_MODE] =		{ "gpsMode", AT_PARAM_TYPE_NUM_INT },
+	[MODEM_INFO_IMSI] =		{ "imsi", AT_PARAM_TYPE_STRING },
+	[MODEM_INFO_IMEI] =		{ "imei", AT_PARAM_TYPE_STRING },
+};
+
+int modem_info_init(void)
+{
+	return 0;
+}
+
+int modem_info_name_get(enum modem_info info, char *name)
+{
+	if (info >= MODEM_INFO_COUNT || !modem_info_desc[info].name) {
+		return -EINVAL;
+	}
+
+	strcpy(name, modem_info_desc[info].name);
+
+	return strlen(name);
+}
+
+enum at_param_type modem_info_type_get(enum modem_info info)
+{
+	if (info >= MODEM_INFO_COUNT || !modem_info_desc[info].name) {
+		return -EINVAL;
+	}
+
+	return modem_info_desc[info].type;
+}
+
+static void lte_param_set(struct lte_param *param, enum modem_info type, uint16_t value,
+			  const char *value_string)
+{
+	param->type = type;
+	param->value = value;
+	strcpy(param->value_string, value_string);
+}
+
+int modem_info_params_init(struct modem_param_info *modem)
+{
+	memset(modem, 0, sizeof(*modem));
+
+	return 0;
+}
+
+int modem_info_params_get(struct modem_param_info *modem)
+{
+	lte_param_set(&modem->network.current_band, MODEM_INFO_CUR_BAND, 20, "");
+	lte_param_set(&modem->network.sup_band, MODEM_INFO_SUP_BAND, 0, "(1,2,3,4,5,8,12,13,20)");
+	lte_param_set(&modem->network.area_code, MODEM_INFO_AREA_CODE, 30401, "76C1");
+	lte_param_set(&modem->network.current_operator, MODEM_INFO_OPERATOR, 0, "24202");
+	lte_param_set(&modem->network.mcc, MODEM_INFO_MCC, 242, "");
+	lte_param_set(&modem->network.mnc, MODEM_INFO_MNC, 2, "");
+	lte_param_set(&modem->network.cellid_hex, MODEM_INFO_CELLID, 0, "0138F10F");
+	lte_param_set(&modem->network.ip_address, MODEM_INFO_IP_ADDRESS, 0, "10.160.33.51");
+	lte_param_set(&modem->network.ue_mode, MODEM_INFO_UE_MODE, 2, "");
+	lte_param_set(&modem->network.lte_mode, MODEM_INFO_LTE_MODE, 1, "");
+	lte_param_set(&modem->network.nbiot_mode, MODEM_INFO_NBIOT_MODE, 0, "");
+	lte_param_set(&modem->network.gps_mode, MODEM_INFO_GPS_MODE, 1, "");
+	lte_param_set(&modem->network.rsrp, MODEM_INFO_RSRP, 55, "");
+	modem->network.cellid_dec = 20508943;
+
+	lte_param_set(&modem->sim.uicc, MODEM_INFO_UICC, 1, "");
+	lte_param_set(&modem->sim.iccid, MODEM_INFO_ICCID, 0, "8931080019073497795F");
+	lte_param_set(&modem->sim.imsi, MODEM_INFO_IMSI, 0, "242016000001234");
+
+	lte_param_set(&modem->device.modem_fw, MODEM_INFO_FW_VERSION, 0, "mfw_nrf9160_1.3.2");
+	lte_param_set(&modem->device.battery, MODEM_INFO_BATTERY, 4962, "");
+	lte_param_set(&modem->device.imei, MODEM_INFO_IMEI, 0, "352656100367872");
+	modem->device.board = "nrf9160dk_nrf9160_ns";
+	modem->device.app_version = "1.0.0-\"rc1\"\\beta\t";
+	modem->device.app_name = "codec_test";
+
+	return 0;
+}
+
+/* Reference encoders, building the messages with cJSON the way the codec did
+ * before the streaming writer was introduced.
+ */
+static char *ref_sensor_data(const struct nrf_cloud_sensor_data *sensor)
+{
+	cJSON *root_obj = cJSON_CreateObject();
+	char *buffer;
+
+	/* Only the temperature sensor is used in the tests */
+	zassert_equal(sensor->type, NRF_CLOUD_SENSOR_TEMP, NULL);
+	cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_APPID_KEY,
+				  NRF_CLOUD_JSON_APPID_VAL_TEMP);
+	cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
+	cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				  NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+
+	buffer = cJSON_PrintUnformatted(root_obj);
+	cJSON_Delete(root_obj);
+
+	return buffer;
+}
+
+static char *ref_device_status(const struct nrf_cloud_device_status *dev_status,
+			       const bool include_state)
+{
+	cJSON *root_obj = cJSON_CreateObject();
+	cJSON *reported_obj;
+	char *buffer = NULL;
+
+	if (include_state) {
+		cJSON *state_obj = cJSON_AddObjectToObjectCS(root_obj, "state");
+
+		reported_obj = cJSON_AddObjectToObjectCS(state_obj, "reported");
+	} else {
+		reported_obj = cJSON_AddObjectToObjectCS(root_obj, "reported");
+	}
+
+	cJSON *device_obj = cJSON_AddObjectToObjectCS(reported_obj, "device");
+	cJSON *svc_inf_obj = cJSON_AddObjectToObjectCS(device_obj, "serviceInfo");
+
+	if ((dev_status->modem &&
+	     nrf_cloud_modem_info_json_encode(dev_status->modem, device_obj)) ||
+	    (dev_status->svc &&
+	     nrf_cloud_service_info_json_encode(dev_status->svc, svc_inf_obj))) {
+		goto cleanup;
+	}
+
+	buffer = cJSON_PrintUnformatted(root_obj);
+
+cleanup:
+	cJSON_Delete(root_obj);
+
+	return buffer;
+}
+
+static char *ref_location_req(const struct lte_lc_cells_info *cells,
+			      const struct wifi_scan_info *wifi)
+{
+	cJSON *req_obj = cJSON_CreateObject();
+	char *buffer = NULL;
+
+	if ((cells && nrf_cloud_format_cell_pos_req_json(cells, req_obj)) ||
+	    (wifi && nrf_cloud_format_wifi_req_json(wifi, req_obj))) {
+		goto cleanup;
+	}
+
+	buffer = cJSON_PrintUnformatted(req_obj);
+
+cleanup:
+	cJSON_Delete(req_obj);
+
+	return buffer;
+}
+
+static char *ref_location_msg(const struct lte_lc_cells_info *cells,
+			      const struct wifi_scan_info *wifi, const bool request_loc)
+{
+	cJSON *req_obj = json_create_req_obj(NRF_CLOUD_JSON_APPID_VAL_LOCATION,
+					     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	cJSON *data_obj = cJSON_AddObjectToObject(req_obj, NRF_CLOUD_JSON_DATA_KEY);
+	char *buffer = NULL;
+
+	if ((cells && nrf_cloud_format_cell_pos_req_json(cells, data_obj)) ||
+	    (wifi && nrf_cloud_format_wifi_req_json(wifi, data_obj)) ||
+	    (!request_loc &&
+	     !cJSON_AddNumberToObjectCS(data_obj, NRF_CLOUD_LOCATION_KEY_DOREPLY, 0))) {
+		goto cleanup;
+	}
+
+	buffer = cJSON_PrintUnformatted(req_obj);
+
+cleanup:
+	cJSON_Delete(req_obj);
+
+	return buffer;
+}
+
+static char *ref_gnss_msg(const struct nrf_cloud_gnss_data *gnss)
+{
+	cJSON *msg_obj = cJSON_CreateObject();
+	char *buffer = NULL;
+
+	if (!nrf_cloud_gnss_msg_json_encode(gnss, msg_obj)) {
+		buffer = cJSON_PrintUnformatted(msg_obj);
+	}
+	cJSON_Delete(msg_obj);
+
+	return buffer;
+}
+
+/* Test data */
+static struct lte_lc_ncell ncells[] = {
+	{ .earfcn = 6300, .phys_cell_id = 293, .rsrp = 29, .rsrq = 12, .time_diff = 24 },
+	{ .earfcn = 6300, .phys_cell_id = 11, .rsrp = NRF_CLOUD_LOCATION_CELL_OMIT_RSRP,
+	  .rsrq = 3, .time_diff = LTE_LC_CELL_TIME_DIFF_INVALID },
+	{ .earfcn = 1650, .phys_cell_id = 500, .rsrp = 0,
+	  .rsrq = NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ, .time_diff = -160 },
+};
+
+static struct lte_lc_cell gci_cells[] = {
+	{ .mcc = 242, .mnc = 1, .id = 0x0138F110, .tac = 0x76C1, .earfcn = 6300,
+	  .timing_advance = NRF_CLOUD_LOCATION_CELL_OMIT_TIME_ADV, .rsrp = 40, .rsrq = 20 },
+	{ .mcc = 242, .mnc = 12, .id = 0x0FFFFFFF, .tac = 0xFFFF,
+	  .earfcn = NRF_CLOUD_LOCATION_CELL_OMIT_EARFCN, .timing_advance = 60000,
+	  .rsrp = NRF_CLOUD_LOCATION_CELL_OMIT_RSRP, .rsrq = NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ },
+};
+
+static struct lte_lc_cells_info cells = {
+	.current_cell = {
+		.mcc = 242, .mnc = 2, .id = 20508943, .tac = 30401, .earfcn = 6300,
+		.timing_advance = 80, .rsrp = 55, .rsrq = 25
+	},
+	.ncells_count = ARRAY_SIZE(ncells),
+	.neighbor_cells = ncells,
+	.gci_cells_count = ARRAY_SIZE(gci_cells),
+	.gci_cells = gci_cells,
+};
+
+static struct lte_lc_cells_info single_cell = {
+	.current_cell = {
+		.mcc = 310, .mnc = 410, .id = 84426764, .tac = 2305,
+		.earfcn = NRF_CLOUD_LOCATION_CELL_OMIT_EARFCN,
+		.timing_advance = NRF_CLOUD_LOCATION_CELL_OMIT_TIME_ADV,
+		.rsrp = NRF_CLOUD_LOCATION_CELL_OMIT_RSRP, .rsrq = NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ
+	},
+};
+
+static struct wifi_scan_result aps[] = {
+	{ .mac = { 0x40, 0x01, 0x7a, 0xc9, 0x10, 0x22 }, .ssid = "Nordic Guest",
+	  .ssid_length = 12, .rssi = -62, .channel = 11 },
+	{ .mac = { 0xa8, 0x9c, 0xed, 0x00, 0x00, 0x01 }, .ssid = "\"quoted\"\\ssid\n",
+	  .ssid_length = 15, .rssi = NRF_CLOUD_LOCATION_WIFI_OMIT_RSSI, .channel = 1 },
+	{ .mac = { 0x00, 0x0c, 0x29, 0xff, 0xee, 0xdd }, .ssid_length = 0, .rssi = -91,
+	  .channel = NRF_CLOUD_LOCATION_WIFI_OMIT_CHAN },
+	{ .mac = { 0xfc, 0xfb, 0xfa, 0x01, 0x02, 0x03 }, .ssid = "ctrl\x01\x1f",
+	  .ssid_length = 6, .rssi = -45, .channel = 157 },
+};
+
+static struct wifi_scan_info wifi = {
+	.ap_info = aps,
+	.cnt = ARRAY_SIZE(aps),
+};
+
+static struct nrf_cloud_svc_info_fota fota = {
+	.bootloader = 1, .modem = 1, .application = 1, .modem_full = 1
+};
+
+static struct nrf_cloud_svc_info_ui ui = {
+	.air_pressure = 1, .gnss = 1, .flip = 0, .button = 1,
+	.temperature = 1, .humidity = 0, .light_sensor = 1, .rsrp = 1
+};
+
+static struct nrf_cloud_svc_info svc = { .fota = &fota, .ui = &ui };
+static struct nrf_cloud_svc_info svc_null = { .fota = NULL, .ui = NULL };
+
+static struct nrf_cloud_modem_info modem_all = {
+	.device = NRF_CLOUD_INFO_SET,
+	.network = NRF_CLOUD_INFO_SET,
+	.sim = NRF_CLOUD_INFO_SET,
+};
+
+static struct nrf_cloud_modem_info modem_mixed = {
+	.device = NRF_CLOUD_INFO_CLEAR,
+	.network = NRF_CLOUD_INFO_SET,
+	.sim = NRF_CLOUD_INFO_NO_CHANGE,
+};
+
+static const struct nrf_cloud_gnss_data gnss_pvt = {
+	.type = NRF_CLOUD_GNSS_TYPE_PVT,
+	.ts_ms = 1662044400123,
+	.pvt = {
+		.lat = 63.42118918, .lon = 10.43739987, .accuracy = 12.3f,
+		.alt = 153.75f, .has_alt = 1,
+		.speed = 0.1f, .has_speed = 1,
+		.heading = 0, .has_heading = 0
+	}
+};
+
+/* The codec checks the sentence is terminated within the maximum length */
+static const char nmea_sentence[NRF_MODEM_GNSS_NMEA_MAX_LEN] =
+	"$GPGGA,181908.00,3404.7041,N,07044.3966,W,4,13,1.00,495.1,M,29.2,M,0.10,0000*40";
+
+static const struct nrf_cloud_gnss_data gnss_nmea = {
+	.type = NRF_CLOUD_GNSS_TYPE_NMEA,
+	.ts_ms = NRF_CLOUD_NO_TIMESTAMP,
+	.nmea = {
+		.sentence = nmea_sentence
+	}
+};
+
+/* Every message type, encoded with the streaming writer and with cJSON */
+enum msg_type {
+	MSG_SENSOR,
+	MSG_DEVICE_STATUS,
+	MSG_LOCATION_REST,
+	MSG_LOCATION_MQTT,
+	MSG_GNSS,
+	MSG_TYPE_COUNT
+};
+
+static const char *const msg_type_str[] = {
+	[MSG_SENSOR] = "sensor data",
+	[MSG_DEVICE_STATUS] = "device status",
+	[MSG_LOCATION_REST] = "location (REST)",
+	[MSG_LOCATION_MQTT] = "location (MQTT)",
+	[MSG_GNSS] = "GNSS PVT",
+};
+
+static const struct nrf_cloud_device_status dev_status = { .modem = &modem_all, .svc = &svc };
+
+static const struct nrf_cloud_sensor_data sensor = {
+	.type = NRF_CLOUD_SENSOR_TEMP,
+	.data = { .ptr = "{\"temp\":\"23.5\",\n\"unit\":\"C\"}", .len = 28 },
+};
+
+static int encode(const enum msg_type type, char **out)
+{
+	struct nrf_cloud_data data;
+	int err;
+
+	switch (type) {
+	case MSG_SENSOR:
+		err = nrf_cloud_encode_sensor_data(&sensor, &data);
+		break;
+	case MSG_DEVICE_STATUS:
+		err = nrf_cloud_device_status_encode(&dev_status, &data, true);
+		break;
+	case MSG_LOCATION_REST:
+		return nrf_cloud_format_location_req(&cells, &wifi, out);
+	case MSG_LOCATION_MQTT:
+		err = nrf_cloud_location_req_msg_encode(&cells, &wifi, false, &data);
+		break;
+	case MSG_GNSS:
+		err = nrf_cloud_gnss_msg_encode(&gnss_pvt, &data);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if (!err) {
+		zassert_equal(data.len, strlen(data.ptr), "Invalid length");
+		*out = (char *)data.ptr;
+	}
+
+	return err;
+}
+
+static char *encode_ref(const enum msg_type type)
+{
+	switch (type) {
+	case MSG_SENSOR:
+		return ref_sensor_data(&sensor);
+	case MSG_DEVICE_STATUS:
+		return ref_device_status(&dev_status, true);
+	case MSG_LOCATION_REST:
+		return ref_location_req(&cells, &wifi);
+	case MSG_LOCATION_MQTT:
+		return ref_location_msg(&cells, &wifi, false);
+	case MSG_GNSS:
+		return ref_gnss_msg(&gnss_pvt);
+	default:
+		return NULL;
+	}
+}
+
+static void check_equal(char *out, char *ref)
+{
+	zassert_not_null(out, "Output not encoded");
+	zassert_not_null(ref, "Reference not encoded");
+	zassert_equal(strcmp(out, ref), 0, "Output differs from cJSON:\n%s\n%s", out, ref);
+
+	nrf_cloud_free(out);
+	cJSON_free(ref);
+}
+
+void *codec_test_setup(void)
+{
+	static struct nrf_cloud_os_mem_hooks hooks = {
+		.malloc_fn = test_malloc,
+		.calloc_fn = test_calloc,
+		.free_fn = test_free,
+	};
+
+	nrf_cloud_os_mem_hooks_init(&hooks);
+
+	return NULL;
+}
+
+void codec_test_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(heap_used, 0, "Memory leak: %zu bytes", heap_used);
+}
+
+ZTEST_SUITE(nrf_cloud_codec_test, NULL, codec_test_setup, NULL, codec_test_after, NULL);
+
+ZTEST(nrf_cloud_codec_test, test_sensor_data)
+{
+	struct nrf_cloud_data data;
+
+	zassert_ok(nrf_cloud_encode_sensor_data(&sensor, &data), NULL);
+	check_equal((char *)data.ptr, ref_sensor_data(&sensor));
+}
+
+ZTEST(nrf_cloud_codec_test, test_device_status)
+{
+	struct modem_param_info mpi;
+	struct nrf_cloud_modem_info modem_mpi = modem_all;
+	const struct nrf_cloud_device_status statuses[] = {
+		{ .modem = &modem_all, .svc = &svc },
+		{ .modem = &modem_mixed, .svc = &svc_null },
+		{ .modem = &modem_mpi, .svc = NULL },
+		{ .modem = NULL, .svc = &svc },
+		{ .modem = NULL, .svc = NULL },
+	};
+	struct nrf_cloud_data data;
+
+	modem_info_params_init(&mpi);
+	modem_info_params_get(&mpi);
+	mpi.device.board = "custom\x7f\x10" "board";
+	modem_mpi.mpi = &mpi;
+
+	for (size_t i = 0; i < ARRAY_SIZE(statuses); i++) {
+		for (int state = 0; state < 2; state++) {
+			zassert_ok(nrf_cloud_device_status_encode(&statuses[i], &data, state),
+				   "Encoding of status %zu failed", i);
+			check_equal((char *)data.ptr, ref_device_status(&statuses[i], state));
+		}
+	}
+
+	/* Section which can not be encoded */
+	mpi.device.app_name = NULL;
+	zassert_equal(nrf_cloud_device_status_encode(&statuses[2], &data, true), -EINVAL, NULL);
+	zassert_is_null(ref_device_status(&statuses[2], true), NULL);
+}
+
+ZTEST(nrf_cloud_codec_test, test_location_req)
+{
+	const struct lte_lc_cells_info *const cell_infos[] = { &cells, &single_cell, NULL };
+	const struct wifi_scan_info *const wifi_infos[] = { &wifi, NULL };
+	char *out;
+
+	for (size_t c = 0; c < ARRAY_SIZE(cell_infos); c++) {
+		for (size_t w = 0; w < ARRAY_SIZE(wifi_infos); w++) {
+			if (!cell_infos[c] && !wifi_infos[w]) {
+				zassert_equal(nrf_cloud_format_location_req(NULL, NULL, &out),
+					      -EINVAL, NULL);
+				continue;
+			}
+
+			zassert_ok(nrf_cloud_format_location_req(cell_infos[c], wifi_infos[w],
+								 &out), NULL);
+			check_equal(out, ref_location_req(cell_infos[c], wifi_infos[w]));
+		}
+	}
+}
+
+ZTEST(nrf_cloud_codec_test, test_location_msg)
+{
+	struct nrf_cloud_data data;
+
+	for (int request_loc = 0; request_loc < 2; request_loc++) {
+		zassert_ok(nrf_cloud_location_req_msg_encode(&cells, &wifi, request_loc, &data),
+			   NULL);
+		check_equal((char *)data.ptr, ref_location_msg(&cells, &wifi, request_loc));
+
+		zassert_ok(nrf_cloud_location_req_msg_encode(&single_cell, NULL, request_loc,
+							     &data), NULL);
+		check_equal((char *)data.ptr, ref_location_msg(&single_cell, NULL, request_loc));
+
+		zassert_ok(nrf_cloud_location_req_msg_encode(NULL, &wifi, request_loc, &data),
+			   NULL);
+		check_equal((char *)data.ptr, ref_location_msg(NULL, &wifi, request_loc));
+	}
+}
+
+ZTEST(nrf_cloud_codec_test, test_gnss_msg)
+{
+	struct nrf_cloud_gnss_data gnss = gnss_pvt;
+	struct nrf_cloud_data data;
+
+	zassert_ok(nrf_cloud_gnss_msg_encode(&gnss_pvt, &data), NULL);
+	check_equal((char *)data.ptr, ref_gnss_msg(&gnss_pvt));
+
+	zassert_ok(nrf_cloud_gnss_msg_encode(&gnss_nmea, &data), NULL);
+	check_equal((char *)data.ptr, ref_gnss_msg(&gnss_nmea));
+
+	/* Extreme values */
+	gnss.ts_ms = 0;
+	gnss.pvt.lat = -90.0;
+	gnss.pvt.lon = 1e-7;
+	gnss.pvt.accuracy = 1e30f;
+	gnss.pvt.heading = 359.99f;
+	gnss.pvt.has_heading = 1;
+	zassert_ok(nrf_cloud_gnss_msg_encode(&gnss, &data), NULL);
+	check_equal((char *)data.ptr, ref_gnss_msg(&gnss));
+
+	gnss.type = NRF_CLOUD_GNSS_TYPE_NMEA;
+	gnss.nmea.sentence = NULL;
+	zassert_equal(nrf_cloud_gnss_msg_encode(&gnss, &data), -EINVAL, NULL);
+
+	gnss.type = NRF_CLOUD_GNSS_TYPE_MODEM_NMEA + 1;
+	zassert_equal(nrf_cloud_gnss_msg_encode(&gnss, &data), -EPROTO, NULL);
+}
+
+ZTEST(nrf_cloud_codec_test, test_writer)
+{
+	struct nrf_cloud_json_writer w;
+	char buf[64];
+	int len;
+
+	/* Size computation */
+	nrf_cloud_json_writer_init(&w, NULL, 0);
+	nrf_cloud_json_obj_start(&w, NULL);
+	nrf_cloud_json_arr_start(&w, "a\"b");
+	nrf_cloud_json_num_add(&w, NULL, 0.5);
+	nrf_cloud_json_null_add(&w, NULL);
+	nrf_cloud_json_obj_start(&w, NULL);
+	nrf_cloud_json_obj_end(&w);
+	nrf_cloud_json_arr_end(&w);
+	nrf_cloud_json_str_add(&w, "s", "\r\n");
+	nrf_cloud_json_obj_end(&w);
+	len = nrf_cloud_json_writer_finish(&w);
+	zassert_equal(len, strlen("{\"a\\\"b\":[0.5,null,{}],\"s\":\"\\r\\n\"}"), NULL);
+
+	/* Buffer too small, including the NULL terminator */
+	nrf_cloud_json_writer_init(&w, buf, len);
+	nrf_cloud_json_obj_start(&w, NULL);
+	nrf_cloud_json_arr_start(&w, "a\"b");
+	nrf_cloud_json_num_add(&w, NULL, 0.5);
+	nrf_cloud_json_null_add(&w, NULL);
+	nrf_cloud_json_obj_start(&w, NULL);
+	nrf_cloud_json_obj_end(&w);
+	nrf_cloud_json_arr_end(&w);
+	nrf_cloud_json_str_add(&w, "s", "\r\n");
+	nrf_cloud_json_obj_end(&w);
+	zassert_equal(nrf_cloud_json_writer_finish(&w), -ENOBUFS, NULL);
+
+	/* Missing key in an object */
+	nrf_cloud_json_writer_init(&w, buf, sizeof(buf));
+	nrf_cloud_json_obj_start(&w, NULL);
+	zassert_equal(nrf_cloud_json_num_add(&w, NULL, 1), -EINVAL, NULL);
+
+	/* Key in an array */
+	nrf_cloud_json_writer_init(&w, buf, sizeof(buf));
+	nrf_cloud_json_arr_start(&w, NULL);
+	zassert_equal(nrf_cloud_json_num_add(&w, "key", 1), -EINVAL, NULL);
+
+	/* Mismatched and missing ends */
+	nrf_cloud_json_writer_init(&w, buf, sizeof(buf));
+	nrf_cloud_json_arr_start(&w, NULL);
+	zassert_equal(nrf_cloud_json_obj_end(&w), -EINVAL, NULL);
+
+	nrf_cloud_json_writer_init(&w, buf, sizeof(buf));
+	nrf_cloud_json_obj_start(&w, NULL);
+	zassert_equal(nrf_cloud_json_writer_finish(&w), -EINVAL, NULL);
+
+	/* Second root value */
+	nrf_cloud_json_writer_init(&w, buf, sizeof(buf));
+	nrf_cloud_json_null_add(&w, NULL);
+	zassert_equal(nrf_cloud_json_null_add(&w, NULL), -EINVAL, NULL);
+}
+
+ZTEST(nrf_cloud_codec_test, test_encode_performance)
+{
+	TC_PRINT("%-16s %6s %12s %12s %12s %12s\n", "message", "bytes",
+		 "heap (B)", "cJSON heap", "time (us)", "cJSON time");
+
+	for (enum msg_type type = 0; type < MSG_TYPE_COUNT; type++) {
+		size_t peak;
+		size_t ref_peak;
+		uint32_t start;
+		uint64_t cycles = 0;
+		uint64_t ref_cycles = 0;
+		char *out;
+		char *ref;
+		size_t len;
+
+		for (int i = 0; i < PERF_ITERATIONS; i++) {
+			heap_peak_reset();
+			start = k_cycle_get_32();
+			zassert_ok(encode(type, &out), NULL);
+			cycles += k_cycle_get_32() - start;
+			peak = heap_peak - heap_used + strlen(out) + 1;
+			len = strlen(out);
+			nrf_cloud_free(out);
+
+			heap_peak_reset();
+			start = k_cycle_get_32();
+			ref = encode_ref(type);
+			ref_cycles += k_cycle_get_32() - start;
+			zassert_not_null(ref, NULL);
+			ref_peak = heap_peak - heap_used + strlen(ref) + 1;
+			cJSON_free(ref);
+		}
+
+		TC_PRINT("%-16s %6zu %12zu %12zu %12llu %12llu\n", msg_type_str[type], len,
+			 peak, ref_peak,
+			 k_cyc_to_us_floor64(cycles / PERF_ITERATIONS),
+			 k_cyc_to_us_floor64(ref_cycles / PERF_ITERATIONS));
+
+		/* Only the output itself is allocated */
+		zassert_equal(peak, len + 1, "Unexpected allocation");
+		zassert_true(peak < ref_peak, NULL);
+	}
+}
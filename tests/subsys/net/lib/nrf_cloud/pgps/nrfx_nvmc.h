@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* nrfx is not available on native_posix; the test provides the function used */
+#ifndef NRFX_NVMC_H__
+#define NRFX_NVMC_H__
+
+#include <stdint.h>
+
+uint32_t nrfx_nvmc_flash_page_size_get(void);
+
+#endif /* NRFX_NVMC_H__ */
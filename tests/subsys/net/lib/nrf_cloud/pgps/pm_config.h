@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* generated file replaced to simplify building the test; predictions are
+ * stored in the flash area simulated by the test
+ */
+#ifndef PM_CONFIG_H__
+#define PM_CONFIG_H__
+#endif /* PM_CONFIG_H__ */
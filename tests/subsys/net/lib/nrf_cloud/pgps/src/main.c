@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) 2022 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/storage/stream_flash.h>
+#include <net/download_client.h>
+
+/* Predictions are stored in a flash area simulated by the test, instead of a partition */
+#define SIM_FLASH_AREA_ID	1
+#define SIM_FLASH_OFFSET	0x100000
+#define SIM_FLASH_PAGE_SIZE	4096
+
+static const struct device sim_flash_dev = {
+	.name = "sim_flash",
+};
+
+#define FLASH_MAP_PM_H_
+#undef FLASH_AREA_ID
+#undef FLASH_AREA_DEVICE
+#define FLASH_AREA_ID(label) SIM_FLASH_AREA_ID
+#define FLASH_AREA_DEVICE(label) (&sim_flash_dev)
+
+#include "nrf_cloud_pgps.c"
+
+/* Time of reading from the simulated flash, like an external flash on an 8 MHz SPI bus */
+#define SIM_FLASH_READ_SETUP_US	20
+#define SIM_FLASH_READ_BYTE_NS	1000
+
+#define START_DAY		15000
+#define START_TIME		0
+#define CUR_PNUM		10
+#define LOOKUPS			100
+
+static uint8_t sim_flash[NUM_BLOCKS * BLOCK_SIZE];
+static size_t sim_write_off;
+
+static const struct flash_area sim_flash_area = {
+	.fa_id = SIM_FLASH_AREA_ID,
+	.fa_off = SIM_FLASH_OFFSET,
+	.fa_size = sizeof(sim_flash),
+	.fa_dev = &sim_flash_dev,
+};
+
+static struct {
+	uint32_t reads;
+	uint32_t bytes;
+	uint32_t cycles;
+} flash_stats;
+
+static int64_t test_unix_time_ms;
+
+static enum nrf_cloud_pgps_event_type last_evt_type;
+static uint16_t requested_count;
+
+uint32_t nrfx_nvmc_flash_page_size_get(void)
+{
+	return SIM_FLASH_PAGE_SIZE;
+}
+
+int flash_area_open(uint8_t id, const struct flash_area **fa)
+{
+	zassert_equal(id, SIM_FLASH_AREA_ID, "Unexpected flash area %u", id);
+	*fa = &sim_flash_area;
+
+	return 0;
+}
+
+int flash_area_read(const struct flash_area *fa, off_t off, void *dst, size_t len)
+{
+	zassert_true((off >= 0) && (off + len <= sizeof(sim_flash)),
+		     "Read of %zu bytes at 0x%lx out of flash area", len, (long)off);
+
+	k_busy_wait(SIM_FLASH_READ_SETUP_US + (len * SIM_FLASH_READ_BYTE_NS) / NSEC_PER_USEC);
+	memcpy(dst, &sim_flash[off], len);
+
+	flash_stats.reads++;
+	flash_stats.bytes += len;
+
+	return 0;
+}
+
+int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev, uint8_t *buf,
+		      size_t buf_len, size_t offset, size_t size, stream_flash_callback_t cb)
+{
+	zassert_equal_ptr(fdev, &sim_flash_dev, "Unexpected flash device");
+	zassert_true((offset >= SIM_FLASH_OFFSET) &&
+		     (offset + size <= SIM_FLASH_OFFSET + sizeof(sim_flash)),
+		     "Stream of %zu bytes at 0x%zx out of flash area", size, offset);
+
+	sim_write_off = offset - SIM_FLASH_OFFSET;
+
+	return 0;
+}
+
+int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data, size_t len,
+				bool flush)
+{
+	zassert_true(sim_write_off + len <= sizeof(sim_flash), "Write out of flash area");
+
+	memcpy(&sim_flash[sim_write_off], data, len);
+	sim_write_off += len;
+
+	return 0;
+}
+
+int date_time_now(int64_t *unix_time_ms)
+{
+	*unix_time_ms = test_unix_time_ms;
+
+	return 0;
+}
+
+int nrf_cloud_agps_process(const char *buf, size_t buf_len)
+{
+	return 0;
+}
+
+void nrf_cloud_agps_processed(struct nrf_modem_gnss_agps_data_frame *received_elements)
+{
+	memset(received_elements, 0, sizeof(*received_elements));
+}
+
+int download_client_init(struct download_client *client, download_client_callback_t callback)
+{
+	return 0;
+}
+
+int download_client_connect(struct download_client *client, const char *host,
+			    const struct download_client_cfg *config)
+{
+	return -ENOTSUP;
+}
+
+int download_client_start(struct download_client *client, const char *file, size_t from)
+{
+	return -ENOTSUP;
+}
+
+int download_client_disconnect(struct download_client *client)
+{
+	return 0;
+}
+
+/* Settings backend keeping the settings in RAM, over simulated reboots */
+static struct ram_setting {
+	char name[SETTINGS_MAX_NAME_LEN + 1];
+	uint8_t value[64];
+	size_t len;
+} ram_settings[4];
+
+static ssize_t ram_settings_read_cb(void *cb_arg, void *data, size_t len)
+{
+	struct ram_setting *setting = cb_arg;
+
+	len = MIN(len, setting->len);
+	memcpy(data, setting->value, len);
+
+	return len;
+}
+
+static int ram_settings_load(struct settings_store *cs, const struct settings_load_arg *arg)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(ram_settings); i++) {
+		if (ram_settings[i].name[0] != '\0') {
+			settings_call_set_handler(ram_settings[i].name, ram_settings[i].len,
+						  ram_settings_read_cb, &ram_settings[i], arg);
+		}
+	}
+
+	return 0;
+}
+
+static int ram_settings_save(struct settings_store *cs, const char *name, const char *value,
+			     size_t val_len)
+{
+	struct ram_setting *setting = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(ram_settings); i++) {
+		if (!strcmp(ram_settings[i].name, name)) {
+			setting = &ram_settings[i];
+			break;
+		}
+		if ((setting == NULL) && (ram_settings[i].name[0] == '\0')) {
+			setting = &ram_settings[i];
+		}
+	}
+
+	zassert_not_null(setting, "No space for setting %s", name);
+	zassert_true(val_len <= sizeof(setting->value), "Setting %s too long", name);
+
+	if (val_len == 0) {
+		/* deleted */
+		memset(setting, 0, sizeof(*setting));
+		return 0;
+	}
+
+	strncpy(setting->name, name, sizeof(setting->name) - 1);
+	memcpy(setting->value, value, val_len);
+	setting->len = val_len;
+
+	return 0;
+}
+
+static const struct settings_store_itf ram_settings_itf = {
+	.csi_load = ram_settings_load,
+	.csi_save = ram_settings_save,
+};
+
+static struct settings_store ram_settings_store = {
+	.cs_itf = &ram_settings_itf,
+};
+
+int settings_backend_init(void)
+{
+	settings_dst_register(&ram_settings_store);
+	settings_src_register(&ram_settings_store);
+
+	return 0;
+}
+
+static void pgps_event_handler(struct nrf_cloud_pgps_event *event)
+{
+	last_evt_type = event->type;
+
+	if (event->type == PGPS_EVT_REQUEST) {
+		requested_count = event->request->prediction_count;
+	}
+}
+
+static int64_t prediction_gps_sec(int pnum)
+{
+	return npgps_gps_day_time_to_sec(START_DAY, START_TIME) +
+	       (int64_t)pnum * PREDICTION_PERIOD * SEC_PER_MIN;
+}
+
+/* Set the current time to the middle of the validity period of a prediction */
+static void set_time(int pnum)
+{
+	int64_t gps_sec = prediction_gps_sec(pnum) + (PREDICTION_PERIOD * SEC_PER_MIN) / 2;
+
+	/* the library looks up predictions for a shifted time */
+	gps_sec -= PREDICTION_MIDPOINT_SHIFT_SEC;
+
+	test_unix_time_ms = (gps_sec - GPS_TO_UTC_LEAP_SECONDS + GPS_TO_UNIX_UTC_OFFSET_SECONDS) *
+			    MSEC_PER_SEC;
+}
+
+static void flash_stats_reset(void)
+{
+	memset(&flash_stats, 0, sizeof(flash_stats));
+	flash_stats.cycles = k_cycle_get_32();
+}
+
+static uint32_t flash_stats_print(const char *what)
+{
+	uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - flash_stats.cycles);
+
+	TC_PRINT("%s: %u flash reads, %u bytes, %u us\n", what, flash_stats.reads,
+		 flash_stats.bytes, us);
+
+	return us;
+}
+
+static void boot(void)
+{
+	struct nrf_cloud_pgps_init_param param = {
+		.event_handler = pgps_event_handler,
+		.storage_base = SIM_FLASH_OFFSET,
+		.storage_size = sizeof(sim_flash),
+	};
+
+	zassert_ok(nrf_cloud_pgps_init(&param), "Init failed");
+}
+
+static void prediction_dl_make(int pnum, uint8_t *buf)
+{
+	struct nrf_cloud_pgps_prediction p = {
+		.time_type = NRF_CLOUD_AGPS_GPS_SYSTEM_CLOCK,
+		.time_count = 1,
+		.ephemeris_type = NRF_CLOUD_AGPS_EPHEMERIDES,
+		.ephemeris_count = NRF_CLOUD_PGPS_NUM_SV,
+	};
+	uint16_t gps_day;
+	uint32_t gps_time_of_day;
+	size_t schema_offset = offsetof(struct nrf_cloud_pgps_prediction, schema_version);
+
+	npgps_gps_sec_to_day_time(prediction_gps_sec(pnum), &gps_day, &gps_time_of_day);
+	p.time.date_day = gps_day;
+	p.time.time_full_s = gps_time_of_day;
+
+	for (int i = 0; i < NRF_CLOUD_PGPS_NUM_SV; i++) {
+		p.ephemerii[i].sv_id = i + 1;
+		p.ephemerii[i].toe = pnum;
+	}
+
+	/* schema version and sentinel are not downloaded */
+	memcpy(buf, &p, schema_offset);
+	memcpy(&buf[schema_offset], &p.ephemeris_type, PGPS_PREDICTION_DL_SIZE - schema_offset);
+}
+
+/* Boot with nothing stored, and download the requested predictions */
+static void boot_and_download(void)
+{
+	static uint8_t buf[PGPS_PREDICTION_DL_SIZE];
+	struct nrf_cloud_pgps_header header = {
+		.schema_version = NRF_CLOUD_PGPS_BIN_SCHEMA_VERSION,
+		.array_type = NRF_CLOUD_PGPS_PREDICTION_HEADER,
+		.num_items = 1,
+		.prediction_count = NUM_PREDICTIONS,
+		.prediction_size = PGPS_PREDICTION_DL_SIZE,
+		.prediction_period_min = PREDICTION_PERIOD,
+		.gps_day = START_DAY,
+		.gps_time_of_day = START_TIME,
+	};
+	const struct npgps_block_map *map;
+
+	boot();
+	zassert_equal(last_evt_type, PGPS_EVT_REQUEST, "Predictions not requested");
+	zassert_equal(requested_count, NUM_PREDICTIONS, "Wrong number of predictions requested");
+
+	zassert_ok(nrf_cloud_pgps_begin_update(), "Begin update failed");
+	zassert_ok(nrf_cloud_pgps_process_update((uint8_t *)&header, sizeof(header)),
+		   "Header not accepted");
+	for (int pnum = 0; pnum < NUM_PREDICTIONS; pnum++) {
+		prediction_dl_make(pnum, buf);
+		zassert_ok(nrf_cloud_pgps_process_update(buf, sizeof(buf)),
+			   "Prediction %d not accepted", pnum);
+	}
+	zassert_ok(nrf_cloud_pgps_finish_update(), "Finish update failed");
+	zassert_equal(last_evt_type, PGPS_EVT_READY, "Predictions not ready");
+
+	map = npgps_get_saved_block_map();
+	zassert_equal(map->prediction_count, NUM_PREDICTIONS, "Block map not saved");
+	zassert_equal(map->gps_day, START_DAY, "Wrong block map day");
+	zassert_equal(map->gps_time_of_day, START_TIME, "Wrong block map time");
+	for (int pnum = 0; pnum < NUM_PREDICTIONS; pnum++) {
+		zassert_equal(map->blocks[pnum], pnum, "Wrong block of prediction %d", pnum);
+	}
+}
+
+static void assert_current_prediction(int pnum)
+{
+	struct nrf_cloud_pgps_prediction *p;
+
+	zassert_equal(nrf_cloud_pgps_find_prediction(&p), pnum, "Prediction %d not found", pnum);
+	zassert_equal(p->ephemerii[0].toe, pnum, "Wrong prediction data");
+}
+
+static void *suite_setup(void)
+{
+	zassert_ok(settings_subsys_init(), "Settings init failed");
+
+	return NULL;
+}
+
+static void before_each(void *fixture)
+{
+	struct nrf_cloud_pgps_header erased = {0};
+
+	/* simulate erased flash and settings, and a device that was just reset */
+	memset(sim_flash, 0xff, sizeof(sim_flash));
+	(void)npgps_delete_block_map();
+	zassert_ok(npgps_save_header(&erased), "Saving header failed");
+
+	k_timer_stop(&prediction_timer);
+	atomic_set(&pgps_need_assistance, false);
+	state = PGPS_NONE;
+
+	last_evt_type = PGPS_EVT_INIT;
+	requested_count = 0;
+	set_time(CUR_PNUM);
+}
+
+ZTEST(nrf_cloud_pgps, test_boot_with_block_map)
+{
+	boot_and_download();
+
+	flash_stats_reset();
+	boot();
+	flash_stats_print("Boot with block map");
+
+	zassert_equal(last_evt_type, PGPS_EVT_AVAILABLE, "Prediction not available");
+	zassert_true(index.restored, "Block map not used");
+
+	/* only the current prediction is read, when it is found at boot */
+	zassert_equal(flash_stats.reads, 1, "Stored predictions read at boot");
+	zassert_equal(flash_stats.bytes, PGPS_PREDICTION_STORAGE_SIZE,
+		      "Stored predictions read at boot");
+	for (int pnum = 0; pnum < NUM_PREDICTIONS; pnum++) {
+		zassert_equal(index.validated[pnum], pnum == CUR_PNUM,
+			      "Prediction %d validated before use", pnum);
+	}
+
+	assert_current_prediction(CUR_PNUM);
+}
+
+ZTEST(nrf_cloud_pgps, test_boot_without_block_map)
+{
+	uint32_t walk_us;
+	uint32_t restore_us;
+
+	boot_and_download();
+
+	/* as after an update from a version of the library that did not save it */
+	zassert_ok(npgps_delete_block_map(), "Deleting block map failed");
+
+	flash_stats_reset();
+	boot();
+	walk_us = flash_stats_print("Boot without block map");
+
+	zassert_equal(last_evt_type, PGPS_EVT_AVAILABLE, "Prediction not available");
+	zassert_false(index.restored, "Block map used");
+
+	/* start and sentinel of each prediction, and then the current prediction */
+	zassert_equal(flash_stats.reads, 2 * NUM_PREDICTIONS + 1, "Wrong number of flash reads");
+	zassert_equal(npgps_get_saved_block_map()->prediction_count, NUM_PREDICTIONS,
+		      "Block map not saved after validating all predictions");
+
+	flash_stats_reset();
+	boot();
+	restore_us = flash_stats_print("Next boot");
+
+	zassert_true(index.restored, "Block map not used");
+	zassert_equal(flash_stats.reads, 1, "Stored predictions read at boot");
+	zassert_true(restore_us < walk_us, "Boot not faster with block map");
+
+	assert_current_prediction(CUR_PNUM);
+}
+
+ZTEST(nrf_cloud_pgps, test_repeated_lookups)
+{
+	boot_and_download();
+	boot();
+
+	flash_stats_reset();
+	for (int i = 0; i < LOOKUPS; i++) {
+		assert_current_prediction(CUR_PNUM);
+	}
+	flash_stats_print("Lookups of the current prediction");
+
+	zassert_equal(flash_stats.reads, 0, "Cached prediction read again");
+
+	/* each prediction is read once when the time moves on, and validated when first used */
+	flash_stats_reset();
+	for (int pnum = CUR_PNUM + 1; pnum < NUM_PREDICTIONS; pnum++) {
+		set_time(pnum);
+		for (int i = 0; i < LOOKUPS; i++) {
+			assert_current_prediction(pnum);
+		}
+		zassert_true(index.validated[pnum], "Prediction %d not validated", pnum);
+	}
+	flash_stats_print("Lookups of the following predictions");
+
+	zassert_equal(flash_stats.reads, NUM_PREDICTIONS - CUR_PNUM - 1,
+		      "Wrong number of flash reads");
+
+	/* with one cached prediction, lookups alternating around a prediction
+	 * boundary read a prediction each time
+	 */
+	flash_stats_reset();
+	for (int i = 0; i < LOOKUPS; i++) {
+		set_time(CUR_PNUM + (i & 1));
+		assert_current_prediction(CUR_PNUM + (i & 1));
+	}
+	flash_stats_print("Lookups alternating around a boundary");
+
+	zassert_equal(flash_stats.reads, LOOKUPS, "Wrong number of flash reads");
+}
+
+ZTEST(nrf_cloud_pgps, test_bad_prediction_found_on_use)
+{
+	uint32_t sentinel = 0;
+
+	boot_and_download();
+
+	/* corrupt the current prediction, stored in the block of the same number */
+	memcpy(&sim_flash[CUR_PNUM * BLOCK_SIZE + offsetof(struct nrf_cloud_pgps_prediction,
+							    sentinel)],
+	       &sentinel, sizeof(sentinel));
+
+	flash_stats_reset();
+	boot();
+	flash_stats_print("Boot with bad prediction");
+
+	/* all stored predictions are checked again, and the bad one and the
+	 * following ones are requested
+	 */
+	zassert_false(index.restored, "Block map still used");
+	zassert_equal(npgps_get_saved_block_map()->prediction_count, 0, "Block map not deleted");
+	zassert_equal(last_evt_type, PGPS_EVT_REQUEST, "Predictions not requested");
+	zassert_equal(requested_count, NUM_PREDICTIONS - CUR_PNUM,
+		      "Wrong number of predictions requested");
+}
+
+ZTEST_SUITE(nrf_cloud_pgps, NULL, suite_setup, before_each, NULL, NULL);
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include <nrf_rpc.h>
+#include <nrf_rpc_tr.h>
+#include <nrf_rpc_os.h>
+
+/* Packet layout used by the test: nRF RPC header followed by a sequence number. */
+#define PACKET_ID_OFFSET  2
+#define PACKET_SEQ_OFFSET 5
+#define PACKET_LEN        7
+
+#define ID_FAST 1
+#define ID_SLOW 2
+#define ID_GATE 3
+
+#define FAST_HANDLER_US 50
+#define SLOW_HANDLER_US 2000
+
+#define BENCH_PACKETS   200
+#define BENCH_SLOW_STEP 10
+
+#define HIGH_PRIO (CONFIG_NRF_RPC_THREAD_PRIORITY - 1)
+
+static const struct nrf_rpc_tr fast_tr;
+static const struct nrf_rpc_tr slow_tr;
+static const struct nrf_rpc_group fast_group = { .transport = &fast_tr };
+static const struct nrf_rpc_group slow_group = { .transport = &slow_tr };
+
+static uint8_t packets[BENCH_PACKETS][PACKET_LEN];
+static uint32_t sent_at[BENCH_PACKETS];
+static uint32_t latency_us[BENCH_PACKETS];
+
+static uint16_t order[BENCH_PACKETS];
+static atomic_t handled_cnt;
+
+static K_SEM_DEFINE(gate_sem, 0, 1);
+static K_SEM_DEFINE(done_sem, 0, BENCH_PACKETS);
+
+static void pool_handler(const uint8_t *data, size_t len)
+{
+	uint16_t seq = sys_get_le16(&data[PACKET_SEQ_OFFSET]);
+	atomic_val_t pos;
+
+	switch (data[PACKET_ID_OFFSET]) {
+	case ID_GATE:
+		k_sem_take(&gate_sem, K_FOREVER);
+		break;
+	case ID_SLOW:
+		k_busy_wait(SLOW_HANDLER_US);
+		break;
+	default:
+		k_busy_wait(FAST_HANDLER_US);
+		break;
+	}
+
+	latency_us[seq] = k_cyc_to_us_floor32(k_cycle_get_32() - sent_at[seq]);
+
+	pos = atomic_inc(&handled_cnt);
+	order[pos] = seq;
+
+	k_sem_give(&done_sem);
+}
+
+static void packet_send(const struct nrf_rpc_tr *transport, uint8_t id, uint16_t seq)
+{
+	uint8_t *packet = packets[seq];
+
+	memset(packet, 0, PACKET_LEN);
+	packet[PACKET_ID_OFFSET] = id;
+	sys_put_le16(seq, &packet[PACKET_SEQ_OFFSET]);
+
+	sent_at[seq] = k_cycle_get_32();
+
+	nrf_rpc_os_rx_begin(transport);
+	nrf_rpc_os_thread_pool_send(packet, PACKET_LEN);
+	nrf_rpc_os_rx_end();
+}
+
+static void wait_handled(size_t cnt)
+{
+	for (size_t i = 0; i < cnt; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(10)), "Packet not handled");
+	}
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static uint32_t fast_latency_percentile(size_t cnt, unsigned int percentile)
+{
+	static uint32_t sorted[BENCH_PACKETS];
+	size_t n = 0;
+
+	for (size_t i = 0; i < cnt; i++) {
+		if (i % BENCH_SLOW_STEP) {
+			sorted[n++] = latency_us[i];
+		}
+	}
+
+	qsort(sorted, n, sizeof(sorted[0]), cmp_u32);
+
+	return sorted[(n * percentile) / 100 - 1];
+}
+
+/* Sends a burst of fast commands with every BENCH_SLOW_STEP-th one slow and
+ * reports the throughput and the fast command latency.
+ */
+static uint32_t bench_run(const char *name)
+{
+	uint32_t start = k_cycle_get_32();
+	uint32_t elapsed_us;
+
+	for (uint16_t seq = 0; seq < BENCH_PACKETS; seq++) {
+		if (seq % BENCH_SLOW_STEP) {
+			packet_send(&fast_tr, ID_FAST, seq);
+		} else {
+			packet_send(&slow_tr, ID_SLOW, seq);
+		}
+	}
+
+	wait_handled(BENCH_PACKETS);
+
+	elapsed_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	TC_PRINT("%s: %u packets/s, fast latency p50 %u us p99 %u us\n", name,
+		 (uint32_t)(BENCH_PACKETS * 1000000ULL / MAX(elapsed_us, 1)),
+		 fast_latency_percentile(BENCH_PACKETS, 50),
+		 fast_latency_percentile(BENCH_PACKETS, 99));
+
+	return fast_latency_percentile(BENCH_PACKETS, 99);
+}
+
+static void *suite_setup(void)
+{
+	zassert_ok(nrf_rpc_os_init(pool_handler), "Init failed");
+
+	return NULL;
+}
+
+static void before_each(void *fixture)
+{
+	atomic_set(&handled_cnt, 0);
+	k_sem_reset(&done_sem);
+	zassert_ok(nrf_rpc_os_group_priority_set(&fast_group, CONFIG_NRF_RPC_THREAD_PRIORITY));
+	zassert_ok(nrf_rpc_os_group_priority_set(&slow_group, CONFIG_NRF_RPC_THREAD_PRIORITY));
+}
+
+ZTEST(nrf_rpc_thread_pool, test_arrival_order)
+{
+	for (uint16_t seq = 0; seq < CONFIG_NRF_RPC_THREAD_POOL_INBOX_SIZE; seq++) {
+		packet_send(&fast_tr, ID_FAST, seq);
+	}
+
+	wait_handled(CONFIG_NRF_RPC_THREAD_POOL_INBOX_SIZE);
+
+	/* Equal priority packets are started in the order of arrival. With
+	 * several pool threads they may finish out of order by at most the
+	 * number of threads.
+	 */
+	for (uint16_t i = 0; i < CONFIG_NRF_RPC_THREAD_POOL_INBOX_SIZE; i++) {
+		zassert_true(abs((int)order[i] - (int)i) < CONFIG_NRF_RPC_THREAD_POOL_SIZE,
+			     "Packet %u handled at %u", order[i], i);
+	}
+}
+
+ZTEST(nrf_rpc_thread_pool, test_group_priority)
+{
+	zassert_ok(nrf_rpc_os_group_priority_set(&fast_group, HIGH_PRIO));
+
+	/* Keep every pool thread busy, so that the next packets wait in the inbox. */
+	for (uint16_t seq = 0; seq < CONFIG_NRF_RPC_THREAD_POOL_SIZE; seq++) {
+		packet_send(&slow_tr, ID_GATE, seq);
+	}
+
+	k_sleep(K_MSEC(1));
+
+	packet_send(&slow_tr, ID_SLOW, 10);
+	packet_send(&slow_tr, ID_SLOW, 11);
+	packet_send(&fast_tr, ID_FAST, 12);
+
+	/* Release one pool thread, it takes the high priority packet first. */
+	k_sem_give(&gate_sem);
+	k_sleep(K_MSEC(1));
+
+	zassert_true(order[0] < CONFIG_NRF_RPC_THREAD_POOL_SIZE);
+	zassert_equal(order[1], 12, "High priority packet not taken first");
+
+	for (uint16_t i = 1; i < CONFIG_NRF_RPC_THREAD_POOL_SIZE; i++) {
+		k_sem_give(&gate_sem);
+	}
+
+	wait_handled(CONFIG_NRF_RPC_THREAD_POOL_SIZE + 3);
+}
+
+ZTEST(nrf_rpc_thread_pool, test_group_priority_invalid)
+{
+	static const struct nrf_rpc_group no_transport_group;
+
+	zassert_equal(nrf_rpc_os_group_priority_set(NULL, HIGH_PRIO), -NRF_EINVAL);
+	zassert_equal(nrf_rpc_os_group_priority_set(&no_transport_group, HIGH_PRIO),
+		      -NRF_EINVAL);
+}
+
+ZTEST(nrf_rpc_thread_pool, test_benchmark_mixed)
+{
+	uint32_t p99_default;
+	uint32_t p99_prio;
+
+	p99_default = bench_run("Default priority");
+
+	before_each(NULL);
+	zassert_ok(nrf_rpc_os_group_priority_set(&fast_group, HIGH_PRIO));
+
+	p99_prio = bench_run("Fast group high priority");
+
+	/* Fast commands no longer wait behind slow ones queued before them. */
+	zassert_true(p99_prio <= p99_default, "Priority increased fast latency (%u > %u us)",
+		     p99_prio, p99_default);
+}
+
+ZTEST_SUITE(nrf_rpc_thread_pool, NULL, suite_setup, before_each, NULL, NULL);